@@ -25,8 +25,11 @@
 #include "object.h"
 #include "pointer.h"
 #include "singleton.h"
+#include "startup-profiler.h"
 
+#include <map>
 #include <sstream>
+#include <unordered_map>
 
 /**
  * \file
@@ -311,6 +314,134 @@ ArrayMatcher::StringToUint32(std::string str, uint32_t* value) const
     return !iss.bad() && !iss.fail();
 }
 
+/**
+ * \ingroup config-impl
+ * Index of the objects of the containers registered with
+ * Config::IndexContainer.
+ */
+class ContainerIndex
+{
+  public:
+    /**
+     * Register a container.
+     *
+     * \param [in] owner The object owning the container.
+     * \param [in] name The name of the container attribute.
+     */
+    void Add(const Object* owner, std::string name);
+    /**
+     * Add an object to a registered container.
+     *
+     * \param [in] owner The object owning the container.
+     * \param [in] name The name of the container attribute.
+     * \param [in] index The index of the object in the container.
+     * \param [in] object The object.
+     */
+    void NotifyAdded(const Object* owner,
+                     std::string name,
+                     std::size_t index,
+                     Ptr<Object> object);
+    /**
+     * Remove all the registered containers of an object.
+     *
+     * \param [in] owner The object owning the containers.
+     */
+    void Remove(const Object* owner);
+    /**
+     * Get the objects of a container, reading them on the first call.
+     *
+     * \param [in] owner The object owning the container.
+     * \param [in] name The name of the container attribute.
+     * \returns The objects, at their index in the container, or
+     *          \c nullptr if the container is not registered.
+     */
+    const std::vector<Ptr<Object>>* Lookup(Ptr<Object> owner, const std::string& name);
+
+  private:
+    /** The index of one container. */
+    struct Container
+    {
+        bool loaded{false};                //!< The objects were read from the owner.
+        std::vector<Ptr<Object>> objects; //!< The objects, null where there is none.
+    };
+
+    /** The registered containers, by owner and name. */
+    std::unordered_map<const Object*, std::map<std::string, Container>> m_containers;
+
+}; // class ContainerIndex
+
+void
+ContainerIndex::Add(const Object* owner, std::string name)
+{
+    NS_LOG_FUNCTION(this << owner << name);
+    m_containers[owner][name] = Container();
+}
+
+void
+ContainerIndex::NotifyAdded(const Object* owner,
+                            std::string name,
+                            std::size_t index,
+                            Ptr<Object> object)
+{
+    NS_LOG_FUNCTION(this << owner << name << index << object);
+    auto i = m_containers.find(owner);
+    if (i == m_containers.end())
+    {
+        return;
+    }
+    auto j = i->second.find(name);
+    if (j == i->second.end() || !j->second.loaded)
+    {
+        // The objects will all be read on the first lookup.
+        return;
+    }
+    std::vector<Ptr<Object>>& objects = j->second.objects;
+    if (index >= objects.size())
+    {
+        objects.resize(index + 1);
+    }
+    objects[index] = object;
+}
+
+void
+ContainerIndex::Remove(const Object* owner)
+{
+    NS_LOG_FUNCTION(this << owner);
+    m_containers.erase(owner);
+}
+
+const std::vector<Ptr<Object>>*
+ContainerIndex::Lookup(Ptr<Object> owner, const std::string& name)
+{
+    NS_LOG_FUNCTION(this << owner << name);
+    auto i = m_containers.find(PeekPointer(owner));
+    if (i == m_containers.end())
+    {
+        return nullptr;
+    }
+    auto j = i->second.find(name);
+    if (j == i->second.end())
+    {
+        return nullptr;
+    }
+    Container& container = j->second;
+    if (!container.loaded)
+    {
+        ObjectPtrContainerValue value;
+        owner->GetAttribute(name, value);
+        for (auto k = value.Begin(); k != value.End(); ++k)
+        {
+            if (k->first >= container.objects.size())
+            {
+                container.objects.resize(k->first + 1);
+            }
+            container.objects[k->first] = k->second;
+        }
+        container.loaded = true;
+    }
+    return &container.objects;
+}
+
 /**
  * \ingroup config-impl
  * Abstract class to parse Config paths into object references.
@@ -322,8 +453,9 @@ class Resolver
      * Construct from a base Config path.
      *
      * \param [in] path The Config path.
+     * \param [in] index The index of the containers, if any.
      */
-    Resolver(std::string path);
+    Resolver(std::string path, ContainerIndex* index = nullptr);
     /** Destructor. */
     virtual ~Resolver();
 
@@ -354,6 +486,13 @@ class Resolver
      * \param [in,out] vector The resulting list of matching objects.
      */
     void DoArrayResolve(std::string path, const ObjectPtrContainerValue& vector);
+    /**
+     * Parse an index on the Config path, in an indexed container.
+     *
+     * \param [in] path The remaining Config path.
+     * \param [in] objects The objects of the container.
+     */
+    void DoIndexedArrayResolve(std::string path, const std::vector<Ptr<Object>>& objects);
     /**
      * Handle one object found on the path.
      *
@@ -378,11 +517,14 @@ class Resolver
     std::vector<std::string> m_workStack;
     /** The Config path. */
     std::string m_path;
+    /** The index of the containers, or \c nullptr. */
+    ContainerIndex* m_index;
 
 }; // class Resolver
 
-Resolver::Resolver(std::string path)
-    : m_path(path)
+Resolver::Resolver(std::string path, ContainerIndex* index)
+    : m_path(path),
+      m_index(index)
 {
     NS_LOG_FUNCTION(this << path);
     Canonicalize();
@@ -582,10 +724,19 @@ Resolver::DoResolve(std::string path, Ptr<Object> root)
                     NS_LOG_DEBUG("GetAttribute(vector)=" << info.name << " on path="
                                                          << GetResolvedPath() << pathLeft);
                     foundMatch = true;
-                    ObjectPtrContainerValue vector;
-                    root->GetAttribute(info.name, vector);
+                    const std::vector<Ptr<Object>>* indexed =
+                        m_index ? m_index->Lookup(root, info.name) : nullptr;
                     m_workStack.push_back(info.name);
-                    DoArrayResolve(pathLeft, vector);
+                    if (indexed)
+                    {
+                        DoIndexedArrayResolve(pathLeft, *indexed);
+                    }
+                    else
+                    {
+                        ObjectPtrContainerValue vector;
+                        root->GetAttribute(info.name, vector);
+                        DoArrayResolve(pathLeft, vector);
+                    }
                     m_workStack.pop_back();
                 }
                 // this could be anything else and we don't know what to do with it.
@@ -633,6 +784,47 @@ Resolver::DoArrayResolve(std::string path, const ObjectPtrContainerValue& contai
     }
 }
 
+void
+Resolver::DoIndexedArrayResolve(std::string path, const std::vector<Ptr<Object>>& objects)
+{
+    NS_LOG_FUNCTION(this << path << objects.size());
+    NS_ASSERT(!path.empty());
+    NS_ASSERT((path.find('/')) == 0);
+    std::string::size_type next = path.find('/', 1);
+    if (next == std::string::npos)
+    {
+        return;
+    }
+    std::string item = path.substr(1, next - 1);
+    std::string pathLeft = path.substr(next, path.size() - next);
+
+    // An explicit index, such as "3", is looked up directly.  The longer
+    // numbers and the other expressions go through the ArrayMatcher.
+    if (!item.empty() && item.size() <= 9 &&
+        item.find_first_not_of("0123456789") == std::string::npos)
+    {
+        std::size_t i = std::stoul(item);
+        if (i < objects.size() && objects[i])
+        {
+            m_workStack.push_back(std::to_string(i));
+            DoResolve(pathLeft, objects[i]);
+            m_workStack.pop_back();
+        }
+        return;
+    }
+
+    ArrayMatcher matcher = ArrayMatcher(item);
+    for (std::size_t i = 0; i < objects.size(); ++i)
+    {
+        if (objects[i] && matcher.Matches(i))
+        {
+            m_workStack.push_back(std::to_string(i));
+            DoResolve(pathLeft, objects[i]);
+            m_workStack.pop_back();
+        }
+    }
+}
+
 /**
  * \ingroup config-impl
  * Config system implementation class.
@@ -667,6 +859,16 @@ class ConfigImpl : public Singleton<ConfigImpl>
     /** \copydoc ns3::Config::GetRootNamespaceObject() */
     Ptr<Object> GetRootNamespaceObject(std::size_t i) const;
 
+    /** \copydoc ns3::Config::IndexContainer() */
+    void IndexContainer(Ptr<Object> owner, std::string name);
+    /** \copydoc ns3::Config::NotifyIndexedObjectAdded() */
+    void NotifyIndexedObjectAdded(Ptr<Object> owner,
+                                  std::string name,
+                                  std::size_t index,
+                                  Ptr<Object> object);
+    /** \copydoc ns3::Config::UnindexContainers() */
+    void UnindexContainers(const Object* owner);
+
   private:
     /**
      * Break a Config path into the leading path and the last leaf token.
@@ -682,6 +884,8 @@ class ConfigImpl : public Singleton<ConfigImpl>
 
     /** The list of Config path roots. */
     Roots m_roots;
+    /** The index of the containers registered with IndexContainer. */
+    ContainerIndex m_index;
 
 }; // class ConfigImpl
 
@@ -701,6 +905,7 @@ void
 ConfigImpl::Set(std::string path, const AttributeValue& value)
 {
     NS_LOG_FUNCTION(this << path << &value);
+    StartupProfiler::Scope profile(StartupProfiler::CONFIG_OPERATION, "Set", path);
 
     std::string root;
     std::string leaf;
@@ -713,6 +918,7 @@ bool
 ConfigImpl::SetFailSafe(std::string path, const AttributeValue& value)
 {
     NS_LOG_FUNCTION(this << path << &value);
+    StartupProfiler::Scope profile(StartupProfiler::CONFIG_OPERATION, "Set", path);
 
     std::string root;
     std::string leaf;
@@ -725,6 +931,9 @@ bool
 ConfigImpl::ConnectWithoutContextFailSafe(std::string path, const CallbackBase& cb)
 {
     NS_LOG_FUNCTION(this << path << &cb);
+    StartupProfiler::Scope profile(StartupProfiler::CONFIG_OPERATION,
+                                   "ConnectWithoutContext",
+                                   path);
     std::string root;
     std::string leaf;
     ParsePath(path, &root, &leaf);
@@ -736,6 +945,9 @@ void
 ConfigImpl::DisconnectWithoutContext(std::string path, const CallbackBase& cb)
 {
     NS_LOG_FUNCTION(this << path << &cb);
+    StartupProfiler::Scope profile(StartupProfiler::CONFIG_OPERATION,
+                                   "DisconnectWithoutContext",
+                                   path);
     std::string root;
     std::string leaf;
     ParsePath(path, &root, &leaf);
@@ -754,6 +966,7 @@ bool
 ConfigImpl::ConnectFailSafe(std::string path, const CallbackBase& cb)
 {
     NS_LOG_FUNCTION(this << path << &cb);
+    StartupProfiler::Scope profile(StartupProfiler::CONFIG_OPERATION, "Connect", path);
 
     std::string root;
     std::string leaf;
@@ -766,6 +979,7 @@ void
 ConfigImpl::Disconnect(std::string path, const CallbackBase& cb)
 {
     NS_LOG_FUNCTION(this << path << &cb);
+    StartupProfiler::Scope profile(StartupProfiler::CONFIG_OPERATION, "Disconnect", path);
 
     std::string root;
     std::string leaf;
@@ -785,12 +999,13 @@ MatchContainer
 ConfigImpl::LookupMatches(std::string path)
 {
     NS_LOG_FUNCTION(this << path);
+    StartupProfiler::Scope profile(StartupProfiler::CONFIG_RESOLVE, path);
 
     class LookupMatchesResolver : public Resolver
     {
       public:
-        LookupMatchesResolver(std::string path)
-            : Resolver(path)
+        LookupMatchesResolver(std::string path, ContainerIndex* index)
+            : Resolver(path, index)
         {
         }
 
@@ -802,7 +1017,7 @@ ConfigImpl::LookupMatches(std::string path)
 
         std::vector<Ptr<Object>> m_objects;
         std::vector<std::string> m_contexts;
-    } resolver = LookupMatchesResolver(path);
+    } resolver = LookupMatchesResolver(path, &m_index);
 
     for (auto i = m_roots.begin(); i != m_roots.end(); i++)
     {
@@ -855,6 +1070,30 @@ ConfigImpl::GetRootNamespaceObject(std::size_t i) const
     return m_roots[i];
 }
 
+void
+ConfigImpl::IndexContainer(Ptr<Object> owner, std::string name)
+{
+    NS_LOG_FUNCTION(this << owner << name);
+    m_index.Add(PeekPointer(owner), name);
+}
+
+void
+ConfigImpl::NotifyIndexedObjectAdded(Ptr<Object> owner,
+                                     std::string name,
+                                     std::size_t index,
+                                     Ptr<Object> object)
+{
+    NS_LOG_FUNCTION(this << owner << name << index << object);
+    m_index.NotifyAdded(PeekPointer(owner), name, index, object);
+}
+
+void
+ConfigImpl::UnindexContainers(const Object* owner)
+{
+    NS_LOG_FUNCTION(this << owner);
+    m_index.Remove(owner);
+}
+
 void
 Reset()
 {
@@ -904,6 +1143,7 @@ bool
 SetDefaultFailSafe(std::string fullName, const AttributeValue& value)
 {
     NS_LOG_FUNCTION(fullName << &value);
+    StartupProfiler::Scope profile(StartupProfiler::ATTRIBUTE_SET, fullName);
     std::string::size_type pos = fullName.rfind("::");
     if (pos == std::string::npos)
     {
@@ -1033,6 +1273,30 @@ GetRootNamespaceObject(uint32_t i)
     return ConfigImpl::Get()->GetRootNamespaceObject(i);
 }
 
+void
+IndexContainer(Ptr<Object> owner, std::string name)
+{
+    NS_LOG_FUNCTION(owner << name);
+    ConfigImpl::Get()->IndexContainer(owner, name);
+}
+
+void
+NotifyIndexedObjectAdded(Ptr<Object> owner,
+                         std::string name,
+                         std::size_t index,
+                         Ptr<Object> object)
+{
+    NS_LOG_FUNCTION(owner << name << index << object);
+    ConfigImpl::Get()->NotifyIndexedObjectAdded(owner, name, index, object);
+}
+
+void
+UnindexContainers(const Object* owner)
+{
+    NS_LOG_FUNCTION(owner);
+    ConfigImpl::Get()->UnindexContainers(owner);
+}
+
 } // namespace Config
 
 } // namespace ns3
@@ -390,6 +390,46 @@ std::size_t GetRootNamespaceObjectN();
  */
 Ptr<Object> GetRootNamespaceObject(uint32_t i);
 
+/**
+ * \ingroup config
+ * \param [in] owner The object owning the container.
+ * \param [in] name The name of an ObjectPtrContainer attribute of \pname{owner}.
+ *
+ * Index the objects of a container attribute for the path resolution.
+ *
+ * The path resolution reads all the objects of the containers on a path,
+ * e.g., every Node for "/NodeList/3/DeviceList/0".  The objects of an
+ * indexed container are read once, on the first resolution through the
+ * container, and an explicit index, such as "3", is then looked up
+ * directly.  The owner must report each object added to the container
+ * with Config::NotifyIndexedObjectAdded, and call
+ * Config::UnindexContainers when it is disposed: the containers from
+ * which objects are removed or replaced must not be indexed.
+ */
+void IndexContainer(Ptr<Object> owner, std::string name);
+/**
+ * \ingroup config
+ * \param [in] owner The object owning the container.
+ * \param [in] name The name of the indexed container attribute.
+ * \param [in] index The index of the new object in the container.
+ * \param [in] object The new object.
+ *
+ * Add an object to the index of a container.
+ */
+void NotifyIndexedObjectAdded(Ptr<Object> owner,
+                              std::string name,
+                              std::size_t index,
+                              Ptr<Object> object);
+/**
+ * \ingroup config
+ * \param [in] owner The object owning the containers.
+ *
+ * This function undoes the work of Config::IndexContainer for all the
+ * containers of \pname{owner}.  It takes a raw pointer so that it can
+ * be called from the DoDispose method of \pname{owner}.
+ */
+void UnindexContainers(const Object* owner);
+
 } // namespace Config
 
 } // namespace ns3
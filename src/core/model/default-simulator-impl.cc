@@ -19,12 +19,20 @@
 
 #include "default-simulator-impl.h"
 
+#include "abort.h"
 #include "assert.h"
+#include "boolean.h"
+#include "event-profiler.h"
+#include "event-trace.h"
 #include "log.h"
 #include "scheduler.h"
 #include "simulator.h"
+#include "string.h"
+#include "uinteger.h"
 
 #include <cmath>
+#include <fstream>
+#include <iostream>
 
 /**
  * \file
@@ -45,10 +53,36 @@ NS_OBJECT_ENSURE_REGISTERED(DefaultSimulatorImpl);
 TypeId
 DefaultSimulatorImpl::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::DefaultSimulatorImpl")
-                            .SetParent<SimulatorImpl>()
-                            .SetGroupName("Core")
-                            .AddConstructor<DefaultSimulatorImpl>();
+    static TypeId tid =
+        TypeId("ns3::DefaultSimulatorImpl")
+            .SetParent<SimulatorImpl>()
+            .SetGroupName("Core")
+            .AddConstructor<DefaultSimulatorImpl>()
+            .AddAttribute("EventTraceFile",
+                          "The file in which to record the operations on the event list, "
+                          "to replay them with utils/bench-scheduler; empty for none.",
+                          StringValue(""),
+                          MakeStringAccessor(&DefaultSimulatorImpl::SetEventTraceFile),
+                          MakeStringChecker())
+            .AddAttribute("EventProfileFile",
+                          "The file in which to write the event profile; empty for std::clog.",
+                          StringValue(""),
+                          MakeStringAccessor(&DefaultSimulatorImpl::m_eventProfileFile),
+                          MakeStringChecker())
+            .AddAttribute("EventProfileSampleInterval",
+                          "The number of events between two samples of the size of the event "
+                          "list in the event profile, read when the profiling is first enabled; "
+                          "zero for none.",
+                          UintegerValue(100000),
+                          MakeUintegerAccessor(&DefaultSimulatorImpl::m_eventProfileSampleInterval),
+                          MakeUintegerChecker<uint64_t>())
+            .AddAttribute("EventProfile",
+                          "Count the events and measure their wall-clock time per target "
+                          "and per context, and print the profile at the end of the simulation.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&DefaultSimulatorImpl::SetEventProfile,
+                                              &DefaultSimulatorImpl::GetEventProfile),
+                          MakeBooleanChecker());
     return tid;
 }
 
@@ -62,8 +96,9 @@ DefaultSimulatorImpl::DefaultSimulatorImpl()
     m_currentContext = Simulator::NO_CONTEXT;
     m_unscheduledEvents = 0;
     m_eventCount = 0;
-    m_eventsWithContextEmpty = true;
     m_mainThreadId = std::this_thread::get_id();
+    m_profileEvents = false;
+    m_eventProfileSampleInterval = 0;
 }
 
 DefaultSimulatorImpl::~DefaultSimulatorImpl()
@@ -71,6 +106,40 @@ DefaultSimulatorImpl::~DefaultSimulatorImpl()
     NS_LOG_FUNCTION(this);
 }
 
+void
+DefaultSimulatorImpl::SetEventTraceFile(const std::string& filename)
+{
+    NS_LOG_FUNCTION(this << filename);
+    m_eventTrace.reset();
+    if (!filename.empty())
+    {
+        m_eventTrace = std::make_unique<EventTraceWriter>(filename);
+    }
+}
+
+void
+DefaultSimulatorImpl::SetEventProfile(bool enable)
+{
+    NS_LOG_FUNCTION(this << enable);
+    if (enable && !m_eventProfiler)
+    {
+        m_eventProfiler = std::make_unique<EventProfiler>(m_eventProfileSampleInterval);
+    }
+    m_profileEvents = enable;
+}
+
+bool
+DefaultSimulatorImpl::GetEventProfile() const
+{
+    return m_profileEvents;
+}
+
+const EventProfiler*
+DefaultSimulatorImpl::GetEventProfiler() const
+{
+    return m_eventProfiler.get();
+}
+
 void
 DefaultSimulatorImpl::DoDispose()
 {
@@ -83,6 +152,7 @@ DefaultSimulatorImpl::DoDispose()
         next.impl->Unref();
     }
     m_events = nullptr;
+    m_eventTrace.reset();
     SimulatorImpl::DoDispose();
 }
 
@@ -100,6 +170,20 @@ DefaultSimulatorImpl::Destroy()
             ev->Invoke();
         }
     }
+
+    if (m_eventProfiler)
+    {
+        if (m_eventProfileFile.empty())
+        {
+            m_eventProfiler->Report(std::clog);
+        }
+        else
+        {
+            std::ofstream os(m_eventProfileFile);
+            NS_ABORT_MSG_UNLESS(os, "Cannot open the event profile file " << m_eventProfileFile);
+            m_eventProfiler->Report(os);
+        }
+    }
 }
 
 void
@@ -130,6 +214,10 @@ void
 DefaultSimulatorImpl::ProcessOneEvent()
 {
     Scheduler::Event next = m_events->RemoveNext();
+    if (m_eventTrace)
+    {
+        m_eventTrace->RemoveNext(next.key);
+    }
 
     PreEventHook(EventId(next.impl, next.key.m_ts, next.key.m_context, next.key.m_uid));
 
@@ -141,7 +229,14 @@ DefaultSimulatorImpl::ProcessOneEvent()
     m_currentTs = next.key.m_ts;
     m_currentContext = next.key.m_context;
     m_currentUid = next.key.m_uid;
-    next.impl->Invoke();
+    if (m_profileEvents)
+    {
+        m_eventProfiler->Invoke(next.impl, next.key.m_context, next.key.m_ts, m_unscheduledEvents);
+    }
+    else
+    {
+        next.impl->Invoke();
+    }
     next.impl->Unref();
 
     ProcessEventsWithContext();
@@ -156,22 +251,12 @@ DefaultSimulatorImpl::IsFinished() const
 void
 DefaultSimulatorImpl::ProcessEventsWithContext()
 {
-    if (m_eventsWithContextEmpty)
+    if (!m_eventsWithContext.IsPending())
     {
         return;
     }
 
-    // swap queues
-    EventsWithContext eventsWithContext;
-    {
-        std::unique_lock lock{m_eventsWithContextMutex};
-        m_eventsWithContext.swap(eventsWithContext);
-        m_eventsWithContextEmpty = true;
-    }
-    while (!eventsWithContext.empty())
-    {
-        EventWithContext event = eventsWithContext.front();
-        eventsWithContext.pop_front();
+    m_eventsWithContext.Drain([this](const EventWithContext& event) {
         Scheduler::Event ev;
         ev.impl = event.event;
         ev.key.m_ts = m_currentTs + event.timestamp;
@@ -180,7 +265,11 @@ DefaultSimulatorImpl::ProcessEventsWithContext()
         m_uid++;
         m_unscheduledEvents++;
         m_events->Insert(ev);
-    }
+        if (m_eventTrace)
+        {
+            m_eventTrace->Insert(ev.key);
+        }
+    });
 }
 
 void
@@ -237,6 +326,10 @@ DefaultSimulatorImpl::Schedule(const Time& delay, EventImpl* event)
     m_uid++;
     m_unscheduledEvents++;
     m_events->Insert(ev);
+    if (m_eventTrace)
+    {
+        m_eventTrace->Insert(ev.key);
+    }
     return EventId(event, ev.key.m_ts, ev.key.m_context, ev.key.m_uid);
 }
 
@@ -256,6 +349,10 @@ DefaultSimulatorImpl::ScheduleWithContext(uint32_t context, const Time& delay, E
         m_uid++;
         m_unscheduledEvents++;
         m_events->Insert(ev);
+        if (m_eventTrace)
+        {
+            m_eventTrace->Insert(ev.key);
+        }
     }
     else
     {
@@ -264,11 +361,7 @@ DefaultSimulatorImpl::ScheduleWithContext(uint32_t context, const Time& delay, E
         // Current time added in ProcessEventsWithContext()
         ev.timestamp = delay.GetTimeStep();
         ev.event = event;
-        {
-            std::unique_lock lock{m_eventsWithContextMutex};
-            m_eventsWithContext.push_back(ev);
-            m_eventsWithContextEmpty = false;
-        }
+        m_eventsWithContext.Push(ev);
     }
 }
 
@@ -339,6 +432,10 @@ DefaultSimulatorImpl::Remove(const EventId& id)
     event.key.m_context = id.GetContext();
     event.key.m_uid = id.GetUid();
     m_events->Remove(event);
+    if (m_eventTrace)
+    {
+        m_eventTrace->Remove(event.key);
+    }
     event.impl->Cancel();
     // whenever we remove an event from the event list, we have to unref it.
     event.impl->Unref();
@@ -352,6 +449,10 @@ DefaultSimulatorImpl::Cancel(const EventId& id)
     if (!IsExpired(id))
     {
         id.PeekEventImpl()->Cancel();
+        if (m_eventTrace)
+        {
+            m_eventTrace->Cancel({id.GetTs(), id.GetUid(), id.GetContext()});
+        }
     }
 }
 
@@ -20,10 +20,12 @@
 #ifndef DEFAULT_SIMULATOR_IMPL_H
 #define DEFAULT_SIMULATOR_IMPL_H
 
+#include "mpsc-queue.h"
 #include "simulator-impl.h"
 
 #include <list>
-#include <mutex>
+#include <memory>
+#include <string>
 #include <thread>
 
 /**
@@ -37,11 +39,24 @@ namespace ns3
 
 // Forward
 class Scheduler;
+class EventTraceWriter;
+class EventProfiler;
 
 /**
  * \ingroup simulator
  *
  * The default single process simulator implementation.
+ *
+ * When the \c EventTraceFile attribute is set, the operations on the event
+ * list are recorded in an event trace (see EventTraceWriter), which can be
+ * replayed against the Scheduler implementations by
+ * \c utils/bench-scheduler.cc.
+ *
+ * When the \c EventProfile attribute is true, the events are run through an
+ * EventProfiler, which counts them and measures their wall-clock time per
+ * target and per context.  The profile is printed when the simulation is
+ * destroyed.  The attribute can be changed at any time, e.g., to profile
+ * only the steady state of a scenario.
  */
 class DefaultSimulatorImpl : public SimulatorImpl
 {
@@ -78,9 +93,32 @@ class DefaultSimulatorImpl : public SimulatorImpl
     uint32_t GetContext() const override;
     uint64_t GetEventCount() const override;
 
+    /**
+     * \returns the event profiler, or nullptr if the events were never profiled
+     */
+    const EventProfiler* GetEventProfiler() const;
+
   private:
     void DoDispose() override;
 
+    /**
+     * Start or stop recording the operations on the event list.
+     *
+     * \param [in] filename The event trace file, or an empty string to stop.
+     */
+    void SetEventTraceFile(const std::string& filename);
+
+    /**
+     * Start or stop profiling the events.
+     *
+     * \param [in] enable Whether to profile the next events.
+     */
+    void SetEventProfile(bool enable);
+    /**
+     * \returns true if the events are profiled
+     */
+    bool GetEventProfile() const;
+
     /** Process the next event. */
     void ProcessOneEvent();
     /** Move events from a different context into the main event queue. */
@@ -97,17 +135,8 @@ class DefaultSimulatorImpl : public SimulatorImpl
         EventImpl* event;
     };
 
-    /** Container type for the events from a different context. */
-    typedef std::list<EventWithContext> EventsWithContext;
-    /** The container of events from a different context. */
-    EventsWithContext m_eventsWithContext;
-    /**
-     * Flag \c true if all events with context have been moved to the
-     * primary event queue.
-     */
-    bool m_eventsWithContextEmpty;
-    /** Mutex to control access to the list of events with context. */
-    std::mutex m_eventsWithContextMutex;
+    /** The events scheduled by other threads. */
+    MpscQueue<EventWithContext> m_eventsWithContext;
 
     /** Container type for the events to run at Simulator::Destroy() */
     typedef std::list<EventId> DestroyEvents;
@@ -136,6 +165,18 @@ class DefaultSimulatorImpl : public SimulatorImpl
 
     /** Main execution thread. */
     std::thread::id m_mainThreadId;
+
+    /** The recorder of the operations on the event list, if enabled. */
+    std::unique_ptr<EventTraceWriter> m_eventTrace;
+
+    /** Flag \c true if the events are profiled. */
+    bool m_profileEvents;
+    /** The event profiler, created when the profiling is first enabled. */
+    std::unique_ptr<EventProfiler> m_eventProfiler;
+    /** The file of the event profile, or empty for std::clog. */
+    std::string m_eventProfileFile;
+    /** The number of events between two samples of the size of the event list. */
+    uint64_t m_eventProfileSampleInterval;
 };
 
 } // namespace ns3
@@ -20,6 +20,22 @@
 #include "event-impl.h"
 
 #include "log.h"
+#include "make-event.h"
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#define NS3_EVENT_IMPL_DEMANGLE 1
+#endif
+#if __has_include(<dlfcn.h>)
+#include <dlfcn.h>
+#define NS3_EVENT_IMPL_DLADDR 1
+#endif
 
 /**
  * \file
@@ -32,6 +48,70 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("EventImpl");
 
+#if defined(__SANITIZE_ADDRESS__)
+#define NS3_EVENT_IMPL_POOL 0
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define NS3_EVENT_IMPL_POOL 0
+#endif
+#endif
+#ifndef NS3_EVENT_IMPL_POOL
+#define NS3_EVENT_IMPL_POOL 1
+#endif
+
+namespace
+{
+
+/** The granularity of the size classes. */
+constexpr std::size_t EVENT_SIZE_GRANULE = 16;
+/** The number of size classes, the larger events are allocated from the heap. */
+constexpr std::size_t EVENT_SIZE_CLASSES = 16;
+/** The maximum number of blocks kept in the free list of a size class. */
+constexpr uint32_t EVENT_MAX_CACHED = 4096;
+
+/** A block in a free list. */
+struct FreeBlock
+{
+    FreeBlock* next; //!< The next block of the free list.
+};
+
+/**
+ * The free lists of a thread.
+ *
+ * The events are often freed by a thread other than the one which allocated
+ * them (e.g., with ScheduleWithContext from another thread); the blocks then
+ * join the free lists of the thread which frees them.
+ */
+struct EventPool
+{
+    FreeBlock* head[EVENT_SIZE_CLASSES]{};     //!< The free list of each size class.
+    uint32_t length[EVENT_SIZE_CLASSES]{};     //!< The length of each free list.
+    ns3::EventImpl::AllocationCounts counts{}; //!< The allocations of the thread.
+
+    ~EventPool();
+};
+
+/** Whether the free lists of the thread have been destroyed, at thread exit. */
+thread_local bool g_eventPoolDestroyed = false;
+/** The free lists of the thread. */
+thread_local EventPool g_eventPool;
+
+EventPool::~EventPool()
+{
+    for (auto& head : this->head)
+    {
+        while (head)
+        {
+            FreeBlock* block = head;
+            head = block->next;
+            ::operator delete(block);
+        }
+    }
+    g_eventPoolDestroyed = true;
+}
+
+} // unnamed namespace
+
 EventImpl::~EventImpl()
 {
     NS_LOG_FUNCTION(this);
@@ -67,4 +147,219 @@ EventImpl::IsCancelled()
     return m_cancel;
 }
 
+namespace internal
+{
+
+namespace
+{
+
+/**
+ * \param [in] name A mangled name.
+ * \returns the demangled name, or the name itself if it is not mangled
+ */
+std::string
+Demangle(const char* name)
+{
+#ifdef NS3_EVENT_IMPL_DEMANGLE
+    int status;
+    char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    if (status == 0)
+    {
+        std::string ret = demangled;
+        std::free(demangled);
+        return ret;
+    }
+#endif
+    return name;
+}
+
+/**
+ * \param [in] function The address of a function.
+ * \returns the demangled name of the symbol at this address, or an empty string
+ */
+std::string
+LookupSymbol(const void* function)
+{
+#ifdef NS3_EVENT_IMPL_DLADDR
+    Dl_info info;
+    if (function && dladdr(function, &info) && info.dli_sname && info.dli_saddr == function)
+    {
+        return Demangle(info.dli_sname);
+    }
+#endif
+    return "";
+}
+
+} // unnamed namespace
+
+std::string
+GetTypeName(const std::type_info& type)
+{
+    return Demangle(type.name());
+}
+
+std::string
+GetFunctionName(const void* function)
+{
+    std::string name = LookupSymbol(function);
+    if (name.empty())
+    {
+        std::ostringstream oss;
+        oss << "function at " << function;
+        name = oss.str();
+    }
+    return name;
+}
+
+std::string
+GetMemberFunctionName(const void* self,
+                      const void* function,
+                      std::size_t size,
+                      const std::type_info& type)
+{
+    std::string name;
+#ifdef __GXX_ABI_VERSION
+    // Itanium C++ ABI: a member function pointer is a function address, or
+    // one plus the offset of the function in the virtual table, and an
+    // adjustment of this.  On ARM, the virtual flag is the low bit of the
+    // adjustment instead.
+    if (size == 2 * sizeof(std::ptrdiff_t))
+    {
+        std::ptrdiff_t fields[2];
+        std::memcpy(fields, function, sizeof(fields));
+        std::ptrdiff_t ptr = fields[0];
+        std::ptrdiff_t adj = fields[1];
+#if defined(__arm__) || defined(__aarch64__)
+        bool isVirtual = adj & 1;
+        adj >>= 1;
+        std::ptrdiff_t offset = ptr;
+#else
+        bool isVirtual = ptr & 1;
+        std::ptrdiff_t offset = ptr - 1;
+#endif
+        if (!isVirtual)
+        {
+            name = LookupSymbol(reinterpret_cast<const void*>(ptr));
+        }
+        else if (self)
+        {
+            const char* object = static_cast<const char*>(self) + adj;
+            const char* vtable = *reinterpret_cast<const char* const*>(object);
+            name = LookupSymbol(*reinterpret_cast<const void* const*>(vtable + offset));
+        }
+    }
+#endif
+    if (name.empty())
+    {
+        std::ostringstream oss;
+        oss << GetTypeName(type) << "::member function 0x" << std::hex << std::setfill('0');
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            oss << std::setw(2) << +static_cast<const unsigned char*>(function)[i];
+        }
+        name = oss.str();
+    }
+    return name;
+}
+
+} // namespace internal
+
+EventImpl::Target
+EventImpl::GetTarget() const
+{
+    return {&typeid(*this), {0, 0}};
+}
+
+std::string
+EventImpl::GetTargetName() const
+{
+    return internal::GetTypeName(typeid(*this));
+}
+
+// No logging in the allocation functions, which run before the construction
+// and after the destruction of the events.
+
+void*
+EventImpl::operator new(std::size_t size)
+{
+#if NS3_EVENT_IMPL_POOL
+    std::size_t sizeClass = (size - 1) / EVENT_SIZE_GRANULE;
+    if (sizeClass < EVENT_SIZE_CLASSES)
+    {
+        if (!g_eventPoolDestroyed)
+        {
+            EventPool& pool = g_eventPool;
+            pool.counts.allocations++;
+            FreeBlock* block = pool.head[sizeClass];
+            if (block)
+            {
+                pool.head[sizeClass] = block->next;
+                pool.length[sizeClass]--;
+                pool.counts.cached--;
+                return block;
+            }
+            pool.counts.heapAllocations++;
+        }
+        // The whole size class even without a pool: the event may be freed by
+        // a thread whose pool is alive, which then caches the block.
+        return ::operator new((sizeClass + 1) * EVENT_SIZE_GRANULE);
+    }
+#endif
+    return ::operator new(size);
+}
+
+void
+EventImpl::operator delete(void* p, std::size_t size)
+{
+#if NS3_EVENT_IMPL_POOL
+    std::size_t sizeClass = (size - 1) / EVENT_SIZE_GRANULE;
+    if (sizeClass < EVENT_SIZE_CLASSES && !g_eventPoolDestroyed)
+    {
+        EventPool& pool = g_eventPool;
+        if (pool.length[sizeClass] < EVENT_MAX_CACHED)
+        {
+            auto block = static_cast<FreeBlock*>(p);
+            block->next = pool.head[sizeClass];
+            pool.head[sizeClass] = block;
+            pool.length[sizeClass]++;
+            pool.counts.cached++;
+            return;
+        }
+    }
+#endif
+    ::operator delete(p);
+}
+
+void*
+EventImpl::operator new(std::size_t size, std::align_val_t alignment)
+{
+    return ::operator new(size, alignment);
+}
+
+void
+EventImpl::operator delete(void* p, std::size_t size, std::align_val_t alignment)
+{
+    ::operator delete(p, alignment);
+}
+
+EventImpl::AllocationCounts
+EventImpl::GetAllocationCounts()
+{
+    if (g_eventPoolDestroyed)
+    {
+        return AllocationCounts{0, 0, 0};
+    }
+    return g_eventPool.counts;
+}
+
+void
+EventImpl::ResetAllocationCounts()
+{
+    if (!g_eventPoolDestroyed)
+    {
+        g_eventPool.counts.allocations = 0;
+        g_eventPool.counts.heapAllocations = 0;
+    }
+}
+
 } // namespace ns3
@@ -21,7 +21,11 @@
 
 #include "simple-ref-count.h"
 
+#include <cstddef>
+#include <new>
 #include <stdint.h>
+#include <string>
+#include <typeinfo>
 
 /**
  * \file
@@ -41,6 +45,11 @@ namespace ns3
  * when it reaches the time associated to this event. Most subclasses
  * are usually created by one of the many Simulator::Schedule
  * methods.
+ *
+ * Events are small, short lived and created at a high rate, so they are
+ * allocated from per-thread free lists with 16-byte size classes, up to
+ * 256 bytes, instead of the general purpose heap.  The free lists are
+ * bypassed in AddressSanitizer builds, to keep its use-after-free checks.
  */
 class EventImpl : public SimpleRefCount<EventImpl>
 {
@@ -67,6 +76,88 @@ class EventImpl : public SimpleRefCount<EventImpl>
      */
     bool IsCancelled();
 
+    /**
+     * Allocate the memory of an event, from the free list of its size
+     * class if not empty.
+     *
+     * \param [in] size The size of the event.
+     * \returns the allocated memory
+     */
+    static void* operator new(std::size_t size);
+    /**
+     * Return the memory of an event to the free list of its size class.
+     *
+     * \param [in] p The memory of the event.
+     * \param [in] size The size of the event.
+     */
+    static void operator delete(void* p, std::size_t size);
+    /**
+     * Allocate the memory of an over-aligned event, from the heap.
+     *
+     * \param [in] size The size of the event.
+     * \param [in] alignment The alignment of the event.
+     * \returns the allocated memory
+     */
+    static void* operator new(std::size_t size, std::align_val_t alignment);
+    /**
+     * Free the memory of an over-aligned event.
+     *
+     * \param [in] p The memory of the event.
+     * \param [in] size The size of the event.
+     * \param [in] alignment The alignment of the event.
+     */
+    static void operator delete(void* p, std::size_t size, std::align_val_t alignment);
+
+    /**
+     * The identity of the function run by an event, which groups the events
+     * of an event profile: the events with the same target run the same
+     * function or member function, possibly on different objects.
+     */
+    struct Target
+    {
+        const std::type_info* type; //!< The dynamic type of the event.
+        uint64_t function[2];       //!< The bytes of the function pointer, or zero.
+
+        /**
+         * \param [in] other The other target.
+         * \returns true if both targets are the same
+         */
+        bool operator==(const Target& other) const = default;
+    };
+
+    /**
+     * \returns the target of the event
+     *
+     * The events made by MakeEvent() identify their function or member
+     * function, the others only their dynamic type.
+     */
+    virtual Target GetTarget() const;
+    /**
+     * \returns the name of the target of the event, e.g., the qualified
+     * name of its member function
+     *
+     * This may resolve symbols, so it is meant to be called once per target.
+     * The object of a virtual member function must be alive.
+     */
+    virtual std::string GetTargetName() const;
+
+    /** The event allocations of a thread. */
+    struct AllocationCounts
+    {
+        uint64_t allocations;     //!< Number of events allocated.
+        uint64_t heapAllocations; //!< Number of events allocated from the heap.
+        uint64_t cached;          //!< Number of blocks in the free lists.
+    };
+
+    /**
+     * \returns the event allocations of the calling thread since the last
+     * ResetAllocationCounts()
+     */
+    static AllocationCounts GetAllocationCounts();
+
+    /** Reset the allocation counts of the calling thread. */
+    static void ResetAllocationCounts();
+
   protected:
     /**
      * Implementation for Invoke().
@@ -0,0 +1,220 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "event-profiler.h"
+
+#include "log.h"
+#include "nstime.h"
+#include "simulator.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::EventProfiler implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("EventProfiler");
+
+namespace
+{
+
+/**
+ * \param [in] duration A duration.
+ * \returns the duration in seconds
+ */
+double
+ToSeconds(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration<double>(duration).count();
+}
+
+/**
+ * Sort entries by decreasing time, then by name.
+ * \param [in,out] entries The entries.
+ */
+void
+SortEntries(std::vector<EventProfiler::Entry>& entries)
+{
+    std::sort(entries.begin(),
+              entries.end(),
+              [](const EventProfiler::Entry& a, const EventProfiler::Entry& b) {
+                  return a.time != b.time ? a.time > b.time : a.name < b.name;
+              });
+}
+
+} // unnamed namespace
+
+std::size_t
+EventProfiler::TargetHash::operator()(const EventImpl::Target& target) const
+{
+    std::size_t hash = target.type->hash_code();
+    hash ^= std::hash<uint64_t>()(target.function[0]) + 0x9e3779b97f4a7c15ULL + (hash << 6);
+    hash ^= std::hash<uint64_t>()(target.function[1]) + 0x9e3779b97f4a7c15ULL + (hash << 6);
+    return hash;
+}
+
+EventProfiler::EventProfiler(uint64_t sampleInterval)
+    : m_lastTarget{nullptr, {0, 0}},
+      m_lastEntry(nullptr),
+      m_cancelled{"(cancelled)"},
+      m_events(0),
+      m_sampleInterval(sampleInterval),
+      m_nextSample(sampleInterval),
+      m_maxQueueSize(0),
+      m_start(std::chrono::steady_clock::now())
+{
+    NS_LOG_FUNCTION(this << sampleInterval);
+}
+
+EventProfiler::Entry&
+EventProfiler::GetTargetEntry(EventImpl* event)
+{
+    EventImpl::Target target = event->GetTarget();
+    if (m_lastEntry && target == m_lastTarget)
+    {
+        return *m_lastEntry;
+    }
+    auto [it, inserted] = m_targets.try_emplace(target);
+    if (inserted)
+    {
+        it->second.name = event->GetTargetName();
+    }
+    m_lastTarget = target;
+    m_lastEntry = &it->second;
+    return it->second;
+}
+
+void
+EventProfiler::Sample(uint64_t ts, uint64_t queueSize)
+{
+    auto wallTime = ToSeconds(std::chrono::steady_clock::now() - m_start);
+    m_samples.push_back({ts, wallTime, m_events, queueSize, m_maxQueueSize});
+    m_maxQueueSize = 0;
+    m_nextSample += m_sampleInterval;
+}
+
+std::vector<EventProfiler::Entry>
+EventProfiler::GetTargets() const
+{
+    // the same function may be the target of several event types, e.g.,
+    // when it is scheduled with a raw pointer and with a Ptr
+    std::map<std::string, Entry> merged;
+    for (const auto& [target, entry] : m_targets)
+    {
+        Entry& e = merged[entry.name];
+        e.name = entry.name;
+        e.events += entry.events;
+        e.time += entry.time;
+    }
+    std::vector<Entry> entries;
+    for (const auto& [name, entry] : merged)
+    {
+        entries.push_back(entry);
+    }
+    if (m_cancelled.events > 0)
+    {
+        entries.push_back(m_cancelled);
+    }
+    SortEntries(entries);
+    return entries;
+}
+
+std::vector<EventProfiler::Entry>
+EventProfiler::GetContexts() const
+{
+    std::vector<Entry> entries;
+    for (const auto& [context, entry] : m_contexts)
+    {
+        Entry e = entry;
+        e.name = context == Simulator::NO_CONTEXT ? "none" : std::to_string(context);
+        entries.push_back(e);
+    }
+    SortEntries(entries);
+    return entries;
+}
+
+const std::vector<EventProfiler::QueueSample>&
+EventProfiler::GetQueueSamples() const
+{
+    return m_samples;
+}
+
+uint64_t
+EventProfiler::GetEventCount() const
+{
+    return m_events;
+}
+
+void
+EventProfiler::Report(std::ostream& os, uint32_t maxEntries) const
+{
+    std::vector<Entry> targets = GetTargets();
+    std::chrono::steady_clock::duration total{};
+    for (const auto& entry : targets)
+    {
+        total += entry.time;
+    }
+    double totalSeconds = ToSeconds(total);
+
+    auto printEntries = [&os, maxEntries, totalSeconds](const std::vector<Entry>& entries) {
+        os << "  %time   cumulative(s)    self(s)      events   ns/event  name" << std::endl;
+        double cumulative = 0;
+        for (std::size_t i = 0; i < entries.size() && i < maxEntries; ++i)
+        {
+            const Entry& e = entries[i];
+            double seconds = ToSeconds(e.time);
+            cumulative += seconds;
+            os << std::fixed << std::setprecision(2) << std::setw(7)
+               << (totalSeconds > 0 ? 100 * seconds / totalSeconds : 0) << std::setprecision(6)
+               << std::setw(16) << cumulative << std::setw(11) << seconds << std::setw(12)
+               << e.events << std::setprecision(0) << std::setw(11)
+               << (e.events > 0 ? seconds * 1e9 / e.events : 0) << "  " << e.name << std::endl;
+        }
+        if (entries.size() > maxEntries)
+        {
+            os << "  ... " << entries.size() - maxEntries << " more" << std::endl;
+        }
+    };
+
+    os << "Event profile: " << m_events << " events, " << std::setprecision(4) << totalSeconds
+       << " s in the events, " << ToSeconds(std::chrono::steady_clock::now() - m_start)
+       << " s in total" << std::endl;
+    os << "Events by target:" << std::endl;
+    printEntries(targets);
+    os << "Events by context:" << std::endl;
+    printEntries(GetContexts());
+    if (!m_samples.empty())
+    {
+        os << "Event list size:" << std::endl;
+        os << "   time(s)    wall(s)      events        size    max size" << std::endl;
+        for (const auto& sample : m_samples)
+        {
+            os << std::fixed << std::setprecision(6) << std::setw(10)
+               << TimeStep(sample.ts).GetSeconds() << std::setprecision(3) << std::setw(11)
+               << sample.wallTime << std::setw(12) << sample.events << std::setw(12)
+               << sample.size << std::setw(12) << sample.maxSize << std::endl;
+        }
+    }
+    os.unsetf(std::ios_base::floatfield);
+}
+
+} // namespace ns3
@@ -0,0 +1,198 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EVENT_PROFILER_H
+#define EVENT_PROFILER_H
+
+#include "event-impl.h"
+
+#include <chrono>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::EventProfiler declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup simulator
+ *
+ * \brief Event counts and wall-clock time per event target and per context.
+ *
+ * The profiler runs the events of a simulation and records, for each
+ * target (the function or member function run by the event, see
+ * EventImpl::GetTarget) and for each context (usually the node id), the
+ * number of events and the wall-clock time spent in them.  Every
+ * \c sampleInterval events, it also records the size of the event list.
+ *
+ * The DefaultSimulatorImpl runs its events through a profiler when its
+ * \c EventProfile attribute is true, and prints the profile when the
+ * simulation is destroyed, e.g., with
+ *
+ *     NS_ATTRIBUTE_DEFAULT='ns3::DefaultSimulatorImpl::EventProfile=true'
+ *
+ * The targets are named from the dynamic symbol table, so that the names
+ * of the functions of static libraries or executables may be unresolved.
+ */
+class EventProfiler
+{
+  public:
+    /** The events of a target or of a context. */
+    struct Entry
+    {
+        std::string name;                           //!< The target or context.
+        uint64_t events{0};                         //!< The number of events.
+        std::chrono::steady_clock::duration time{}; //!< The time spent in the events.
+    };
+
+    /** A sample of the size of the event list. */
+    struct QueueSample
+    {
+        uint64_t ts;      //!< The simulation time, in time steps.
+        double wallTime;  //!< The wall-clock time since the start, in seconds.
+        uint64_t events;  //!< The number of events run.
+        uint64_t size;    //!< The number of events in the list.
+        uint64_t maxSize; //!< The largest size since the previous sample.
+    };
+
+    /**
+     * Constructor.
+     *
+     * \param [in] sampleInterval The number of events between two samples of
+     * the size of the event list, or zero for no samples.
+     */
+    EventProfiler(uint64_t sampleInterval = 100000);
+
+    /**
+     * Run an event and record it.
+     *
+     * \param [in] event The event.
+     * \param [in] context The context of the event.
+     * \param [in] ts The time of the event, in time steps.
+     * \param [in] queueSize The number of events in the list.
+     */
+    void Invoke(EventImpl* event, uint32_t context, uint64_t ts, uint64_t queueSize)
+    {
+        if (queueSize > m_maxQueueSize)
+        {
+            m_maxQueueSize = queueSize;
+        }
+        if (event->IsCancelled())
+        {
+            // the object of a cancelled event may be gone, so its target is not named
+            ++m_cancelled.events;
+        }
+        else
+        {
+            Entry& target = GetTargetEntry(event);
+            auto start = std::chrono::steady_clock::now();
+            event->Invoke();
+            auto time = std::chrono::steady_clock::now() - start;
+            ++target.events;
+            target.time += time;
+            Entry& ctx = m_contexts[context];
+            ++ctx.events;
+            ctx.time += time;
+        }
+        if (++m_events == m_nextSample)
+        {
+            Sample(ts, queueSize);
+        }
+    }
+
+    /**
+     * \returns the events per target, merged by name, by decreasing time
+     */
+    std::vector<Entry> GetTargets() const;
+    /**
+     * \returns the events per context, by decreasing time
+     */
+    std::vector<Entry> GetContexts() const;
+    /**
+     * \returns the samples of the size of the event list
+     */
+    const std::vector<QueueSample>& GetQueueSamples() const;
+    /**
+     * \returns the number of events run through the profiler
+     */
+    uint64_t GetEventCount() const;
+
+    /**
+     * Print the flat profile.
+     *
+     * \param [in] os The output stream.
+     * \param [in] maxEntries The maximum number of targets and of contexts printed.
+     */
+    void Report(std::ostream& os, uint32_t maxEntries = 30) const;
+
+  private:
+    /** Hash of an event target. */
+    struct TargetHash
+    {
+        /**
+         * \param [in] target The target.
+         * \returns the hash of the target
+         */
+        std::size_t operator()(const EventImpl::Target& target) const;
+    };
+
+    /**
+     * Find or create the entry of the target of an event.
+     * \param [in] event The event.
+     * \returns the entry of the target
+     */
+    Entry& GetTargetEntry(EventImpl* event);
+    /**
+     * Record a sample of the size of the event list.
+     * \param [in] ts The current time, in time steps.
+     * \param [in] queueSize The number of events in the list.
+     */
+    void Sample(uint64_t ts, uint64_t queueSize);
+
+    /** The entries of the targets. */
+    std::unordered_map<EventImpl::Target, Entry, TargetHash> m_targets;
+    /** The target of the last event, whose entry is cached. */
+    EventImpl::Target m_lastTarget;
+    /** The entry of m_lastTarget. */
+    Entry* m_lastEntry;
+    /** The entry of the cancelled events, which are not run. */
+    Entry m_cancelled;
+    /** The entries of the contexts. */
+    std::unordered_map<uint32_t, Entry> m_contexts;
+    /** The number of events run through the profiler. */
+    uint64_t m_events;
+    /** The number of events between two samples. */
+    uint64_t m_sampleInterval;
+    /** The value of m_events at the next sample. */
+    uint64_t m_nextSample;
+    /** The largest size of the event list since the last sample. */
+    uint64_t m_maxQueueSize;
+    /** The samples of the size of the event list. */
+    std::vector<QueueSample> m_samples;
+    /** The creation of the profiler. */
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace ns3
+
+#endif /* EVENT_PROFILER_H */
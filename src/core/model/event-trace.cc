@@ -0,0 +1,216 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "event-trace.h"
+
+#include "abort.h"
+#include "log.h"
+
+#include <cstring>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::EventTraceWriter and ns3::EventTraceReader implementations.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("EventTrace");
+
+namespace
+{
+
+/** The signature at the start of an event trace, with the format version. */
+const char EVENT_TRACE_SIGNATURE[8] = {'N', 'S', '3', 'E', 'V', 'T', 'R', '1'};
+
+/**
+ * Zigzag encoding of a signed difference.
+ * \param [in] value The difference.
+ * \returns the encoded value, small for small differences of either sign
+ */
+uint64_t
+ZigZag(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+/**
+ * Zigzag decoding of a signed difference.
+ * \param [in] value The encoded value.
+ * \returns the difference
+ */
+int64_t
+UnZigZag(uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+} // unnamed namespace
+
+EventTraceWriter::EventTraceWriter(const std::string& filename)
+    : m_file(filename, std::ios::binary | std::ios::trunc),
+      m_now(0),
+      m_lastUid(0)
+{
+    NS_LOG_FUNCTION(this << filename);
+    NS_ABORT_MSG_IF(!m_file.is_open(), "Cannot open the event trace " << filename);
+    m_file.write(EVENT_TRACE_SIGNATURE, sizeof(EVENT_TRACE_SIGNATURE));
+}
+
+EventTraceWriter::~EventTraceWriter()
+{
+    NS_LOG_FUNCTION(this);
+    m_file.close();
+}
+
+void
+EventTraceWriter::WriteVarint(uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        m_file.put(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    m_file.put(static_cast<char>(value));
+}
+
+void
+EventTraceWriter::WriteTs(uint64_t ts)
+{
+    WriteVarint(ZigZag(static_cast<int64_t>(ts - m_now)));
+}
+
+void
+EventTraceWriter::WriteUid(uint32_t uid)
+{
+    WriteVarint(ZigZag(static_cast<int32_t>(uid - m_lastUid)));
+}
+
+void
+EventTraceWriter::Insert(const Scheduler::EventKey& key)
+{
+    m_file.put(EventTrace::INSERT);
+    WriteTs(key.m_ts);
+    WriteUid(key.m_uid);
+    WriteVarint(key.m_context);
+    m_lastUid = key.m_uid;
+}
+
+void
+EventTraceWriter::RemoveNext(const Scheduler::EventKey& key)
+{
+    m_file.put(EventTrace::REMOVE_NEXT);
+    WriteTs(key.m_ts);
+    m_now = key.m_ts;
+}
+
+void
+EventTraceWriter::Remove(const Scheduler::EventKey& key)
+{
+    m_file.put(EventTrace::REMOVE);
+    WriteTs(key.m_ts);
+    WriteUid(key.m_uid);
+}
+
+void
+EventTraceWriter::Cancel(const Scheduler::EventKey& key)
+{
+    m_file.put(EventTrace::CANCEL);
+    WriteUid(key.m_uid);
+}
+
+EventTraceReader::EventTraceReader(const std::string& filename)
+    : m_file(filename, std::ios::binary),
+      m_now(0),
+      m_lastUid(0)
+{
+    NS_LOG_FUNCTION(this << filename);
+    NS_ABORT_MSG_IF(!m_file.is_open(), "Cannot open the event trace " << filename);
+    char signature[sizeof(EVENT_TRACE_SIGNATURE)];
+    m_file.read(signature, sizeof(signature));
+    NS_ABORT_MSG_IF(!m_file || std::memcmp(signature, EVENT_TRACE_SIGNATURE, sizeof(signature)),
+                    filename << " is not an event trace");
+}
+
+uint64_t
+EventTraceReader::ReadVarint()
+{
+    uint64_t value = 0;
+    for (uint32_t shift = 0; shift < 64; shift += 7)
+    {
+        int byte = m_file.get();
+        NS_ABORT_MSG_IF(byte == std::char_traits<char>::eof(), "Truncated event trace");
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return value;
+        }
+    }
+    NS_FATAL_ERROR("Corrupted event trace");
+    return value;
+}
+
+uint64_t
+EventTraceReader::ReadTs()
+{
+    return m_now + UnZigZag(ReadVarint());
+}
+
+uint32_t
+EventTraceReader::ReadUid()
+{
+    return m_lastUid + static_cast<uint32_t>(UnZigZag(ReadVarint()));
+}
+
+bool
+EventTraceReader::Read(EventTrace::Record& record)
+{
+    int operation = m_file.get();
+    if (operation == std::char_traits<char>::eof())
+    {
+        return false;
+    }
+    record.operation = static_cast<EventTrace::Operation>(operation);
+    record.key.m_context = 0;
+    switch (record.operation)
+    {
+    case EventTrace::INSERT:
+        record.key.m_ts = ReadTs();
+        record.key.m_uid = ReadUid();
+        record.key.m_context = ReadVarint();
+        m_lastUid = record.key.m_uid;
+        break;
+    case EventTrace::REMOVE_NEXT:
+        record.key.m_ts = ReadTs();
+        record.key.m_uid = 0;
+        m_now = record.key.m_ts;
+        break;
+    case EventTrace::REMOVE:
+        record.key.m_ts = ReadTs();
+        record.key.m_uid = ReadUid();
+        break;
+    case EventTrace::CANCEL:
+        record.key.m_ts = 0;
+        record.key.m_uid = ReadUid();
+        break;
+    default:
+        NS_FATAL_ERROR("Corrupted event trace: unknown operation " << operation);
+    }
+    return true;
+}
+
+} // namespace ns3
@@ -0,0 +1,178 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EVENT_TRACE_H
+#define EVENT_TRACE_H
+
+#include "scheduler.h"
+
+#include <fstream>
+#include <stdint.h>
+#include <string>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::EventTraceWriter and ns3::EventTraceReader declarations.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup scheduler
+ *
+ * The operations on the event list recorded in an event trace.
+ *
+ * An event trace is a compact binary stream of the operations of a
+ * simulation on its Scheduler, which can be replayed against any Scheduler
+ * implementation, e.g., by \c utils/bench-scheduler.cc, to compare them on
+ * the event mix of a real scenario.  The DefaultSimulatorImpl records a
+ * trace when its \c EventTraceFile attribute is set, e.g., with
+ *
+ *     NS_ATTRIBUTE_DEFAULT='ns3::DefaultSimulatorImpl::EventTraceFile=events.bin'
+ *
+ * The trace starts with an eight byte signature, followed by one record
+ * per operation: a one byte operation code and its fields, as LEB128
+ * variable length integers.  The timestamps are relative to the timestamp
+ * of the last event removed with RemoveNext(), and the event uids relative
+ * to the uid of the last inserted event, both zigzag encoded, so that a
+ * record takes a few bytes.
+ */
+namespace EventTrace
+{
+
+/** The operations on the event list. */
+enum Operation : uint8_t
+{
+    INSERT = 'I',      //!< Scheduler::Insert: timestamp, uid and context.
+    REMOVE_NEXT = 'N', //!< Scheduler::RemoveNext: timestamp of the event.
+    REMOVE = 'R',      //!< Scheduler::Remove: timestamp and uid.
+    CANCEL = 'C',      //!< EventId::Cancel, which leaves the event in the list: uid.
+};
+
+/** An operation read from a trace. */
+struct Record
+{
+    Operation operation;     //!< The operation.
+    Scheduler::EventKey key; //!< The key of the event, with the fields of the operation.
+};
+
+} // namespace EventTrace
+
+/**
+ * \ingroup scheduler
+ *
+ * Write the operations on an event list to an event trace.
+ */
+class EventTraceWriter
+{
+  public:
+    /**
+     * Open the trace file, aborting on failure.
+     *
+     * \param [in] filename The file name.
+     */
+    EventTraceWriter(const std::string& filename);
+    /** Destructor: flush and close the file. */
+    ~EventTraceWriter();
+
+    /**
+     * Record the insertion of an event.
+     * \param [in] key The key of the event.
+     */
+    void Insert(const Scheduler::EventKey& key);
+    /**
+     * Record the removal of the next event.
+     * \param [in] key The key of the event.
+     */
+    void RemoveNext(const Scheduler::EventKey& key);
+    /**
+     * Record the removal of an event.
+     * \param [in] key The key of the event.
+     */
+    void Remove(const Scheduler::EventKey& key);
+    /**
+     * Record the cancellation of an event.
+     * \param [in] key The key of the event.
+     */
+    void Cancel(const Scheduler::EventKey& key);
+
+  private:
+    /**
+     * Write a variable length integer.
+     * \param [in] value The value.
+     */
+    void WriteVarint(uint64_t value);
+    /**
+     * Write the timestamp of an event, relative to the current time.
+     * \param [in] ts The timestamp.
+     */
+    void WriteTs(uint64_t ts);
+    /**
+     * Write the uid of an event, relative to the last inserted event.
+     * \param [in] uid The uid.
+     */
+    void WriteUid(uint32_t uid);
+
+    std::ofstream m_file; //!< The trace file.
+    uint64_t m_now;       //!< The timestamp of the last event removed with RemoveNext.
+    uint32_t m_lastUid;   //!< The uid of the last inserted event.
+};
+
+/**
+ * \ingroup scheduler
+ *
+ * Read the operations on an event list from an event trace.
+ */
+class EventTraceReader
+{
+  public:
+    /**
+     * Open the trace file, aborting on failure or if the file is not an
+     * event trace.
+     *
+     * \param [in] filename The file name.
+     */
+    EventTraceReader(const std::string& filename);
+
+    /**
+     * Read the next operation.
+     *
+     * \param [out] record The operation, with the absolute timestamp and uid
+     *              of the event.
+     * \returns \c false at the end of the trace
+     */
+    bool Read(EventTrace::Record& record);
+
+  private:
+    /**
+     * Read a variable length integer, aborting at the end of the file.
+     * \returns The value.
+     */
+    uint64_t ReadVarint();
+    /** \returns the timestamp of an event */
+    uint64_t ReadTs();
+    /** \returns the uid of an event */
+    uint32_t ReadUid();
+
+    std::ifstream m_file; //!< The trace file.
+    uint64_t m_now;       //!< The timestamp of the last event removed with RemoveNext.
+    uint32_t m_lastUid;   //!< The uid of the last inserted event.
+};
+
+} // namespace ns3
+
+#endif /* EVENT_TRACE_H */
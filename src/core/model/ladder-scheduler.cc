@@ -0,0 +1,329 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ladder-scheduler.h"
+
+#include "assert.h"
+#include "event-impl.h"
+#include "log.h"
+#include "type-id.h"
+#include "uinteger.h"
+
+#include <algorithm>
+#include <limits>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::LadderScheduler class implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LadderScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED(LadderScheduler);
+
+TypeId
+LadderScheduler::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::LadderScheduler")
+            .SetParent<Scheduler>()
+            .SetGroupName("Core")
+            .AddConstructor<LadderScheduler>()
+            .AddAttribute("Threshold",
+                          "The maximum number of events with different timestamps "
+                          "of a bucket sorted as a whole; larger buckets are "
+                          "subdivided into a new rung.",
+                          UintegerValue(50),
+                          MakeUintegerAccessor(&LadderScheduler::m_threshold),
+                          MakeUintegerChecker<uint32_t>(1));
+    return tid;
+}
+
+LadderScheduler::LadderScheduler()
+    : m_threshold(50),
+      m_topStart(0),
+      m_topMin(std::numeric_limits<uint64_t>::max()),
+      m_topMax(0),
+      m_rungs(MAX_RUNGS),
+      m_nRungs(0),
+      m_head(0),
+      m_count(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+LadderScheduler::~LadderScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+uint64_t
+LadderScheduler::CurrentStart(const Rung& rung)
+{
+    return rung.start + rung.current * rung.width;
+}
+
+void
+LadderScheduler::Insert(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+    ++m_count;
+    uint64_t ts = ev.key.m_ts;
+    if (ts >= m_topStart)
+    {
+        m_top.push_back(ev);
+        m_topMin = std::min(m_topMin, ts);
+        m_topMax = std::max(m_topMax, ts);
+        if (m_head == m_bottom.size())
+        {
+            Refill();
+        }
+        return;
+    }
+    // the rungs are ordered from the latest (and coarsest) to the earliest
+    for (std::size_t i = 0; i < m_nRungs; ++i)
+    {
+        Rung& rung = m_rungs[i];
+        if (ts >= CurrentStart(rung))
+        {
+            rung.buckets[(ts - rung.start) / rung.width].push_back(ev);
+            ++rung.count;
+            if (m_head == m_bottom.size())
+            {
+                Refill();
+            }
+            return;
+        }
+    }
+    InsertBottom(ev);
+    if (m_head == m_bottom.size())
+    {
+        Refill();
+    }
+}
+
+void
+LadderScheduler::InsertBottom(const Event& ev)
+{
+    if (m_head == m_bottom.size())
+    {
+        m_bottom.clear();
+        m_head = 0;
+    }
+    if (m_bottom.empty() || !(ev < m_bottom.back()))
+    {
+        // e.g., an event scheduled for the same time as the current ones
+        m_bottom.push_back(ev);
+        return;
+    }
+    if (m_bottom.size() - m_head > m_threshold && m_nRungs < MAX_RUNGS &&
+        m_bottom[m_head].key.m_ts != m_bottom.back().key.m_ts)
+    {
+        // subdivide the bottom into a new rung rather than sorting it
+        uint64_t limit = m_nRungs > 0 ? CurrentStart(m_rungs[m_nRungs - 1]) : m_topStart;
+        uint64_t start = std::min(ev.key.m_ts, m_bottom[m_head].key.m_ts);
+        SpawnRung(m_bottom.begin() + m_head, m_bottom.end(), start, limit);
+        Rung& rung = m_rungs[m_nRungs - 1];
+        rung.buckets[(ev.key.m_ts - rung.start) / rung.width].push_back(ev);
+        ++rung.count;
+        m_bottom.clear();
+        m_head = 0;
+        return;
+    }
+    auto it = std::upper_bound(m_bottom.begin() + m_head, m_bottom.end(), ev);
+    m_bottom.insert(it, ev);
+}
+
+void
+LadderScheduler::SpawnRung(Bucket::const_iterator begin,
+                           Bucket::const_iterator end,
+                           uint64_t start,
+                           uint64_t limit)
+{
+    NS_LOG_FUNCTION(this << start << limit);
+    NS_ASSERT(m_nRungs < MAX_RUNGS);
+    NS_ASSERT(limit > start);
+    Rung& rung = m_rungs[m_nRungs++];
+    uint64_t count = std::max<uint64_t>(end - begin, 1);
+    uint64_t span = limit - start;
+    // about one event per bucket
+    rung.width = span / count + (span % count != 0 ? 1 : 0);
+    rung.nBuckets = span / rung.width + (span % rung.width != 0 ? 1 : 0);
+    rung.start = start;
+    rung.current = 0;
+    rung.count = end - begin;
+    if (rung.buckets.size() < rung.nBuckets)
+    {
+        rung.buckets.resize(rung.nBuckets);
+    }
+    for (auto it = begin; it != end; ++it)
+    {
+        rung.buckets[(it->key.m_ts - start) / rung.width].push_back(*it);
+    }
+}
+
+void
+LadderScheduler::MoveToBottom(Bucket& bucket)
+{
+    m_bottom.clear();
+    m_head = 0;
+    m_bottom.swap(bucket);
+    // the events of the same time are usually inserted in order
+    if (!std::is_sorted(m_bottom.begin(), m_bottom.end()))
+    {
+        std::sort(m_bottom.begin(), m_bottom.end());
+    }
+}
+
+void
+LadderScheduler::Refill()
+{
+    while (m_head == m_bottom.size() && m_count > 0)
+    {
+        if (m_nRungs == 0)
+        {
+            NS_ASSERT(!m_top.empty());
+            if (m_top.size() <= m_threshold || m_topMin == m_topMax)
+            {
+                m_topStart = m_topMax + 1;
+                MoveToBottom(m_top);
+            }
+            else
+            {
+                SpawnRung(m_top.begin(), m_top.end(), m_topMin, m_topMax + 1);
+                const Rung& rung = m_rungs[0];
+                m_topStart = rung.start + rung.nBuckets * rung.width;
+                m_top.clear();
+            }
+            m_topMin = std::numeric_limits<uint64_t>::max();
+            m_topMax = 0;
+            continue;
+        }
+
+        Rung& rung = m_rungs[m_nRungs - 1];
+        if (rung.count == 0)
+        {
+            --m_nRungs;
+            continue;
+        }
+        while (rung.buckets[rung.current].empty())
+        {
+            ++rung.current;
+        }
+        Bucket& bucket = rung.buckets[rung.current];
+        ++rung.current;
+        rung.count -= bucket.size();
+        if (bucket.size() > m_threshold && m_nRungs < MAX_RUNGS)
+        {
+            auto [first, last] = std::minmax_element(
+                bucket.begin(),
+                bucket.end(),
+                [](const Event& a, const Event& b) { return a.key.m_ts < b.key.m_ts; });
+            if (first->key.m_ts != last->key.m_ts)
+            {
+                SpawnRung(bucket.begin(), bucket.end(), first->key.m_ts, CurrentStart(rung));
+                bucket.clear();
+                continue;
+            }
+        }
+        MoveToBottom(bucket);
+    }
+}
+
+bool
+LadderScheduler::IsEmpty() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_count == 0;
+}
+
+Scheduler::Event
+LadderScheduler::PeekNext() const
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(m_head < m_bottom.size());
+    return m_bottom[m_head];
+}
+
+Scheduler::Event
+LadderScheduler::RemoveNext()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(m_head < m_bottom.size());
+    Event ev = m_bottom[m_head++];
+    --m_count;
+    if (m_head == m_bottom.size())
+    {
+        Refill();
+    }
+    else if (m_head > m_threshold && 2 * m_head > m_bottom.size())
+    {
+        // do not let a bottom which is never emptied grow forever
+        m_bottom.erase(m_bottom.begin(), m_bottom.begin() + m_head);
+        m_head = 0;
+    }
+    return ev;
+}
+
+void
+LadderScheduler::Remove(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+    uint64_t ts = ev.key.m_ts;
+    Bucket* bucket = nullptr;
+    if (ts >= m_topStart)
+    {
+        bucket = &m_top;
+    }
+    else
+    {
+        for (std::size_t i = 0; i < m_nRungs; ++i)
+        {
+            Rung& rung = m_rungs[i];
+            if (ts >= CurrentStart(rung))
+            {
+                bucket = &rung.buckets[(ts - rung.start) / rung.width];
+                --rung.count;
+                break;
+            }
+        }
+    }
+
+    if (bucket != nullptr)
+    {
+        auto it = std::find(bucket->begin(), bucket->end(), ev);
+        NS_ASSERT_MSG(it != bucket->end(),
+                      "Event not found " << ev.key.m_ts << " " << ev.key.m_uid);
+        bucket->erase(it);
+    }
+    else
+    {
+        auto it = std::lower_bound(m_bottom.begin() + m_head, m_bottom.end(), ev);
+        NS_ASSERT_MSG(it != m_bottom.end() && *it == ev,
+                      "Event not found " << ev.key.m_ts << " " << ev.key.m_uid);
+        m_bottom.erase(it);
+    }
+    --m_count;
+    if (m_head == m_bottom.size())
+    {
+        Refill();
+    }
+}
+
+} // namespace ns3
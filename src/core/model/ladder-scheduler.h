@@ -0,0 +1,171 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LADDER_SCHEDULER_H
+#define LADDER_SCHEDULER_H
+
+#include "scheduler.h"
+
+#include <stdint.h>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::LadderScheduler declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup scheduler
+ * \brief a ladder queue event scheduler
+ *
+ * This event scheduler is an implementation of the ladder queue described in
+ * ["Ladder Queue: An O(1) Priority Queue Structure for Large-Scale Discrete
+ * Event Simulation" by Wai Teng Tang, Rick Siow Mong Goh and Ian Li-Jin
+ * Thng][Tang].
+ *
+ * [Tang]: https://doi.org/10.1145/1103323.1103324 "Tang"
+ *
+ * The events are kept in three tiers:
+ *  - the \em top, an unsorted vector of the far future events;
+ *  - the \em rungs, arrays of buckets, each bucket an unsorted vector
+ *    covering a uniform time span.  The first rung is created from the top,
+ *    with about one event per bucket, and each further rung subdivides a
+ *    bucket of the previous rung holding more than \c Threshold events;
+ *  - the \em bottom, a sorted vector of the earliest events.
+ *
+ * The events are only sorted when a bucket is moved to the bottom, so that
+ * most insertions are an append to a vector.  Unlike the original
+ * algorithm, a bucket whose events all have the same timestamp is never
+ * subdivided, and is not sorted if the events were inserted in order,
+ * which is the common case of the bursts of events scheduled for the same
+ * instant, such as the slot boundaries of many devices.  For the same
+ * reason an event later than all the events of the bottom is appended to
+ * it.  The storage of the buckets is kept across rungs to avoid the
+ * allocations.
+ *
+ * \par Time Complexity
+ *
+ * Operation    | Amortized %Time | Reason
+ * :----------- | :-------------- | :-----
+ * Insert()     | ~Constant       | Append to a bucket; insertion in the bottom
+ * IsEmpty()    | Constant        | Explicit queue size
+ * PeekNext()   | Constant        | Bottom kept sorted
+ * Remove()     | ~Constant       | Search within a bucket
+ * RemoveNext() | ~Constant       | Sort of small buckets; rung creation
+ *
+ * \par Memory Complexity
+ *
+ * Category  | Memory                           | Reason
+ * :-------- | :------------------------------- | :-----
+ * Overhead  | 8 rungs, 3 x `sizeof (*)` per bucket | `std::vector` per bucket
+ * Per Event | 0                                | Events stored in `std::vector` directly
+ */
+class LadderScheduler : public Scheduler
+{
+  public:
+    /**
+     *  Register this type.
+     *  \return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    LadderScheduler();
+    /** Destructor. */
+    ~LadderScheduler() override;
+
+    // Inherited
+    void Insert(const Scheduler::Event& ev) override;
+    bool IsEmpty() const override;
+    Scheduler::Event PeekNext() const override;
+    Scheduler::Event RemoveNext() override;
+    void Remove(const Scheduler::Event& ev) override;
+
+  private:
+    /** Event list type: a vector of events. */
+    typedef std::vector<Scheduler::Event> Bucket;
+
+    /** A rung: buckets of uniform width, consumed in time order. */
+    struct Rung
+    {
+        uint64_t start;              //!< Timestamp of the start of the first bucket.
+        uint64_t width;              //!< Time span of each bucket, at least 1.
+        std::size_t nBuckets;        //!< Number of buckets in use.
+        std::size_t current;         //!< Index of the first bucket not consumed yet.
+        std::size_t count;           //!< Number of events in the rung.
+        std::vector<Bucket> buckets; //!< The buckets, at least \c nBuckets.
+    };
+
+    /** The maximum number of rungs. */
+    static constexpr std::size_t MAX_RUNGS = 8;
+
+    /**
+     * \param [in] rung The rung.
+     * \returns the timestamp of the start of the first bucket not consumed yet
+     */
+    static uint64_t CurrentStart(const Rung& rung);
+
+    /**
+     * Create a new rung from events later than the last rung.
+     *
+     * \param [in] begin The first event.
+     * \param [in] end Past the last event.
+     * \param [in] start The earliest timestamp of the events.
+     * \param [in] limit The end of the span of the rung, excluded.
+     */
+    void SpawnRung(Bucket::const_iterator begin,
+                   Bucket::const_iterator end,
+                   uint64_t start,
+                   uint64_t limit);
+
+    /**
+     * Insert an event in the bottom, keeping it sorted.
+     *
+     * \param [in] ev The event.
+     */
+    void InsertBottom(const Scheduler::Event& ev);
+
+    /**
+     * Replace the (empty) bottom with a bucket, and sort it if needed.
+     *
+     * \param [in,out] bucket The bucket, emptied.
+     */
+    void MoveToBottom(Bucket& bucket);
+
+    /** Fill the bottom from the rungs or the top when it is empty. */
+    void Refill();
+
+    uint32_t m_threshold; //!< The maximum size of a bucket moved to the bottom.
+
+    Bucket m_top;        //!< The far future events, unsorted.
+    uint64_t m_topStart; //!< The earliest timestamp of the events of the top.
+    uint64_t m_topMin;   //!< The minimum timestamp of the events of the top.
+    uint64_t m_topMax;   //!< The maximum timestamp of the events of the top.
+
+    std::vector<Rung> m_rungs; //!< The rungs, with storage for MAX_RUNGS.
+    std::size_t m_nRungs;      //!< The number of rungs in use.
+
+    Bucket m_bottom;     //!< The earliest events, sorted.
+    std::size_t m_head;  //!< Index of the first event of the bottom.
+    std::size_t m_count; //!< The number of events.
+};
+
+} // namespace ns3
+
+#endif /* LADDER_SCHEDULER_H */
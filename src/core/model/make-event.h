@@ -21,9 +21,13 @@
 
 #include "warnings.h"
 
+#include <algorithm>
+#include <cstring>
 #include <functional>
+#include <string>
 #include <tuple>
 #include <type_traits>
+#include <typeinfo>
 
 /**
  * \file
@@ -101,6 +105,83 @@ namespace ns3
 namespace internal
 {
 
+/**
+ * \ingroup events
+ * \param [in] type The type.
+ * \returns the demangled name of the type
+ */
+std::string GetTypeName(const std::type_info& type);
+
+/**
+ * \ingroup events
+ * The name of a function, from the dynamic symbol table.
+ *
+ * \param [in] function The address of the function.
+ * \returns the demangled name of the function, or its address if not found
+ */
+std::string GetFunctionName(const void* function);
+
+/**
+ * \ingroup events
+ * The name of a member function, from the dynamic symbol table.
+ *
+ * Resolving a virtual member function requires the object.
+ *
+ * \param [in] self The object, converted to the class of the member function, or nullptr.
+ * \param [in] function The member function pointer.
+ * \param [in] size The size of the member function pointer.
+ * \param [in] type The class of the member function.
+ * \returns the demangled name of the member function, or the class name
+ * and the bytes of the pointer if not found
+ */
+std::string GetMemberFunctionName(const void* self,
+                                  const void* function,
+                                  std::size_t size,
+                                  const std::type_info& type);
+
+/**
+ * \ingroup events
+ * Make the target of an event from the type of the event and its function.
+ *
+ * \tparam F \deduced The type of the function or member function pointer.
+ * \param [in] type The dynamic type of the event.
+ * \param [in] function The function or member function pointer.
+ * \returns the target
+ */
+template <typename F>
+EventImpl::Target
+MakeEventTarget(const std::type_info& type, const F& function)
+{
+    EventImpl::Target target{&type, {0, 0}};
+    std::memcpy(target.function, &function, std::min(sizeof(F), sizeof(target.function)));
+    return target;
+}
+
+/**
+ * \ingroup events
+ * The class of a member pointer type.
+ *
+ * This is the generic template declaration (with empty body).
+ *
+ * \tparam T \explicit The member pointer type.
+ */
+template <typename T>
+struct MemberClass;
+
+/**
+ * \ingroup events
+ * The class of a member pointer type.
+ *
+ * \tparam T \deduced The type of the member.
+ * \tparam C \deduced The class.
+ */
+template <typename T, typename C>
+struct MemberClass<T C::*>
+{
+    /** The class. */
+    using Type = C;
+};
+
 /**
  * \ingroup events
  * Helper for the MakeEvent functions which take a class method.
@@ -143,13 +224,17 @@ template <typename MEM, typename OBJ, typename... Ts>
 std::enable_if_t<std::is_member_pointer_v<MEM>, EventImpl*>
 MakeEvent(MEM mem_ptr, OBJ obj, Ts... args)
 {
+    // The object and the arguments are stored in the event itself, so that
+    // the event is a single allocation from the EventImpl free lists.
     class EventMemberImpl : public EventImpl
     {
       public:
         EventMemberImpl() = delete;
 
         EventMemberImpl(OBJ obj, MEM function, Ts... args)
-            : m_function(std::bind(function, obj, args...))
+            : m_obj(obj),
+              m_function(function),
+              m_arguments(args...)
         {
         }
 
@@ -158,13 +243,38 @@ MakeEvent(MEM mem_ptr, OBJ obj, Ts... args)
         {
         }
 
+        Target GetTarget() const override
+        {
+            return internal::MakeEventTarget(typeid(EventMemberImpl), m_function);
+        }
+
+        std::string GetTargetName() const override
+        {
+            using Class = typename internal::MemberClass<MEM>::Type;
+            const Class* self = nullptr;
+            if constexpr (requires(const OBJ& o) {
+                              static_cast<bool>(o);
+                              static_cast<const Class*>(&*o);
+                          })
+            {
+                if (m_obj)
+                {
+                    self = static_cast<const Class*>(&*m_obj);
+                }
+            }
+            return internal::GetMemberFunctionName(self, &m_function, sizeof(MEM), typeid(Class));
+        }
+
       private:
         void Notify() override
         {
-            m_function();
+            std::apply([this](auto&... args) { std::invoke(m_function, m_obj, args...); },
+                       m_arguments);
         }
 
-        std::function<void()> m_function;
+        OBJ m_obj;
+        MEM m_function;
+        std::tuple<std::remove_reference_t<Ts>...> m_arguments;
     }* ev = new EventMemberImpl(obj, mem_ptr, args...);
 
     return ev;
@@ -183,6 +293,16 @@ MakeEvent(void (*f)(Us...), Ts... args)
         {
         }
 
+        Target GetTarget() const override
+        {
+            return internal::MakeEventTarget(typeid(EventFunctionImpl), m_function);
+        }
+
+        std::string GetTargetName() const override
+        {
+            return internal::GetFunctionName(reinterpret_cast<const void*>(m_function));
+        }
+
       protected:
         ~EventFunctionImpl() override
         {
@@ -191,7 +311,7 @@ MakeEvent(void (*f)(Us...), Ts... args)
       private:
         void Notify() override
         {
-            std::apply([this](Ts... args) { (*m_function)(args...); }, m_arguments);
+            std::apply([this](auto&... args) { (*m_function)(args...); }, m_arguments);
         }
 
         void (*m_function)(Us...);
@@ -217,6 +337,11 @@ MakeEvent(T function)
         {
         }
 
+        std::string GetTargetName() const override
+        {
+            return internal::GetTypeName(typeid(T));
+        }
+
       private:
         void Notify() override
         {
@@ -0,0 +1,299 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MPSC_QUEUE_H
+#define MPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::MpscQueue declaration and template implementation.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup simulator
+ *
+ * \brief A multiple producer, single consumer queue, used to pass the
+ * events scheduled by other threads to the thread of the simulation.
+ *
+ * The queue is a bounded ring of cells, each with a sequence number which
+ * tells whether it is free for the producer of a given position or holds
+ * the item of that position for the consumer.  A producer claims a position
+ * with a compare-and-swap and publishes its item with a release store, so
+ * that neither side takes a lock.
+ *
+ * When the ring is full, the producers fall back on a list protected by a
+ * mutex, so that Push() never blocks on the consumer and never drops an
+ * item, even when the consumer is not running.  The items of a producer
+ * are drained in the order in which it pushed them: once an item is in the
+ * overflow list, all the producers push to the list until the consumer has
+ * drained it.
+ *
+ * The ring is allocated by the first Push(), so that a simulation in which
+ * no other thread schedules events does not pay for it.
+ *
+ * \tparam T \explicit The type of the items, which must be default
+ * constructible and copyable.
+ */
+template <typename T>
+class MpscQueue
+{
+  public:
+    /**
+     * Constructor.
+     *
+     * \param [in] capacity The capacity of the ring, rounded up to a power of two.
+     */
+    MpscQueue(std::size_t capacity = 4096);
+
+    /** Destructor. */
+    ~MpscQueue();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /**
+     * Add an item, from any thread.
+     *
+     * \param [in] item The item.
+     * \returns true if no item was pending, i.e., if the consumer may have
+     * to be woken up
+     */
+    bool Push(const T& item);
+
+    /**
+     * \returns true if an item may have been pushed since the last Drain()
+     *
+     * This is a hint for the consumer, which costs one relaxed load.
+     */
+    bool IsPending() const;
+
+    /**
+     * Remove the items pushed so far and pass them to a function, in order,
+     * from the consumer thread only.
+     *
+     * An item pushed concurrently may be left for the next call.
+     *
+     * \tparam F \deduced The type of the function.
+     * \param [in] f The function, called with each item.
+     * \returns the number of items removed
+     */
+    template <typename F>
+    std::size_t Drain(F&& f);
+
+  private:
+    /** A cell of the ring. */
+    struct alignas(64) Cell
+    {
+        /**
+         * The position for which the cell is free if equal to it, or
+         * holds an item if equal to the position plus one.
+         */
+        std::atomic<std::size_t> sequence;
+        T item; //!< The item.
+    };
+
+    /**
+     * Allocate the ring, if no other producer has.
+     * \returns the cells of the ring
+     */
+    Cell* Allocate();
+
+    /**
+     * Push an item in the ring.
+     * \param [in] item The item.
+     * \returns false if the ring is full
+     */
+    bool TryPush(const T& item);
+
+    std::atomic<Cell*> m_cells; //!< The cells of the ring, null until the first push.
+    std::size_t m_mask;         //!< The capacity of the ring minus one.
+    /** The next position of the producers. */
+    alignas(64) std::atomic<std::size_t> m_pushPosition;
+    /** Flag \c true if an item may have been pushed since the last Drain(). */
+    alignas(64) std::atomic<bool> m_pending;
+    /** Flag \c true if the overflow list holds items. */
+    std::atomic<bool> m_overflowing;
+    /** The mutex of the overflow list, and of the allocation of the ring. */
+    std::mutex m_overflowMutex;
+    /** The items pushed while the ring was full. */
+    std::vector<T> m_overflow;
+    /** The next position of the consumer. */
+    alignas(64) std::size_t m_popPosition;
+};
+
+/*************************************************************************
+ *  Implementation of the templates declared above.
+ *************************************************************************/
+
+template <typename T>
+MpscQueue<T>::MpscQueue(std::size_t capacity)
+    : m_cells(nullptr),
+      m_pushPosition(0),
+      m_pending(false),
+      m_overflowing(false),
+      m_popPosition(0)
+{
+    std::size_t size = 2;
+    while (size < capacity)
+    {
+        size *= 2;
+    }
+    m_mask = size - 1;
+}
+
+template <typename T>
+MpscQueue<T>::~MpscQueue()
+{
+    delete[] m_cells.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+typename MpscQueue<T>::Cell*
+MpscQueue<T>::Allocate()
+{
+    std::unique_lock lock{m_overflowMutex};
+    Cell* cells = m_cells.load(std::memory_order_relaxed);
+    if (cells == nullptr)
+    {
+        cells = new Cell[m_mask + 1];
+        for (std::size_t i = 0; i <= m_mask; ++i)
+        {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        // publishes the sequences to the producers and to the consumer
+        m_cells.store(cells, std::memory_order_release);
+    }
+    return cells;
+}
+
+template <typename T>
+bool
+MpscQueue<T>::TryPush(const T& item)
+{
+    Cell* cells = m_cells.load(std::memory_order_acquire);
+    if (cells == nullptr)
+    {
+        cells = Allocate();
+    }
+    std::size_t position = m_pushPosition.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        Cell& cell = cells[position & m_mask];
+        std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(sequence - position);
+        if (diff == 0)
+        {
+            if (m_pushPosition.compare_exchange_weak(position,
+                                                     position + 1,
+                                                     std::memory_order_relaxed))
+            {
+                cell.item = item;
+                cell.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            // the consumer has not freed the cell of the previous round
+            return false;
+        }
+        else
+        {
+            position = m_pushPosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+bool
+MpscQueue<T>::Push(const T& item)
+{
+    if (m_overflowing.load(std::memory_order_acquire) || !TryPush(item))
+    {
+        std::unique_lock lock{m_overflowMutex};
+        m_overflow.push_back(item);
+        m_overflowing.store(true, std::memory_order_release);
+    }
+    return !m_pending.exchange(true, std::memory_order_acq_rel);
+}
+
+template <typename T>
+bool
+MpscQueue<T>::IsPending() const
+{
+    return m_pending.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+template <typename F>
+std::size_t
+MpscQueue<T>::Drain(F&& f)
+{
+    // cleared first, so that an item published during the drain sets it
+    // again; the exchange also acquires the items published before
+    m_pending.exchange(false, std::memory_order_acq_rel);
+    std::size_t count = 0;
+    // null if nothing was pushed yet, and then the ring is empty
+    Cell* cells = m_cells.load(std::memory_order_acquire);
+    while (cells != nullptr)
+    {
+        Cell& cell = cells[m_popPosition & m_mask];
+        if (cell.sequence.load(std::memory_order_acquire) != m_popPosition + 1)
+        {
+            // empty, or the producer of this position has not published yet
+            break;
+        }
+        f(cell.item);
+        cell.sequence.store(m_popPosition + m_mask + 1, std::memory_order_release);
+        ++m_popPosition;
+        ++count;
+    }
+    if (m_pushPosition.load(std::memory_order_relaxed) != m_popPosition)
+    {
+        // an item is not published yet: the overflow list, which holds later
+        // items, waits for the next drain, and its producer sets m_pending
+        // when it publishes the item
+        return count;
+    }
+    if (m_overflowing.load(std::memory_order_acquire))
+    {
+        std::vector<T> overflow;
+        {
+            std::unique_lock lock{m_overflowMutex};
+            overflow.swap(m_overflow);
+            m_overflowing.store(false, std::memory_order_release);
+        }
+        for (const auto& item : overflow)
+        {
+            f(item);
+        }
+        count += overflow.size();
+    }
+    return count;
+}
+
+} // namespace ns3
+
+#endif /* MPSC_QUEUE_H */
@@ -0,0 +1,637 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "multithreaded-simulator-impl.h"
+
+#include "abort.h"
+#include "assert.h"
+#include "log.h"
+#include "simulator.h"
+#include "uinteger.h"
+
+#include <algorithm>
+#include <barrier>
+#include <thread>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::MultithreadedSimulatorImpl implementation.
+ */
+
+namespace ns3
+{
+
+// Note: as in DefaultSimulatorImpl, logging is avoided in the functions
+// called for every event.
+NS_LOG_COMPONENT_DEFINE("MultithreadedSimulatorImpl");
+
+NS_OBJECT_ENSURE_REGISTERED(MultithreadedSimulatorImpl);
+
+namespace
+{
+
+/** The largest timestamp, used as infinity. */
+const uint64_t MAX_TS = 0x7fffffffffffffffULL;
+
+} // unnamed namespace
+
+thread_local MultithreadedSimulatorImpl::Partition* MultithreadedSimulatorImpl::m_currentPartition =
+    nullptr;
+
+TypeId
+MultithreadedSimulatorImpl::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::MultithreadedSimulatorImpl")
+            .SetParent<SimulatorImpl>()
+            .SetGroupName("Core")
+            .AddConstructor<MultithreadedSimulatorImpl>()
+            .AddAttribute("PartitionCount",
+                          "The number of partitions, each run by its own thread.",
+                          UintegerValue(2),
+                          MakeUintegerAccessor(&MultithreadedSimulatorImpl::m_partitionCount),
+                          MakeUintegerChecker<uint32_t>(1));
+    return tid;
+}
+
+MultithreadedSimulatorImpl::MultithreadedSimulatorImpl()
+    : m_partitionCount(2),
+      m_lookAheadBound(MAX_TS),
+      m_lookAhead(MAX_TS),
+      m_running(false),
+      m_stop(false),
+      m_done(false),
+      m_windowEnd(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+MultithreadedSimulatorImpl::~MultithreadedSimulatorImpl()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+MultithreadedSimulatorImpl::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    for (auto& partition : m_partitions)
+    {
+        while (!partition.events->IsEmpty())
+        {
+            Scheduler::Event next = partition.events->RemoveNext();
+            next.impl->Unref();
+        }
+        partition.events = nullptr;
+        for (auto& outbox : partition.outbox)
+        {
+            for (auto& ev : outbox)
+            {
+                ev.impl->Unref();
+            }
+        }
+    }
+    m_partitions.clear();
+    m_stopEvents.clear();
+    SimulatorImpl::DoDispose();
+}
+
+void
+MultithreadedSimulatorImpl::Destroy()
+{
+    NS_LOG_FUNCTION(this);
+    while (!m_destroyEvents.empty())
+    {
+        Ptr<EventImpl> ev = m_destroyEvents.front().PeekEventImpl();
+        m_destroyEvents.pop_front();
+        NS_LOG_LOGIC("handle destroy " << ev);
+        if (!ev->IsCancelled())
+        {
+            ev->Invoke();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::SetScheduler(ObjectFactory schedulerFactory)
+{
+    NS_LOG_FUNCTION(this << schedulerFactory);
+    NS_ASSERT_MSG(!m_running, "Cannot change the scheduler during Simulator::Run");
+
+    if (m_partitions.empty())
+    {
+        // the attributes are set by now, since the Simulator sets the
+        // scheduler right after creating the implementation
+        m_partitions = std::vector<Partition>(m_partitionCount);
+        for (uint32_t i = 0; i < m_partitionCount; ++i)
+        {
+            Partition& partition = m_partitions[i];
+            partition.id = i;
+            partition.simulator = this;
+            partition.currentTs = 0;
+            partition.currentContext = Simulator::NO_CONTEXT;
+            partition.currentUid = EventId::UID::INVALID;
+            partition.uid = EventId::UID::VALID;
+            partition.eventCount = 0;
+            partition.nextTs = MAX_TS;
+            partition.outbox.resize(m_partitionCount);
+        }
+    }
+
+    for (auto& partition : m_partitions)
+    {
+        Ptr<Scheduler> scheduler = schedulerFactory.Create<Scheduler>();
+        if (partition.events)
+        {
+            while (!partition.events->IsEmpty())
+            {
+                scheduler->Insert(partition.events->RemoveNext());
+            }
+        }
+        partition.events = scheduler;
+    }
+}
+
+// System ID for non-distributed simulation is always zero
+uint32_t
+MultithreadedSimulatorImpl::GetSystemId() const
+{
+    return 0;
+}
+
+void
+MultithreadedSimulatorImpl::SetPartition(uint32_t context, uint32_t partition)
+{
+    NS_LOG_FUNCTION(this << context << partition);
+    NS_ASSERT_MSG(!m_running, "Cannot change the partitions during Simulator::Run");
+    NS_ABORT_MSG_IF(partition >= m_partitionCount,
+                    "Partition " << partition << " out of range, there are " << m_partitionCount
+                                 << " partitions");
+    NS_ABORT_MSG_IF(context == Simulator::NO_CONTEXT,
+                    "The events without a context belong to the first partition");
+    if (context >= m_contextToPartition.size())
+    {
+        m_contextToPartition.resize(context + 1, Simulator::NO_CONTEXT);
+    }
+    m_contextToPartition[context] = partition;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetPartition(uint32_t context) const
+{
+    if (context == Simulator::NO_CONTEXT)
+    {
+        return 0;
+    }
+    if (context < m_contextToPartition.size() &&
+        m_contextToPartition[context] != Simulator::NO_CONTEXT)
+    {
+        return m_contextToPartition[context];
+    }
+    return context % m_partitionCount;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetPartitionCount() const
+{
+    return m_partitionCount;
+}
+
+void
+MultithreadedSimulatorImpl::BoundLookAhead(const Time& lookAhead)
+{
+    NS_LOG_FUNCTION(this << lookAhead);
+    NS_ABORT_MSG_IF(!lookAhead.IsStrictlyPositive(), "The lookahead must be > 0");
+    m_lookAheadBound = std::min<uint64_t>(m_lookAheadBound, lookAhead.GetTimeStep());
+}
+
+Time
+MultithreadedSimulatorImpl::GetLookAhead() const
+{
+    uint64_t lookAhead = m_lookAheadBound;
+    for (const auto& declaration : m_declarations)
+    {
+        if (GetPartition(declaration.contextA) != GetPartition(declaration.contextB))
+        {
+            lookAhead = std::min(lookAhead, declaration.delay);
+        }
+    }
+    return TimeStep(lookAhead);
+}
+
+void
+MultithreadedSimulatorImpl::DeclareLookAhead(uint32_t contextA,
+                                             uint32_t contextB,
+                                             const Time& delay)
+{
+    NS_LOG_FUNCTION(contextA << contextB << delay);
+    Ptr<MultithreadedSimulatorImpl> impl =
+        DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+    if (!impl)
+    {
+        return;
+    }
+    NS_ASSERT_MSG(!impl->m_running, "Cannot declare a lookahead during Simulator::Run");
+    NS_ABORT_MSG_IF(delay.IsNegative(), "Negative lookahead");
+    impl->m_declarations.push_back({contextA, contextB, (uint64_t)delay.GetTimeStep()});
+}
+
+bool
+MultithreadedSimulatorImpl::IsRemoteContext(uint32_t context)
+{
+    return m_currentPartition &&
+           m_currentPartition->simulator->GetPartition(context) != m_currentPartition->id;
+}
+
+MultithreadedSimulatorImpl::Partition&
+MultithreadedSimulatorImpl::GetCurrentPartition() const
+{
+    if (m_currentPartition)
+    {
+        return *m_currentPartition;
+    }
+    NS_ABORT_MSG_IF(m_running,
+                    "MultithreadedSimulatorImpl: thread-unsafe invocation from a thread that "
+                    "is not running a partition");
+    return const_cast<Partition&>(m_partitions[0]);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::Insert(Partition& partition,
+                                   uint64_t ts,
+                                   uint32_t context,
+                                   EventImpl* event)
+{
+    Scheduler::Event ev;
+    ev.impl = event;
+    ev.key.m_ts = ts;
+    ev.key.m_context = context;
+    ev.key.m_uid = partition.uid;
+    partition.uid++;
+    partition.events->Insert(ev);
+    return ev.key.m_uid;
+}
+
+void
+MultithreadedSimulatorImpl::MergeInbound(Partition& partition)
+{
+    for (auto& source : m_partitions)
+    {
+        auto& inbound = source.outbox[partition.id];
+        for (auto& ev : inbound)
+        {
+            ev.key.m_uid = partition.uid;
+            partition.uid++;
+            partition.events->Insert(ev);
+        }
+        inbound.clear();
+    }
+    partition.nextTs =
+        partition.events->IsEmpty() ? MAX_TS : partition.events->PeekNext().key.m_ts;
+}
+
+void
+MultithreadedSimulatorImpl::ComputeWindow()
+{
+    uint64_t next = MAX_TS;
+    for (const auto& partition : m_partitions)
+    {
+        next = std::min(next, partition.nextTs);
+    }
+
+    // the pending Stop(delay) events cap the window, so that no partition
+    // runs past the stop time
+    uint64_t stopTs = MAX_TS;
+    for (auto it = m_stopEvents.begin(); it != m_stopEvents.end();)
+    {
+        if (it->PeekEventImpl()->IsCancelled() || it->GetTs() < next)
+        {
+            it = m_stopEvents.erase(it);
+        }
+        else
+        {
+            stopTs = std::min(stopTs, it->GetTs());
+            ++it;
+        }
+    }
+
+    if (m_stop || next == MAX_TS)
+    {
+        m_done = true;
+        return;
+    }
+    m_windowEnd = std::min(next + m_lookAhead, stopTs + 1);
+}
+
+void
+MultithreadedSimulatorImpl::ProcessWindow(Partition& partition)
+{
+    while (!partition.events->IsEmpty() && partition.events->PeekNext().key.m_ts < m_windowEnd)
+    {
+        Scheduler::Event next = partition.events->RemoveNext();
+
+        PreEventHook(EventId(next.impl, next.key.m_ts, next.key.m_context, next.key.m_uid));
+
+        NS_ASSERT(next.key.m_ts >= partition.currentTs);
+        // only this thread writes the count
+        partition.eventCount.store(partition.eventCount.load(std::memory_order_relaxed) + 1,
+                                   std::memory_order_relaxed);
+        partition.currentTs = next.key.m_ts;
+        partition.currentContext = next.key.m_context;
+        partition.currentUid = next.key.m_uid;
+        next.impl->Invoke();
+        next.impl->Unref();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsFinished() const
+{
+    if (m_stop)
+    {
+        return true;
+    }
+    for (const auto& partition : m_partitions)
+    {
+        if (!partition.events->IsEmpty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+MultithreadedSimulatorImpl::Run()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT_MSG(!m_running, "Simulator::Run is not reentrant");
+
+    m_lookAhead = GetLookAhead().GetTimeStep();
+    NS_ABORT_MSG_IF(m_lookAhead == 0,
+                    "Zero lookahead between two partitions: map the contexts that interact "
+                    "without delay to the same partition");
+    NS_LOG_INFO("Running " << m_partitionCount << " partitions with a lookahead of "
+                           << TimeStep(m_lookAhead));
+
+    m_stop = false;
+    m_done = false;
+    m_windowEnd = 0;
+
+    // Two synchronization points per window: after the events of the
+    // window, so that the buffered events are complete, and after the
+    // merge, when the last thread to arrive computes the next window.
+    std::barrier windowDone(m_partitionCount);
+    std::barrier mergeDone(m_partitionCount, [this]() noexcept { ComputeWindow(); });
+
+    auto runPartition = [this, &windowDone, &mergeDone](Partition& partition) {
+        m_currentPartition = &partition;
+        while (true)
+        {
+            windowDone.arrive_and_wait();
+            MergeInbound(partition);
+            mergeDone.arrive_and_wait();
+            if (m_done)
+            {
+                break;
+            }
+            ProcessWindow(partition);
+        }
+        m_currentPartition = nullptr;
+    };
+
+    m_running = true;
+    std::vector<std::thread> threads;
+    threads.reserve(m_partitionCount - 1);
+    for (uint32_t i = 1; i < m_partitionCount; ++i)
+    {
+        threads.emplace_back(runPartition, std::ref(m_partitions[i]));
+    }
+    runPartition(m_partitions[0]);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    m_running = false;
+
+    // All the pending events are later than the end of the last window,
+    // the partitions can share the same clock again.
+    uint64_t now = 0;
+    for (const auto& partition : m_partitions)
+    {
+        now = std::max(now, partition.currentTs);
+    }
+    for (auto& partition : m_partitions)
+    {
+        partition.currentTs = now;
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Stop()
+{
+    NS_LOG_FUNCTION(this);
+    m_stop = true;
+}
+
+EventId
+MultithreadedSimulatorImpl::Stop(const Time& delay)
+{
+    NS_LOG_FUNCTION(this << delay.GetTimeStep());
+    EventId id = Simulator::Schedule(delay, &Simulator::Stop);
+    std::unique_lock lock{m_mutex};
+    m_stopEvents.push_back(id);
+    return id;
+}
+
+//
+// Schedule an event for a _relative_ time in the future.
+//
+EventId
+MultithreadedSimulatorImpl::Schedule(const Time& delay, EventImpl* event)
+{
+    NS_ASSERT_MSG(delay.IsPositive(), "MultithreadedSimulatorImpl::Schedule(): Negative delay");
+    Partition& partition = GetCurrentPartition();
+    uint64_t ts = partition.currentTs + delay.GetTimeStep();
+    uint32_t uid = Insert(partition, ts, partition.currentContext, event);
+    return EventId(event, ts, partition.currentContext, uid);
+}
+
+void
+MultithreadedSimulatorImpl::ScheduleWithContext(uint32_t context,
+                                                const Time& delay,
+                                                EventImpl* event)
+{
+    NS_ASSERT_MSG(delay.IsPositive(),
+                  "MultithreadedSimulatorImpl::ScheduleWithContext(): Negative delay");
+    Partition& current = GetCurrentPartition();
+    Partition& destination = m_partitions[GetPartition(context)];
+    uint64_t ts = current.currentTs + delay.GetTimeStep();
+
+    if (!m_running || &destination == &current)
+    {
+        Insert(destination, ts, context, event);
+        return;
+    }
+
+    NS_ABORT_MSG_IF(ts < m_windowEnd,
+                    "Event for context " << context << " in partition " << destination.id
+                                         << " scheduled from partition " << current.id
+                                         << " with a delay of " << delay
+                                         << ", shorter than the lookahead "
+                                         << TimeStep(m_lookAhead));
+    Scheduler::Event ev;
+    ev.impl = event;
+    ev.key.m_ts = ts;
+    ev.key.m_context = context;
+    ev.key.m_uid = 0; // assigned by the destination partition
+    current.outbox[destination.id].push_back(ev);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleNow(EventImpl* event)
+{
+    return Schedule(Time(0), event);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleDestroy(EventImpl* event)
+{
+    EventId id(Ptr<EventImpl>(event, false),
+               GetCurrentPartition().currentTs,
+               0xffffffff,
+               EventId::UID::DESTROY);
+    std::unique_lock lock{m_mutex};
+    m_destroyEvents.push_back(id);
+    return id;
+}
+
+Time
+MultithreadedSimulatorImpl::Now() const
+{
+    // Do not add function logging here, to avoid stack overflow
+    return TimeStep(GetCurrentPartition().currentTs);
+}
+
+Time
+MultithreadedSimulatorImpl::GetDelayLeft(const EventId& id) const
+{
+    if (IsExpired(id))
+    {
+        return TimeStep(0);
+    }
+    return TimeStep(id.GetTs() - GetCurrentPartition().currentTs);
+}
+
+void
+MultithreadedSimulatorImpl::Remove(const EventId& id)
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        std::unique_lock lock{m_mutex};
+        for (auto i = m_destroyEvents.begin(); i != m_destroyEvents.end(); i++)
+        {
+            if (*i == id)
+            {
+                m_destroyEvents.erase(i);
+                break;
+            }
+        }
+        return;
+    }
+    if (IsExpired(id))
+    {
+        return;
+    }
+    Partition& partition = m_partitions[GetPartition(id.GetContext())];
+    NS_ABORT_MSG_IF(m_running && &partition != m_currentPartition,
+                    "Cannot remove an event of another partition");
+    Scheduler::Event event;
+    event.impl = id.PeekEventImpl();
+    event.key.m_ts = id.GetTs();
+    event.key.m_context = id.GetContext();
+    event.key.m_uid = id.GetUid();
+    partition.events->Remove(event);
+    event.impl->Cancel();
+    // whenever we remove an event from the event list, we have to unref it.
+    event.impl->Unref();
+}
+
+void
+MultithreadedSimulatorImpl::Cancel(const EventId& id)
+{
+    if (!IsExpired(id))
+    {
+        id.PeekEventImpl()->Cancel();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsExpired(const EventId& id) const
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        if (id.PeekEventImpl() == nullptr || id.PeekEventImpl()->IsCancelled())
+        {
+            return true;
+        }
+        std::unique_lock lock{m_mutex};
+        for (auto i = m_destroyEvents.begin(); i != m_destroyEvents.end(); i++)
+        {
+            if (*i == id)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (id.PeekEventImpl() == nullptr)
+    {
+        return true;
+    }
+    // the clock of another partition, and the events it runs, change during the run
+    const Partition& partition = m_partitions[GetPartition(id.GetContext())];
+    NS_ABORT_MSG_IF(m_running && &partition != m_currentPartition,
+                    "Cannot check an event of another partition");
+    return id.GetTs() < partition.currentTs ||
+           (id.GetTs() == partition.currentTs && id.GetUid() <= partition.currentUid) ||
+           id.PeekEventImpl()->IsCancelled();
+}
+
+Time
+MultithreadedSimulatorImpl::GetMaximumSimulationTime() const
+{
+    return TimeStep(MAX_TS);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetContext() const
+{
+    return GetCurrentPartition().currentContext;
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetEventCount() const
+{
+    uint64_t eventCount = 0;
+    for (const auto& partition : m_partitions)
+    {
+        eventCount += partition.eventCount.load(std::memory_order_relaxed);
+    }
+    return eventCount;
+}
+
+} // namespace ns3
@@ -0,0 +1,285 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MULTITHREADED_SIMULATOR_IMPL_H
+#define MULTITHREADED_SIMULATOR_IMPL_H
+
+#include "event-impl.h"
+#include "nstime.h"
+#include "ptr.h"
+#include "scheduler.h"
+#include "simulator-impl.h"
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::MultithreadedSimulatorImpl declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup simulator
+ *
+ * \brief Shared-memory parallel simulator implementation, with one
+ * thread per partition of the simulation contexts.
+ *
+ * The contexts (i.e., the node ids) are grouped in partitions, each with
+ * its own event list, clock and thread.  The partitions advance in time
+ * windows with a conservative synchronization: the window starts at the
+ * earliest pending event of all the partitions and is as long as the
+ * lookahead, the smallest delay of any interaction between contexts of
+ * different partitions.  Within a window the partitions run in parallel;
+ * the events they schedule for other partitions are buffered and merged
+ * into the destination event lists between two windows.
+ *
+ * The lookahead is declared by the models that connect contexts, e.g.,
+ * a channel with a propagation delay, or the slot period of a protocol
+ * whose cross-node interactions only happen at slot boundaries, through
+ * DeclareLookAhead(), and can be bounded globally with BoundLookAhead().
+ * Scheduling an event for another partition earlier than the end of the
+ * current window is a fatal error.
+ *
+ * The execution is deterministic: the events of each partition are run in
+ * the same order at every run, independently of the thread scheduling,
+ * since the buffered events are merged in the order of the source
+ * partitions at the same window boundaries.  The interleaving of the
+ * events of different partitions at the same time may differ from the
+ * DefaultSimulatorImpl.
+ *
+ * By default the context \c c belongs to the partition \c c modulo the
+ * number of partitions, and the events without a context belong to the
+ * first partition.  Models with zero-delay interactions between nodes
+ * (e.g., the nodes of the same cell) must be mapped to the same partition
+ * with SetPartition().
+ *
+ * The models must not share mutable state, including the reference
+ * counts of objects and packets, across partitions: the only
+ * communication between partitions must be the arguments of the events
+ * they schedule for each other.  Each thread keeps its own free lists of
+ * packet data, so that the partitions can create and destroy packets, but
+ * a packet must not be referenced by two partitions.  The
+ * PointToPointChannel meets these constraints: it declares its delay as
+ * the lookahead between the nodes of its devices, and gives a serialized
+ * copy of the packets to the devices of other partitions, whose events it
+ * schedules with IsRemoteContext().  The other channels, e.g., the spectrum
+ * channels of the mmWave and LTE models, share their packets and devices
+ * between the receivers: the nodes connected by them, e.g., the eNBs and UEs
+ * of a RAN, must be mapped to the same partition.
+ *
+ * Events can only be scheduled from the main thread, before and after
+ * Simulator::Run, and from the events themselves.  The events can only be
+ * checked, cancelled and removed by the events of their own partition, or
+ * while the simulator is not running.  Simulator::Stop() ends the
+ * simulation at the end of the current window, and Simulator::Stop(delay)
+ * after running all the events at the stop time.
+ */
+class MultithreadedSimulatorImpl : public SimulatorImpl
+{
+  public:
+    /**
+     *  Register this type.
+     *  \return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    MultithreadedSimulatorImpl();
+    /** Destructor. */
+    ~MultithreadedSimulatorImpl() override;
+
+    // Inherited
+    void Destroy() override;
+    bool IsFinished() const override;
+    void Stop() override;
+    EventId Stop(const Time& delay) override;
+    EventId Schedule(const Time& delay, EventImpl* event) override;
+    void ScheduleWithContext(uint32_t context, const Time& delay, EventImpl* event) override;
+    EventId ScheduleNow(EventImpl* event) override;
+    EventId ScheduleDestroy(EventImpl* event) override;
+    void Remove(const EventId& id) override;
+    void Cancel(const EventId& id) override;
+    bool IsExpired(const EventId& id) const override;
+    void Run() override;
+    Time Now() const override;
+    Time GetDelayLeft(const EventId& id) const override;
+    Time GetMaximumSimulationTime() const override;
+    void SetScheduler(ObjectFactory schedulerFactory) override;
+    uint32_t GetSystemId() const override;
+    uint32_t GetContext() const override;
+    uint64_t GetEventCount() const override;
+
+    /**
+     * Assign a context to a partition.  Must not be called during Simulator::Run.
+     *
+     * \param [in] context The context, i.e., the node id.
+     * \param [in] partition The partition, smaller than the number of partitions.
+     */
+    void SetPartition(uint32_t context, uint32_t partition);
+
+    /**
+     * \param [in] context The context.
+     * \returns the partition of the context
+     */
+    uint32_t GetPartition(uint32_t context) const;
+
+    /**
+     * \returns the number of partitions
+     */
+    uint32_t GetPartitionCount() const;
+
+    /**
+     * Add a global bound to the lookahead, in addition to the declared
+     * interactions between the contexts.  The minimum bound is used.
+     *
+     * \param [in] lookAhead The maximum lookahead; must be > 0.
+     */
+    void BoundLookAhead(const Time& lookAhead);
+
+    /**
+     * \returns the lookahead implied by the current partitions, declarations
+     * and bound, or GetMaximumSimulationTime() if unconstrained
+     */
+    Time GetLookAhead() const;
+
+    /**
+     * Declare that the events between two contexts are scheduled with at
+     * least the given delay.  The declarations between contexts of the same
+     * partition do not constrain the lookahead.
+     *
+     * This method can be called whatever the simulator implementation: it
+     * has no effect unless the simulator is a MultithreadedSimulatorImpl.
+     *
+     * \param [in] contextA The first context.
+     * \param [in] contextB The second context.
+     * \param [in] delay The minimum delay of the interactions between the contexts.
+     */
+    static void DeclareLookAhead(uint32_t contextA, uint32_t contextB, const Time& delay);
+
+    /**
+     * Check whether the events scheduled for a context by the running event
+     * are run by another thread, with which the event arguments must not be
+     * shared.
+     *
+     * This method can be called whatever the simulator implementation: it
+     * returns false unless the calling thread runs a partition of a
+     * MultithreadedSimulatorImpl.
+     *
+     * \param [in] context The context of the events.
+     * \returns whether the context belongs to another partition than the running event
+     */
+    static bool IsRemoteContext(uint32_t context);
+
+  private:
+    // Inherited from Object
+    void DoDispose() override;
+
+    /** The state of a partition. */
+    struct alignas(64) Partition
+    {
+        uint32_t id;             //!< The index of the partition.
+        Ptr<Scheduler> events;   //!< The event list.
+        uint64_t currentTs;      //!< Timestamp of the current event.
+        uint32_t currentContext; //!< Execution context of the current event.
+        uint32_t currentUid;     //!< Unique id of the current event.
+        uint32_t uid;            //!< Next event unique id.
+        uint64_t nextTs;         //!< Timestamp of the next event, at the window boundary.
+        /** The simulator of the partition. */
+        const MultithreadedSimulatorImpl* simulator;
+        /** Number of events executed, written by the partition and read by any thread. */
+        std::atomic<uint64_t> eventCount;
+        /** The events scheduled for each partition during the current window. */
+        std::vector<std::vector<Scheduler::Event>> outbox;
+    };
+
+    /** A declared interaction between two contexts. */
+    struct LookAheadDeclaration
+    {
+        uint32_t contextA; //!< The first context.
+        uint32_t contextB; //!< The second context.
+        uint64_t delay;    //!< The minimum delay, in timesteps.
+    };
+
+    /**
+     * \returns the partition of the calling thread: the partition of the
+     * running event, or the first partition in the main thread
+     */
+    Partition& GetCurrentPartition() const;
+
+    /**
+     * Insert an event in the event list of a partition.
+     *
+     * \param [in] partition The partition.
+     * \param [in] ts The timestamp of the event.
+     * \param [in] context The context of the event.
+     * \param [in] event The event.
+     * \returns the unique id of the event
+     */
+    uint32_t Insert(Partition& partition, uint64_t ts, uint32_t context, EventImpl* event);
+
+    /**
+     * Run the events of a partition up to the end of the current window.
+     *
+     * \param [in] partition The partition.
+     */
+    void ProcessWindow(Partition& partition);
+
+    /**
+     * Merge the events scheduled by the other partitions for a partition,
+     * in the order of the source partitions.
+     *
+     * \param [in] partition The partition.
+     */
+    void MergeInbound(Partition& partition);
+
+    /**
+     * Compute the end of the next window, or detect the end of the
+     * simulation.  Called by a single thread between two windows.
+     */
+    void ComputeWindow();
+
+    /** The partition of the calling thread during Simulator::Run. */
+    static thread_local Partition* m_currentPartition;
+
+    uint32_t m_partitionCount;                  //!< The number of partitions.
+    std::vector<Partition> m_partitions;        //!< The partitions.
+    std::vector<uint32_t> m_contextToPartition; //!< The explicit partition of the contexts.
+
+    std::vector<LookAheadDeclaration> m_declarations; //!< The declared interactions.
+    uint64_t m_lookAheadBound;                        //!< The global bound of the lookahead.
+    uint64_t m_lookAhead;                             //!< The lookahead of the current run.
+
+    std::atomic<bool> m_running;     //!< Whether the partitions are running.
+    std::atomic<bool> m_stop;        //!< Flag calling for the end of the simulation.
+    bool m_done;                     //!< Whether the last window has been run.
+    uint64_t m_windowEnd;            //!< The end of the current window, excluded.
+    std::list<EventId> m_stopEvents; //!< The pending Stop(delay) events.
+
+    /** Container type for the events to run at Simulator::Destroy(). */
+    typedef std::list<EventId> DestroyEvents;
+
+    DestroyEvents m_destroyEvents; //!< The events to run at Simulator::Destroy().
+    mutable std::mutex m_mutex;    //!< Protects m_destroyEvents and m_stopEvents.
+};
+
+} // namespace ns3
+
+#endif /* MULTITHREADED_SIMULATOR_IMPL_H */
@@ -22,6 +22,7 @@
 #include "attribute-construction-list.h"
 #include "environment-variable.h"
 #include "log.h"
+#include "startup-profiler.h"
 #include "string.h"
 #include "trace-source-accessor.h"
 
@@ -94,6 +95,7 @@ ObjectBase::ConstructSelf(const AttributeConstructionList& attributes)
     // loop over the inheritance tree back to the Object base class.
     NS_LOG_FUNCTION(this << &attributes);
     TypeId tid = GetInstanceTypeId();
+    StartupProfiler::Scope profile(StartupProfiler::OBJECT_CONSTRUCT, tid);
     do // Do this tid and all parents
     {
         // loop over all attributes in object type
@@ -213,6 +215,7 @@ ObjectBase::SetAttribute(std::string name, const AttributeValue& value)
     NS_LOG_FUNCTION(this << name << &value);
     TypeId::AttributeInformation info;
     TypeId tid = GetInstanceTypeId();
+    StartupProfiler::Scope profile(StartupProfiler::ATTRIBUTE_SET, tid, name);
     if (!tid.LookupAttributeByName(name, &info))
     {
         NS_FATAL_ERROR(
@@ -236,6 +239,7 @@ ObjectBase::SetAttributeFailSafe(std::string name, const AttributeValue& value)
     NS_LOG_FUNCTION(this << name << &value);
     TypeId::AttributeInformation info;
     TypeId tid = GetInstanceTypeId();
+    StartupProfiler::Scope profile(StartupProfiler::ATTRIBUTE_SET, tid, name);
     if (!tid.LookupAttributeByName(name, &info))
     {
         return false;
@@ -19,6 +19,7 @@
 #include "object-factory.h"
 
 #include "log.h"
+#include "startup-profiler.h"
 
 #include <sstream>
 
@@ -96,6 +97,7 @@ ObjectFactory::Create() const
     NS_ASSERT_MSG(
         m_tid.GetUid(),
         "ObjectFactory::Create - can't use an ObjectFactory without setting a TypeId first.");
+    StartupProfiler::Scope profile(StartupProfiler::OBJECT_CREATE, m_tid);
     Callback<ObjectBase*> cb = m_tid.GetConstructor();
     ObjectBase* base = cb();
     auto derived = dynamic_cast<Object*>(base);
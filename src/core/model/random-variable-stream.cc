@@ -109,6 +109,16 @@ RandomVariableStream::GetInteger()
     return static_cast<uint32_t>(GetValue());
 }
 
+void
+RandomVariableStream::GetValues(std::span<double> values)
+{
+    NS_LOG_FUNCTION(this << values.size());
+    for (double& value : values)
+    {
+        value = GetValue();
+    }
+}
+
 void
 RandomVariableStream::SetStream(int64_t stream)
 {
@@ -226,6 +236,28 @@ UniformRandomVariable::GetInteger()
     return static_cast<uint32_t>(GetValue(m_min, m_max + 1));
 }
 
+void
+UniformRandomVariable::GetValues(std::span<double> values, double min, double max)
+{
+    NS_LOG_FUNCTION(this << values.size() << min << max);
+    Peek()->RandU01(values);
+    for (double& v : values)
+    {
+        v = min + v * (max - min);
+        if (IsAntithetic())
+        {
+            v = min + (max - v);
+        }
+    }
+}
+
+void
+UniformRandomVariable::GetValues(std::span<double> values)
+{
+    NS_LOG_FUNCTION(this << values.size());
+    GetValues(values, m_min, m_max);
+}
+
 NS_OBJECT_ENSURE_REGISTERED(ConstantRandomVariable);
 
 TypeId
@@ -455,6 +487,38 @@ ExponentialRandomVariable::GetValue()
     return GetValue(m_mean, m_bound);
 }
 
+void
+ExponentialRandomVariable::GetValues(std::span<double> values, double mean, double bound)
+{
+    NS_LOG_FUNCTION(this << values.size() << mean << bound);
+    if (bound != 0)
+    {
+        // A rejected value draws one more uniform, which the bulk draw
+        // would have given to the next value.
+        for (double& value : values)
+        {
+            value = GetValue(mean, bound);
+        }
+        return;
+    }
+    Peek()->RandU01(values);
+    for (double& v : values)
+    {
+        if (IsAntithetic())
+        {
+            v = (1 - v);
+        }
+        v = -mean * std::log(v);
+    }
+}
+
+void
+ExponentialRandomVariable::GetValues(std::span<double> values)
+{
+    NS_LOG_FUNCTION(this << values.size());
+    GetValues(values, m_mean, m_bound);
+}
+
 NS_OBJECT_ENSURE_REGISTERED(ParetoRandomVariable);
 
 TypeId
@@ -776,6 +840,83 @@ NormalRandomVariable::GetValue()
     return GetValue(m_mean, m_variance, m_bound);
 }
 
+void
+NormalRandomVariable::GetValues(std::span<double> values,
+                                double mean,
+                                double variance,
+                                double bound)
+{
+    NS_LOG_FUNCTION(this << values.size() << mean << variance << bound);
+    // This follows GetValue(double,double,double) value by value.  Each
+    // pair of uniforms gives at most two values, so drawing one pair per
+    // two missing values never draws a pair that GetValue would not.
+    const std::size_t maxPairs = 64;
+    double u[2 * maxPairs];
+    std::size_t i = 0;
+    while (i < values.size())
+    {
+        if (m_nextValid)
+        { // use previously generated
+            m_nextValid = false;
+            double x2 = mean + m_v2 * m_y * std::sqrt(variance);
+            if (std::fabs(x2 - mean) <= bound)
+            {
+                values[i++] = x2;
+            }
+            continue;
+        }
+        std::size_t pairs = std::min((values.size() - i + 1) / 2, maxPairs);
+        Peek()->RandU01(std::span<double>(u, 2 * pairs));
+        for (std::size_t j = 0; j < pairs; ++j)
+        {
+            if (m_nextValid)
+            {
+                m_nextValid = false;
+                double x2 = mean + m_v2 * m_y * std::sqrt(variance);
+                if (std::fabs(x2 - mean) <= bound)
+                {
+                    values[i++] = x2;
+                }
+            }
+            double u1 = u[2 * j];
+            double u2 = u[2 * j + 1];
+            if (IsAntithetic())
+            {
+                u1 = (1 - u1);
+                u2 = (1 - u2);
+            }
+            double v1 = 2 * u1 - 1;
+            double v2 = 2 * u2 - 1;
+            double w = v1 * v1 + v2 * v2;
+            if (w <= 1.0)
+            { // Got good pair
+                double y = std::sqrt((-2 * std::log(w)) / w);
+                double x1 = mean + v1 * y * std::sqrt(variance);
+                if (std::fabs(x1 - mean) <= bound)
+                {
+                    m_nextValid = true;
+                    m_y = y;
+                    m_v2 = v2;
+                    values[i++] = x1;
+                    continue;
+                }
+                double x2 = mean + v2 * y * std::sqrt(variance);
+                if (std::fabs(x2 - mean) <= bound)
+                {
+                    values[i++] = x2;
+                }
+            }
+        }
+    }
+}
+
+void
+NormalRandomVariable::GetValues(std::span<double> values)
+{
+    NS_LOG_FUNCTION(this << values.size());
+    GetValues(values, m_mean, m_variance, m_bound);
+}
+
 NS_OBJECT_ENSURE_REGISTERED(LogNormalRandomVariable);
 
 TypeId
@@ -31,6 +31,7 @@
 #include "type-id.h"
 
 #include <map>
+#include <span>
 #include <stdint.h>
 
 /**
@@ -154,6 +155,19 @@ class RandomVariableStream : public Object
     // The base implementation returns `(uint32_t)GetValue()`
     virtual uint32_t GetInteger();
 
+    /**
+     * \brief Fill \pname{values} with the next random values drawn from
+     * the distribution.
+     *
+     * The values are the ones that as many calls to GetValue() would
+     * return, so that the bulk and the scalar paths can be mixed on the
+     * same stream.  The base implementation calls GetValue() for each
+     * value; the common distributions draw their uniforms in bulk.
+     *
+     * \param [out] values The random values.
+     */
+    virtual void GetValues(std::span<double> values);
+
   protected:
     /**
      * \brief Get the pointer to the underlying RngStream.
@@ -271,12 +285,20 @@ class UniformRandomVariable : public RandomVariableStream
      */
     uint32_t GetInteger(uint32_t min, uint32_t max);
 
+    /**
+     * \copydoc RandomVariableStream::GetValues()
+     * \param [in] min Low end of the range (included).
+     * \param [in] max High end of the range (excluded).
+     */
+    void GetValues(std::span<double> values, double min, double max);
+
     // Inherited
     /**
      * \copydoc RandomVariableStream::GetValue()
      * \note The upper limit is excluded from the output range, unlike GetInteger().
      */
     double GetValue() override;
+    void GetValues(std::span<double> values) override;
 
     /**
      * \copydoc RandomVariableStream::GetInteger()
@@ -590,8 +612,16 @@ class ExponentialRandomVariable : public RandomVariableStream
     /** \copydoc GetValue(double,double) */
     uint32_t GetInteger(uint32_t mean, uint32_t bound);
 
+    /**
+     * \copydoc RandomVariableStream::GetValues()
+     * \param [in] mean Mean value of the unbounded exponential distribution.
+     * \param [in] bound Upper bound on values returned.
+     */
+    void GetValues(std::span<double> values, double mean, double bound);
+
     // Inherited
     double GetValue() override;
+    void GetValues(std::span<double> values) override;
     using RandomVariableStream::GetInteger;
 
   private:
@@ -1015,8 +1045,20 @@ class NormalRandomVariable : public RandomVariableStream
     /** \copydoc GetValue(double,double,double) */
     uint32_t GetInteger(uint32_t mean, uint32_t variance, uint32_t bound);
 
+    /**
+     * \copydoc RandomVariableStream::GetValues()
+     * \param [in] mean Mean value for the normal distribution.
+     * \param [in] variance Variance value for the normal distribution.
+     * \param [in] bound Bound on values returned.
+     */
+    void GetValues(std::span<double> values,
+                   double mean,
+                   double variance,
+                   double bound = NormalRandomVariable::INFINITE_VALUE);
+
     // Inherited
     double GetValue() override;
+    void GetValues(std::span<double> values) override;
     using RandomVariableStream::GetInteger;
 
   private:
@@ -30,6 +30,7 @@
 #include "synchronizer.h"
 #include "wall-clock-synchronizer.h"
 
+#include <chrono>
 #include <cmath>
 #include <mutex>
 #include <thread>
@@ -103,6 +104,8 @@ void
 RealtimeSimulatorImpl::DoDispose()
 {
     NS_LOG_FUNCTION(this);
+    ProcessEventsWithContext();
+
     while (!m_events->IsEmpty())
     {
         Scheduler::Event next = m_events->RemoveNext();
@@ -218,6 +221,14 @@ RealtimeSimulatorImpl::ProcessOneEvent()
                 m_synchronizer->Realtime(),
                 "RealtimeSimulatorImpl::ProcessOneEvent (): Synchronizer reports not Realtime ()");
 
+            //
+            // The synchronizer is reset before the events of the other threads
+            // are moved to the event list, so that an event injected after the
+            // move interrupts the wait below.
+            //
+            m_synchronizer->SetCondition(false);
+            ProcessEventsWithContext();
+
             //
             // tsNow is set to the normalized current real time.  When the simulation was
             // started, the current real time was effectively set to zero; so tsNow is
@@ -250,10 +261,9 @@ RealtimeSimulatorImpl::ProcessOneEvent()
             // We've figured out how long we need to delay in order to pace the
             // simulation time with the real time.  We're going to sleep, but need
             // to work with the synchronizer to make sure we're awakened if something
-            // external happens (like a packet is received).  This next line resets
-            // the synchronizer so that any future event will cause it to interrupt.
+            // external happens (like a packet is received).  The synchronizer was
+            // reset above, so that any later event will cause it to interrupt.
             //
-            m_synchronizer->SetCondition(false);
         }
 
         //
@@ -401,7 +411,7 @@ RealtimeSimulatorImpl::IsFinished() const
     bool rc;
     {
         std::unique_lock lock{m_mutex};
-        rc = m_events->IsEmpty() || m_stop;
+        rc = (m_events->IsEmpty() && !m_eventsWithContext.IsPending()) || m_stop;
     }
 
     return rc;
@@ -443,6 +453,8 @@ RealtimeSimulatorImpl::Run()
         {
             std::unique_lock lock{m_mutex};
 
+            m_synchronizer->SetCondition(false);
+            ProcessEventsWithContext();
             if (!m_events->IsEmpty())
             {
                 process = true;
@@ -542,26 +554,35 @@ RealtimeSimulatorImpl::ScheduleWithContext(uint32_t context, const Time& delay,
 {
     NS_LOG_FUNCTION(this << context << delay << impl);
 
+    if (m_main != std::this_thread::get_id())
     {
-        std::unique_lock lock{m_mutex};
-        uint64_t ts;
-
-        if (m_main == std::this_thread::get_id())
+        //
+        // Other threads, e.g., the readers of emulated devices, do not take the
+        // mutex: their events go through a lock-free queue, and are inserted in
+        // the event list by the main thread.  If the simulator is running, the
+        // main thread, which alone reads the synchronizer, derives the real time
+        // of the event from the time at which it was pushed.  If we're not, the
+        // event is relative to m_currentTs, where we stopped.
+        //
+        EventWithContext ev;
+        ev.context = context;
+        ev.running = m_running;
+        if (ev.running)
         {
-            ts = m_currentTs + delay.GetTimeStep();
+            ev.scheduled = std::chrono::steady_clock::now();
         }
-        else
+        ev.delay = delay.GetTimeStep();
+        ev.event = impl;
+        if (m_eventsWithContext.Push(ev))
         {
-            //
-            // If the simulator is running, we're pacing and have a meaningful
-            // realtime clock.  If we're not, then m_currentTs is where we stopped.
-            //
-            ts = m_running ? m_synchronizer->GetCurrentRealtime() : m_currentTs;
-            ts += delay.GetTimeStep();
+            m_synchronizer->Signal();
         }
+        return;
+    }
 
-        NS_ASSERT_MSG(ts >= m_currentTs,
-                      "RealtimeSimulatorImpl::ScheduleRealtime(): schedule for time < m_currentTs");
+    {
+        std::unique_lock lock{m_mutex};
+        uint64_t ts = m_currentTs + delay.GetTimeStep();
         Scheduler::Event ev;
         ev.impl = impl;
         ev.key.m_ts = ts;
@@ -574,6 +595,50 @@ RealtimeSimulatorImpl::ScheduleWithContext(uint32_t context, const Time& delay,
     }
 }
 
+void
+RealtimeSimulatorImpl::ProcessEventsWithContext()
+{
+    if (!m_eventsWithContext.IsPending())
+    {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    auto realtime = static_cast<int64_t>(m_synchronizer->GetCurrentRealtime());
+    m_eventsWithContext.Drain([this, now, realtime](const EventWithContext& event) {
+        auto delay = static_cast<int64_t>(event.delay);
+        int64_t ts = static_cast<int64_t>(m_currentTs) + delay;
+        if (event.running)
+        {
+            Time queued = NanoSeconds(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(now - event.scheduled)
+                    .count());
+            ts = realtime - queued.GetTimeStep() + delay;
+        }
+        if (ts < static_cast<int64_t>(m_currentTs))
+        {
+            //
+            // The mutex used to make the real time of the event at least
+            // m_currentTs.  Without it, the main thread may run later events
+            // between the push and the drain, so an event with a short delay
+            // falls in the past: it runs now, as if it had been scheduled at
+            // the drain, late by at most the time it spent in the queue.
+            //
+            NS_LOG_LOGIC("Event of context " << event.context << " moved from " << ts << " to "
+                                             << m_currentTs);
+            ts = m_currentTs;
+        }
+        Scheduler::Event ev;
+        ev.impl = event.event;
+        ev.key.m_ts = ts;
+        ev.key.m_context = event.context;
+        ev.key.m_uid = m_uid;
+        m_uid++;
+        m_unscheduledEvents++;
+        m_events->Insert(ev);
+    });
+}
+
 EventId
 RealtimeSimulatorImpl::ScheduleNow(EventImpl* impl)
 {
@@ -21,11 +21,14 @@
 #include "assert.h"
 #include "event-impl.h"
 #include "log.h"
+#include "mpsc-queue.h"
 #include "ptr.h"
 #include "scheduler.h"
 #include "simulator-impl.h"
 #include "synchronizer.h"
 
+#include <atomic>
+#include <chrono>
 #include <list>
 #include <mutex>
 #include <thread>
@@ -181,17 +184,44 @@ class RealtimeSimulatorImpl : public SimulatorImpl
     uint64_t NextTs() const;
     /** Process the next event. */
     void ProcessOneEvent();
+    /**
+     * Move the events scheduled by other threads into the event list.
+     * Called with #m_mutex locked.
+     */
+    void ProcessEventsWithContext();
     /** Destructor implementation. */
     void DoDispose() override;
 
+    /** An event scheduled by another thread, with its execution context. */
+    struct EventWithContext
+    {
+        /** The event context. */
+        uint32_t context;
+        /** Whether the simulator was running when the event was scheduled. */
+        bool running;
+        /**
+         * The time at which the event was scheduled, if running.  Only the
+         * main thread reads the synchronizer: the real time of the event is
+         * that of the drain minus the time spent in the queue.
+         */
+        std::chrono::steady_clock::time_point scheduled;
+        /** The delay of the event. */
+        uint64_t delay;
+        /** The event implementation. */
+        EventImpl* event;
+    };
+
+    /** The events scheduled by other threads. */
+    MpscQueue<EventWithContext> m_eventsWithContext;
+
     /** Container type for events to be run at destroy time. */
     typedef std::list<EventId> DestroyEvents;
     /** Container for events to be run at destroy time. */
     DestroyEvents m_destroyEvents;
     /** Has the stopping condition been reached? */
     bool m_stop;
-    /** Is the simulator currently running. */
-    bool m_running;
+    /** Is the simulator currently running.  Read by other threads. */
+    std::atomic<bool> m_running;
 
     /**
      * \name Mutex-protected variables.
@@ -375,6 +375,58 @@ RngStream::RandU01()
     return u;
 }
 
+void
+RngStream::RandU01(std::span<double> values)
+{
+    // Same arithmetic as RandU01(), on a local copy of the state so that
+    // the compiler can interleave the two independent components.
+    double s10 = m_currentState[0];
+    double s11 = m_currentState[1];
+    double s12 = m_currentState[2];
+    double s20 = m_currentState[3];
+    double s21 = m_currentState[4];
+    double s22 = m_currentState[5];
+
+    for (double& value : values)
+    {
+        int32_t k;
+
+        /* Component 1 */
+        double p1 = a12 * s11 - a13n * s10;
+        k = static_cast<int32_t>(p1 / m1);
+        p1 -= k * m1;
+        if (p1 < 0.0)
+        {
+            p1 += m1;
+        }
+        s10 = s11;
+        s11 = s12;
+        s12 = p1;
+
+        /* Component 2 */
+        double p2 = a21 * s22 - a23n * s20;
+        k = static_cast<int32_t>(p2 / m2);
+        p2 -= k * m2;
+        if (p2 < 0.0)
+        {
+            p2 += m2;
+        }
+        s20 = s21;
+        s21 = s22;
+        s22 = p2;
+
+        /* Combination */
+        value = ((p1 > p2) ? (p1 - p2) * MRG32k3a::norm : (p1 - p2 + m1) * MRG32k3a::norm);
+    }
+
+    m_currentState[0] = s10;
+    m_currentState[1] = s11;
+    m_currentState[2] = s12;
+    m_currentState[3] = s20;
+    m_currentState[4] = s21;
+    m_currentState[5] = s22;
+}
+
 RngStream::RngStream(uint32_t seedNumber, uint64_t stream, uint64_t substream)
 {
     if (seedNumber >= m1 || seedNumber >= m2 || seedNumber == 0)
@@ -18,6 +18,7 @@
 
 #ifndef RNGSTREAM_H
 #define RNGSTREAM_H
+#include <span>
 #include <stdint.h>
 #include <string>
 
@@ -70,6 +71,15 @@ class RngStream
      * \returns The next random.
      */
     double RandU01();
+    /**
+     * Fill \pname{values} with the next random numbers of this stream.
+     *
+     * The values are the ones that as many calls to RandU01() would
+     * return, but the state stays in registers for the whole span.
+     *
+     * \param [out] values The random numbers, in [0, 1).
+     */
+    void RandU01(std::span<double> values);
 
   private:
     /**
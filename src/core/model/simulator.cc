@@ -28,6 +28,7 @@
 #include "ptr.h"
 #include "scheduler.h"
 #include "simulator-impl.h"
+#include "startup-profiler.h"
 #include "string.h"
 
 #include "ns3/core-config.h"
@@ -179,6 +180,7 @@ Simulator::Run()
 {
     NS_LOG_FUNCTION_NOARGS();
     Time::ClearMarkedTimes();
+    StartupProfiler::NotifyRun();
     GetImpl()->Run();
 }
 
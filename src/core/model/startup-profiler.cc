@@ -0,0 +1,279 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "startup-profiler.h"
+
+#include "environment-variable.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup core
+ * ns3::StartupProfiler implementation.
+ */
+
+namespace ns3
+{
+
+namespace
+{
+
+/** Calls and time of an entry. */
+struct Entry
+{
+    uint64_t calls{0};      //!< number of calls
+    int64_t nanoseconds{0}; //!< total time
+};
+
+/** The records of the profiler. */
+struct Records
+{
+    /** The entries of each category, by key. */
+    std::unordered_map<std::string, Entry> entries[StartupProfiler::CATEGORY_COUNT];
+    /** The time at which the profiler was enabled. */
+    std::chrono::steady_clock::time_point start{std::chrono::steady_clock::now()};
+    /** The number of entries printed per category at Simulator::Run. */
+    uint32_t maxEntries{10};
+};
+
+/**
+ * \returns the records of the profiler
+ */
+Records&
+GetRecords()
+{
+    static Records records;
+    return records;
+}
+
+/** The names of the categories. */
+const char* g_categoryNames[StartupProfiler::CATEGORY_COUNT] = {
+    "TypeId::LookupByName",
+    "ObjectFactory::Create",
+    "Object attribute initialization",
+    "Attribute set / Config::SetDefault",
+    "Config path resolution",
+    "Config set / connect",
+};
+
+/** Enable the profiler from the NS_STARTUP_PROFILER environment variable. */
+struct StartupProfilerEnvironment
+{
+    StartupProfilerEnvironment()
+    {
+        auto [found, value] = EnvironmentVariable::Get("NS_STARTUP_PROFILER");
+        if (found && !value.empty() && value != "0")
+        {
+            long maxEntries = std::strtol(value.c_str(), nullptr, 10);
+            if (maxEntries > 1)
+            {
+                GetRecords().maxEntries = maxEntries;
+            }
+            StartupProfiler::Enable();
+        }
+    }
+};
+
+/** Reads NS_STARTUP_PROFILER when the library is loaded. */
+StartupProfilerEnvironment g_startupProfilerEnvironment;
+
+} // unnamed namespace
+
+bool StartupProfiler::m_enabled = false;
+
+void
+StartupProfiler::Enable()
+{
+    if (!m_enabled)
+    {
+        GetRecords().start = std::chrono::steady_clock::now();
+    }
+    m_enabled = true;
+}
+
+void
+StartupProfiler::Disable()
+{
+    m_enabled = false;
+}
+
+void
+StartupProfiler::Reset()
+{
+    Records& records = GetRecords();
+    for (auto& entries : records.entries)
+    {
+        entries.clear();
+    }
+    records.start = std::chrono::steady_clock::now();
+}
+
+void
+StartupProfiler::Record(Category category, const std::string& key, int64_t nanoseconds)
+{
+    Entry& entry = GetRecords().entries[category][key];
+    entry.calls++;
+    entry.nanoseconds += nanoseconds;
+}
+
+uint64_t
+StartupProfiler::GetCalls(Category category, const std::string& key)
+{
+    const auto& entries = GetRecords().entries[category];
+    auto it = entries.find(key);
+    return (it == entries.end()) ? 0 : it->second.calls;
+}
+
+uint64_t
+StartupProfiler::GetCalls(Category category)
+{
+    uint64_t calls = 0;
+    for (const auto& entry : GetRecords().entries[category])
+    {
+        calls += entry.second.calls;
+    }
+    return calls;
+}
+
+std::string
+StartupProfiler::NormalizePath(const std::string& path)
+{
+    std::string normalized;
+    normalized.reserve(path.size());
+    std::size_t i = 0;
+    while (i < path.size())
+    {
+        std::size_t end = path.find('/', i + 1);
+        if (end == std::string::npos)
+        {
+            end = path.size();
+        }
+        // a path element made of digits only, e.g., /NodeList/12
+        if (path[i] == '/' && end > i + 1 &&
+            std::all_of(path.begin() + i + 1, path.begin() + end, [](unsigned char c) {
+                return std::isdigit(c);
+            }))
+        {
+            normalized += "/#";
+        }
+        else
+        {
+            normalized.append(path, i, end - i);
+        }
+        i = end;
+    }
+    return normalized;
+}
+
+void
+StartupProfiler::Report(std::ostream& os, uint32_t maxEntries)
+{
+    Records& records = GetRecords();
+    double elapsed =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - records.start)
+            .count();
+
+    std::ios_base::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+    os << std::fixed << std::setprecision(3);
+    os << "Startup profile: " << elapsed << " ms of wall-clock time since enabled"
+       << " (inclusive times)" << std::endl;
+
+    for (uint32_t c = 0; c < CATEGORY_COUNT; ++c)
+    {
+        std::vector<std::pair<std::string, Entry>> entries(records.entries[c].begin(),
+                                                           records.entries[c].end());
+        Entry total;
+        for (const auto& entry : entries)
+        {
+            total.calls += entry.second.calls;
+            total.nanoseconds += entry.second.nanoseconds;
+        }
+        os << "  " << g_categoryNames[c] << ": " << total.calls << " calls, "
+           << total.nanoseconds / 1e6 << " ms, " << entries.size() << " distinct" << std::endl;
+
+        std::size_t n = std::min<std::size_t>(maxEntries, entries.size());
+        std::partial_sort(entries.begin(),
+                          entries.begin() + n,
+                          entries.end(),
+                          [](const auto& a, const auto& b) {
+                              return a.second.nanoseconds > b.second.nanoseconds;
+                          });
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const Entry& entry = entries[i].second;
+            os << "    " << std::setw(10) << entry.nanoseconds / 1e6 << " ms " << std::setw(9)
+               << entry.calls << " calls " << std::setw(9)
+               << entry.nanoseconds / 1e3 / entry.calls << " us/call  " << entries[i].first
+               << std::endl;
+        }
+    }
+    os.flags(flags);
+    os.precision(precision);
+}
+
+void
+StartupProfiler::NotifyRun()
+{
+    if (m_enabled)
+    {
+        Report(std::clog, GetRecords().maxEntries);
+        Disable();
+    }
+}
+
+void
+StartupProfiler::Scope::Start(Category category,
+                              TypeId tid,
+                              const char* operation,
+                              const std::string& name)
+{
+    m_category = category;
+    if (tid.GetUid() != 0)
+    {
+        m_key = name.empty() ? tid.GetName() : tid.GetName() + "::" + name;
+    }
+    else if (category == CONFIG_RESOLVE || category == CONFIG_OPERATION)
+    {
+        m_key = NormalizePath(name);
+    }
+    else
+    {
+        m_key = name;
+    }
+    if (operation)
+    {
+        m_key = operation + (" " + m_key);
+    }
+    m_start = std::chrono::steady_clock::now();
+}
+
+void
+StartupProfiler::Scope::Stop()
+{
+    auto end = std::chrono::steady_clock::now();
+    Record(m_category,
+           m_key,
+           std::chrono::duration_cast<std::chrono::nanoseconds>(end - m_start).count());
+}
+
+} // namespace ns3
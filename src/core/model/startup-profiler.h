@@ -0,0 +1,230 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef STARTUP_PROFILER_H
+#define STARTUP_PROFILER_H
+
+/**
+ * \file
+ * \ingroup core
+ * ns3::StartupProfiler declaration.
+ */
+
+#include "type-id.h"
+
+#include <chrono>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+
+namespace ns3
+{
+
+/**
+ * \ingroup core
+ *
+ * \brief Time and call counts of the object system during scenario construction.
+ *
+ * When enabled, the profiler records the wall-clock time and the number of
+ * calls of the operations that dominate the construction of large scenarios:
+ * TypeId lookups by name, object creation through ObjectFactory, the
+ * attribute initialization of every new Object, attribute sets and
+ * Config::SetDefault, Config path resolution and Config set/connect
+ * operations.  The records are grouped by TypeId, attribute or Config path
+ * (with the numeric path elements replaced by '#', so that the paths of all
+ * the nodes and devices are accounted together).
+ *
+ * The times are inclusive: an object creation includes the attribute
+ * initialization of the object, a Config::Connect includes the path
+ * resolution, and so on.
+ *
+ * A summary with the busiest entries of each category is printed to
+ * std::clog when Simulator::Run is called for the first time, after which
+ * recording stops, so that only the setup phase is measured.
+ *
+ * <b> Enabling the profiler </b>
+ *
+ * Set the environment variable \c NS_STARTUP_PROFILER to a non-empty value
+ * other than \c 0, or call StartupProfiler::Enable() at the beginning of the
+ * program.  The value of the environment variable, if a number larger than
+ * 1, sets the number of entries printed per category (default 10).
+ *
+ * The profiler is meant for the single-threaded setup phase and is not
+ * thread safe.  When disabled, each instrumented call only tests a flag.
+ */
+class StartupProfiler
+{
+  public:
+    /** The instrumented operations. */
+    enum Category
+    {
+        TYPEID_LOOKUP = 0, //!< TypeId::LookupByName
+        OBJECT_CREATE,     //!< ObjectFactory::Create
+        OBJECT_CONSTRUCT,  //!< ObjectBase::ConstructSelf, i.e., attribute initialization
+        ATTRIBUTE_SET,     //!< ObjectBase::SetAttribute and Config::SetDefault
+        CONFIG_RESOLVE,    //!< Config path resolution
+        CONFIG_OPERATION,  //!< Config::Set, Connect and Disconnect
+        CATEGORY_COUNT     //!< number of categories
+    };
+
+    /**
+     * \returns true if the profiler is recording
+     */
+    static bool IsEnabled()
+    {
+        return m_enabled;
+    }
+
+    /** Start recording. */
+    static void Enable();
+
+    /** Stop recording, keeping the records. */
+    static void Disable();
+
+    /** Discard all the records. */
+    static void Reset();
+
+    /**
+     * Print the summary of the records.
+     *
+     * \param [in] os The output stream.
+     * \param [in] maxEntries The maximum number of entries printed per category.
+     */
+    static void Report(std::ostream& os, uint32_t maxEntries = 10);
+
+    /**
+     * Print the summary, if enabled, and stop recording.
+     * Called by Simulator::Run.
+     */
+    static void NotifyRun();
+
+    /**
+     * \param [in] category The category.
+     * \param [in] key The TypeId name, attribute or Config path of the entry.
+     * \returns the number of calls recorded for the entry
+     */
+    static uint64_t GetCalls(Category category, const std::string& key);
+
+    /**
+     * \param [in] category The category.
+     * \returns the number of calls recorded for the category
+     */
+    static uint64_t GetCalls(Category category);
+
+    /**
+     * \param [in] path The Config path.
+     * \returns the path with the numeric elements replaced by '#'
+     */
+    static std::string NormalizePath(const std::string& path);
+
+    /**
+     * \ingroup core
+     * Measure the time spent in a scope and record it when the scope ends.
+     *
+     * The key is only built when the profiler is enabled.
+     */
+    class Scope
+    {
+      public:
+        /**
+         * \param [in] category The category.
+         * \param [in] key The key of the entry.
+         */
+        Scope(Category category, const std::string& key)
+            : m_active(m_enabled)
+        {
+            if (m_active)
+            {
+                Start(category, TypeId(), nullptr, key);
+            }
+        }
+
+        /**
+         * \param [in] category The category.
+         * \param [in] operation The name of the operation, prepended to the key.
+         * \param [in] key The key of the entry.
+         */
+        Scope(Category category, const char* operation, const std::string& key)
+            : m_active(m_enabled)
+        {
+            if (m_active)
+            {
+                Start(category, TypeId(), operation, key);
+            }
+        }
+
+        /**
+         * \param [in] category The category.
+         * \param [in] tid The TypeId of the entry.
+         * \param [in] name The attribute name, appended to the TypeId name if not empty.
+         */
+        Scope(Category category, TypeId tid, const std::string& name = "")
+            : m_active(m_enabled)
+        {
+            if (m_active)
+            {
+                Start(category, tid, nullptr, name);
+            }
+        }
+
+        ~Scope()
+        {
+            if (m_active)
+            {
+                Stop();
+            }
+        }
+
+        // Delete copy constructor and assignment operator to avoid misuse
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+      private:
+        /**
+         * Start the measure.
+         * \param [in] category The category.
+         * \param [in] tid The TypeId of the entry.
+         * \param [in] operation The name of the operation, or nullptr.
+         * \param [in] name The key of the entry, or the attribute name if tid is valid.
+         */
+        void Start(Category category,
+                   TypeId tid,
+                   const char* operation,
+                   const std::string& name);
+
+        /** Record the time spent since Start. */
+        void Stop();
+
+        bool m_active;                                 //!< whether the scope is measured
+        Category m_category;                           //!< the category
+        std::string m_key;                             //!< the key of the entry
+        std::chrono::steady_clock::time_point m_start; //!< the start of the scope
+    };
+
+  private:
+    /**
+     * Add a call to an entry.
+     * \param [in] category The category.
+     * \param [in] key The key of the entry.
+     * \param [in] nanoseconds The time spent in the call.
+     */
+    static void Record(Category category, const std::string& key, int64_t nanoseconds);
+
+    static bool m_enabled; //!< whether the profiler is recording
+};
+
+} // namespace ns3
+
+#endif /* STARTUP_PROFILER_H */
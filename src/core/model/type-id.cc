@@ -21,6 +21,7 @@
 #include "hash.h"
 #include "log.h" // NS_ASSERT and NS_LOG
 #include "singleton.h"
+#include "startup-profiler.h"
 #include "trace-source-accessor.h"
 
 #include <iomanip>
@@ -836,6 +837,7 @@ TypeId
 TypeId::LookupByName(std::string name)
 {
     NS_LOG_FUNCTION(name);
+    StartupProfiler::Scope profile(StartupProfiler::TYPEID_LOOKUP, name);
     uint16_t uid = IidManager::Get()->GetUid(name);
     NS_ASSERT_MSG(uid != 0, "Assert in TypeId::LookupByName: " << name << " not found");
     return TypeId(uid);
@@ -845,6 +847,7 @@ bool
 TypeId::LookupByNameFailSafe(std::string name, TypeId* tid)
 {
     NS_LOG_FUNCTION(name << tid->GetUid());
+    StartupProfiler::Scope profile(StartupProfiler::TYPEID_LOOKUP, name);
     uint16_t uid = IidManager::Get()->GetUid(name);
     if (uid == 0)
     {
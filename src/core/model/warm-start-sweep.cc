@@ -0,0 +1,240 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "warm-start-sweep.h"
+
+#include "abort.h"
+#include "config.h"
+#include "log.h"
+#include "rng-seed-manager.h"
+#include "simulator-impl.h"
+#include "simulator.h"
+#include "string.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+/**
+ * \file
+ * \ingroup core
+ * ns3::WarmStartSweep implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("WarmStartSweep");
+
+namespace
+{
+
+/** Flush the standard streams, so that their buffers are not output twice. */
+void
+FlushStandardStreams()
+{
+    std::cout.flush();
+    std::cerr.flush();
+    std::clog.flush();
+    std::fflush(nullptr);
+}
+
+/**
+ * Write a buffer to a file descriptor, retrying on interruption.
+ * \param [in] fd The file descriptor.
+ * \param [in] data The buffer.
+ * \param [in] size The size of the buffer.
+ * \returns \c false on failure
+ */
+bool
+WriteAll(int fd, const char* data, std::size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t written = write(fd, data, size);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= written;
+    }
+    return true;
+}
+
+/**
+ * Read a file descriptor up to the end of file.
+ * \param [in] fd The file descriptor.
+ * \returns the data read
+ */
+std::string
+ReadAll(int fd)
+{
+    std::string data;
+    char buffer[4096];
+    while (true)
+    {
+        ssize_t size = read(fd, buffer, sizeof(buffer));
+        if (size < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (size <= 0)
+        {
+            return data;
+        }
+        data.append(buffer, size);
+    }
+}
+
+} // unnamed namespace
+
+WarmStartSweep::WarmStartSweep()
+    : m_parallelism(std::max(std::thread::hardware_concurrency(), 1U))
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+WarmStartSweep::AddVariant(const Variant& variant)
+{
+    NS_LOG_FUNCTION(this << variant.name);
+    m_variants.push_back(variant);
+}
+
+void
+WarmStartSweep::SetParallelism(uint32_t children)
+{
+    NS_LOG_FUNCTION(this << children);
+    NS_ABORT_MSG_IF(children == 0, "At least one child is needed");
+    m_parallelism = children;
+}
+
+void
+WarmStartSweep::SetResultCallback(Callback<std::string> callback)
+{
+    NS_LOG_FUNCTION(this);
+    m_result = callback;
+}
+
+std::vector<WarmStartSweep::Result>
+WarmStartSweep::Run(const Time& checkpoint, const Time& stop)
+{
+    NS_LOG_FUNCTION(this << checkpoint << stop);
+    std::string impl = Simulator::GetImplementation()->GetInstanceTypeId().GetName();
+    NS_ABORT_MSG_IF(impl != "ns3::DefaultSimulatorImpl",
+                    "The warm-start sweep requires the ns3::DefaultSimulatorImpl, not " << impl);
+    NS_ABORT_MSG_IF(checkpoint < Simulator::Now(), "The checkpoint is in the past");
+    NS_ABORT_MSG_IF(stop < checkpoint, "The stop time is before the checkpoint");
+
+    Simulator::Stop(checkpoint - Simulator::Now());
+    Simulator::Run();
+    NS_LOG_INFO("Checkpoint reached at " << Simulator::Now().As(Time::S) << " after "
+                                         << Simulator::GetEventCount() << " events");
+
+    std::vector<Result> results(m_variants.size());
+    /** A running child. */
+    struct Child
+    {
+        std::size_t variant; //!< The index of the variant.
+        pid_t pid;           //!< The process id.
+        int fd;              //!< The read end of the result pipe.
+    };
+
+    std::deque<Child> running;
+    std::size_t next = 0;
+    while (next < m_variants.size() || !running.empty())
+    {
+        if (next < m_variants.size() && running.size() < m_parallelism)
+        {
+            int fds[2];
+            NS_ABORT_MSG_IF(pipe(fds) != 0, "pipe() failed: " << std::strerror(errno));
+            FlushStandardStreams();
+            pid_t pid = fork();
+            NS_ABORT_MSG_IF(pid < 0, "fork() failed: " << std::strerror(errno));
+            if (pid == 0)
+            {
+                close(fds[0]);
+                // the read ends of the pipes of the running children
+                for (const auto& child : running)
+                {
+                    close(child.fd);
+                }
+                RunChild(m_variants[next], stop, fds[1]);
+            }
+            close(fds[1]);
+            NS_LOG_LOGIC("Variant " << m_variants[next].name << " started in child " << pid);
+            running.push_back({next, pid, fds[0]});
+            ++next;
+            continue;
+        }
+
+        // collect the oldest child: the variants usually take similar times
+        Child child = running.front();
+        running.pop_front();
+        Result& result = results[child.variant];
+        result.name = m_variants[child.variant].name;
+        result.output = ReadAll(child.fd);
+        close(child.fd);
+        int status = 0;
+        while (waitpid(child.pid, &status, 0) < 0 && errno == EINTR)
+        {
+        }
+        result.status = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+        NS_LOG_LOGIC("Variant " << result.name << " completed with status " << result.status);
+    }
+    return results;
+}
+
+void
+WarmStartSweep::RunChild(const Variant& variant, const Time& stop, int fd)
+{
+    NS_LOG_FUNCTION(this << variant.name << stop << fd);
+    if (variant.run != 0)
+    {
+        RngSeedManager::SetRun(variant.run);
+    }
+    for (const auto& [path, value] : variant.values)
+    {
+        Config::Set(path, StringValue(value));
+    }
+    if (!variant.setup.IsNull())
+    {
+        variant.setup();
+    }
+
+    Simulator::Stop(stop - Simulator::Now());
+    Simulator::Run();
+
+    std::string output = m_result.IsNull() ? std::string() : m_result();
+    bool written = WriteAll(fd, output.data(), output.size());
+    close(fd);
+    Simulator::Destroy();
+    FlushStandardStreams();
+    // skip the destructors of the static objects, shared with the parent
+    _exit(written ? 0 : 1);
+}
+
+} // namespace ns3
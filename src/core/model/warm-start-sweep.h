@@ -0,0 +1,155 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef WARM_START_SWEEP_H
+#define WARM_START_SWEEP_H
+
+#include "callback.h"
+#include "nstime.h"
+
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup core
+ * ns3::WarmStartSweep declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup core
+ *
+ * \brief Run the variants of a parameter sweep from a shared warm state.
+ *
+ * Many sweeps spend a large share of every run on the same setup: building
+ * the topology, attaching the devices, activating the bearers, ramping up
+ * the transport.  The sweep runs the scenario once up to a checkpoint
+ * time, and then forks one child process per variant.  Each child starts
+ * from a copy-on-write copy of the whole simulation state at the
+ * checkpoint, applies its variant (RNG run number, Config::Set values and
+ * a setup callback), runs to the stop time, and sends a result string,
+ * built by the result callback, back to the parent.
+ *
+ * \code
+ *   WarmStartSweep sweep;
+ *   for (uint32_t run = 1; run <= 8; ++run)
+ *   {
+ *       WarmStartSweep::Variant variant;
+ *       variant.name = "run " + std::to_string(run);
+ *       variant.run = run;
+ *       variant.values.emplace_back(
+ *           "/NodeList/0/ApplicationList/0/$ns3::OnOffApplication/DataRate",
+ *           "100Mbps");
+ *       sweep.AddVariant(variant);
+ *   }
+ *   sweep.SetResultCallback([&sink]() { return std::to_string(sink->GetTotalRx()); });
+ *   for (const auto& result : sweep.Run(Seconds(1), Seconds(5)))
+ *   {
+ *       std::cout << result.name << ": " << result.output << std::endl;
+ *   }
+ *   Simulator::Destroy();
+ * \endcode
+ *
+ * The random variable streams draw their numbers from the run number
+ * given when they were created or assigned a stream: the streams that
+ * must differ between the variants must be re-assigned in the setup
+ * callback, e.g., with AssignStreams(), or be created after the
+ * checkpoint.
+ *
+ * The sweep relies on fork(), and is only available on POSIX systems.
+ * It requires the DefaultSimulatorImpl, since the other threads of a
+ * process are not copied by fork().  The files opened before the
+ * checkpoint (e.g., the traces) are shared by the children, which must
+ * open their own output files.  The parent returns from Run() at the
+ * checkpoint, after all the children have completed.
+ */
+class WarmStartSweep
+{
+  public:
+    /** A variant of the sweep, applied in a child at the checkpoint. */
+    struct Variant
+    {
+        std::string name; //!< The name of the variant, reported with its result.
+        /** The run number of the RngSeedManager, or 0 to keep the current one. */
+        uint64_t run{0};
+        /** The attribute values to set with Config::Set: path and value. */
+        std::vector<std::pair<std::string, std::string>> values;
+        Callback<void> setup; //!< Called after the values are set, if not null.
+    };
+
+    /** The result of a variant. */
+    struct Result
+    {
+        std::string name;   //!< The name of the variant.
+        int status;         //!< The exit status of the child, or -1 if it did not exit.
+        std::string output; //!< The string returned by the result callback.
+    };
+
+    /** Constructor. */
+    WarmStartSweep();
+
+    /**
+     * Add a variant.
+     * \param [in] variant The variant.
+     */
+    void AddVariant(const Variant& variant);
+
+    /**
+     * Set the maximum number of children running at the same time.
+     * \param [in] children The number of children, by default the number
+     *             of hardware threads.
+     */
+    void SetParallelism(uint32_t children);
+
+    /**
+     * Set the callback building the result of a variant, in the child, at
+     * the stop time.
+     * \param [in] callback The result callback.
+     */
+    void SetResultCallback(Callback<std::string> callback);
+
+    /**
+     * Run the simulation up to the checkpoint, then the variants in child
+     * processes up to the stop time.
+     *
+     * \param [in] checkpoint The (absolute) time of the checkpoint.
+     * \param [in] stop The (absolute) stop time of the variants.
+     * \returns The results of the variants, in the order they were added.
+     */
+    std::vector<Result> Run(const Time& checkpoint, const Time& stop);
+
+  private:
+    /**
+     * Run a variant, in a child process, and write its result.
+     *
+     * \param [in] variant The variant.
+     * \param [in] stop The stop time.
+     * \param [in] fd The file descriptor to which to write the result.
+     */
+    [[noreturn]] void RunChild(const Variant& variant, const Time& stop, int fd);
+
+    std::vector<Variant> m_variants; //!< The variants.
+    uint32_t m_parallelism;          //!< The maximum number of running children.
+    Callback<std::string> m_result;  //!< The result callback.
+};
+
+} // namespace ns3
+
+#endif /* WARM_START_SWEEP_H */
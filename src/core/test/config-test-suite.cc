@@ -864,6 +864,110 @@ SearchAttributesOfParentObjectsTestCase::DoRun()
     NS_TEST_ASSERT_MSG_EQ(iv.Get(), 42, "Object Attribute \"X\" not settable in derived class");
 }
 
+/**
+ * \ingroup config-tests
+ * Test the path resolution through an indexed ObjectVector.
+ */
+class IndexedContainerConfigTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    IndexedContainerConfigTestCase();
+
+    /** Destructor. */
+    ~IndexedContainerConfigTestCase() override
+    {
+    }
+
+  private:
+    void DoRun() override;
+};
+
+IndexedContainerConfigTestCase::IndexedContainerConfigTestCase()
+    : TestCase("Check the resolution of paths through an indexed vector of Object")
+{
+}
+
+void
+IndexedContainerConfigTestCase::DoRun()
+{
+    IntegerValue iv;
+
+    Ptr<ConfigTestObject> root = CreateObject<ConfigTestObject>();
+    Config::RegisterRootNamespaceObject(root);
+    Ptr<ConfigTestObject> a = CreateObject<ConfigTestObject>();
+    root->SetNodeA(a);
+
+    //
+    // Index the vector once it holds two objects: they are read on the
+    // first resolution through the vector.
+    //
+    std::vector<Ptr<ConfigTestObject>> objects;
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        objects.push_back(CreateObject<ConfigTestObject>());
+        a->AddNodeB(objects.back());
+    }
+    Config::IndexContainer(a, "NodesB");
+
+    Config::Set("/NodeA/NodesB/1/A", IntegerValue(-11));
+    objects[0]->GetAttribute("A", iv);
+    NS_TEST_ASSERT_MSG_EQ(iv.Get(), 10, "Object Attribute \"A\" unexpectedly set");
+    objects[1]->GetAttribute("A", iv);
+    NS_TEST_ASSERT_MSG_EQ(iv.Get(), -11, "Object Attribute \"A\" not set as expected");
+
+    //
+    // The objects added to the indexed vector are resolved once notified.
+    //
+    for (uint32_t i = 2; i < 4; ++i)
+    {
+        objects.push_back(CreateObject<ConfigTestObject>());
+        a->AddNodeB(objects.back());
+        Config::NotifyIndexedObjectAdded(a, "NodesB", i, objects.back());
+    }
+    Config::Set("/NodeA/NodesB/3/A", IntegerValue(-12));
+    objects[3]->GetAttribute("A", iv);
+    NS_TEST_ASSERT_MSG_EQ(iv.Get(), -12, "Object Attribute \"A\" not set as expected");
+
+    Config::MatchContainer matches = Config::LookupMatches("/NodeA/NodesB/*");
+    NS_TEST_ASSERT_MSG_EQ(matches.GetN(), 4, "Unexpected number of matches");
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        std::ostringstream oss;
+        oss << "/NodeA/NodesB/" << i << "/";
+        NS_TEST_ASSERT_MSG_EQ(matches.Get(i), objects[i], "Unexpected match");
+        NS_TEST_ASSERT_MSG_EQ(matches.GetMatchedPath(i), oss.str(), "Unexpected matched path");
+    }
+
+    Config::Set("/NodeA/NodesB/[1-2]|0/B", IntegerValue(-13));
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        objects[i]->GetAttribute("B", iv);
+        NS_TEST_ASSERT_MSG_EQ(iv.Get(),
+                              (i < 3 ? -13 : 9),
+                              "Object Attribute \"B\" not as expected");
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(Config::LookupMatches("/NodeA/NodesB/4").GetN(),
+                          0,
+                          "Out of range index unexpectedly matched");
+
+    //
+    // Once unindexed, the objects not notified are found again.
+    //
+    objects.push_back(CreateObject<ConfigTestObject>());
+    a->AddNodeB(objects.back());
+    NS_TEST_ASSERT_MSG_EQ(Config::LookupMatches("/NodeA/NodesB/4").GetN(),
+                          0,
+                          "Object not notified unexpectedly matched");
+    Config::UnindexContainers(PeekPointer(a));
+    NS_TEST_ASSERT_MSG_EQ(Config::LookupMatches("/NodeA/NodesB/*").GetN(),
+                          5,
+                          "Unexpected number of matches");
+
+    Config::UnregisterRootNamespaceObject(root);
+}
+
 /**
  * \ingroup config-tests
  * The Test Suite that glues all of the Test Cases together.
@@ -882,6 +986,7 @@ ConfigTestSuite::ConfigTestSuite()
     AddTestCase(new UnderRootNamespaceConfigTestCase);
     AddTestCase(new ObjectVectorConfigTestCase);
     AddTestCase(new SearchAttributesOfParentObjectsTestCase);
+    AddTestCase(new IndexedContainerConfigTestCase);
 }
 
 /**
@@ -0,0 +1,297 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/event-impl.h"
+#include "ns3/test.h"
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+#if defined(__GLIBC__) && __has_include(<malloc.h>)
+#include <malloc.h>
+#define NS3_EVENT_IMPL_POOL_TEST_USABLE_SIZE 1
+#endif
+
+/**
+ * \file
+ * \ingroup event-impl-pool-tests
+ * EventImpl allocation pool test suite.
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup event-impl-pool-tests EventImpl allocation pool test suite
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * \ingroup event-impl-pool-tests
+ *
+ * An event with a payload of N bytes.
+ *
+ * \tparam N The size of the payload.
+ */
+template <std::size_t N>
+class EventImplPoolTestEvent : public EventImpl
+{
+  public:
+    /** Fill the payload, which overruns a block smaller than the event. */
+    EventImplPoolTestEvent()
+    {
+        std::memset(payload, 0xa5, sizeof(payload));
+    }
+
+    char payload[N]; //!< The payload.
+
+  protected:
+    void Notify() override
+    {
+    }
+};
+
+/**
+ * \ingroup event-impl-pool-tests
+ *
+ * An over-aligned event.
+ */
+class alignas(64) EventImplPoolTestAlignedEvent : public EventImpl
+{
+  protected:
+    void Notify() override
+    {
+    }
+};
+
+/** A 40-byte event on LP64, whose size class rounds it up to 48 bytes. */
+using EventImplPoolTestSmallEvent = EventImplPoolTestEvent<27>;
+/** An event of the same size class as EventImplPoolTestSmallEvent. */
+using EventImplPoolTestSameClassEvent = EventImplPoolTestEvent<35>;
+/** An event larger than the largest size class. */
+using EventImplPoolTestLargeEvent = EventImplPoolTestEvent<300>;
+
+/**
+ * \ingroup event-impl-pool-tests
+ *
+ * \param [in] p The memory of an event.
+ * \param [in] size The size of the event.
+ * \returns whether the memory holds the whole size class of the event
+ */
+static bool
+HoldsSizeClass(const void* p, std::size_t size)
+{
+#ifdef NS3_EVENT_IMPL_POOL_TEST_USABLE_SIZE
+    std::size_t classSize = ((size - 1) / 16 + 1) * 16;
+    return malloc_usable_size(const_cast<void*>(p)) >= classSize;
+#else
+    return true;
+#endif
+}
+
+/**
+ * \ingroup event-impl-pool-tests
+ *
+ * \returns whether the events are allocated from the pool, which is disabled
+ * e.g. under AddressSanitizer
+ */
+static bool
+IsPoolEnabled()
+{
+    uint64_t allocations = EventImpl::GetAllocationCounts().allocations;
+    delete new EventImplPoolTestSmallEvent;
+    return EventImpl::GetAllocationCounts().allocations != allocations;
+}
+
+/**
+ * \ingroup event-impl-pool-tests
+ *
+ * Allocate and free events of the size classes, larger events and
+ * over-aligned events.
+ */
+class EventImplPoolTestCase : public TestCase
+{
+  public:
+    EventImplPoolTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+EventImplPoolTestCase::EventImplPoolTestCase()
+    : TestCase("Allocate events from the free lists of their size class")
+{
+}
+
+void
+EventImplPoolTestCase::DoRun()
+{
+    NS_TEST_ASSERT_MSG_EQ((sizeof(EventImplPoolTestSmallEvent) - 1) / 16,
+                          (sizeof(EventImplPoolTestSameClassEvent) - 1) / 16,
+                          "the events should have the same size class");
+
+    if (!IsPoolEnabled())
+    {
+        return;
+    }
+
+    EventImpl::ResetAllocationCounts();
+    EventImpl::AllocationCounts before = EventImpl::GetAllocationCounts();
+    EventImpl* event = new EventImplPoolTestSmallEvent;
+    EventImpl::AllocationCounts counts = EventImpl::GetAllocationCounts();
+    NS_TEST_ASSERT_MSG_EQ(counts.allocations, before.allocations + 1, "wrong allocation count");
+    NS_TEST_ASSERT_MSG_EQ(HoldsSizeClass(event, sizeof(EventImplPoolTestSmallEvent)),
+                          true,
+                          "the block should hold the whole size class");
+
+    // A freed block is cached and reused by the next event of its size class
+    before = EventImpl::GetAllocationCounts();
+    delete event;
+    counts = EventImpl::GetAllocationCounts();
+    NS_TEST_ASSERT_MSG_EQ(counts.cached, before.cached + 1, "the block should be cached");
+    EventImpl* sameClass = new EventImplPoolTestSameClassEvent;
+    NS_TEST_ASSERT_MSG_EQ(sameClass, event, "the cached block should be reused");
+    EventImpl::AllocationCounts after = EventImpl::GetAllocationCounts();
+    NS_TEST_ASSERT_MSG_EQ(after.allocations, counts.allocations + 1, "wrong allocation count");
+    NS_TEST_ASSERT_MSG_EQ(after.heapAllocations,
+                          counts.heapAllocations,
+                          "the event should not be allocated from the heap");
+    NS_TEST_ASSERT_MSG_EQ(after.cached, before.cached, "the block should leave the cache");
+    delete sameClass;
+
+    // Larger and over-aligned events bypass the pool
+    before = EventImpl::GetAllocationCounts();
+    EventImpl* large = new EventImplPoolTestLargeEvent;
+    EventImpl* aligned = new EventImplPoolTestAlignedEvent;
+    NS_TEST_ASSERT_MSG_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 64,
+                          0,
+                          "the event should be aligned");
+    delete large;
+    delete aligned;
+    after = EventImpl::GetAllocationCounts();
+    NS_TEST_ASSERT_MSG_EQ(after.allocations,
+                          before.allocations,
+                          "larger and over-aligned events should not be pooled");
+    NS_TEST_ASSERT_MSG_EQ(after.cached,
+                          before.cached,
+                          "larger and over-aligned events should not be cached");
+}
+
+/**
+ * \ingroup event-impl-pool-tests
+ *
+ * Allocate and free events in a thread after its pool has been destroyed,
+ * at thread exit, and pass them to a thread whose pool is alive.
+ */
+class EventImplPoolDestroyedTestCase : public TestCase
+{
+  public:
+    EventImplPoolDestroyedTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Runs at the exit of a thread, after the destruction of the pool of the
+     * thread, which is constructed after it.
+     */
+    struct AtThreadExit
+    {
+        ~AtThreadExit();
+
+        EventImplPoolDestroyedTestCase* test{nullptr}; //!< The test case.
+    };
+
+    EventImpl* m_fromMainThread{nullptr};    //!< An event allocated by the main thread.
+    EventImpl* m_fromExitingThread{nullptr}; //!< An event allocated at thread exit.
+    bool m_countsCleared{false};             //!< Whether the counts of a destroyed pool are zero.
+};
+
+EventImplPoolDestroyedTestCase::EventImplPoolDestroyedTestCase()
+    : TestCase("Allocate and free events after the destruction of the pool")
+{
+}
+
+EventImplPoolDestroyedTestCase::AtThreadExit::~AtThreadExit()
+{
+    delete test->m_fromMainThread;
+    test->m_fromExitingThread = new EventImplPoolTestSmallEvent;
+    EventImpl::AllocationCounts counts = EventImpl::GetAllocationCounts();
+    test->m_countsCleared = counts.allocations == 0 && counts.cached == 0;
+}
+
+void
+EventImplPoolDestroyedTestCase::DoRun()
+{
+    if (!IsPoolEnabled())
+    {
+        return;
+    }
+
+    m_fromMainThread = new EventImplPoolTestSmallEvent;
+    std::thread thread([this]() {
+        thread_local AtThreadExit atExit;
+        atExit.test = this;
+        // construct the pool of the thread after atExit
+        delete new EventImplPoolTestSmallEvent;
+    });
+    thread.join();
+
+    NS_TEST_ASSERT_MSG_EQ(m_countsCleared, true, "the destroyed pool should have no counts");
+    NS_TEST_ASSERT_MSG_NE(m_fromExitingThread, nullptr, "the event should be allocated");
+    bool holdsSizeClass =
+        HoldsSizeClass(m_fromExitingThread, sizeof(EventImplPoolTestSmallEvent));
+    NS_TEST_ASSERT_MSG_EQ(holdsSizeClass,
+                          true,
+                          "the block should hold the whole size class");
+
+    // The main thread caches the block in the size class of the event, and
+    // the next event of that class fills it
+    delete m_fromExitingThread;
+    EventImpl* sameClass = new EventImplPoolTestSameClassEvent;
+    delete sameClass;
+}
+
+/**
+ * \ingroup event-impl-pool-tests
+ *
+ * EventImpl allocation pool test suite.
+ */
+class EventImplPoolTestSuite : public TestSuite
+{
+  public:
+    EventImplPoolTestSuite();
+};
+
+EventImplPoolTestSuite::EventImplPoolTestSuite()
+    : TestSuite("event-impl-pool", Type::UNIT)
+{
+    AddTestCase(new EventImplPoolTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new EventImplPoolDestroyedTestCase, TestCase::Duration::QUICK);
+}
+
+/**
+ * \ingroup event-impl-pool-tests
+ * EventImplPoolTestSuite instance variable.
+ */
+static EventImplPoolTestSuite g_eventImplPoolTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -0,0 +1,241 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/default-simulator-impl.h"
+#include "ns3/event-profiler.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+/**
+ * \file
+ * \ingroup event-profiler-tests
+ * Event profiler test suite.
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup event-profiler-tests Event profiler test suite
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * \ingroup event-profiler-tests
+ *
+ * Base class with a virtual event, to check the naming of virtual member
+ * functions.
+ */
+class EventProfilerTestBase
+{
+  public:
+    virtual ~EventProfilerTestBase() = default;
+
+    /** Event run through a virtual call. */
+    virtual void Virtual();
+};
+
+void
+EventProfilerTestBase::Virtual()
+{
+}
+
+/**
+ * \ingroup event-profiler-tests
+ *
+ * Profile a simulation with member function, function and lambda events.
+ */
+class EventProfilerTestCase : public TestCase, public EventProfilerTestBase
+{
+  public:
+    EventProfilerTestCase();
+
+    void Virtual() override;
+
+    /** Event without arguments. */
+    void Tick();
+    /**
+     * Event with an argument.
+     * \param [in] value The argument.
+     */
+    void Tock(uint32_t value);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \param [in] entries The entries of a profile.
+     * \param [in] name A part of the name of an entry.
+     * \returns the number of events of the entries whose name contains the given name
+     */
+    static uint64_t GetEvents(const std::vector<EventProfiler::Entry>& entries,
+                              const std::string& name);
+};
+
+EventProfilerTestCase::EventProfilerTestCase()
+    : TestCase("Check the event counts per target and per context")
+{
+}
+
+void
+EventProfilerTestCase::Virtual()
+{
+}
+
+void
+EventProfilerTestCase::Tick()
+{
+}
+
+void
+EventProfilerTestCase::Tock(uint32_t value)
+{
+}
+
+/**
+ * \ingroup event-profiler-tests
+ * Event function.
+ */
+void
+EventProfilerTestFunction()
+{
+}
+
+uint64_t
+EventProfilerTestCase::GetEvents(const std::vector<EventProfiler::Entry>& entries,
+                                 const std::string& name)
+{
+    uint64_t events = 0;
+    for (const auto& entry : entries)
+    {
+        if (entry.name.find(name) != std::string::npos)
+        {
+            events += entry.events;
+        }
+    }
+    return events;
+}
+
+void
+EventProfilerTestCase::DoRun()
+{
+    std::string filename = CreateTempDirFilename("profile.txt");
+    Ptr<SimulatorImpl> impl = Simulator::GetImplementation();
+    auto defaultImpl = DynamicCast<DefaultSimulatorImpl>(impl);
+    NS_TEST_ASSERT_MSG_NE(defaultImpl, nullptr, "not a DefaultSimulatorImpl");
+    NS_TEST_ASSERT_MSG_EQ(defaultImpl->GetEventProfiler(), nullptr, "profiler before enabling");
+
+    // not profiled
+    Simulator::Schedule(Seconds(0.5), &EventProfilerTestCase::Tick, this);
+    impl->SetAttribute("EventProfileFile", StringValue(filename));
+    impl->SetAttribute("EventProfileSampleInterval", UintegerValue(4));
+    Simulator::Schedule(Seconds(1), [impl]() {
+        impl->SetAttribute("EventProfile", BooleanValue(true));
+    });
+    for (uint32_t i = 0; i < 6; ++i)
+    {
+        Simulator::ScheduleWithContext(i % 2, Seconds(2 + i), &EventProfilerTestCase::Tick, this);
+    }
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        Simulator::ScheduleWithContext(7, Seconds(2 + i), &EventProfilerTestCase::Tock, this, i);
+        Simulator::Schedule(Seconds(2 + i), &EventProfilerTestBase::Virtual, this);
+    }
+    Simulator::Schedule(Seconds(3), &EventProfilerTestFunction);
+    Simulator::Schedule(Seconds(3), &EventProfilerTestCase::Tick, this).Cancel();
+    Simulator::Schedule(Seconds(10), [impl]() {
+        impl->SetAttribute("EventProfile", BooleanValue(false));
+    });
+    // not profiled
+    Simulator::Schedule(Seconds(11), &EventProfilerTestCase::Tick, this);
+    Simulator::Run();
+
+    const EventProfiler* profiler = defaultImpl->GetEventProfiler();
+    NS_TEST_ASSERT_MSG_NE(profiler, nullptr, "no profiler");
+    // 6 Tick, 3 Tock, 3 Virtual, the function, the cancelled event and the
+    // lambda which disables the profiler
+    NS_TEST_ASSERT_MSG_EQ(profiler->GetEventCount(), 15, "wrong number of events");
+    std::vector<EventProfiler::Entry> targets = profiler->GetTargets();
+    NS_TEST_ASSERT_MSG_EQ(targets.size(), 6, "wrong number of targets");
+    NS_TEST_ASSERT_MSG_EQ(GetEvents(targets, "EventProfilerTestCase::Tick()"),
+                          6,
+                          "wrong number of Tick events");
+    NS_TEST_ASSERT_MSG_EQ(GetEvents(targets, "EventProfilerTestCase::Tock(unsigned int)"),
+                          3,
+                          "wrong number of Tock events");
+    NS_TEST_ASSERT_MSG_EQ(GetEvents(targets, "EventProfilerTestCase::Virtual()"),
+                          3,
+                          "virtual member function not resolved to the overrider");
+    NS_TEST_ASSERT_MSG_EQ(GetEvents(targets, "EventProfilerTestFunction()"),
+                          1,
+                          "wrong number of function events");
+    NS_TEST_ASSERT_MSG_EQ(GetEvents(targets, "lambda"), 1, "wrong number of lambda events");
+    NS_TEST_ASSERT_MSG_EQ(GetEvents(targets, "(cancelled)"), 1, "wrong number of cancellations");
+
+    std::vector<EventProfiler::Entry> contexts = profiler->GetContexts();
+    NS_TEST_ASSERT_MSG_EQ(GetEvents(contexts, "0"), 3, "wrong number of events in context 0");
+    NS_TEST_ASSERT_MSG_EQ(GetEvents(contexts, "1"), 3, "wrong number of events in context 1");
+    NS_TEST_ASSERT_MSG_EQ(GetEvents(contexts, "7"), 3, "wrong number of events in context 7");
+    NS_TEST_ASSERT_MSG_EQ(profiler->GetQueueSamples().size(), 3, "wrong number of samples");
+    NS_TEST_ASSERT_MSG_EQ(profiler->GetQueueSamples().back().events,
+                          12,
+                          "wrong event count of the last sample");
+
+    Simulator::Destroy();
+    std::ifstream is(filename);
+    std::stringstream profile;
+    profile << is.rdbuf();
+    NS_TEST_ASSERT_MSG_NE(profile.str().find("Event profile: 15 events"),
+                          std::string::npos,
+                          "profile not written");
+    std::remove(filename.c_str());
+}
+
+/**
+ * \ingroup event-profiler-tests
+ *
+ * Event profiler test suite.
+ */
+class EventProfilerTestSuite : public TestSuite
+{
+  public:
+    EventProfilerTestSuite();
+};
+
+EventProfilerTestSuite::EventProfilerTestSuite()
+    : TestSuite("event-profiler", Type::UNIT)
+{
+    AddTestCase(new EventProfilerTestCase, TestCase::Duration::QUICK);
+}
+
+/**
+ * \ingroup event-profiler-tests
+ * EventProfilerTestSuite instance variable.
+ */
+static EventProfilerTestSuite g_eventProfilerTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -0,0 +1,166 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/event-trace.h"
+#include "ns3/map-scheduler.h"
+#include "ns3/simulator-impl.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+
+#include <cstdio>
+
+/**
+ * \file
+ * \ingroup event-trace-tests
+ * Event trace test suite.
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup event-trace-tests Event trace test suite
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * \ingroup event-trace-tests
+ *
+ * Record the event trace of a simulation and replay it against a scheduler.
+ */
+class EventTraceTestCase : public TestCase
+{
+  public:
+    EventTraceTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Event which schedules the next one, and cancels or removes another.
+     * \param [in] depth The number of events left to schedule.
+     */
+    void Tick(uint32_t depth);
+
+    EventId m_spare; //!< An event to remove or cancel.
+};
+
+EventTraceTestCase::EventTraceTestCase()
+    : TestCase("Check the recording and the replay of an event trace")
+{
+}
+
+void
+EventTraceTestCase::Tick(uint32_t depth)
+{
+    if (depth == 0)
+    {
+        return;
+    }
+    if (depth % 3 == 0)
+    {
+        Simulator::Remove(m_spare);
+    }
+    else if (depth % 3 == 1)
+    {
+        m_spare.Cancel();
+    }
+    m_spare = Simulator::Schedule(MicroSeconds(depth), &EventTraceTestCase::Tick, this, 0);
+    Simulator::ScheduleWithContext(depth % 4,
+                                   MicroSeconds(depth % 2),
+                                   &EventTraceTestCase::Tick,
+                                   this,
+                                   depth - 1);
+}
+
+void
+EventTraceTestCase::DoRun()
+{
+    std::string filename = CreateTempDirFilename("events.bin");
+    Simulator::GetImplementation()->SetAttribute("EventTraceFile", StringValue(filename));
+    Simulator::Schedule(Seconds(1), &EventTraceTestCase::Tick, this, 30);
+    Simulator::Run();
+    uint64_t events = Simulator::GetEventCount();
+    Simulator::Destroy();
+
+    Ptr<Scheduler> scheduler = CreateObject<MapScheduler>();
+    EventTraceReader reader(filename);
+    EventTrace::Record record;
+    uint64_t counts[4] = {0, 0, 0, 0};
+    uint64_t now = 0;
+    while (reader.Read(record))
+    {
+        switch (record.operation)
+        {
+        case EventTrace::INSERT:
+            NS_TEST_ASSERT_MSG_GT_OR_EQ(record.key.m_ts, now, "event in the past");
+            scheduler->Insert(Scheduler::Event{nullptr, record.key});
+            ++counts[0];
+            break;
+        case EventTrace::REMOVE_NEXT: {
+            Scheduler::Event ev = scheduler->RemoveNext();
+            NS_TEST_ASSERT_MSG_EQ(ev.key.m_ts, record.key.m_ts, "wrong event time");
+            now = ev.key.m_ts;
+            ++counts[1];
+            break;
+        }
+        case EventTrace::REMOVE:
+            scheduler->Remove(Scheduler::Event{nullptr, record.key});
+            ++counts[2];
+            break;
+        case EventTrace::CANCEL:
+            ++counts[3];
+            break;
+        }
+    }
+    NS_TEST_ASSERT_MSG_EQ(scheduler->IsEmpty(), true, "events left after the replay");
+    NS_TEST_ASSERT_MSG_EQ(counts[1], events, "wrong number of events run");
+    NS_TEST_ASSERT_MSG_EQ(counts[0], counts[1] + counts[2], "wrong number of insertions");
+    // the first removal is of an invalid event
+    NS_TEST_ASSERT_MSG_EQ(counts[2], 9, "wrong number of removals");
+    NS_TEST_ASSERT_MSG_EQ(counts[3], 10, "wrong number of cancellations");
+    std::remove(filename.c_str());
+}
+
+/**
+ * \ingroup event-trace-tests
+ *
+ * Event trace test suite.
+ */
+class EventTraceTestSuite : public TestSuite
+{
+  public:
+    EventTraceTestSuite();
+};
+
+EventTraceTestSuite::EventTraceTestSuite()
+    : TestSuite("event-trace", Type::UNIT)
+{
+    AddTestCase(new EventTraceTestCase, TestCase::Duration::QUICK);
+}
+
+/**
+ * \ingroup event-trace-tests
+ * EventTraceTestSuite instance variable.
+ */
+static EventTraceTestSuite g_eventTraceTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -0,0 +1,184 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/ladder-scheduler.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <set>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup ladder-scheduler-tests
+ * LadderScheduler test suite.
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup ladder-scheduler-tests LadderScheduler test suite
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * \ingroup ladder-scheduler-tests
+ *
+ * Check the order of the events of the LadderScheduler against a sorted
+ * set, with bursts of events at the same time, a sparse far future tail
+ * and random removals.
+ */
+class LadderSchedulerTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     * \param [in] threshold The Threshold attribute of the scheduler.
+     */
+    LadderSchedulerTestCase(uint32_t threshold);
+
+  private:
+    void DoRun() override;
+
+    uint32_t m_threshold; //!< The Threshold attribute of the scheduler.
+};
+
+LadderSchedulerTestCase::LadderSchedulerTestCase(uint32_t threshold)
+    : TestCase("Check the order of the events with threshold " + std::to_string(threshold)),
+      m_threshold(threshold)
+{
+}
+
+void
+LadderSchedulerTestCase::DoRun()
+{
+    Ptr<LadderScheduler> scheduler = CreateObject<LadderScheduler>();
+    scheduler->SetAttribute("Threshold", UintegerValue(m_threshold));
+    Ptr<UniformRandomVariable> rng = CreateObject<UniformRandomVariable>();
+    rng->SetStream(1);
+
+    std::set<Scheduler::Event> reference;
+    std::vector<Scheduler::Event> pending;
+    uint32_t uid = 0;
+    uint64_t now = 0;
+    const uint64_t slot = 125000;
+
+    auto insert = [&](uint64_t ts) {
+        Scheduler::Event ev;
+        ev.impl = nullptr;
+        ev.key.m_ts = ts;
+        ev.key.m_uid = uid++;
+        ev.key.m_context = 0;
+        scheduler->Insert(ev);
+        reference.insert(ev);
+        pending.push_back(ev);
+    };
+
+    for (uint32_t i = 0; i < 2000; ++i)
+    {
+        insert(rng->GetInteger(0, 10 * slot));
+    }
+    for (uint32_t step = 0; step < 50000; ++step)
+    {
+        double choice = rng->GetValue();
+        if (choice < 0.05)
+        {
+            // a burst at the next slot boundary
+            uint64_t boundary = (now / slot + 1) * slot;
+            for (uint32_t k = rng->GetInteger(1, 20); k > 0; --k)
+            {
+                insert(boundary);
+            }
+        }
+        else if (choice < 0.1)
+        {
+            // the far future
+            insert(now + rng->GetInteger(100 * slot, 10000 * slot));
+        }
+        else if (choice < 0.15)
+        {
+            // now
+            insert(now);
+        }
+        else if (choice < 0.35)
+        {
+            insert(now + rng->GetInteger(0, 2 * slot));
+        }
+        else if (choice < 0.4 && !pending.empty())
+        {
+            uint32_t index = rng->GetInteger(0, pending.size() - 1);
+            Scheduler::Event ev = pending[index];
+            pending[index] = pending.back();
+            pending.pop_back();
+            if (reference.erase(ev) > 0)
+            {
+                scheduler->Remove(ev);
+            }
+        }
+        else if (!reference.empty())
+        {
+            NS_TEST_ASSERT_MSG_EQ(scheduler->IsEmpty(), false, "scheduler empty");
+            Scheduler::Event expected = *reference.begin();
+            reference.erase(reference.begin());
+            NS_TEST_ASSERT_MSG_EQ(scheduler->PeekNext().key.m_uid,
+                                  expected.key.m_uid,
+                                  "wrong next event at step " << step);
+            Scheduler::Event ev = scheduler->RemoveNext();
+            NS_TEST_ASSERT_MSG_EQ(ev.key.m_uid, expected.key.m_uid, "wrong event");
+            NS_TEST_ASSERT_MSG_EQ(ev.key.m_ts, expected.key.m_ts, "wrong event time");
+            now = ev.key.m_ts;
+        }
+    }
+    while (!reference.empty())
+    {
+        Scheduler::Event ev = scheduler->RemoveNext();
+        NS_TEST_ASSERT_MSG_EQ(ev.key.m_uid, reference.begin()->key.m_uid, "wrong event");
+        reference.erase(reference.begin());
+    }
+    NS_TEST_ASSERT_MSG_EQ(scheduler->IsEmpty(), true, "scheduler not empty");
+}
+
+/**
+ * \ingroup ladder-scheduler-tests
+ *
+ * LadderScheduler test suite.
+ */
+class LadderSchedulerTestSuite : public TestSuite
+{
+  public:
+    LadderSchedulerTestSuite();
+};
+
+LadderSchedulerTestSuite::LadderSchedulerTestSuite()
+    : TestSuite("ladder-scheduler", Type::UNIT)
+{
+    AddTestCase(new LadderSchedulerTestCase(50), TestCase::Duration::QUICK);
+    AddTestCase(new LadderSchedulerTestCase(2), TestCase::Duration::QUICK);
+}
+
+/**
+ * \ingroup ladder-scheduler-tests
+ * LadderSchedulerTestSuite instance variable.
+ */
+static LadderSchedulerTestSuite g_ladderSchedulerTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -0,0 +1,182 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/mpsc-queue.h"
+#include "ns3/test.h"
+
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup mpsc-queue-tests
+ * MpscQueue test suite.
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup mpsc-queue-tests MpscQueue test suite
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * \ingroup mpsc-queue-tests
+ *
+ * Push and drain from a single thread, through the ring and through the
+ * overflow list.
+ */
+class MpscQueueOverflowTestCase : public TestCase
+{
+  public:
+    MpscQueueOverflowTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+MpscQueueOverflowTestCase::MpscQueueOverflowTestCase()
+    : TestCase("Check the order of the items in the ring and in the overflow list")
+{
+}
+
+void
+MpscQueueOverflowTestCase::DoRun()
+{
+    MpscQueue<uint32_t> queue(4);
+    NS_TEST_ASSERT_MSG_EQ(queue.IsPending(), false, "pending before the first push");
+    std::vector<uint32_t> items;
+    auto collect = [&items](uint32_t item) { items.push_back(item); };
+    // the ring is not allocated yet
+    NS_TEST_ASSERT_MSG_EQ(queue.Drain(collect), 0, "items in an empty queue");
+
+    NS_TEST_ASSERT_MSG_EQ(queue.Push(0), true, "first push does not wake the consumer");
+    for (uint32_t i = 1; i < 10; ++i)
+    {
+        NS_TEST_ASSERT_MSG_EQ(queue.Push(i), false, "later push wakes the consumer");
+    }
+    NS_TEST_ASSERT_MSG_EQ(queue.IsPending(), true, "not pending after a push");
+    NS_TEST_ASSERT_MSG_EQ(queue.Drain(collect), 10, "wrong number of items");
+    NS_TEST_ASSERT_MSG_EQ(queue.IsPending(), false, "pending after the drain");
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        NS_TEST_ASSERT_MSG_EQ(items[i], i, "items out of order");
+    }
+
+    // the ring is reused once the overflow list is drained
+    items.clear();
+    NS_TEST_ASSERT_MSG_EQ(queue.Push(10), true, "push after a drain does not wake the consumer");
+    queue.Push(11);
+    NS_TEST_ASSERT_MSG_EQ(queue.Drain(collect), 2, "wrong number of items");
+    NS_TEST_ASSERT_MSG_EQ(items[0], 10, "items out of order");
+    NS_TEST_ASSERT_MSG_EQ(items[1], 11, "items out of order");
+}
+
+/**
+ * \ingroup mpsc-queue-tests
+ *
+ * Push from several threads while the consumer drains, and check that no
+ * item is lost and that the items of each producer keep their order.
+ */
+class MpscQueueThreadsTestCase : public TestCase
+{
+  public:
+    MpscQueueThreadsTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+MpscQueueThreadsTestCase::MpscQueueThreadsTestCase()
+    : TestCase("Check that concurrent producers lose no item and keep their order")
+{
+}
+
+void
+MpscQueueThreadsTestCase::DoRun()
+{
+    const uint32_t producers = 4;
+    const uint32_t count = 20000;
+    // a small ring, so that the producers go through the overflow list too
+    MpscQueue<std::pair<uint32_t, uint32_t>> queue(64);
+    std::atomic<uint32_t> done{0};
+    std::vector<std::thread> threads;
+    for (uint32_t p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&queue, &done, p, count]() {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                queue.Push({p, i});
+            }
+            ++done;
+        });
+    }
+
+    std::vector<uint32_t> next(producers, 0);
+    bool ordered = true;
+    uint64_t received = 0;
+    auto check = [&](const std::pair<uint32_t, uint32_t>& item) {
+        ordered = ordered && item.second == next[item.first];
+        next[item.first] = item.second + 1;
+        ++received;
+    };
+    while (done.load() < producers)
+    {
+        queue.Drain(check);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    queue.Drain(check);
+
+    NS_TEST_ASSERT_MSG_EQ(ordered, true, "items of a producer out of order");
+    NS_TEST_ASSERT_MSG_EQ(received, producers * count, "items lost");
+    NS_TEST_ASSERT_MSG_EQ(queue.IsPending(), false, "pending after the last drain");
+}
+
+/**
+ * \ingroup mpsc-queue-tests
+ *
+ * MpscQueue test suite.
+ */
+class MpscQueueTestSuite : public TestSuite
+{
+  public:
+    MpscQueueTestSuite();
+};
+
+MpscQueueTestSuite::MpscQueueTestSuite()
+    : TestSuite("mpsc-queue", Type::UNIT)
+{
+    AddTestCase(new MpscQueueOverflowTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new MpscQueueThreadsTestCase, TestCase::Duration::QUICK);
+}
+
+/**
+ * \ingroup mpsc-queue-tests
+ * MpscQueueTestSuite instance variable.
+ */
+static MpscQueueTestSuite g_mpscQueueTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -0,0 +1,338 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/config.h"
+#include "ns3/multithreaded-simulator-impl.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup multithreaded-simulator-tests
+ * MultithreadedSimulatorImpl test suite.
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup multithreaded-simulator-tests MultithreadedSimulatorImpl test suite
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * \ingroup multithreaded-simulator-tests
+ *
+ * Contexts with periodic local events, exchanging messages with a delay
+ * of at least one millisecond.
+ *
+ * The local events run at even timesteps and the messages arrive at odd
+ * ones, and the messages are accumulated, so that the trace of each
+ * context does not depend on the order of the events at the same time.
+ */
+class MessageExchange
+{
+  public:
+    /**
+     * Constructor.
+     * \param [in] contexts The number of contexts.
+     */
+    MessageExchange(uint32_t contexts);
+
+    /** Schedule the first event of every context. */
+    void Start();
+
+    /** \returns the trace of every context: the time and state at each local event */
+    const std::vector<std::vector<std::pair<int64_t, uint64_t>>>& GetTraces() const;
+
+  private:
+    /**
+     * Local event.
+     * \param [in] context The context.
+     */
+    void Tick(uint32_t context);
+    /**
+     * Reception of a message.
+     * \param [in] context The receiving context.
+     * \param [in] value The content of the message.
+     */
+    void Receive(uint32_t context, uint64_t value);
+
+    uint32_t m_contexts;              //!< The number of contexts.
+    std::vector<uint64_t> m_state;    //!< The state of each context.
+    std::vector<uint64_t> m_received; //!< The messages received since the last tick.
+    std::vector<uint32_t> m_ticks;    //!< The number of ticks of each context.
+    /** The trace of each context. */
+    std::vector<std::vector<std::pair<int64_t, uint64_t>>> m_traces;
+};
+
+MessageExchange::MessageExchange(uint32_t contexts)
+    : m_contexts(contexts),
+      m_state(contexts),
+      m_received(contexts, 0),
+      m_ticks(contexts, 0),
+      m_traces(contexts)
+{
+    for (uint32_t i = 0; i < contexts; ++i)
+    {
+        m_state[i] = i + 1;
+    }
+}
+
+void
+MessageExchange::Start()
+{
+    for (uint32_t i = 0; i < m_contexts; ++i)
+    {
+        Simulator::ScheduleWithContext(i, MicroSeconds(i), &MessageExchange::Tick, this, i);
+    }
+}
+
+const std::vector<std::vector<std::pair<int64_t, uint64_t>>>&
+MessageExchange::GetTraces() const
+{
+    return m_traces;
+}
+
+void
+MessageExchange::Tick(uint32_t context)
+{
+    NS_ASSERT(Simulator::GetContext() == context);
+    m_state[context] = m_state[context] * 6364136223846793005ULL + 1 + m_received[context];
+    m_received[context] = 0;
+    m_traces[context].emplace_back(Simulator::Now().GetTimeStep(), m_state[context]);
+    if (++m_ticks[context] % 3 == 0)
+    {
+        uint32_t destination = (context + 1 + (m_state[context] >> 33) % (m_contexts - 1)) %
+                               m_contexts;
+        Simulator::ScheduleWithContext(destination,
+                                       MilliSeconds(1) + NanoSeconds(2 * context + 1),
+                                       &MessageExchange::Receive,
+                                       this,
+                                       destination,
+                                       m_state[context] >> 17);
+    }
+    Simulator::Schedule(MicroSeconds(10 + context), &MessageExchange::Tick, this, context);
+}
+
+void
+MessageExchange::Receive(uint32_t context, uint64_t value)
+{
+    NS_ASSERT(Simulator::GetContext() == context);
+    m_received[context] += value;
+}
+
+/**
+ * \ingroup multithreaded-simulator-tests
+ *
+ * Check that the multithreaded simulator gives the same traces as the
+ * default simulator, whatever the number of partitions.
+ */
+class MultithreadedSimulatorTestCase : public TestCase
+{
+  public:
+    MultithreadedSimulatorTestCase();
+
+  private:
+    void DoRun() override;
+    void DoTeardown() override;
+
+    /**
+     * Run the message exchange.
+     * \param [in] simulatorType The simulator implementation.
+     * \param [in] partitions The number of partitions of the multithreaded simulator.
+     * \param [out] eventCount The number of events.
+     * \returns the traces of the contexts
+     */
+    std::vector<std::vector<std::pair<int64_t, uint64_t>>> RunExchange(
+        const std::string& simulatorType,
+        uint32_t partitions,
+        uint64_t& eventCount);
+
+    /** The number of contexts. */
+    static const uint32_t CONTEXTS = 8;
+};
+
+MultithreadedSimulatorTestCase::MultithreadedSimulatorTestCase()
+    : TestCase("Check the traces of the multithreaded simulator against the default simulator")
+{
+}
+
+std::vector<std::vector<std::pair<int64_t, uint64_t>>>
+MultithreadedSimulatorTestCase::RunExchange(const std::string& simulatorType,
+                                            uint32_t partitions,
+                                            uint64_t& eventCount)
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue(simulatorType));
+    Config::SetDefault("ns3::MultithreadedSimulatorImpl::PartitionCount",
+                       UintegerValue(partitions));
+
+    for (uint32_t i = 0; i < CONTEXTS; ++i)
+    {
+        for (uint32_t j = i + 1; j < CONTEXTS; ++j)
+        {
+            MultithreadedSimulatorImpl::DeclareLookAhead(i, j, MilliSeconds(1));
+        }
+    }
+    Ptr<MultithreadedSimulatorImpl> impl =
+        DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+    if (impl && partitions > 1)
+    {
+        NS_TEST_EXPECT_MSG_EQ(impl->GetPartitionCount(), partitions, "wrong partition count");
+        NS_TEST_EXPECT_MSG_EQ(impl->GetLookAhead(), MilliSeconds(1), "wrong lookahead");
+    }
+
+    MessageExchange exchange(CONTEXTS);
+    exchange.Start();
+    Simulator::Stop(MilliSeconds(50) + NanoSeconds(500));
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ((Simulator::Now() <= MilliSeconds(50) + NanoSeconds(500)),
+                          true,
+                          "ran past the stop time");
+    eventCount = Simulator::GetEventCount();
+    Simulator::Destroy();
+    return exchange.GetTraces();
+}
+
+void
+MultithreadedSimulatorTestCase::DoRun()
+{
+    uint64_t reference = 0;
+    auto expected = RunExchange("ns3::DefaultSimulatorImpl", 1, reference);
+    NS_TEST_ASSERT_MSG_GT(expected[0].size(), 1000, "too few events");
+
+    for (uint32_t partitions : {1, 2, 3, 8})
+    {
+        uint64_t eventCount = 0;
+        auto traces = RunExchange("ns3::MultithreadedSimulatorImpl", partitions, eventCount);
+        NS_TEST_EXPECT_MSG_EQ(eventCount, reference, "wrong event count");
+        for (uint32_t i = 0; i < CONTEXTS; ++i)
+        {
+            NS_TEST_ASSERT_MSG_EQ(traces[i].size(),
+                                  expected[i].size(),
+                                  "wrong trace length of context " << i << " with " << partitions
+                                                                   << " partitions");
+            for (std::size_t k = 0; k < traces[i].size(); ++k)
+            {
+                NS_TEST_ASSERT_MSG_EQ(traces[i][k].first,
+                                      expected[i][k].first,
+                                      "wrong event time of context " << i);
+                NS_TEST_ASSERT_MSG_EQ(traces[i][k].second,
+                                      expected[i][k].second,
+                                      "wrong state of context " << i);
+            }
+        }
+    }
+}
+
+void
+MultithreadedSimulatorTestCase::DoTeardown()
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue("ns3::DefaultSimulatorImpl"));
+}
+
+/**
+ * \ingroup multithreaded-simulator-tests
+ *
+ * Check the computation of the lookahead and the partitions.
+ */
+class MultithreadedSimulatorLookAheadTestCase : public TestCase
+{
+  public:
+    MultithreadedSimulatorLookAheadTestCase();
+
+  private:
+    void DoRun() override;
+    void DoTeardown() override;
+};
+
+MultithreadedSimulatorLookAheadTestCase::MultithreadedSimulatorLookAheadTestCase()
+    : TestCase("Check the lookahead of the multithreaded simulator")
+{
+}
+
+void
+MultithreadedSimulatorLookAheadTestCase::DoRun()
+{
+    Config::SetGlobal("SimulatorImplementationType",
+                      StringValue("ns3::MultithreadedSimulatorImpl"));
+    Config::SetDefault("ns3::MultithreadedSimulatorImpl::PartitionCount", UintegerValue(2));
+    Ptr<MultithreadedSimulatorImpl> impl =
+        DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+    NS_TEST_ASSERT_MSG_NE(impl, nullptr, "not a multithreaded simulator");
+
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLookAhead(),
+                          impl->GetMaximumSimulationTime(),
+                          "unconstrained lookahead");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetPartition(5), 1, "wrong default partition");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetPartition(Simulator::NO_CONTEXT), 0, "wrong partition");
+
+    // contexts 0 and 2 share a partition: no constraint
+    MultithreadedSimulatorImpl::DeclareLookAhead(0, 2, MicroSeconds(1));
+    MultithreadedSimulatorImpl::DeclareLookAhead(0, 1, MicroSeconds(100));
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLookAhead(), MicroSeconds(100), "wrong lookahead");
+
+    impl->SetPartition(2, 1);
+    NS_TEST_EXPECT_MSG_EQ(impl->GetPartition(2), 1, "wrong explicit partition");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLookAhead(), MicroSeconds(1), "wrong lookahead");
+
+    impl->SetPartition(2, 0);
+    impl->BoundLookAhead(MicroSeconds(50));
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLookAhead(), MicroSeconds(50), "wrong bounded lookahead");
+
+    Simulator::Destroy();
+}
+
+void
+MultithreadedSimulatorLookAheadTestCase::DoTeardown()
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue("ns3::DefaultSimulatorImpl"));
+}
+
+/**
+ * \ingroup multithreaded-simulator-tests
+ *
+ * MultithreadedSimulatorImpl test suite.
+ */
+class MultithreadedSimulatorTestSuite : public TestSuite
+{
+  public:
+    MultithreadedSimulatorTestSuite();
+};
+
+MultithreadedSimulatorTestSuite::MultithreadedSimulatorTestSuite()
+    : TestSuite("multithreaded-simulator", Type::UNIT)
+{
+    AddTestCase(new MultithreadedSimulatorLookAheadTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new MultithreadedSimulatorTestCase, TestCase::Duration::QUICK);
+}
+
+/**
+ * \ingroup multithreaded-simulator-tests
+ * MultithreadedSimulatorTestSuite instance variable.
+ */
+static MultithreadedSimulatorTestSuite g_multithreadedSimulatorTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -2938,6 +2938,95 @@ ShuffleElementsTest::DoRun()
                           "Expected vector {4, 1, 9, 3, 2, 7}");
 }
 
+/**
+ * \ingroup rng-tests
+ * Test that the bulk GetValues returns the values of as many GetValue calls.
+ */
+class BulkValuesTestCase : public TestCase
+{
+  public:
+    BulkValuesTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Compare the values of two streams created with the same stream number,
+     * one read with GetValue and the other with GetValues and GetValue.
+     *
+     * \param [in] factory The configured factory of the random variable.
+     * \param [in] label The configuration name, for the messages.
+     */
+    void CheckSameValues(ObjectFactory factory, std::string label);
+};
+
+BulkValuesTestCase::BulkValuesTestCase()
+    : TestCase("Check that GetValues returns the same values as GetValue")
+{
+}
+
+void
+BulkValuesTestCase::CheckSameValues(ObjectFactory factory, std::string label)
+{
+    Ptr<RandomVariableStream> scalar = factory.Create<RandomVariableStream>();
+    Ptr<RandomVariableStream> bulk = factory.Create<RandomVariableStream>();
+    scalar->SetStream(7);
+    bulk->SetStream(7);
+
+    std::vector<double> values;
+    for (std::size_t n : {1, 2, 3, 7, 64, 129, 200, 0, 5})
+    {
+        values.resize(n);
+        bulk->GetValues(values);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            NS_TEST_ASSERT_MSG_EQ(values[i],
+                                  scalar->GetValue(),
+                                  label << ": value " << i << " of " << n << " differs");
+        }
+        // Interleave the scalar path on the bulk stream.
+        NS_TEST_ASSERT_MSG_EQ(bulk->GetValue(),
+                              scalar->GetValue(),
+                              label << ": value after " << n << " differs");
+    }
+}
+
+void
+BulkValuesTestCase::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    ObjectFactory factory;
+    factory.SetTypeId(UniformRandomVariable::GetTypeId());
+    factory.Set("Min", DoubleValue(-3.0));
+    factory.Set("Max", DoubleValue(5.0));
+    CheckSameValues(factory, "uniform");
+    factory.Set("Antithetic", BooleanValue(true));
+    CheckSameValues(factory, "antithetic uniform");
+
+    factory = ObjectFactory();
+    factory.SetTypeId(ExponentialRandomVariable::GetTypeId());
+    factory.Set("Mean", DoubleValue(2.0));
+    CheckSameValues(factory, "exponential");
+    factory.Set("Bound", DoubleValue(1.0));
+    CheckSameValues(factory, "bounded exponential");
+
+    factory = ObjectFactory();
+    factory.SetTypeId(NormalRandomVariable::GetTypeId());
+    factory.Set("Mean", DoubleValue(1.0));
+    factory.Set("Variance", DoubleValue(4.0));
+    CheckSameValues(factory, "normal");
+    factory.Set("Antithetic", BooleanValue(true));
+    CheckSameValues(factory, "antithetic normal");
+    factory.Set("Bound", DoubleValue(1.0));
+    CheckSameValues(factory, "bounded normal");
+
+    factory = ObjectFactory();
+    factory.SetTypeId(ParetoRandomVariable::GetTypeId());
+    CheckSameValues(factory, "pareto");
+}
+
 /**
  * \ingroup rng-tests
  * RandomVariableStream test suite, covering all random number variable
@@ -2995,6 +3084,7 @@ RandomVariableSuite::RandomVariableSuite()
     AddTestCase(new BinomialTestCase);
     AddTestCase(new BinomialAntitheticTestCase);
     AddTestCase(new ShuffleElementsTest);
+    AddTestCase(new BulkValuesTestCase);
 }
 
 static RandomVariableSuite randomVariableSuite; //!< Static variable for test initialization
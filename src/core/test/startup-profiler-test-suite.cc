@@ -0,0 +1,186 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/config.h"
+#include "ns3/integer.h"
+#include "ns3/object-factory.h"
+#include "ns3/object.h"
+#include "ns3/startup-profiler.h"
+#include "ns3/test.h"
+
+#include <sstream>
+
+/**
+ * \file
+ * \ingroup startup-profiler-tests
+ * StartupProfiler test suite.
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup startup-profiler-tests StartupProfiler test suite
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * \ingroup startup-profiler-tests
+ *
+ * Object with an attribute, created by the tests.
+ */
+class StartupProfilerTestObject : public Object
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return The object TypeId.
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::tests::StartupProfilerTestObject")
+                                .SetParent<Object>()
+                                .SetGroupName("Core")
+                                .HideFromDocumentation()
+                                .AddConstructor<StartupProfilerTestObject>()
+                                .AddAttribute(
+                                    "Value",
+                                    "A test value.",
+                                    IntegerValue(1),
+                                    MakeIntegerAccessor(&StartupProfilerTestObject::m_value),
+                                    MakeIntegerChecker<int32_t>());
+        return tid;
+    }
+
+  private:
+    int32_t m_value; //!< The attribute.
+};
+
+NS_OBJECT_ENSURE_REGISTERED(StartupProfilerTestObject);
+
+/**
+ * \ingroup startup-profiler-tests
+ *
+ * Check the calls recorded by the profiler.
+ */
+class StartupProfilerTestCase : public TestCase
+{
+  public:
+    StartupProfilerTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+StartupProfilerTestCase::StartupProfilerTestCase()
+    : TestCase("Check the calls recorded by the startup profiler")
+{
+}
+
+void
+StartupProfilerTestCase::DoRun()
+{
+    const std::string name = "ns3::tests::StartupProfilerTestObject";
+
+    NS_TEST_ASSERT_MSG_EQ(StartupProfiler::NormalizePath("/NodeList/12/DeviceList/0/Mac"),
+                          "/NodeList/#/DeviceList/#/Mac",
+                          "numeric path elements not normalized");
+    NS_TEST_ASSERT_MSG_EQ(StartupProfiler::NormalizePath("/NodeList/[0-3]/$ns3::Node/Id1"),
+                          "/NodeList/[0-3]/$ns3::Node/Id1",
+                          "non numeric path elements modified");
+
+    bool wasEnabled = StartupProfiler::IsEnabled();
+    StartupProfiler::Enable();
+    StartupProfiler::Reset();
+
+    ObjectFactory factory;
+    factory.SetTypeId(name);
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        Ptr<Object> object = factory.Create<Object>();
+        object->SetAttribute("Value", IntegerValue(i));
+    }
+    Config::Set("/NodeList/0/Foo", IntegerValue(0));
+
+    NS_TEST_ASSERT_MSG_EQ(StartupProfiler::GetCalls(StartupProfiler::TYPEID_LOOKUP, name),
+                          1,
+                          "wrong number of TypeId lookups");
+    NS_TEST_ASSERT_MSG_EQ(StartupProfiler::GetCalls(StartupProfiler::OBJECT_CREATE, name),
+                          3,
+                          "wrong number of object creations");
+    NS_TEST_ASSERT_MSG_EQ(StartupProfiler::GetCalls(StartupProfiler::OBJECT_CONSTRUCT, name),
+                          3,
+                          "wrong number of attribute initializations");
+    NS_TEST_ASSERT_MSG_EQ(
+        StartupProfiler::GetCalls(StartupProfiler::ATTRIBUTE_SET, name + "::Value"),
+        3,
+        "wrong number of attribute sets");
+    NS_TEST_ASSERT_MSG_EQ(
+        StartupProfiler::GetCalls(StartupProfiler::CONFIG_OPERATION, "Set /NodeList/#/Foo"),
+        1,
+        "wrong number of Config::Set");
+    NS_TEST_ASSERT_MSG_EQ(StartupProfiler::GetCalls(StartupProfiler::CONFIG_RESOLVE, "/NodeList/#"),
+                          1,
+                          "wrong number of Config path resolutions");
+
+    std::ostringstream oss;
+    StartupProfiler::Report(oss, 1);
+    NS_TEST_ASSERT_MSG_NE(oss.str().find(name), std::string::npos, "entry missing in the report");
+
+    StartupProfiler::Disable();
+    factory.Create<Object>();
+    NS_TEST_ASSERT_MSG_EQ(StartupProfiler::GetCalls(StartupProfiler::OBJECT_CREATE, name),
+                          3,
+                          "calls recorded while disabled");
+
+    StartupProfiler::Reset();
+    NS_TEST_ASSERT_MSG_EQ(StartupProfiler::GetCalls(StartupProfiler::OBJECT_CREATE),
+                          0,
+                          "records not discarded");
+    if (wasEnabled)
+    {
+        StartupProfiler::Enable();
+    }
+}
+
+/**
+ * \ingroup startup-profiler-tests
+ *
+ * StartupProfiler test suite.
+ */
+class StartupProfilerTestSuite : public TestSuite
+{
+  public:
+    StartupProfilerTestSuite();
+};
+
+StartupProfilerTestSuite::StartupProfilerTestSuite()
+    : TestSuite("startup-profiler", Type::UNIT)
+{
+    AddTestCase(new StartupProfilerTestCase, TestCase::Duration::QUICK);
+}
+
+/**
+ * \ingroup startup-profiler-tests
+ * StartupProfilerTestSuite instance variable.
+ */
+static StartupProfilerTestSuite g_startupProfilerTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
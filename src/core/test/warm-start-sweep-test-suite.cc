@@ -0,0 +1,194 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/config.h"
+#include "ns3/double.h"
+#include "ns3/object.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+#include "ns3/warm-start-sweep.h"
+
+#include <string>
+
+/**
+ * \file
+ * \ingroup warm-start-sweep-tests
+ * Warm-start sweep test suite.
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup warm-start-sweep-tests Warm-start sweep test suite
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * \ingroup warm-start-sweep-tests
+ *
+ * An object accumulating its rate every millisecond.
+ */
+class SweepTestObject : public Object
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Start the ticks. */
+    void Start();
+
+    uint64_t m_sum{0};                //!< The sum of the rates.
+    uint64_t m_draws{0};              //!< The sum of the random draws.
+    Ptr<UniformRandomVariable> m_rng; //!< A random variable.
+
+  private:
+    /** Add the rate and a random draw to the sums, and schedule the next tick. */
+    void Tick();
+
+    uint32_t m_rate{0}; //!< The rate added at each tick.
+};
+
+TypeId
+SweepTestObject::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::tests::SweepTestObject")
+                            .SetParent<Object>()
+                            .SetGroupName("Core")
+                            .AddAttribute("Rate",
+                                          "The rate added at each tick.",
+                                          UintegerValue(1),
+                                          MakeUintegerAccessor(&SweepTestObject::m_rate),
+                                          MakeUintegerChecker<uint32_t>());
+    return tid;
+}
+
+void
+SweepTestObject::Start()
+{
+    m_rng = CreateObject<UniformRandomVariable>();
+    m_rng->SetAttribute("Max", DoubleValue(1000));
+    Simulator::Schedule(MilliSeconds(1), &SweepTestObject::Tick, this);
+}
+
+void
+SweepTestObject::Tick()
+{
+    m_sum += m_rate;
+    m_draws += m_rng->GetInteger();
+    Simulator::Schedule(MilliSeconds(1), &SweepTestObject::Tick, this);
+}
+
+/**
+ * \ingroup warm-start-sweep-tests
+ *
+ * Run variants with different rates and RNG runs from a checkpoint.
+ */
+class WarmStartSweepTestCase : public TestCase
+{
+  public:
+    WarmStartSweepTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+WarmStartSweepTestCase::WarmStartSweepTestCase()
+    : TestCase("Check the variants run from the checkpoint")
+{
+}
+
+void
+WarmStartSweepTestCase::DoRun()
+{
+    Ptr<SweepTestObject> object = CreateObject<SweepTestObject>();
+    Config::RegisterRootNamespaceObject(object);
+    object->Start();
+
+    WarmStartSweep sweep;
+    sweep.SetParallelism(2);
+    for (uint32_t rate = 1; rate <= 4; ++rate)
+    {
+        WarmStartSweep::Variant variant;
+        variant.name = "rate " + std::to_string(rate);
+        variant.values.emplace_back("/Rate", std::to_string(rate));
+        // the same run for the first two variants
+        variant.run = rate < 3 ? 7 : rate;
+        variant.setup = [object]() { object->m_rng->SetStream(0); };
+        sweep.AddVariant(variant);
+    }
+    sweep.SetResultCallback([object]() {
+        return std::to_string(object->m_sum) + " " + std::to_string(object->m_draws);
+    });
+    // the stop events run before the ticks of the same time: ticks at 1 to
+    // 99 ms, then at 100 to 299 ms
+    auto results = sweep.Run(MilliSeconds(100), MilliSeconds(300));
+
+    NS_TEST_ASSERT_MSG_EQ(Simulator::Now(), MilliSeconds(100), "parent not at the checkpoint");
+    NS_TEST_ASSERT_MSG_EQ(object->m_sum, 99, "parent ran past the checkpoint");
+    NS_TEST_ASSERT_MSG_EQ(results.size(), 4, "wrong number of results");
+    std::string draws[4];
+    for (uint32_t i = 0; i < results.size(); ++i)
+    {
+        NS_TEST_ASSERT_MSG_EQ(results[i].name, "rate " + std::to_string(i + 1), "wrong order");
+        NS_TEST_ASSERT_MSG_EQ(results[i].status, 0, "child failed");
+        std::size_t space = results[i].output.find(' ');
+        NS_TEST_ASSERT_MSG_NE(space, std::string::npos, "wrong output " << results[i].output);
+        uint64_t sum = std::stoull(results[i].output.substr(0, space));
+        NS_TEST_ASSERT_MSG_EQ(sum, 99 + 200 * (i + 1), "variant rate not applied");
+        draws[i] = results[i].output.substr(space + 1);
+    }
+    NS_TEST_ASSERT_MSG_EQ(draws[0], draws[1], "same run, different draws");
+    NS_TEST_ASSERT_MSG_NE(draws[1], draws[2], "different runs, same draws");
+    NS_TEST_ASSERT_MSG_NE(draws[2], draws[3], "different runs, same draws");
+
+    Config::UnregisterRootNamespaceObject(object);
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup warm-start-sweep-tests
+ *
+ * Warm-start sweep test suite.
+ */
+class WarmStartSweepTestSuite : public TestSuite
+{
+  public:
+    WarmStartSweepTestSuite();
+};
+
+WarmStartSweepTestSuite::WarmStartSweepTestSuite()
+    : TestSuite("warm-start-sweep", Type::UNIT)
+{
+    AddTestCase(new WarmStartSweepTestCase, TestCase::Duration::QUICK);
+}
+
+/**
+ * \ingroup warm-start-sweep-tests
+ * WarmStartSweepTestSuite instance variable.
+ */
+static WarmStartSweepTestSuite g_warmStartSweepTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -875,8 +875,8 @@ class EpcX2UeImsiSinrUpdateHeader : public Header
     virtual uint32_t Deserialize(Buffer::Iterator start);
     virtual void Print(std::ostream& os) const;
 
-    std::map<uint64_t, double> GetUeImsiSinrMap() const;
-    void SetUeImsiSinrMap(std::map<uint64_t, double> map);
+    const UeSinrReport& GetUeSinrReport() const;
+    void SetUeSinrReport(const UeSinrReport& report);
 
     uint16_t GetSourceCellId() const;
     void SetSourceCellId(uint16_t sourceCellId);
@@ -888,12 +888,7 @@ class EpcX2UeImsiSinrUpdateHeader : public Header
     uint32_t m_numberOfIes;
     uint32_t m_headerLength;
 
-    // from http://beej.us/guide/bgnet/examples/ieee754.c, to convert
-    // uint64_t to double and viceversa according to IEEE754 format
-    static uint64_t pack754(long double f);
-    static long double unpack754(uint64_t i);
-
-    std::map<uint64_t, double> m_map;
+    UeSinrReport m_report;
     uint16_t m_sourceCellId;
 };
 
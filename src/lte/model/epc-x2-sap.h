@@ -29,6 +29,7 @@
 #include "ns3/packet.h"
 #include <ns3/lte-enb-cmac-sap.h>
 #include <ns3/lte-rrc-sap.h>
+#include <ns3/lte-ue-sinr-report.h>
 
 #include <bitset>
 #include <map>
@@ -383,7 +384,7 @@ class EpcX2Sap
     {
         uint16_t sourceCellId;
         uint16_t targetCellId;
-        std::map<uint64_t, double> ueImsiSinrMap;
+        UeSinrReport ueSinrReport;
     };
 
     struct HandoverFailedParams
@@ -518,7 +518,7 @@ EpcX2::RecvFromX2cSocket(Ptr<Socket> socket)
         NS_LOG_INFO("X2 SinrUpdateHeader header: " << x2ueSinrUpdateHeader);
 
         EpcX2SapUser::UeImsiSinrParams params;
-        params.ueImsiSinrMap = x2ueSinrUpdateHeader.GetUeImsiSinrMap();
+        params.ueSinrReport = x2ueSinrUpdateHeader.GetUeSinrReport();
         params.sourceCellId = x2ueSinrUpdateHeader.GetSourceCellId();
 
         m_x2SapUser->RecvUeSinrUpdate(params);
@@ -1316,7 +1316,7 @@ EpcX2::DoSendUeSinrUpdate(EpcX2Sap::UeImsiSinrParams params)
 
     // Build the X2 message
     EpcX2UeImsiSinrUpdateHeader x2imsiSinrHeader;
-    x2imsiSinrHeader.SetUeImsiSinrMap(params.ueImsiSinrMap);
+    x2imsiSinrHeader.SetUeSinrReport(params.ueSinrReport);
     x2imsiSinrHeader.SetSourceCellId(params.sourceCellId);
 
     EpcX2Header x2Header;
@@ -25,6 +25,7 @@
 
 #include <bitset>
 #include <string>
+#include <vector>
 
 namespace ns3
 {
@@ -66,17 +67,26 @@ class Asn1Header : public Header
     virtual void PreSerialize(void) const = 0;
 
   protected:
-    mutable uint8_t m_serializationPendingBits;    //!< pending bits
-    mutable uint8_t m_numSerializationPendingBits; //!< number of pending bits
-    mutable bool m_isDataSerialized;               //!< true if data is serialized
-    mutable Buffer m_serializationResult;          //!< serialization result
+    mutable uint8_t m_serializationPendingBits;         //!< pending bits
+    mutable uint8_t m_numSerializationPendingBits;      //!< number of pending bits
+    mutable bool m_isDataSerialized;                    //!< true if data is serialized
+    mutable Buffer m_serializationResult;               //!< serialization result
+    mutable std::vector<uint8_t> m_serializationOctets; //!< octets of the ongoing serialization
 
     /**
-     * Function to write in m_serializationResult, after resizing its size
+     * Function to append an octet to the ongoing serialization, which is
+     * copied to m_serializationResult by FinalizeSerialization()
      * \param octet bits to write
      */
     void WriteOctet(uint8_t octet) const;
 
+    /**
+     * Append bits to the ongoing serialization, most significant bit first
+     * \param value the bits to write, right-aligned
+     * \param numBits number of bits to write (at most 64)
+     */
+    void WriteBits(uint64_t value, uint32_t numBits) const;
+
     // Serialization functions
 
     /**
@@ -121,6 +131,16 @@ class Asn1Header : public Header
      */
     void FinalizeSerialization() const;
 
+    /**
+     * Finalizes a deserialization: the octets read are kept as the
+     * serialization result, so that the size of the header and any further
+     * serialization do not require to encode the message again.
+     * \param start the iterator at the beginning of the header
+     * \param end the iterator after the last octet read
+     * \returns the number of octets read
+     */
+    uint32_t FinalizeDeserialization(Buffer::Iterator start, Buffer::Iterator end);
+
     /**
      * Serialize a bitset
      * \param data data to serialize
@@ -263,6 +283,15 @@ class Asn1Header : public Header
 
     // Deserialization functions
 
+    /**
+     * Read bits, most significant bit first
+     * \param value buffer to store the bits read, right-aligned
+     * \param numBits number of bits to read (at most 64)
+     * \param bIterator buffer iterator
+     * \returns the modified buffer iterator
+     */
+    Buffer::Iterator ReadBits(uint64_t* value, uint32_t numBits, Buffer::Iterator bIterator);
+
     /**
      * Deserialize a bitset
      * \param data buffer to store the result
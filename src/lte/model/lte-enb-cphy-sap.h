@@ -27,6 +27,7 @@
 #define LTE_ENB_CPHY_SAP_H
 
 #include <ns3/lte-rrc-sap.h>
+#include <ns3/lte-ue-sinr-report.h>
 #include <ns3/ptr.h>
 
 #include <map>
@@ -140,10 +141,10 @@ class LteEnbCphySapUser
     struct UeAssociatedSinrInfo
     {
         uint8_t componentCarrierId;
-        std::map<uint64_t, double> ueImsiSinrMap;
+        UeSinrReport ueSinrReport; ///< full SINR report of the CC, sorted by IMSI
     };
 
-    virtual void UpdateUeSinrEstimate(LteEnbCphySapUser::UeAssociatedSinrInfo info) = 0;
+    virtual void UpdateUeSinrEstimate(const LteEnbCphySapUser::UeAssociatedSinrInfo& info) = 0;
 };
 
 /**
@@ -284,7 +285,7 @@ class MemberLteEnbCphySapUser : public LteEnbCphySapUser
      * \param owner the owner class
      */
     MemberLteEnbCphySapUser(C* owner);
-    virtual void UpdateUeSinrEstimate(UeAssociatedSinrInfo info);
+    virtual void UpdateUeSinrEstimate(const UeAssociatedSinrInfo& info);
 
     // methods inherited from LteEnbCphySapUser go here
 
@@ -306,7 +307,7 @@ MemberLteEnbCphySapUser<C>::MemberLteEnbCphySapUser()
 
 template <class C>
 void
-MemberLteEnbCphySapUser<C>::UpdateUeSinrEstimate(UeAssociatedSinrInfo info)
+MemberLteEnbCphySapUser<C>::UpdateUeSinrEstimate(const UeAssociatedSinrInfo& info)
 {
     return m_owner->DoUpdateUeSinrEstimate(info);
 }
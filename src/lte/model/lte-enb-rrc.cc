@@ -2670,9 +2670,8 @@ UeManager::SwitchToState(State newState)
                 {
                     uint16_t maxSinrCellId = m_rrc->m_bestMmWaveCellForImsiMap.at(m_imsi);
                     // get the SINR
-                    double maxSinrDb = 10 * std::log10(m_rrc->m_imsiCellSinrMap.find(m_imsi)
-                                                           ->second.find(maxSinrCellId)
-                                                           ->second);
+                    double maxSinrDb = 10 * std::log10(
+                        m_rrc->m_ueCellSinrMatrix.GetSinrByImsi(m_imsi, maxSinrCellId));
                     if (maxSinrDb > m_rrc->m_outageThreshold)
                     {
                         // there is a MmWave cell to which the UE can connect
@@ -2958,6 +2957,7 @@ LteEnbRrc::LteEnbRrc()
       m_lastAllocatedConfigurationIndex(0),
       m_reconfigureUes(false),
       m_firstSibTime(16),
+      m_numCcSinrReports(0),
       m_numNewSinrReports(0),
       m_numberOfComponentCarriers(0),
       m_carriersConfigured(false)
@@ -2972,7 +2972,7 @@ LteEnbRrc::LteEnbRrc()
     m_s1SapUser = new MemberEpcEnbS1SapUser<LteEnbRrc>(this);
     m_cphySapUser.push_back(new MemberLteEnbCphySapUser<LteEnbRrc>(this));
 
-    m_imsiCellSinrMap.clear();
+    m_ueCellSinrMatrix.Clear();
     m_x2_received_cnt = 0;
     m_switchEnabled = true;
     m_lteCellId = 0;
@@ -3283,6 +3283,20 @@ LteEnbRrc::GetTypeId(void)
                           BooleanValue(true),
                           MakeBooleanAccessor(&LteEnbRrc::m_reportAllUeMeas),
                           MakeBooleanChecker())
+            .AddAttribute("DeltaSinrReports",
+                          "If true, the MmWave eNB sends to the LTE coordinator only the UE SINR "
+                          "values that changed since the previous report, and no report if none "
+                          "changed. The NotifyMmWaveSinr trace of the coordinator then fires only "
+                          "for the UEs whose SINR changed",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&LteEnbRrc::m_deltaSinrReports),
+                          MakeBooleanChecker())
+            .AddAttribute("SinrReportDeltaThreshold",
+                          "Minimum SINR change (dB) for a UE to be included in a delta SINR "
+                          "report. If 0, any change is reported",
+                          DoubleValue(0.0),
+                          MakeDoubleAccessor(&LteEnbRrc::m_sinrReportDeltaThreshold),
+                          MakeDoubleChecker<double>(0.0))
             // Trace sources
             .AddTraceSource("NewUeContext",
                             "Fired upon creation of a new UE context.",
@@ -3771,7 +3785,7 @@ LteEnbRrc::ConfigureCell(std::map<uint8_t, Ptr<ComponentCarrierEnb>> ccPhyConf)
      * SystemInformationPeriodicity attribute to configure this).
      */
     Simulator::Schedule(MilliSeconds(16), &LteEnbRrc::SendSystemInformation, this);
-    m_imsiCellSinrMap.clear();
+    m_ueCellSinrMatrix.Clear();
     m_firstReport = true;
     m_configured = true;
 }
@@ -3863,7 +3877,7 @@ LteEnbRrc::ConfigureCell(std::map<uint8_t, MmWaveComponentCarrierConf> ccPhyConf
      */
     // mmWave module: Changed scheduling of initial system information to +2ms
     Simulator::Schedule(MilliSeconds(m_firstSibTime), &LteEnbRrc::SendSystemInformation, this);
-    m_imsiCellSinrMap.clear();
+    m_ueCellSinrMatrix.Clear();
     m_firstReport = true;
     m_configured = true;
 }
@@ -3904,76 +3918,65 @@ LteEnbRrc::GetCellId() const
 }
 
 void
-LteEnbRrc::DoUpdateUeSinrEstimate(LteEnbCphySapUser::UeAssociatedSinrInfo info)
+LteEnbRrc::DoUpdateUeSinrEstimate(const LteEnbCphySapUser::UeAssociatedSinrInfo& info)
 {
     NS_LOG_FUNCTION(this);
 
-    NS_LOG_INFO("CC " << (uint16_t)info.componentCarrierId << " reports the ueImsiSinrMap");
-    m_ueImsiSinrMap[info.componentCarrierId] =
-        info.ueImsiSinrMap; // store the received report in m_ueImsiSinrMap
+    NS_LOG_INFO("CC " << (uint16_t)info.componentCarrierId << " reports the ueSinrReport");
+    if (m_ccSinrReports.size() != m_numberOfComponentCarriers)
+    {
+        m_ccSinrReports.resize(m_numberOfComponentCarriers);
+        m_ccSinrReported.assign(m_numberOfComponentCarriers, false);
+        m_numCcSinrReports = 0;
+    }
+    NS_ASSERT_MSG(info.componentCarrierId < m_ccSinrReports.size(),
+                  "Invalid CC " << (uint16_t)info.componentCarrierId);
 
-    // TODO report immediately or with some filtering
-    if (m_lteCellId >
-        0) // i.e., only if a LTE eNB was actually registered in the scenario
-           // (this is done when an X2 interface among mmWave eNBs and LTE eNB is added)
+    // store the received report, reusing the storage of the previous one
+    m_ccSinrReports[info.componentCarrierId] = info.ueSinrReport;
+    if (!m_ccSinrReported[info.componentCarrierId])
     {
+        m_ccSinrReported[info.componentCarrierId] = true;
+        ++m_numCcSinrReports;
+    }
+
+    // TODO report immediately or with some filtering
+    // only if a LTE eNB was actually registered in the scenario (this is done when an X2
+    // interface among mmWave eNBs and LTE eNB is added), and only once all the CCs reported
+    if (m_lteCellId > 0 && m_numCcSinrReports == m_numberOfComponentCarriers)
+    {
+        // Build the report containing, for each UE, the max SINR among all the CCs
+        NS_LOG_DEBUG("Number of CC reports " << m_numCcSinrReports);
+        m_mergedSinrReport = m_ccSinrReports[0];
+        for (uint16_t cc = 1; cc < m_numberOfComponentCarriers; cc++)
+        {
+            m_mergedSinrReport.MergeMax(m_ccSinrReports[cc]);
+        }
+        m_ccSinrReported.assign(m_numberOfComponentCarriers, false);
+        m_numCcSinrReports = 0;
+
         // send the report to the LTE coordinator
         EpcX2SapProvider::UeImsiSinrParams params;
         params.targetCellId = m_lteCellId;
         params.sourceCellId = m_cellId;
-
-        // if (m_reportAllUeMeas == true)
-        if (false)
+        if (m_deltaSinrReports)
         {
-            params.ueImsiSinrMap = info.ueImsiSinrMap;
-            m_ueImsiSinrMap.clear(); // delete the reports
+            params.ueSinrReport.BuildDelta(m_mergedSinrReport,
+                                           m_sentSinrReport,
+                                           m_sentSinrScratch,
+                                           m_sinrReportDeltaThreshold);
+            if (params.ueSinrReport.GetSize() == 0)
+            {
+                NS_LOG_INFO("No SINR changed since the last report");
+                return;
+            }
         }
         else
         {
-            if (m_ueImsiSinrMap.size() ==
-                m_numberOfComponentCarriers) // if we received the ueImsiSinrMap report from all the
-                                             // CCs
-            {
-                // Build the ueImsiSinrMapToSend containing, for each UE, the max SINR among all the
-                // CCs
-                NS_LOG_DEBUG("Number of ueImsiSinrMaps in m_ueImsiSinrMap "
-                             << (uint16_t)m_ueImsiSinrMap.size());
-
-                std::map<uint64_t, double> ueImsiSinrMapToSend; // map which contains the max SINR
-                                                                // for each UE among the CCs
-                ueImsiSinrMapToSend = m_ueImsiSinrMap.at(0);    // initialization
-
-                for (uint8_t cc = 1; cc < m_numberOfComponentCarriers; cc++)
-                {
-                    NS_ASSERT_MSG(m_ueImsiSinrMap.find(cc) != m_ueImsiSinrMap.end(),
-                                  "CC " << (uint16_t)cc << " didn't report the ueImsiSinrMap");
-
-                    for (std::map<uint64_t, double>::iterator ue = ueImsiSinrMapToSend.begin();
-                         ue != ueImsiSinrMapToSend.end();
-                         ue++)
-                    {
-                        NS_ASSERT_MSG(
-                            m_ueImsiSinrMap.at(cc).find(ue->first) != m_ueImsiSinrMap.at(cc).end(),
-                            "CC " << (uint16_t)cc << " didn't report SINR for UE " << ue->first);
-
-                        NS_LOG_DEBUG("UE " << ue->first << " current SINR " << ue->second
-                                           << " is higher than "
-                                           << m_ueImsiSinrMap.at(cc).at(ue->first) << " ?");
-                        if (ue->second < m_ueImsiSinrMap.at(cc).at(ue->first))
-                        {
-                            NS_LOG_DEBUG("No, update SINR to "
-                                         << m_ueImsiSinrMap.at(cc).at(ue->first));
-                            ue->second = m_ueImsiSinrMap.at(cc).at(
-                                ue->first); // insert the max SINR for this UE among all the CCs
-                        }
-                    }
-                }
-                params.ueImsiSinrMap = ueImsiSinrMapToSend;
-                m_ueImsiSinrMap.clear(); // delete the reports
-            }
+            params.ueSinrReport = m_mergedSinrReport;
         }
 
-        NS_LOG_INFO("number of SINR reported " << params.ueImsiSinrMap.size());
+        NS_LOG_INFO("number of SINR reported " << params.ueSinrReport.GetSize());
         m_x2SapProvider->SendUeSinrUpdate(params);
     }
 }
@@ -3984,60 +3987,28 @@ LteEnbRrc::DoRecvUeSinrUpdate(EpcX2SapUser::UeImsiSinrParams params)
     NS_LOG_FUNCTION(this);
     NS_LOG_LOGIC("Recv Ue SINR Update from cell " << params.sourceCellId);
     uint16_t mmWaveCellId = params.sourceCellId;
-    if (m_cellSinrMap.find(mmWaveCellId) != m_cellSinrMap.end())
-    { // update the entry
-        m_cellSinrMap[mmWaveCellId] = params.ueImsiSinrMap;
-        m_numNewSinrReports++;
-    }
-    else // add the entry
+    m_numNewSinrReports++;
+
+    // a delta report only carries the SINR values that changed, the others are still valid
+    const UeSinrReport& report = params.ueSinrReport;
+    m_ueCellSinrMatrix.Update(mmWaveCellId, report);
+    for (uint32_t i = 0; i < report.GetSize(); ++i)
     {
-        m_cellSinrMap.insert(std::pair<uint16_t, ImsiSinrMap>(mmWaveCellId, params.ueImsiSinrMap));
-        m_numNewSinrReports++;
+        NS_LOG_LOGIC("Imsi " << report.GetImsi(i) << " sinr " << report.GetSinr(i));
+        m_notifyMmWaveSinrTrace(report.GetImsi(i), mmWaveCellId, report.GetSinr(i));
     }
-    // cycle on all the Imsi whose SINR is known in cell mmWaveCellId
-    for (std::map<uint64_t, double>::iterator imsiIter = params.ueImsiSinrMap.begin();
-         imsiIter != params.ueImsiSinrMap.end();
-         ++imsiIter)
-    {
-        uint64_t imsi = imsiIter->first;
-        double sinr = imsiIter->second;
-
-        m_notifyMmWaveSinrTrace(imsi, mmWaveCellId, sinr);
 
-        NS_LOG_LOGIC("Imsi " << imsi << " sinr " << sinr);
-
-        if (m_imsiCellSinrMap.find(imsi) != m_imsiCellSinrMap.end())
+    for (uint32_t ue = 0; ue < m_ueCellSinrMatrix.GetNumUes(); ++ue)
+    {
+        NS_LOG_LOGIC("Imsi " << m_ueCellSinrMatrix.GetImsi(ue));
+        for (uint32_t cell = 0; cell < m_ueCellSinrMatrix.GetNumCells(); ++cell)
         {
-            if (m_imsiCellSinrMap[imsi].find(mmWaveCellId) != m_imsiCellSinrMap[imsi].end())
+            if (m_ueCellSinrMatrix.HasSinr(ue, cell))
             {
-                // update the SINR measure
-                m_imsiCellSinrMap[imsi].find(mmWaveCellId)->second = sinr;
-            }
-            else // new cell for this Imsi
-            {
-                // insert a new SINR measure
-                m_imsiCellSinrMap[imsi].insert(std::pair<uint16_t, double>(mmWaveCellId, sinr));
+                NS_LOG_LOGIC("mmWaveCell " << m_ueCellSinrMatrix.GetCellId(cell) << " sinr "
+                                           << m_ueCellSinrMatrix.GetSinr(ue, cell));
             }
         }
-        else // new imsi
-        {
-            CellSinrMap map;
-            map.insert(std::pair<uint16_t, double>(mmWaveCellId, sinr));
-            m_imsiCellSinrMap.insert(std::pair<uint64_t, CellSinrMap>(imsi, map));
-        }
-    }
-
-    for (std::map<uint64_t, CellSinrMap>::iterator imsiIter = m_imsiCellSinrMap.begin();
-         imsiIter != m_imsiCellSinrMap.end();
-         ++imsiIter)
-    {
-        NS_LOG_LOGIC("Imsi " << imsiIter->first);
-        for (CellSinrMap::iterator cellIter = imsiIter->second.begin();
-             cellIter != imsiIter->second.end();
-             ++cellIter)
-        {
-            NS_LOG_LOGIC("mmWaveCell " << cellIter->first << " sinr " << cellIter->second);
-        }
     }
 
     if (!m_ismmWave && !m_interRatHoMode && m_firstReport)
@@ -4065,12 +4036,11 @@ LteEnbRrc::DoRecvUeSinrUpdate(EpcX2SapUser::UeImsiSinrParams params)
 }
 
 void
-LteEnbRrc::TttBasedHandover(std::map<uint64_t, CellSinrMap>::iterator imsiIter,
+LteEnbRrc::TttBasedHandover(uint64_t imsi,
                             double sinrDifference,
                             uint16_t maxSinrCellId,
                             double maxSinrDb)
 {
-    uint64_t imsi = imsiIter->first;
     bool alreadyAssociatedImsi = false;
     bool onHandoverImsi = true;
     // On RecvRrcConnectionRequest for a new RNTI, the Lte Enb RRC stores the imsi
@@ -4098,7 +4068,7 @@ LteEnbRrc::TttBasedHandover(std::map<uint64_t, CellSinrMap>::iterator imsiIter,
     if (alreadyAssociatedImsi && m_lastMmWaveCell.find(imsi) != m_lastMmWaveCell.end())
     {
         currentSinrDb =
-            10 * std::log10(m_imsiCellSinrMap.find(imsi)->second[m_lastMmWaveCell[imsi]]);
+            10 * std::log10(m_ueCellSinrMatrix.GetSinrByImsi(imsi, m_lastMmWaveCell[imsi]));
         NS_LOG_DEBUG("Current SINR " << currentSinrDb);
     }
 
@@ -4206,7 +4176,7 @@ LteEnbRrc::TttBasedHandover(std::map<uint64_t, CellSinrMap>::iterator imsiIter,
                 //  get the SINR for the scheduled targetCellId: if the diff is smaller than 3 dB
                 //  handover anyway
                 double originalTargetSinrDb =
-                    10 * std::log10(m_imsiCellSinrMap.find(imsi)->second[targetCellId]);
+                    10 * std::log10(m_ueCellSinrMatrix.GetSinrByImsi(imsi, targetCellId));
                 if (maxSinrDb - originalTargetSinrDb >
                     m_sinrThresholdDifference) // this parameter is the same as the one for
                                                // ThresholdBasedSecondaryCellHandover
@@ -4399,12 +4369,11 @@ LteEnbRrc::PerformHandover(uint64_t imsi)
 }
 
 void
-LteEnbRrc::ThresholdBasedSecondaryCellHandover(std::map<uint64_t, CellSinrMap>::iterator imsiIter,
+LteEnbRrc::ThresholdBasedSecondaryCellHandover(uint64_t imsi,
                                                double sinrDifference,
                                                uint16_t maxSinrCellId,
                                                double maxSinrDb)
 {
-    uint64_t imsi = imsiIter->first;
     bool alreadyAssociatedImsi = false;
     bool onHandoverImsi = true;
     // On RecvRrcConnectionRequest for a new RNTI, the Lte Enb RRC stores the imsi
@@ -4547,13 +4516,11 @@ LteEnbRrc::ThresholdBasedSecondaryCellHandover(std::map<uint64_t, CellSinrMap>::
 void
 LteEnbRrc::TriggerUeAssociationUpdate()
 {
-    if (m_imsiCellSinrMap.size() > 0) // there are some entries
+    if (m_ueCellSinrMatrix.GetNumUes() > 0) // there are some entries
     {
-        for (std::map<uint64_t, CellSinrMap>::iterator imsiIter = m_imsiCellSinrMap.begin();
-             imsiIter != m_imsiCellSinrMap.end();
-             ++imsiIter)
+        for (uint32_t ue = 0; ue < m_ueCellSinrMatrix.GetNumUes(); ++ue)
         {
-            uint64_t imsi = imsiIter->first;
+            uint64_t imsi = m_ueCellSinrMatrix.GetImsi(ue);
             long double maxSinr = 0;
             long double currentSinr = 0;
             uint16_t maxSinrCellId = 0;
@@ -4579,20 +4546,23 @@ LteEnbRrc::TriggerUeAssociationUpdate()
             NS_LOG_INFO("alreadyAssociatedImsi " << alreadyAssociatedImsi << " onHandoverImsi "
                                                  << onHandoverImsi);
 
-            for (CellSinrMap::iterator cellIter = imsiIter->second.begin();
-                 cellIter != imsiIter->second.end();
-                 ++cellIter)
+            for (uint32_t cell = 0; cell < m_ueCellSinrMatrix.GetNumCells(); ++cell)
             {
-                NS_LOG_INFO("Cell " << cellIter->first << " reports "
-                                    << 10 * std::log10(cellIter->second));
-                if (cellIter->second > maxSinr)
+                if (!m_ueCellSinrMatrix.HasSinr(ue, cell))
+                {
+                    continue;
+                }
+                uint16_t cellId = m_ueCellSinrMatrix.GetCellId(cell);
+                double sinr = m_ueCellSinrMatrix.GetSinr(ue, cell);
+                NS_LOG_INFO("Cell " << cellId << " reports " << 10 * std::log10(sinr));
+                if (sinr > maxSinr)
                 {
-                    maxSinr = cellIter->second;
-                    maxSinrCellId = cellIter->first;
+                    maxSinr = sinr;
+                    maxSinrCellId = cellId;
                 }
-                if (m_lastMmWaveCell[imsi] == cellIter->first)
+                if (m_lastMmWaveCell[imsi] == cellId)
                 {
-                    currentSinr = cellIter->second;
+                    currentSinr = sinr;
                 }
             }
             long double sinrDifference = std::abs(
@@ -4643,14 +4613,14 @@ LteEnbRrc::TriggerUeAssociationUpdate()
                 m_bestMmWaveCellForImsiMap[imsi] = maxSinrCellId;
                 if (m_handoverMode == THRESHOLD)
                 {
-                    ThresholdBasedSecondaryCellHandover(imsiIter,
+                    ThresholdBasedSecondaryCellHandover(imsi,
                                                         sinrDifference,
                                                         maxSinrCellId,
                                                         maxSinrDb);
                 }
                 else if (m_handoverMode == FIXED_TTT || m_handoverMode == DYNAMIC_TTT)
                 {
-                    TttBasedHandover(imsiIter, sinrDifference, maxSinrCellId, maxSinrDb);
+                    TttBasedHandover(imsi, sinrDifference, maxSinrCellId, maxSinrDb);
                 }
                 else
                 {
@@ -4664,12 +4634,11 @@ LteEnbRrc::TriggerUeAssociationUpdate()
 }
 
 void
-LteEnbRrc::ThresholdBasedInterRatHandover(std::map<uint64_t, CellSinrMap>::iterator imsiIter,
+LteEnbRrc::ThresholdBasedInterRatHandover(uint64_t imsi,
                                           double sinrDifference,
                                           uint16_t maxSinrCellId,
                                           double maxSinrDb)
 {
-    uint64_t imsi = imsiIter->first;
     bool alreadyAssociatedImsi = false;
     bool onHandoverImsi = true;
     // On RecvRrcConnectionRequest for a new RNTI, the Lte Enb RRC stores the imsi
@@ -4773,13 +4742,11 @@ void
 LteEnbRrc::UpdateUeHandoverAssociation()
 {
     // TODO rules for possible ho of each UE
-    if (m_imsiCellSinrMap.size() > 0) // there are some entries
+    if (m_ueCellSinrMatrix.GetNumUes() > 0) // there are some entries
     {
-        for (std::map<uint64_t, CellSinrMap>::iterator imsiIter = m_imsiCellSinrMap.begin();
-             imsiIter != m_imsiCellSinrMap.end();
-             ++imsiIter)
+        for (uint32_t ue = 0; ue < m_ueCellSinrMatrix.GetNumUes(); ++ue)
         {
-            uint64_t imsi = imsiIter->first;
+            uint64_t imsi = m_ueCellSinrMatrix.GetImsi(ue);
             long double maxSinr = 0;
             long double currentSinr = 0;
             uint16_t maxSinrCellId = 0;
@@ -4803,20 +4770,23 @@ LteEnbRrc::UpdateUeHandoverAssociation()
             NS_LOG_INFO("alreadyAssociatedImsi " << alreadyAssociatedImsi << " onHandoverImsi "
                                                  << onHandoverImsi);
 
-            for (CellSinrMap::iterator cellIter = imsiIter->second.begin();
-                 cellIter != imsiIter->second.end();
-                 ++cellIter)
+            for (uint32_t cell = 0; cell < m_ueCellSinrMatrix.GetNumCells(); ++cell)
             {
-                NS_LOG_INFO("Cell " << cellIter->first << " reports "
-                                    << 10 * std::log10(cellIter->second));
-                if (cellIter->second > maxSinr)
+                if (!m_ueCellSinrMatrix.HasSinr(ue, cell))
+                {
+                    continue;
+                }
+                uint16_t cellId = m_ueCellSinrMatrix.GetCellId(cell);
+                double sinr = m_ueCellSinrMatrix.GetSinr(ue, cell);
+                NS_LOG_INFO("Cell " << cellId << " reports " << 10 * std::log10(sinr));
+                if (sinr > maxSinr)
                 {
-                    maxSinr = cellIter->second;
-                    maxSinrCellId = cellIter->first;
+                    maxSinr = sinr;
+                    maxSinrCellId = cellId;
                 }
-                if (m_lastMmWaveCell[imsi] == cellIter->first)
+                if (m_lastMmWaveCell[imsi] == cellId)
                 {
-                    currentSinr = cellIter->second;
+                    currentSinr = sinr;
                 }
             }
 
@@ -4871,7 +4841,7 @@ LteEnbRrc::UpdateUeHandoverAssociation()
             {
                 if (m_handoverMode == THRESHOLD)
                 {
-                    ThresholdBasedInterRatHandover(imsiIter,
+                    ThresholdBasedInterRatHandover(imsi,
                                                    sinrDifference,
                                                    maxSinrCellId,
                                                    maxSinrDb);
@@ -4879,7 +4849,7 @@ LteEnbRrc::UpdateUeHandoverAssociation()
                 else if (m_handoverMode == FIXED_TTT || m_handoverMode == DYNAMIC_TTT)
                 {
                     m_bestMmWaveCellForImsiMap[imsi] = maxSinrCellId;
-                    TttBasedHandover(imsiIter, sinrDifference, maxSinrCellId, maxSinrDb);
+                    TttBasedHandover(imsi, sinrDifference, maxSinrCellId, maxSinrDb);
                 }
                 else
                 {
@@ -74,8 +74,6 @@ class RlcBearerInfo;
 class LteEnbRrc;
 class Packet;
 
-typedef std::map<uint64_t, double> ImsiSinrMap;
-typedef std::map<uint16_t, double> CellSinrMap;
 
 /**
  * \ingroup lte
@@ -1514,7 +1512,7 @@ class LteEnbRrc : public Object
     void DoSendLoadInformation(EpcX2Sap::LoadInformationParams params);
 
     // CPHY SAP methods
-    void DoUpdateUeSinrEstimate(LteEnbCphySapUser::UeAssociatedSinrInfo info);
+    void DoUpdateUeSinrEstimate(const LteEnbCphySapUser::UeAssociatedSinrInfo& info);
 
     // Internal methods
 
@@ -1645,24 +1643,24 @@ class LteEnbRrc : public Object
 
     /**
      * Trigger an handover according to certain conditions on the SINR
-     * @params the iterator on m_imsiCellSinrMap
+     * @params the IMSI of the UE
      * @params the sinrDifference between the current and the maxSinr cell
      * @params the CellId of the maximum SINR cell
      * @params the value of the SINR for this cell
      */
-    void ThresholdBasedSecondaryCellHandover(std::map<uint64_t, CellSinrMap>::iterator imsiIter,
+    void ThresholdBasedSecondaryCellHandover(uint64_t imsi,
                                              double sinrDifference,
                                              uint16_t maxSinrCellId,
                                              double maxSinrDb);
 
     /**
      * Trigger an handover according to certain conditions on the SINR and the TTT
-     * @params the iterator on m_imsiCellSinrMap
+     * @params the IMSI of the UE
      * @params the sinrDifference between the current and the maxSinr cell
      * @params the CellId of the maximum SINR cell
      * @params the value of the SINR for this cell
      */
-    void TttBasedHandover(std::map<uint64_t, CellSinrMap>::iterator imsiIter,
+    void TttBasedHandover(uint64_t imsi,
                           double sinrDifference,
                           uint16_t maxSinrCellId,
                           double maxSinrDb);
@@ -1687,12 +1685,12 @@ class LteEnbRrc : public Object
     /**
      * Trigger an handover according to certain conditions on the SINR (for single-connectivity
      * devices)
-     * @params the iterator on m_imsiCellSinrMap
+     * @params the IMSI of the UE
      * @params the sinrDifference between the current and the maxSinr cell
      * @params the CellId of the maximum SINR cell
      * @params the value of the SINR for this cell
      */
-    void ThresholdBasedInterRatHandover(std::map<uint64_t, CellSinrMap>::iterator imsiIter,
+    void ThresholdBasedInterRatHandover(uint64_t imsi,
                                         double sinrDifference,
                                         uint16_t maxSinrCellId,
                                         double maxSinrDb);
@@ -1930,19 +1928,24 @@ class LteEnbRrc : public Object
     uint32_t m_firstSibTime; // time in ms of initial SIB
 
     // for MmWave eNBs
-    std::map<uint8_t, ImsiSinrMap>
-        m_ueImsiSinrMap;    // this map contains the ueImsiSinrMap reports sent by the CCs
+    std::vector<UeSinrReport> m_ccSinrReports; // last SINR report of each CC
+    std::vector<bool> m_ccSinrReported;        // whether each CC reported since the last update
+    uint16_t m_numCcSinrReports;               // number of CCs that reported since the last update
+    UeSinrReport m_mergedSinrReport;           // max SINR of each UE among the CCs
+    UeSinrReport m_sentSinrReport;             // SINR values known by the coordinator
+    UeSinrReport m_sentSinrScratch;            // storage used to update m_sentSinrReport
+    bool m_deltaSinrReports;                   // if true, only the changed SINR values are sent
+    double m_sinrReportDeltaThreshold;         // minimum SINR change (dB) sent in a delta report
     bool m_reportAllUeMeas; // if true, the MmWave eNB reports to the coordinator all the received
                             // UE measures, i.e. one per CC
 
     // for LTE eNBs
-    std::map<uint16_t, ImsiSinrMap> m_cellSinrMap;
     uint16_t m_numNewSinrReports;
     std::map<uint64_t, uint16_t> m_bestMmWaveCellForImsiMap;
     std::map<uint64_t, uint16_t> m_lastMmWaveCell;
     std::map<uint64_t, bool> m_mmWaveCellSetupCompleted;
     std::map<uint64_t, bool> m_imsiUsingLte;
-    std::map<uint64_t, CellSinrMap> m_imsiCellSinrMap;
+    UeCellSinrMatrix m_ueCellSinrMatrix; // SINR of each UE towards each mmWave cell
     std::map<uint64_t, uint16_t> m_imsiRntiMap;
     std::map<uint16_t, uint64_t> m_rntiImsiMap;
 
@@ -43,7 +43,7 @@ NS_LOG_COMPONENT_DEFINE("LteRlcUmLowLat");
 
 NS_OBJECT_ENSURE_REGISTERED(LteRlcUmLowLat);
 
-uint32_t LteRlcUmLowLat::m_numArrivalsToAvg = 20;
+const uint32_t LteRlcUmLowLat::m_numArrivalsToAvg;
 
 LteRlcUmLowLat::LteRlcUmLowLat()
     : m_maxTxBufferSize(10 * 1024),
@@ -54,6 +54,8 @@ LteRlcUmLowLat::LteRlcUmLowLat()
       m_vrUh(0),
       m_windowSize(512),
       m_expectedSeqNumber(0),
+      m_oldestArrival(0),
+      m_numRecentArrivals(0),
       m_currTotalPacketSize(0),
       // m_lastArrivalTime (0),
       m_arrivalRate(0.0),
@@ -142,16 +144,24 @@ LteRlcUmLowLat::DoTransmitPdcpPdu(Ptr<Packet> p)
         NS_LOG_LOGIC("NumOfBuffers = " << m_txBuffer.size());
         NS_LOG_LOGIC("txBufferSize = " << m_txBufferSize);
 
-        if (m_recentArrivalTimes.size() == m_numArrivalsToAvg)
+        uint32_t arrivalTime = (uint32_t)timeTag.GetSenderTimestamp().GetMicroSeconds();
+        uint32_t last;
+        if (m_numRecentArrivals == m_numArrivalsToAvg)
         {
-            m_recentArrivalTimes.pop_front();
-            m_currTotalPacketSize -= m_recentPacketSizes.front();
-            m_recentPacketSizes.pop_front();
+            // the history is full, overwrite the oldest arrival
+            m_currTotalPacketSize -= m_recentPacketSizes[m_oldestArrival];
+            last = m_oldestArrival;
+            m_oldestArrival = (m_oldestArrival + 1) % m_numArrivalsToAvg;
         }
-        m_recentArrivalTimes.push_back((uint32_t)timeTag.GetSenderTimestamp().GetMicroSeconds());
-        m_recentPacketSizes.push_back(p->GetSize());
+        else
+        {
+            last = (m_oldestArrival + m_numRecentArrivals) % m_numArrivalsToAvg;
+            m_numRecentArrivals++;
+        }
+        m_recentArrivalTimes[last] = arrivalTime;
+        m_recentPacketSizes[last] = p->GetSize();
         m_currTotalPacketSize += p->GetSize();
-        double timeDiff = (m_recentArrivalTimes.back() - m_recentArrivalTimes.front()) * 1e-6;
+        double timeDiff = (arrivalTime - m_recentArrivalTimes[m_oldestArrival]) * 1e-6;
         // m_arrivalRate = (1 - m_forgetFactor) * (p->GetSize () / timeDiff) + m_forgetFactor *
         // m_arrivalRate;
         m_arrivalRate = m_currTotalPacketSize / timeDiff;
@@ -533,7 +543,7 @@ LteRlcUmLowLat::DoReceivePdu(LteMacSapUser::ReceivePduParameters rxPduParams)
     seqNumber.SetModulusBase(m_vrUh - m_windowSize);
 
     if (((m_vrUr < seqNumber) && (seqNumber < m_vrUh) &&
-         (m_rxBuffer.count(seqNumber.GetValue()) > 0)) ||
+         m_rxBuffer.Contains(seqNumber.GetValue())) ||
         (((m_vrUh - m_windowSize) <= seqNumber) && (seqNumber < m_vrUr)))
     {
         NS_LOG_LOGIC("PDU discarded");
@@ -543,7 +553,7 @@ LteRlcUmLowLat::DoReceivePdu(LteMacSapUser::ReceivePduParameters rxPduParams)
     else
     {
         NS_LOG_LOGIC("Place PDU in the reception buffer");
-        m_rxBuffer[seqNumber.GetValue()] = rxPduParams.p;
+        m_rxBuffer.Insert(seqNumber.GetValue(), rxPduParams.p);
     }
 
     // 5.1.2.2.3 Actions when an UMD PDU is placed in the reception buffer
@@ -584,17 +594,13 @@ LteRlcUmLowLat::DoReceivePdu(LteMacSapUser::ReceivePduParameters rxPduParams)
     //      so and deliver the reassembled RLC SDUs to upper layer in ascending order of the RLC SN
     //      if not delivered before;
 
-    if (m_rxBuffer.count(m_vrUr.GetValue()) > 0)
+    if (m_rxBuffer.Contains(m_vrUr.GetValue()))
     {
         NS_LOG_LOGIC("Reception buffer contains SN = " << m_vrUr);
 
-        std::map<uint16_t, Ptr<Packet>>::iterator it;
-        uint16_t newVrUr;
         SequenceNumber10 oldVrUr = m_vrUr;
-
-        it = m_rxBuffer.find(m_vrUr.GetValue());
-        newVrUr = (it->first) + 1;
-        while (m_rxBuffer.count(newVrUr) > 0)
+        uint16_t newVrUr = m_vrUr.GetValue() + 1;
+        while (m_rxBuffer.Contains(newVrUr))
         {
             newVrUr++;
         }
@@ -703,7 +709,7 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
 
         if (extensionBit == 0)
         {
-            m_sdusBuffer.push_back(packet);
+            m_sdusBuffer.PushBack(packet);
         }
         else // extensionBit == 1
         {
@@ -721,12 +727,10 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
             Ptr<Packet> data_field = packet->CreateFragment(0, lengthIndicator);
             packet->RemoveAtStart(lengthIndicator);
 
-            m_sdusBuffer.push_back(data_field);
+            m_sdusBuffer.PushBack(data_field);
         }
     } while (extensionBit == 1);
 
-    std::list<Ptr<Packet>>::iterator it;
-
     // Current reassembling state
     if (m_reassemblingState == WAITING_S0_FULL)
         NS_LOG_LOGIC("Reassembling State = 'WAITING_S0_FULL'");
@@ -752,11 +756,11 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Deliver one or multiple PDUs
                  */
-                for (it = m_sdusBuffer.begin(); it != m_sdusBuffer.end(); it++)
+                while (!m_sdusBuffer.IsEmpty())
                 {
-                    TriggerReceivePdcpPdu(*it);
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
-                m_sdusBuffer.clear();
                 break;
 
             case (LteRlcHeader::FIRST_BYTE | LteRlcHeader::NO_LAST_BYTE):
@@ -765,17 +769,17 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Deliver full PDUs
                  */
-                while (m_sdusBuffer.size() > 1)
+                while (m_sdusBuffer.GetSize() > 1)
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
 
                 /**
                  * Keep S0
                  */
-                m_keepS0 = m_sdusBuffer.front();
-                m_sdusBuffer.pop_front();
+                m_keepS0 = m_sdusBuffer.Front();
+                m_sdusBuffer.PopFront();
                 break;
 
             case (LteRlcHeader::NO_FIRST_BYTE | LteRlcHeader::LAST_BYTE):
@@ -784,20 +788,20 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Discard SI or SN
                  */
-                m_sdusBuffer.pop_front();
+                m_sdusBuffer.PopFront();
 
                 /**
                  * Deliver zero, one or multiple PDUs
                  */
-                while (!m_sdusBuffer.empty())
+                while (!m_sdusBuffer.IsEmpty())
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
             case (LteRlcHeader::NO_FIRST_BYTE | LteRlcHeader::NO_LAST_BYTE):
-                if (m_sdusBuffer.size() == 1)
+                if (m_sdusBuffer.GetSize() == 1)
                 {
                     m_reassemblingState = WAITING_S0_FULL;
                 }
@@ -809,24 +813,24 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Discard SI or SN
                  */
-                m_sdusBuffer.pop_front();
+                m_sdusBuffer.PopFront();
 
-                if (m_sdusBuffer.size() > 0)
+                if (m_sdusBuffer.GetSize() > 0)
                 {
                     /**
                      * Deliver zero, one or multiple PDUs
                      */
-                    while (m_sdusBuffer.size() > 1)
+                    while (m_sdusBuffer.GetSize() > 1)
                     {
-                        TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                        m_sdusBuffer.pop_front();
+                        TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                        m_sdusBuffer.PopFront();
                     }
 
                     /**
                      * Keep S0
                      */
-                    m_keepS0 = m_sdusBuffer.front();
-                    m_sdusBuffer.pop_front();
+                    m_keepS0 = m_sdusBuffer.Front();
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
@@ -849,17 +853,17 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Deliver (Kept)S0 + SN
                  */
-                m_keepS0->AddAtEnd(m_sdusBuffer.front());
-                m_sdusBuffer.pop_front();
+                m_keepS0->AddAtEnd(m_sdusBuffer.Front());
+                m_sdusBuffer.PopFront();
                 TriggerReceivePdcpPdu(m_keepS0);
 
                 /**
                  * Deliver zero, one or multiple PDUs
                  */
-                while (!m_sdusBuffer.empty())
+                while (!m_sdusBuffer.IsEmpty())
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
@@ -869,34 +873,34 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Keep SI
                  */
-                if (m_sdusBuffer.size() == 1)
+                if (m_sdusBuffer.GetSize() == 1)
                 {
-                    m_keepS0->AddAtEnd(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    m_keepS0->AddAtEnd(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
                 else // m_sdusBuffer.size () > 1
                 {
                     /**
                      * Deliver (Kept)S0 + SN
                      */
-                    m_keepS0->AddAtEnd(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    m_keepS0->AddAtEnd(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                     TriggerReceivePdcpPdu(m_keepS0);
 
                     /**
                      * Deliver zero, one or multiple PDUs
                      */
-                    while (m_sdusBuffer.size() > 1)
+                    while (m_sdusBuffer.GetSize() > 1)
                     {
-                        TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                        m_sdusBuffer.pop_front();
+                        TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                        m_sdusBuffer.PopFront();
                     }
 
                     /**
                      * Keep S0
                      */
-                    m_keepS0 = m_sdusBuffer.front();
-                    m_sdusBuffer.pop_front();
+                    m_keepS0 = m_sdusBuffer.Front();
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
@@ -932,11 +936,11 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Deliver one or multiple PDUs
                  */
-                for (it = m_sdusBuffer.begin(); it != m_sdusBuffer.end(); it++)
+                while (!m_sdusBuffer.IsEmpty())
                 {
-                    TriggerReceivePdcpPdu(*it);
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
-                m_sdusBuffer.clear();
                 break;
 
             case (LteRlcHeader::FIRST_BYTE | LteRlcHeader::NO_LAST_BYTE):
@@ -945,17 +949,17 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Deliver full PDUs
                  */
-                while (m_sdusBuffer.size() > 1)
+                while (m_sdusBuffer.GetSize() > 1)
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
 
                 /**
                  * Keep S0
                  */
-                m_keepS0 = m_sdusBuffer.front();
-                m_sdusBuffer.pop_front();
+                m_keepS0 = m_sdusBuffer.Front();
+                m_sdusBuffer.PopFront();
                 break;
 
             case (LteRlcHeader::NO_FIRST_BYTE | LteRlcHeader::LAST_BYTE):
@@ -964,20 +968,20 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Discard SN
                  */
-                m_sdusBuffer.pop_front();
+                m_sdusBuffer.PopFront();
 
                 /**
                  * Deliver zero, one or multiple PDUs
                  */
-                while (!m_sdusBuffer.empty())
+                while (!m_sdusBuffer.IsEmpty())
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
             case (LteRlcHeader::NO_FIRST_BYTE | LteRlcHeader::NO_LAST_BYTE):
-                if (m_sdusBuffer.size() == 1)
+                if (m_sdusBuffer.GetSize() == 1)
                 {
                     m_reassemblingState = WAITING_S0_FULL;
                 }
@@ -989,24 +993,24 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Discard SI or SN
                  */
-                m_sdusBuffer.pop_front();
+                m_sdusBuffer.PopFront();
 
-                if (m_sdusBuffer.size() > 0)
+                if (m_sdusBuffer.GetSize() > 0)
                 {
                     /**
                      * Deliver zero, one or multiple PDUs
                      */
-                    while (m_sdusBuffer.size() > 1)
+                    while (m_sdusBuffer.GetSize() > 1)
                     {
-                        TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                        m_sdusBuffer.pop_front();
+                        TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                        m_sdusBuffer.PopFront();
                     }
 
                     /**
                      * Keep S0
                      */
-                    m_keepS0 = m_sdusBuffer.front();
-                    m_sdusBuffer.pop_front();
+                    m_keepS0 = m_sdusBuffer.Front();
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
@@ -1034,10 +1038,10 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Deliver one or multiple PDUs
                  */
-                while (!m_sdusBuffer.empty())
+                while (!m_sdusBuffer.IsEmpty())
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
@@ -1052,17 +1056,17 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Deliver zero, one or multiple PDUs
                  */
-                while (m_sdusBuffer.size() > 1)
+                while (m_sdusBuffer.GetSize() > 1)
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
 
                 /**
                  * Keep S0
                  */
-                m_keepS0 = m_sdusBuffer.front();
-                m_sdusBuffer.pop_front();
+                m_keepS0 = m_sdusBuffer.Front();
+                m_sdusBuffer.PopFront();
 
                 break;
 
@@ -1077,20 +1081,20 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Discard SI or SN
                  */
-                m_sdusBuffer.pop_front();
+                m_sdusBuffer.PopFront();
 
                 /**
                  * Deliver zero, one or multiple PDUs
                  */
-                while (!m_sdusBuffer.empty())
+                while (!m_sdusBuffer.IsEmpty())
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
             case (LteRlcHeader::NO_FIRST_BYTE | LteRlcHeader::NO_LAST_BYTE):
-                if (m_sdusBuffer.size() == 1)
+                if (m_sdusBuffer.GetSize() == 1)
                 {
                     m_reassemblingState = WAITING_S0_FULL;
                 }
@@ -1107,24 +1111,24 @@ LteRlcUmLowLat::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Discard SI or SN
                  */
-                m_sdusBuffer.pop_front();
+                m_sdusBuffer.PopFront();
 
-                if (m_sdusBuffer.size() > 0)
+                if (m_sdusBuffer.GetSize() > 0)
                 {
                     /**
                      * Deliver zero, one or multiple PDUs
                      */
-                    while (m_sdusBuffer.size() > 1)
+                    while (m_sdusBuffer.GetSize() > 1)
                     {
-                        TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                        m_sdusBuffer.pop_front();
+                        TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                        m_sdusBuffer.PopFront();
                     }
 
                     /**
                      * Keep S0
                      */
-                    m_keepS0 = m_sdusBuffer.front();
-                    m_sdusBuffer.pop_front();
+                    m_keepS0 = m_sdusBuffer.Front();
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
@@ -1151,24 +1155,27 @@ LteRlcUmLowLat::ReassembleOutsideWindow(void)
 {
     NS_LOG_LOGIC("Reassemble Outside Window");
 
-    std::map<uint16_t, Ptr<Packet>>::iterator it;
-    it = m_rxBuffer.begin();
-
-    while ((it != m_rxBuffer.end()) && !IsInsideReorderingWindow(SequenceNumber10(it->first)))
+    // Every PDU in the reception buffer has SN >= VR(UR): if VR(UR) is still
+    // inside the reordering window, so are all of them
+    if (IsInsideReorderingWindow(m_vrUr))
     {
-        NS_LOG_LOGIC("SN = " << it->first);
-
-        // Reassemble RLC SDUs and deliver the PDCP PDU to upper layer
-        ReassembleAndDeliver(it->second);
-
-        std::map<uint16_t, Ptr<Packet>>::iterator it_tmp = it;
-        ++it;
-        m_rxBuffer.erase(it_tmp);
+        NS_LOG_LOGIC("VR(UR) = " << m_vrUr << " is inside the reordering window");
+        return;
     }
 
-    if (it != m_rxBuffer.end())
+    uint16_t lowerEdge = (m_vrUh - m_windowSize).GetValue();
+    uint16_t sn = m_vrUr.GetValue();
+    while (sn != lowerEdge && !m_rxBuffer.IsEmpty())
     {
-        NS_LOG_LOGIC("(SN = " << it->first << ") is inside the reordering window");
+        Ptr<Packet> p = m_rxBuffer.Remove(sn);
+        if (p)
+        {
+            NS_LOG_LOGIC("SN = " << sn);
+
+            // Reassemble RLC SDUs and deliver the PDCP PDU to upper layer
+            ReassembleAndDeliver(p);
+        }
+        sn = (sn + 1) % LteRlcUmRxWindow::SN_SPACE;
     }
 }
 
@@ -1177,25 +1184,16 @@ LteRlcUmLowLat::ReassembleSnInterval(SequenceNumber10 lowSeqNumber, SequenceNumb
 {
     NS_LOG_LOGIC("Reassemble SN between " << lowSeqNumber << " and " << highSeqNumber);
 
-    std::map<uint16_t, Ptr<Packet>>::iterator it;
-
     SequenceNumber10 reassembleSn = lowSeqNumber;
-    NS_LOG_LOGIC("reassembleSN = " << reassembleSn);
-    NS_LOG_LOGIC("highSeqNumber = " << highSeqNumber);
     while (reassembleSn < highSeqNumber)
     {
-        NS_LOG_LOGIC("reassembleSn < highSeqNumber");
-        it = m_rxBuffer.find(reassembleSn.GetValue());
-        NS_LOG_LOGIC("it->first  = " << it->first);
-        NS_LOG_LOGIC("it->second = " << it->second);
-        if (it != m_rxBuffer.end())
+        Ptr<Packet> p = m_rxBuffer.Remove(reassembleSn.GetValue());
+        if (p)
         {
-            NS_LOG_LOGIC("SN = " << it->first);
+            NS_LOG_LOGIC("SN = " << reassembleSn);
 
             // Reassemble RLC SDUs and deliver the PDCP PDU to upper layer
-            ReassembleAndDeliver(it->second);
-
-            m_rxBuffer.erase(it);
+            ReassembleAndDeliver(p);
         }
 
         reassembleSn++;
@@ -1267,10 +1265,9 @@ LteRlcUmLowLat::ExpireReorderingTimer(void)
     //    - start t-Reordering;
     //    - set VR(UX) to VR(UH).
 
-    std::map<uint16_t, Ptr<Packet>>::iterator it;
     SequenceNumber10 newVrUr = m_vrUx;
 
-    while ((it = m_rxBuffer.find(newVrUr.GetValue())) != m_rxBuffer.end())
+    while (m_rxBuffer.Contains(newVrUr.GetValue()))
     {
         newVrUr++;
     }
@@ -29,12 +29,12 @@
 #define LTE_RLC_UM_LOWLAT_H
 
 #include "ns3/lte-rlc-sequence-number.h"
+#include "ns3/lte-rlc-um-rx-window.h"
 #include "ns3/lte-rlc.h"
 #include <ns3/epc-x2-sap.h>
 #include <ns3/event-id.h>
 
-#include <deque>
-#include <map>
+#include <array>
 
 namespace ns3
 {
@@ -92,10 +92,8 @@ class LteRlcUmLowLat : public LteRlc
     uint32_t m_maxTxBufferSize;
     uint32_t m_txBufferSize;
     std::vector<Ptr<Packet>> m_txBuffer;        // Transmission buffer
-    std::map<uint16_t, Ptr<Packet>> m_rxBuffer; // Reception buffer
-    std::vector<Ptr<Packet>> m_reasBuffer;      // Reassembling buffer
-
-    std::list<Ptr<Packet>> m_sdusBuffer; // List of SDUs in a packet
+    LteRlcUmRxWindow m_rxBuffer;                // Reception buffer
+    LteRlcSduQueue m_sdusBuffer;                // List of SDUs in a packet
 
     /**
      * State variables. See section 7.1 in TS 36.322
@@ -136,12 +134,15 @@ class LteRlcUmLowLat : public LteRlc
      */
     SequenceNumber10 m_expectedSeqNumber;
 
-    std::deque<uint32_t> m_recentArrivalTimes;
-    std::deque<uint32_t> m_recentPacketSizes;
+    static const uint32_t m_numArrivalsToAvg = 20; // average last N arrivals
+    // Ring buffers with the time and size of the last N arrivals
+    std::array<uint32_t, m_numArrivalsToAvg> m_recentArrivalTimes;
+    std::array<uint32_t, m_numArrivalsToAvg> m_recentPacketSizes;
+    uint32_t m_oldestArrival;     // index of the oldest arrival in the ring buffers
+    uint32_t m_numRecentArrivals; // number of arrivals in the ring buffers
     uint32_t m_currTotalPacketSize;
     // uint64_t m_lastArrivalTime;
     double m_arrivalRate;
-    static uint32_t m_numArrivalsToAvg; // average last N arrivals
     // double  m_forgetFactor;
     Time m_reorderingTimeExpires;
 
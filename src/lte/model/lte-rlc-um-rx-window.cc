@@ -0,0 +1,106 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "lte-rlc-um-rx-window.h"
+
+#include "ns3/assert.h"
+
+namespace ns3
+{
+
+LteRlcUmRxWindow::LteRlcUmRxWindow()
+    : m_size(0)
+{
+}
+
+void
+LteRlcUmRxWindow::Insert(uint16_t sn, Ptr<Packet> p)
+{
+    NS_ASSERT(p);
+    Ptr<Packet>& slot = m_slots[sn % SN_SPACE];
+    if (!slot)
+    {
+        ++m_size;
+    }
+    slot = p;
+}
+
+Ptr<Packet>
+LteRlcUmRxWindow::Remove(uint16_t sn)
+{
+    Ptr<Packet>& slot = m_slots[sn % SN_SPACE];
+    Ptr<Packet> p = slot;
+    if (p)
+    {
+        slot = nullptr;
+        --m_size;
+    }
+    return p;
+}
+
+void
+LteRlcUmRxWindow::Clear()
+{
+    for (auto& slot : m_slots)
+    {
+        slot = nullptr;
+    }
+    m_size = 0;
+}
+
+LteRlcSduQueue::LteRlcSduQueue()
+    : m_head(0)
+{
+}
+
+void
+LteRlcSduQueue::PushBack(Ptr<Packet> p)
+{
+    if (m_head > 0 && m_sdus.size() == m_sdus.capacity())
+    {
+        // reuse the slots already consumed before growing the storage
+        m_sdus.erase(m_sdus.begin(), m_sdus.begin() + m_head);
+        m_head = 0;
+    }
+    m_sdus.push_back(p);
+}
+
+Ptr<Packet>
+LteRlcSduQueue::Front() const
+{
+    NS_ASSERT_MSG(!IsEmpty(), "SDU queue is empty");
+    return m_sdus[m_head];
+}
+
+void
+LteRlcSduQueue::PopFront()
+{
+    NS_ASSERT_MSG(!IsEmpty(), "SDU queue is empty");
+    m_sdus[m_head] = nullptr;
+    if (++m_head == m_sdus.size())
+    {
+        Clear();
+    }
+}
+
+void
+LteRlcSduQueue::Clear()
+{
+    m_sdus.clear();
+    m_head = 0;
+}
+
+} // namespace ns3
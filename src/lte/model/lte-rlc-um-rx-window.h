@@ -0,0 +1,152 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LTE_RLC_UM_RX_WINDOW_H
+#define LTE_RLC_UM_RX_WINDOW_H
+
+#include "ns3/packet.h"
+#include "ns3/ptr.h"
+
+#include <array>
+#include <stdint.h>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup lte
+ *
+ * Reception buffer of the UM RLC entity, indexed directly by the 10-bit
+ * sequence number (see section 7.1 of 3GPP TS 36.322).
+ *
+ * Every SN owns a slot for the whole lifetime of the entity, so storing and
+ * removing PDUs never allocates. A slot is occupied when it holds a non-null
+ * packet.
+ */
+class LteRlcUmRxWindow
+{
+  public:
+    /// Size of the 10-bit UM sequence number space
+    static const uint16_t SN_SPACE = 1024;
+
+    LteRlcUmRxWindow();
+
+    /**
+     * \param sn the sequence number
+     * \returns true if a PDU with this SN is stored
+     */
+    bool Contains(uint16_t sn) const
+    {
+        return m_slots[sn % SN_SPACE] != nullptr;
+    }
+
+    /**
+     * Store a PDU, replacing any PDU previously stored with the same SN
+     *
+     * \param sn the sequence number
+     * \param p the PDU
+     */
+    void Insert(uint16_t sn, Ptr<Packet> p);
+
+    /**
+     * Take the PDU stored with the given SN out of the window
+     *
+     * \param sn the sequence number
+     * \returns the PDU, or 0 if no PDU is stored with this SN
+     */
+    Ptr<Packet> Remove(uint16_t sn);
+
+    /**
+     * \returns the number of stored PDUs
+     */
+    uint16_t GetSize() const
+    {
+        return m_size;
+    }
+
+    /**
+     * \returns true if no PDU is stored
+     */
+    bool IsEmpty() const
+    {
+        return m_size == 0;
+    }
+
+    /// Drop all the stored PDUs
+    void Clear();
+
+  private:
+    std::array<Ptr<Packet>, SN_SPACE> m_slots; ///< one slot per SN
+    uint16_t m_size;                           ///< number of occupied slots
+};
+
+/**
+ * \ingroup lte
+ *
+ * FIFO of the SDUs (or SDU segments) extracted from a UMD PDU while it is
+ * being reassembled.
+ *
+ * The storage is a vector consumed through a read cursor: popping only
+ * advances the cursor, and the storage is rewound (keeping its capacity)
+ * once every element has been consumed, so that after the first few PDUs
+ * the reassembly does not allocate anymore.
+ */
+class LteRlcSduQueue
+{
+  public:
+    LteRlcSduQueue();
+
+    /**
+     * \param p the SDU to append
+     */
+    void PushBack(Ptr<Packet> p);
+
+    /**
+     * \returns the oldest SDU in the queue
+     */
+    Ptr<Packet> Front() const;
+
+    /// Remove the oldest SDU in the queue
+    void PopFront();
+
+    /**
+     * \returns the number of SDUs in the queue
+     */
+    uint32_t GetSize() const
+    {
+        return m_sdus.size() - m_head;
+    }
+
+    /**
+     * \returns true if the queue is empty
+     */
+    bool IsEmpty() const
+    {
+        return m_head == m_sdus.size();
+    }
+
+    /// Remove all the SDUs, keeping the allocated storage
+    void Clear();
+
+  private:
+    std::vector<Ptr<Packet>> m_sdus; ///< SDU storage
+    uint32_t m_head;                 ///< index of the oldest SDU
+};
+
+} // namespace ns3
+
+#endif // LTE_RLC_UM_RX_WINDOW_H
@@ -500,7 +500,7 @@ LteRlcUm::DoReceivePdu(LteMacSapUser::ReceivePduParameters rxPduParams)
     seqNumber.SetModulusBase(m_vrUh - m_windowSize);
 
     if (((m_vrUr < seqNumber) && (seqNumber < m_vrUh) &&
-         (m_rxBuffer.count(seqNumber.GetValue()) > 0)) ||
+         m_rxBuffer.Contains(seqNumber.GetValue())) ||
         (((m_vrUh - m_windowSize) <= seqNumber) && (seqNumber < m_vrUr)))
     {
         NS_LOG_LOGIC("PDU discarded");
@@ -510,7 +510,7 @@ LteRlcUm::DoReceivePdu(LteMacSapUser::ReceivePduParameters rxPduParams)
     else
     {
         NS_LOG_LOGIC("Place PDU in the reception buffer");
-        m_rxBuffer[seqNumber.GetValue()] = rxPduParams.p;
+        m_rxBuffer.Insert(seqNumber.GetValue(), rxPduParams.p);
     }
 
     // 5.1.2.2.3 Actions when an UMD PDU is placed in the reception buffer
@@ -551,17 +551,13 @@ LteRlcUm::DoReceivePdu(LteMacSapUser::ReceivePduParameters rxPduParams)
     //      so and deliver the reassembled RLC SDUs to upper layer in ascending order of the RLC SN
     //      if not delivered before;
 
-    if (m_rxBuffer.count(m_vrUr.GetValue()) > 0)
+    if (m_rxBuffer.Contains(m_vrUr.GetValue()))
     {
         NS_LOG_LOGIC("Reception buffer contains SN = " << m_vrUr);
 
-        std::map<uint16_t, Ptr<Packet>>::iterator it;
-        uint16_t newVrUr;
         SequenceNumber10 oldVrUr = m_vrUr;
-
-        it = m_rxBuffer.find(m_vrUr.GetValue());
-        newVrUr = (it->first) + 1;
-        while (m_rxBuffer.count(newVrUr) > 0)
+        uint16_t newVrUr = m_vrUr.GetValue() + 1;
+        while (m_rxBuffer.Contains(newVrUr))
         {
             newVrUr++;
         }
@@ -669,7 +665,7 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
 
         if (extensionBit == 0)
         {
-            m_sdusBuffer.push_back(packet);
+            m_sdusBuffer.PushBack(packet);
         }
         else // extensionBit == 1
         {
@@ -687,12 +683,10 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
             Ptr<Packet> data_field = packet->CreateFragment(0, lengthIndicator);
             packet->RemoveAtStart(lengthIndicator);
 
-            m_sdusBuffer.push_back(data_field);
+            m_sdusBuffer.PushBack(data_field);
         }
     } while (extensionBit == 1);
 
-    std::list<Ptr<Packet>>::iterator it;
-
     // Current reassembling state
     if (m_reassemblingState == WAITING_S0_FULL)
         NS_LOG_LOGIC("Reassembling State = 'WAITING_S0_FULL'");
@@ -718,11 +712,11 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Deliver one or multiple PDUs
                  */
-                for (it = m_sdusBuffer.begin(); it != m_sdusBuffer.end(); it++)
+                while (!m_sdusBuffer.IsEmpty())
                 {
-                    TriggerReceivePdcpPdu(*it);
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
-                m_sdusBuffer.clear();
                 break;
 
             case (LteRlcHeader::FIRST_BYTE | LteRlcHeader::NO_LAST_BYTE):
@@ -731,17 +725,17 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Deliver full PDUs
                  */
-                while (m_sdusBuffer.size() > 1)
+                while (m_sdusBuffer.GetSize() > 1)
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
 
                 /**
                  * Keep S0
                  */
-                m_keepS0 = m_sdusBuffer.front();
-                m_sdusBuffer.pop_front();
+                m_keepS0 = m_sdusBuffer.Front();
+                m_sdusBuffer.PopFront();
                 break;
 
             case (LteRlcHeader::NO_FIRST_BYTE | LteRlcHeader::LAST_BYTE):
@@ -750,20 +744,20 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Discard SI or SN
                  */
-                m_sdusBuffer.pop_front();
+                m_sdusBuffer.PopFront();
 
                 /**
                  * Deliver zero, one or multiple PDUs
                  */
-                while (!m_sdusBuffer.empty())
+                while (!m_sdusBuffer.IsEmpty())
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
             case (LteRlcHeader::NO_FIRST_BYTE | LteRlcHeader::NO_LAST_BYTE):
-                if (m_sdusBuffer.size() == 1)
+                if (m_sdusBuffer.GetSize() == 1)
                 {
                     m_reassemblingState = WAITING_S0_FULL;
                 }
@@ -775,24 +769,24 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Discard SI or SN
                  */
-                m_sdusBuffer.pop_front();
+                m_sdusBuffer.PopFront();
 
-                if (m_sdusBuffer.size() > 0)
+                if (m_sdusBuffer.GetSize() > 0)
                 {
                     /**
                      * Deliver zero, one or multiple PDUs
                      */
-                    while (m_sdusBuffer.size() > 1)
+                    while (m_sdusBuffer.GetSize() > 1)
                     {
-                        TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                        m_sdusBuffer.pop_front();
+                        TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                        m_sdusBuffer.PopFront();
                     }
 
                     /**
                      * Keep S0
                      */
-                    m_keepS0 = m_sdusBuffer.front();
-                    m_sdusBuffer.pop_front();
+                    m_keepS0 = m_sdusBuffer.Front();
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
@@ -815,17 +809,17 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Deliver (Kept)S0 + SN
                  */
-                m_keepS0->AddAtEnd(m_sdusBuffer.front());
-                m_sdusBuffer.pop_front();
+                m_keepS0->AddAtEnd(m_sdusBuffer.Front());
+                m_sdusBuffer.PopFront();
                 TriggerReceivePdcpPdu(m_keepS0);
 
                 /**
                  * Deliver zero, one or multiple PDUs
                  */
-                while (!m_sdusBuffer.empty())
+                while (!m_sdusBuffer.IsEmpty())
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
@@ -835,34 +829,34 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Keep SI
                  */
-                if (m_sdusBuffer.size() == 1)
+                if (m_sdusBuffer.GetSize() == 1)
                 {
-                    m_keepS0->AddAtEnd(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    m_keepS0->AddAtEnd(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
                 else // m_sdusBuffer.size () > 1
                 {
                     /**
                      * Deliver (Kept)S0 + SN
                      */
-                    m_keepS0->AddAtEnd(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    m_keepS0->AddAtEnd(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                     TriggerReceivePdcpPdu(m_keepS0);
 
                     /**
                      * Deliver zero, one or multiple PDUs
                      */
-                    while (m_sdusBuffer.size() > 1)
+                    while (m_sdusBuffer.GetSize() > 1)
                     {
-                        TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                        m_sdusBuffer.pop_front();
+                        TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                        m_sdusBuffer.PopFront();
                     }
 
                     /**
                      * Keep S0
                      */
-                    m_keepS0 = m_sdusBuffer.front();
-                    m_sdusBuffer.pop_front();
+                    m_keepS0 = m_sdusBuffer.Front();
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
@@ -898,11 +892,11 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Deliver one or multiple PDUs
                  */
-                for (it = m_sdusBuffer.begin(); it != m_sdusBuffer.end(); it++)
+                while (!m_sdusBuffer.IsEmpty())
                 {
-                    TriggerReceivePdcpPdu(*it);
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
-                m_sdusBuffer.clear();
                 break;
 
             case (LteRlcHeader::FIRST_BYTE | LteRlcHeader::NO_LAST_BYTE):
@@ -911,17 +905,17 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Deliver full PDUs
                  */
-                while (m_sdusBuffer.size() > 1)
+                while (m_sdusBuffer.GetSize() > 1)
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
 
                 /**
                  * Keep S0
                  */
-                m_keepS0 = m_sdusBuffer.front();
-                m_sdusBuffer.pop_front();
+                m_keepS0 = m_sdusBuffer.Front();
+                m_sdusBuffer.PopFront();
                 break;
 
             case (LteRlcHeader::NO_FIRST_BYTE | LteRlcHeader::LAST_BYTE):
@@ -930,20 +924,20 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Discard SN
                  */
-                m_sdusBuffer.pop_front();
+                m_sdusBuffer.PopFront();
 
                 /**
                  * Deliver zero, one or multiple PDUs
                  */
-                while (!m_sdusBuffer.empty())
+                while (!m_sdusBuffer.IsEmpty())
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
             case (LteRlcHeader::NO_FIRST_BYTE | LteRlcHeader::NO_LAST_BYTE):
-                if (m_sdusBuffer.size() == 1)
+                if (m_sdusBuffer.GetSize() == 1)
                 {
                     m_reassemblingState = WAITING_S0_FULL;
                 }
@@ -955,24 +949,24 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Discard SI or SN
                  */
-                m_sdusBuffer.pop_front();
+                m_sdusBuffer.PopFront();
 
-                if (m_sdusBuffer.size() > 0)
+                if (m_sdusBuffer.GetSize() > 0)
                 {
                     /**
                      * Deliver zero, one or multiple PDUs
                      */
-                    while (m_sdusBuffer.size() > 1)
+                    while (m_sdusBuffer.GetSize() > 1)
                     {
-                        TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                        m_sdusBuffer.pop_front();
+                        TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                        m_sdusBuffer.PopFront();
                     }
 
                     /**
                      * Keep S0
                      */
-                    m_keepS0 = m_sdusBuffer.front();
-                    m_sdusBuffer.pop_front();
+                    m_keepS0 = m_sdusBuffer.Front();
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
@@ -1000,10 +994,10 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Deliver one or multiple PDUs
                  */
-                while (!m_sdusBuffer.empty())
+                while (!m_sdusBuffer.IsEmpty())
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
@@ -1018,17 +1012,17 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Deliver zero, one or multiple PDUs
                  */
-                while (m_sdusBuffer.size() > 1)
+                while (m_sdusBuffer.GetSize() > 1)
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
 
                 /**
                  * Keep S0
                  */
-                m_keepS0 = m_sdusBuffer.front();
-                m_sdusBuffer.pop_front();
+                m_keepS0 = m_sdusBuffer.Front();
+                m_sdusBuffer.PopFront();
 
                 break;
 
@@ -1043,20 +1037,20 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Discard SI or SN
                  */
-                m_sdusBuffer.pop_front();
+                m_sdusBuffer.PopFront();
 
                 /**
                  * Deliver zero, one or multiple PDUs
                  */
-                while (!m_sdusBuffer.empty())
+                while (!m_sdusBuffer.IsEmpty())
                 {
-                    TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                    m_sdusBuffer.pop_front();
+                    TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
             case (LteRlcHeader::NO_FIRST_BYTE | LteRlcHeader::NO_LAST_BYTE):
-                if (m_sdusBuffer.size() == 1)
+                if (m_sdusBuffer.GetSize() == 1)
                 {
                     m_reassemblingState = WAITING_S0_FULL;
                 }
@@ -1073,24 +1067,24 @@ LteRlcUm::ReassembleAndDeliver(Ptr<Packet> packet)
                 /**
                  * Discard SI or SN
                  */
-                m_sdusBuffer.pop_front();
+                m_sdusBuffer.PopFront();
 
-                if (m_sdusBuffer.size() > 0)
+                if (m_sdusBuffer.GetSize() > 0)
                 {
                     /**
                      * Deliver zero, one or multiple PDUs
                      */
-                    while (m_sdusBuffer.size() > 1)
+                    while (m_sdusBuffer.GetSize() > 1)
                     {
-                        TriggerReceivePdcpPdu(m_sdusBuffer.front());
-                        m_sdusBuffer.pop_front();
+                        TriggerReceivePdcpPdu(m_sdusBuffer.Front());
+                        m_sdusBuffer.PopFront();
                     }
 
                     /**
                      * Keep S0
                      */
-                    m_keepS0 = m_sdusBuffer.front();
-                    m_sdusBuffer.pop_front();
+                    m_keepS0 = m_sdusBuffer.Front();
+                    m_sdusBuffer.PopFront();
                 }
                 break;
 
@@ -1133,24 +1127,27 @@ LteRlcUm::ReassembleOutsideWindow(void)
 {
     NS_LOG_LOGIC("Reassemble Outside Window");
 
-    std::map<uint16_t, Ptr<Packet>>::iterator it;
-    it = m_rxBuffer.begin();
-
-    while ((it != m_rxBuffer.end()) && !IsInsideReorderingWindow(SequenceNumber10(it->first)))
+    // Every PDU in the reception buffer has SN >= VR(UR): if VR(UR) is still
+    // inside the reordering window, so are all of them
+    if (IsInsideReorderingWindow(m_vrUr))
     {
-        NS_LOG_LOGIC("SN = " << it->first);
-
-        // Reassemble RLC SDUs and deliver the PDCP PDU to upper layer
-        ReassembleAndDeliver(it->second);
-
-        std::map<uint16_t, Ptr<Packet>>::iterator it_tmp = it;
-        ++it;
-        m_rxBuffer.erase(it_tmp);
+        NS_LOG_LOGIC("VR(UR) = " << m_vrUr << " is inside the reordering window");
+        return;
     }
 
-    if (it != m_rxBuffer.end())
+    uint16_t lowerEdge = (m_vrUh - m_windowSize).GetValue();
+    uint16_t sn = m_vrUr.GetValue();
+    while (sn != lowerEdge && !m_rxBuffer.IsEmpty())
     {
-        NS_LOG_LOGIC("(SN = " << it->first << ") is inside the reordering window");
+        Ptr<Packet> p = m_rxBuffer.Remove(sn);
+        if (p)
+        {
+            NS_LOG_LOGIC("SN = " << sn);
+
+            // Reassemble RLC SDUs and deliver the PDCP PDU to upper layer
+            ReassembleAndDeliver(p);
+        }
+        sn = (sn + 1) % LteRlcUmRxWindow::SN_SPACE;
     }
 }
 
@@ -1159,25 +1156,16 @@ LteRlcUm::ReassembleSnInterval(SequenceNumber10 lowSeqNumber, SequenceNumber10 h
 {
     NS_LOG_LOGIC("Reassemble SN between " << lowSeqNumber << " and " << highSeqNumber);
 
-    std::map<uint16_t, Ptr<Packet>>::iterator it;
-
     SequenceNumber10 reassembleSn = lowSeqNumber;
-    NS_LOG_LOGIC("reassembleSN = " << reassembleSn);
-    NS_LOG_LOGIC("highSeqNumber = " << highSeqNumber);
     while (reassembleSn < highSeqNumber)
     {
-        NS_LOG_LOGIC("reassembleSn < highSeqNumber");
-        it = m_rxBuffer.find(reassembleSn.GetValue());
-        NS_LOG_LOGIC("it->first  = " << it->first);
-        NS_LOG_LOGIC("it->second = " << it->second);
-        if (it != m_rxBuffer.end())
+        Ptr<Packet> p = m_rxBuffer.Remove(reassembleSn.GetValue());
+        if (p)
         {
-            NS_LOG_LOGIC("SN = " << it->first);
+            NS_LOG_LOGIC("SN = " << reassembleSn);
 
             // Reassemble RLC SDUs and deliver the PDCP PDU to upper layer
-            ReassembleAndDeliver(it->second);
-
-            m_rxBuffer.erase(it);
+            ReassembleAndDeliver(p);
         }
 
         reassembleSn++;
@@ -1230,10 +1218,9 @@ LteRlcUm::ExpireReorderingTimer(void)
     //    - start t-Reordering;
     //    - set VR(UX) to VR(UH).
 
-    std::map<uint16_t, Ptr<Packet>>::iterator it;
     SequenceNumber10 newVrUr = m_vrUx;
 
-    while ((it = m_rxBuffer.find(newVrUr.GetValue())) != m_rxBuffer.end())
+    while (m_rxBuffer.Contains(newVrUr.GetValue()))
     {
         newVrUr++;
     }
@@ -26,12 +26,11 @@
 #define LTE_RLC_UM_H
 
 #include "ns3/lte-rlc-sequence-number.h"
+#include "ns3/lte-rlc-um-rx-window.h"
 #include "ns3/lte-rlc.h"
 #include <ns3/epc-x2-sap.h>
 #include <ns3/event-id.h>
 
-#include <map>
-
 namespace ns3
 {
 
@@ -119,10 +118,8 @@ class LteRlcUm : public LteRlc
     uint32_t m_maxTxBufferSize;                 ///< maximum transmit buffer status
     uint32_t m_txBufferSize;                    ///< transmit buffer size
     std::vector<Ptr<Packet>> m_txBuffer;        ///< Transmission buffer
-    std::map<uint16_t, Ptr<Packet>> m_rxBuffer; ///< Reception buffer
-    std::vector<Ptr<Packet>> m_reasBuffer;      ///< Reassembling buffer
-
-    std::list<Ptr<Packet>> m_sdusBuffer; ///< List of SDUs in a packet
+    LteRlcUmRxWindow m_rxBuffer;                ///< Reception buffer
+    LteRlcSduQueue m_sdusBuffer;                ///< List of SDUs in a packet
 
     /**
      * State variables. See section 7.1 in TS 36.322
@@ -4862,6 +4862,8 @@ RrcConnectionRequestHeader::PreSerialize() const
 uint32_t
 RrcConnectionRequestHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     // std::bitset<1> dummy;
     std::bitset<0> optionalOrDefaultMask;
     int selectedOption;
@@ -4895,7 +4897,7 @@ RrcConnectionRequestHeader::Deserialize(Buffer::Iterator bIterator)
     // Deserialize spare
     bIterator = DeserializeBitstring(&m_spare, bIterator);
 
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
@@ -4979,12 +4981,14 @@ RrcConnectToMmWaveHeader::PreSerialize() const
 uint32_t
 RrcConnectToMmWaveHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     bIterator = DeserializeDlCcchMessage(bIterator);
 
     // Deserialize mmWaveId
     bIterator = DeserializeBitstring(&m_mmWaveId, bIterator);
 
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
@@ -5048,13 +5052,15 @@ RrcNotifySecondaryConnectedHeader::PreSerialize() const
 uint32_t
 RrcNotifySecondaryConnectedHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     bIterator = DeserializeUlDcchMessage(bIterator);
 
     // Deserialize mmWaveId
     bIterator = DeserializeBitstring(&m_mmWaveId, bIterator);
     bIterator = DeserializeBitstring(&m_mmWaveRnti, bIterator);
 
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
@@ -5133,6 +5139,8 @@ RrcConnectionSetupHeader::PreSerialize() const
 uint32_t
 RrcConnectionSetupHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     int n;
 
     std::bitset<0> bitset0;
@@ -5190,7 +5198,7 @@ RrcConnectionSetupHeader::Deserialize(Buffer::Iterator bIterator)
             }
         }
     }
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
@@ -5294,6 +5302,8 @@ RrcConnectionSetupCompleteHeader::PreSerialize() const
 uint32_t
 RrcConnectionSetupCompleteHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     std::bitset<0> bitset0;
 
     bIterator = DeserializeUlDcchMessage(bIterator);
@@ -5328,7 +5338,7 @@ RrcConnectionSetupCompleteHeader::Deserialize(Buffer::Iterator bIterator)
         }
     }
 
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
@@ -5397,6 +5407,8 @@ RrcConnectionReconfigurationCompleteHeader::PreSerialize() const
 uint32_t
 RrcConnectionReconfigurationCompleteHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     std::bitset<0> bitset0;
     int n;
 
@@ -5419,7 +5431,7 @@ RrcConnectionReconfigurationCompleteHeader::Deserialize(Buffer::Iterator bIterat
         // ...
     }
 
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
@@ -5489,6 +5501,8 @@ RrcConnectionSwitchHeader::PreSerialize() const
 uint32_t
 RrcConnectionSwitchHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     int n;
     bIterator = DeserializeDlDcchMessage(bIterator);
     bIterator = DeserializeInteger(&n, 0, 3, bIterator);
@@ -5507,7 +5521,7 @@ RrcConnectionSwitchHeader::Deserialize(Buffer::Iterator bIterator)
     bIterator = DeserializeInteger(&n, 0, 65535, bIterator);
     m_msg.useMmWaveConnection = (uint16_t)n;
 
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
@@ -5676,6 +5690,8 @@ RrcConnectionReconfigurationHeader::PreSerialize() const
 uint32_t
 RrcConnectionReconfigurationHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     std::bitset<0> bitset0;
 
     bIterator = DeserializeDlDcchMessage(bIterator);
@@ -5823,7 +5839,7 @@ RrcConnectionReconfigurationHeader::Deserialize(Buffer::Iterator bIterator)
         }
     }
 
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
@@ -6311,6 +6327,8 @@ HandoverPreparationInfoHeader::PreSerialize() const
 uint32_t
 HandoverPreparationInfoHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     std::bitset<0> bitset0;
     int n;
 
@@ -6428,7 +6446,7 @@ HandoverPreparationInfoHeader::Deserialize(Buffer::Iterator bIterator)
         }
     }
 
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
@@ -6541,6 +6559,8 @@ RrcConnectionReestablishmentRequestHeader::PreSerialize() const
 uint32_t
 RrcConnectionReestablishmentRequestHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     std::bitset<0> bitset0;
     int n;
 
@@ -6602,7 +6622,7 @@ RrcConnectionReestablishmentRequestHeader::Deserialize(Buffer::Iterator bIterato
         bIterator = DeserializeBitstring(&spare, bIterator);
     }
 
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
@@ -6691,6 +6711,8 @@ RrcConnectionReestablishmentHeader::PreSerialize() const
 uint32_t
 RrcConnectionReestablishmentHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     std::bitset<0> bitset0;
     int n;
 
@@ -6737,7 +6759,7 @@ RrcConnectionReestablishmentHeader::Deserialize(Buffer::Iterator bIterator)
         }
     }
 
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
@@ -6812,6 +6834,8 @@ RrcConnectionReestablishmentCompleteHeader::PreSerialize() const
 uint32_t
 RrcConnectionReestablishmentCompleteHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     std::bitset<0> bitset0;
     int n;
 
@@ -6845,7 +6869,7 @@ RrcConnectionReestablishmentCompleteHeader::Deserialize(Buffer::Iterator bIterat
         }
     }
 
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
@@ -6912,6 +6936,8 @@ RrcConnectionReestablishmentRejectHeader::PreSerialize() const
 uint32_t
 RrcConnectionReestablishmentRejectHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     std::bitset<0> bitset0;
 
     bIterator = DeserializeDlCcchMessage(bIterator);
@@ -6940,7 +6966,7 @@ RrcConnectionReestablishmentRejectHeader::Deserialize(Buffer::Iterator bIterator
         }
     }
 
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
@@ -7007,6 +7033,8 @@ RrcConnectionReleaseHeader::PreSerialize() const
 uint32_t
 RrcConnectionReleaseHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     std::bitset<0> bitset0;
     int n;
 
@@ -7066,7 +7094,7 @@ RrcConnectionReleaseHeader::Deserialize(Buffer::Iterator bIterator)
         }
     }
 
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
@@ -7129,6 +7157,8 @@ RrcConnectionRejectHeader::PreSerialize() const
 uint32_t
 RrcConnectionRejectHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     std::bitset<0> bitset0;
     int n;
 
@@ -7173,7 +7203,7 @@ RrcConnectionRejectHeader::Deserialize(Buffer::Iterator bIterator)
         }
     }
 
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
@@ -7239,6 +7269,8 @@ MeasurementReportHeader::PreSerialize() const
 uint32_t
 MeasurementReportHeader::Deserialize(Buffer::Iterator bIterator)
 {
+    Buffer::Iterator bStart = bIterator;
+
     std::bitset<0> bitset0;
 
     bIterator = DeserializeSequence(&bitset0, false, bIterator);
@@ -7280,7 +7312,7 @@ MeasurementReportHeader::Deserialize(Buffer::Iterator bIterator)
         }
     }
 
-    return GetSerializedSize();
+    return FinalizeDeserialization(bStart, bIterator);
 }
 
 void
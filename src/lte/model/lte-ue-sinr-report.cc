@@ -0,0 +1,335 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "lte-ue-sinr-report.h"
+
+#include <ns3/assert.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace ns3
+{
+
+namespace
+{
+
+/**
+ * \param value the value to encode
+ * \returns the number of bytes of the variable-length encoding of the value
+ */
+uint32_t
+GetVarIntSize(uint64_t value)
+{
+    uint32_t size = 1;
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+/**
+ * Write a value with a variable-length encoding, 7 bits per byte, least
+ * significant group first, the MSB of each byte telling if another follows
+ *
+ * \param i the buffer iterator
+ * \param value the value to encode
+ */
+void
+WriteVarInt(Buffer::Iterator& i, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        i.WriteU8(static_cast<uint8_t>(value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    i.WriteU8(static_cast<uint8_t>(value));
+}
+
+/**
+ * \param i the buffer iterator
+ * \returns the value decoded
+ */
+uint64_t
+ReadVarInt(Buffer::Iterator& i)
+{
+    uint64_t value = 0;
+    uint32_t shift = 0;
+    uint8_t byte;
+    do
+    {
+        byte = i.ReadU8();
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return value;
+}
+
+} // namespace
+
+UeSinrReport::UeSinrReport()
+    : m_delta(false)
+{
+}
+
+void
+UeSinrReport::Clear()
+{
+    m_imsi.clear();
+    m_sinr.clear();
+    m_delta = false;
+}
+
+void
+UeSinrReport::Add(uint64_t imsi, double sinr)
+{
+    NS_ASSERT_MSG(m_imsi.empty() || m_imsi.back() < imsi,
+                  "IMSIs must be added in increasing order");
+    m_imsi.push_back(imsi);
+    m_sinr.push_back(sinr);
+}
+
+void
+UeSinrReport::MergeMax(const UeSinrReport& other)
+{
+    uint32_t j = 0;
+    for (uint32_t i = 0; i < m_imsi.size(); ++i)
+    {
+        while (j < other.m_imsi.size() && other.m_imsi[j] < m_imsi[i])
+        {
+            ++j;
+        }
+        NS_ASSERT_MSG(j < other.m_imsi.size() && other.m_imsi[j] == m_imsi[i],
+                      "No SINR reported for UE " << m_imsi[i]);
+        m_sinr[i] = std::max(m_sinr[i], other.m_sinr[j]);
+    }
+}
+
+void
+UeSinrReport::BuildDelta(const UeSinrReport& current,
+                         UeSinrReport& lastSent,
+                         UeSinrReport& scratch,
+                         double thresholdDb)
+{
+    Clear();
+    m_delta = true;
+    scratch.Clear();
+
+    uint32_t j = 0;
+    for (uint32_t i = 0; i < current.m_imsi.size(); ++i)
+    {
+        uint64_t imsi = current.m_imsi[i];
+        double sinr = current.m_sinr[i];
+        while (j < lastSent.m_imsi.size() && lastSent.m_imsi[j] < imsi)
+        {
+            ++j;
+        }
+
+        bool changed = true;
+        if (j < lastSent.m_imsi.size() && lastSent.m_imsi[j] == imsi)
+        {
+            double sentSinr = lastSent.m_sinr[j];
+            if (thresholdDb > 0 && sentSinr > 0 && sinr > 0)
+            {
+                changed = std::abs(10 * std::log10(sinr / sentSinr)) > thresholdDb;
+            }
+            else
+            {
+                changed = (sinr != sentSinr);
+            }
+            if (!changed)
+            {
+                sinr = sentSinr;
+            }
+        }
+
+        if (changed)
+        {
+            Add(imsi, sinr);
+        }
+        scratch.Add(imsi, sinr);
+    }
+    lastSent.Swap(scratch);
+}
+
+uint32_t
+UeSinrReport::GetSerializedSize() const
+{
+    uint32_t size = 2 + 1; // number of entries, flags
+    uint64_t previousImsi = 0;
+    for (uint32_t i = 0; i < m_imsi.size(); ++i)
+    {
+        size += GetVarIntSize(m_imsi[i] - previousImsi) + 8;
+        previousImsi = m_imsi[i];
+    }
+    return size;
+}
+
+void
+UeSinrReport::Serialize(Buffer::Iterator& i) const
+{
+    NS_ASSERT_MSG(m_imsi.size() <= 0xffff, "Too many entries in the SINR report");
+    i.WriteHtonU16(m_imsi.size());
+    i.WriteU8(m_delta ? 1 : 0);
+
+    uint64_t previousImsi = 0;
+    for (uint32_t j = 0; j < m_imsi.size(); ++j)
+    {
+        WriteVarInt(i, m_imsi[j] - previousImsi);
+        previousImsi = m_imsi[j];
+
+        uint64_t sinrBits;
+        std::memcpy(&sinrBits, &m_sinr[j], sizeof(sinrBits));
+        i.WriteHtonU64(sinrBits);
+    }
+}
+
+void
+UeSinrReport::Deserialize(Buffer::Iterator& i)
+{
+    Clear();
+    uint16_t size = i.ReadNtohU16();
+    m_delta = (i.ReadU8() & 1);
+    m_imsi.reserve(size);
+    m_sinr.reserve(size);
+
+    uint64_t imsi = 0;
+    for (uint16_t j = 0; j < size; ++j)
+    {
+        imsi += ReadVarInt(i);
+        uint64_t sinrBits = i.ReadNtohU64();
+        double sinr;
+        std::memcpy(&sinr, &sinrBits, sizeof(sinr));
+        Add(imsi, sinr);
+    }
+}
+
+void
+UeSinrReport::Print(std::ostream& os) const
+{
+    os << (m_delta ? "delta" : "full");
+    for (uint32_t i = 0; i < m_imsi.size(); ++i)
+    {
+        os << " Imsi " << m_imsi[i] << " sinr " << 10 * std::log10(m_sinr[i]);
+    }
+}
+
+void
+UeSinrReport::Swap(UeSinrReport& other)
+{
+    m_imsi.swap(other.m_imsi);
+    m_sinr.swap(other.m_sinr);
+    std::swap(m_delta, other.m_delta);
+}
+
+std::ostream&
+operator<<(std::ostream& os, const UeSinrReport& report)
+{
+    report.Print(os);
+    return os;
+}
+
+UeCellSinrMatrix::UeCellSinrMatrix()
+{
+}
+
+void
+UeCellSinrMatrix::Clear()
+{
+    m_imsi.clear();
+    m_cellId.clear();
+    m_sinr.clear();
+    m_known.clear();
+}
+
+void
+UeCellSinrMatrix::Update(uint16_t cellId, const UeSinrReport& report)
+{
+    uint32_t cell = AddCell(cellId);
+
+    // both the report and the rows are sorted by IMSI
+    uint32_t ue = 0;
+    for (uint32_t i = 0; i < report.GetSize(); ++i)
+    {
+        uint64_t imsi = report.GetImsi(i);
+        while (ue < m_imsi.size() && m_imsi[ue] < imsi)
+        {
+            ++ue;
+        }
+        if (ue == m_imsi.size() || m_imsi[ue] != imsi)
+        {
+            InsertUe(ue, imsi);
+        }
+        uint32_t index = ue * m_cellId.size() + cell;
+        m_sinr[index] = report.GetSinr(i);
+        m_known[index] = true;
+    }
+}
+
+double
+UeCellSinrMatrix::GetSinrByImsi(uint64_t imsi, uint16_t cellId) const
+{
+    auto ueIt = std::lower_bound(m_imsi.begin(), m_imsi.end(), imsi);
+    auto cellIt = std::lower_bound(m_cellId.begin(), m_cellId.end(), cellId);
+    if (ueIt == m_imsi.end() || *ueIt != imsi || cellIt == m_cellId.end() || *cellIt != cellId)
+    {
+        return 0;
+    }
+    return GetSinr(ueIt - m_imsi.begin(), cellIt - m_cellId.begin());
+}
+
+uint32_t
+UeCellSinrMatrix::AddCell(uint16_t cellId)
+{
+    auto cellIt = std::lower_bound(m_cellId.begin(), m_cellId.end(), cellId);
+    uint32_t cell = cellIt - m_cellId.begin();
+    if (cellIt != m_cellId.end() && *cellIt == cellId)
+    {
+        return cell;
+    }
+
+    // new column: rebuild the matrix, this only happens when a cell reports
+    // for the first time
+    uint32_t oldNumCells = m_cellId.size();
+    m_cellId.insert(cellIt, cellId);
+    std::vector<double> sinr(m_imsi.size() * m_cellId.size(), 0);
+    std::vector<bool> known(m_imsi.size() * m_cellId.size(), false);
+    for (uint32_t ue = 0; ue < m_imsi.size(); ++ue)
+    {
+        for (uint32_t c = 0; c < oldNumCells; ++c)
+        {
+            uint32_t newC = (c < cell) ? c : c + 1;
+            sinr[ue * m_cellId.size() + newC] = m_sinr[ue * oldNumCells + c];
+            known[ue * m_cellId.size() + newC] = m_known[ue * oldNumCells + c];
+        }
+    }
+    m_sinr.swap(sinr);
+    m_known.swap(known);
+    return cell;
+}
+
+void
+UeCellSinrMatrix::InsertUe(uint32_t ue, uint64_t imsi)
+{
+    m_imsi.insert(m_imsi.begin() + ue, imsi);
+    m_sinr.insert(m_sinr.begin() + ue * m_cellId.size(), m_cellId.size(), 0);
+    m_known.insert(m_known.begin() + ue * m_cellId.size(), m_cellId.size(), false);
+}
+
+} // namespace ns3
@@ -0,0 +1,273 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LTE_UE_SINR_REPORT_H
+#define LTE_UE_SINR_REPORT_H
+
+#include <ns3/buffer.h>
+
+#include <ostream>
+#include <stdint.h>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup lte
+ *
+ * Report of the SINR that a mmWave cell estimates for its UEs, sent by the
+ * mmWave eNBs to the LTE coordinator.
+ *
+ * The entries are kept in two parallel arrays sorted by IMSI, so that
+ * reports can be merged and compared with a single linear pass and without
+ * allocating once the arrays have reached their working size.  A report can
+ * be a delta report, i.e., contain only the UEs whose SINR changed with
+ * respect to the previous report sent by the same cell.
+ */
+class UeSinrReport
+{
+  public:
+    UeSinrReport();
+
+    /// Remove all the entries, keeping the allocated storage
+    void Clear();
+
+    /**
+     * Append an entry. The IMSIs must be added in increasing order.
+     *
+     * \param imsi the IMSI of the UE
+     * \param sinr the SINR (linear)
+     */
+    void Add(uint64_t imsi, double sinr);
+
+    /**
+     * \returns the number of entries
+     */
+    uint32_t GetSize() const
+    {
+        return m_imsi.size();
+    }
+
+    /**
+     * \param i the index of the entry
+     * \returns the IMSI of the i-th entry
+     */
+    uint64_t GetImsi(uint32_t i) const
+    {
+        return m_imsi[i];
+    }
+
+    /**
+     * \param i the index of the entry
+     * \returns the SINR (linear) of the i-th entry
+     */
+    double GetSinr(uint32_t i) const
+    {
+        return m_sinr[i];
+    }
+
+    /**
+     * \returns true if the report only contains the entries that changed
+     */
+    bool IsDelta() const
+    {
+        return m_delta;
+    }
+
+    /**
+     * \param delta whether the report only contains the entries that changed
+     */
+    void SetDelta(bool delta)
+    {
+        m_delta = delta;
+    }
+
+    /**
+     * Keep, for each UE in this report, the maximum between its SINR and the
+     * SINR in the other report. Every UE of this report must also be in the
+     * other one.
+     *
+     * \param other the report to merge
+     */
+    void MergeMax(const UeSinrReport& other);
+
+    /**
+     * Build in this report the delta between a full report and the values
+     * last sent to the coordinator, and update the latter accordingly.
+     *
+     * An entry is part of the delta if the UE is new or its SINR differs by
+     * more than the threshold from the last value sent.  After the call,
+     * lastSent contains the values known to the coordinator for the UEs of
+     * the current report.
+     *
+     * \param current the full report
+     * \param lastSent the values last sent, updated by the call
+     * \param scratch storage used to rebuild lastSent
+     * \param thresholdDb the minimum SINR change (in dB) to report
+     */
+    void BuildDelta(const UeSinrReport& current,
+                    UeSinrReport& lastSent,
+                    UeSinrReport& scratch,
+                    double thresholdDb);
+
+    /**
+     * \returns the size of the report when serialized
+     */
+    uint32_t GetSerializedSize() const;
+
+    /**
+     * Serialize the report: the IMSIs are encoded as variable-length
+     * increments with respect to the previous entry.
+     *
+     * \param i the buffer iterator, moved past the report
+     */
+    void Serialize(Buffer::Iterator& i) const;
+
+    /**
+     * \param i the buffer iterator, moved past the report
+     */
+    void Deserialize(Buffer::Iterator& i);
+
+    /**
+     * \param os the output stream
+     */
+    void Print(std::ostream& os) const;
+
+    /// Swap the content of two reports
+    void Swap(UeSinrReport& other);
+
+  private:
+    std::vector<uint64_t> m_imsi; ///< IMSIs, in increasing order
+    std::vector<double> m_sinr;   ///< SINR (linear) of each IMSI
+    bool m_delta;                 ///< true if only the changed entries are reported
+};
+
+std::ostream& operator<<(std::ostream& os, const UeSinrReport& report);
+
+/**
+ * \ingroup lte
+ *
+ * SINR of each UE towards each mmWave cell, as known by the LTE coordinator.
+ *
+ * The values are stored in a dense row-major matrix with one row per UE
+ * (in increasing IMSI order) and one column per cell (in increasing cell ID
+ * order), so that the SINR reports can be applied with a linear merge and
+ * the handover and switch decisions can scan the cells of a UE contiguously.
+ * The pairs for which no SINR has been reported yet are marked as unknown.
+ */
+class UeCellSinrMatrix
+{
+  public:
+    UeCellSinrMatrix();
+
+    /// Remove all the UEs and cells
+    void Clear();
+
+    /**
+     * Apply the report sent by a cell, adding the cell and the UEs that are
+     * not known yet
+     *
+     * \param cellId the ID of the reporting cell
+     * \param report the report
+     */
+    void Update(uint16_t cellId, const UeSinrReport& report);
+
+    /**
+     * \returns the number of UEs
+     */
+    uint32_t GetNumUes() const
+    {
+        return m_imsi.size();
+    }
+
+    /**
+     * \returns the number of cells
+     */
+    uint32_t GetNumCells() const
+    {
+        return m_cellId.size();
+    }
+
+    /**
+     * \param ue the row of the UE
+     * \returns the IMSI of the UE
+     */
+    uint64_t GetImsi(uint32_t ue) const
+    {
+        return m_imsi[ue];
+    }
+
+    /**
+     * \param cell the column of the cell
+     * \returns the ID of the cell
+     */
+    uint16_t GetCellId(uint32_t cell) const
+    {
+        return m_cellId[cell];
+    }
+
+    /**
+     * \param ue the row of the UE
+     * \param cell the column of the cell
+     * \returns true if the cell has reported a SINR for the UE
+     */
+    bool HasSinr(uint32_t ue, uint32_t cell) const
+    {
+        return m_known[ue * m_cellId.size() + cell];
+    }
+
+    /**
+     * \param ue the row of the UE
+     * \param cell the column of the cell
+     * \returns the SINR (linear), or 0 if not known
+     */
+    double GetSinr(uint32_t ue, uint32_t cell) const
+    {
+        return m_sinr[ue * m_cellId.size() + cell];
+    }
+
+    /**
+     * \param imsi the IMSI of the UE
+     * \param cellId the ID of the cell
+     * \returns the SINR (linear), or 0 if not known
+     */
+    double GetSinrByImsi(uint64_t imsi, uint16_t cellId) const;
+
+  private:
+    /**
+     * \param cellId the ID of the cell
+     * \returns the column of the cell, added if not present
+     */
+    uint32_t AddCell(uint16_t cellId);
+
+    /**
+     * Insert an empty row for a UE
+     *
+     * \param ue the row
+     * \param imsi the IMSI of the UE
+     */
+    void InsertUe(uint32_t ue, uint64_t imsi);
+
+    std::vector<uint64_t> m_imsi;   ///< IMSI of each row, in increasing order
+    std::vector<uint16_t> m_cellId; ///< cell ID of each column, in increasing order
+    std::vector<double> m_sinr;     ///< SINR (linear) of each UE towards each cell
+    std::vector<bool> m_known;      ///< whether each SINR has been reported
+};
+
+} // namespace ns3
+
+#endif // LTE_UE_SINR_REPORT_H
@@ -0,0 +1,319 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/lte-mac-sap.h"
+#include "ns3/lte-rlc-header.h"
+#include "ns3/lte-rlc-sap.h"
+#include "ns3/lte-rlc-tag.h"
+#include "ns3/lte-rlc-um-rx-window.h"
+#include "ns3/lte-rlc-um.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Check that the UM reception buffer stores PDUs by SN, wraps around
+ * the 10-bit SN space and keeps track of its occupancy.
+ */
+class LteRlcUmRxWindowTestCase : public TestCase
+{
+  public:
+    LteRlcUmRxWindowTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LteRlcUmRxWindowTestCase::LteRlcUmRxWindowTestCase()
+    : TestCase("UM reception buffer indexed by SN")
+{
+}
+
+void
+LteRlcUmRxWindowTestCase::DoRun()
+{
+    LteRlcUmRxWindow window;
+    NS_TEST_ASSERT_MSG_EQ(window.IsEmpty(), true, "new window should be empty");
+
+    Ptr<Packet> p1 = Create<Packet>(10);
+    Ptr<Packet> p2 = Create<Packet>(20);
+    window.Insert(1023, p1);
+    window.Insert(1024, p2); // wraps to SN 0
+    NS_TEST_ASSERT_MSG_EQ(window.GetSize(), 2, "wrong number of stored PDUs");
+    NS_TEST_ASSERT_MSG_EQ(window.Contains(0), true, "SN 0 should be stored");
+    NS_TEST_ASSERT_MSG_EQ(window.Contains(1), false, "SN 1 should not be stored");
+
+    window.Insert(1023, p2);
+    NS_TEST_ASSERT_MSG_EQ(window.GetSize(), 2, "replacing a PDU should not change the size");
+
+    NS_TEST_ASSERT_MSG_EQ((window.Remove(1023) == p2), true, "wrong PDU removed for SN 1023");
+    NS_TEST_ASSERT_MSG_EQ(window.Contains(1023), false, "SN 1023 should have been removed");
+    NS_TEST_ASSERT_MSG_EQ(window.GetSize(), 1, "wrong number of stored PDUs");
+
+    window.Clear();
+    NS_TEST_ASSERT_MSG_EQ(window.IsEmpty(), true, "window should be empty after Clear");
+    NS_TEST_ASSERT_MSG_EQ(window.Contains(0), false, "SN 0 should have been cleared");
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Check the FIFO order of the reassembly SDU queue across refills.
+ */
+class LteRlcSduQueueTestCase : public TestCase
+{
+  public:
+    LteRlcSduQueueTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LteRlcSduQueueTestCase::LteRlcSduQueueTestCase()
+    : TestCase("Reassembly SDU queue")
+{
+}
+
+void
+LteRlcSduQueueTestCase::DoRun()
+{
+    LteRlcSduQueue queue;
+    NS_TEST_ASSERT_MSG_EQ(queue.IsEmpty(), true, "new queue should be empty");
+
+    for (uint32_t round = 0; round < 3; ++round)
+    {
+        for (uint32_t i = 1; i <= 4; ++i)
+        {
+            queue.PushBack(Create<Packet>(i));
+        }
+        queue.PopFront();
+        queue.PushBack(Create<Packet>(5));
+        NS_TEST_ASSERT_MSG_EQ(queue.GetSize(), 4, "wrong queue size");
+        for (uint32_t i = 2; i <= 5; ++i)
+        {
+            NS_TEST_ASSERT_MSG_EQ(queue.Front()->GetSize(), i, "SDUs out of order");
+            queue.PopFront();
+        }
+        NS_TEST_ASSERT_MSG_EQ(queue.IsEmpty(), true, "queue should be empty");
+    }
+
+    queue.PushBack(Create<Packet>(1));
+    queue.Clear();
+    NS_TEST_ASSERT_MSG_EQ(queue.GetSize(), 0, "queue should be empty after Clear");
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Feed UMD PDUs, each carrying a whole SDU, to the receiving side of an
+ * LteRlcUm and check which SDUs it delivers to the upper layer, and when.
+ *
+ * The PDUs cross the wraparound of the 10-bit SN space, arrive out of order,
+ * and some of them are lost or arrive after t-Reordering gave up on them. The
+ * SDU of the n-th PDU has 10 + n bytes and SN = n mod 1024, so that the
+ * delivered SDUs can be told apart across the wraparound.
+ */
+class LteRlcUmReorderingTestCase : public TestCase, public LteRlcSapUser
+{
+  public:
+    /**
+     * \brief The arrival of a PDU, or the expected delivery of an SDU
+     */
+    struct Event
+    {
+        uint32_t n; ///< the index of the PDU
+        Time time;  ///< the time of the arrival or of the delivery
+    };
+
+    /**
+     * Constructor
+     *
+     * \param name the name of the test case
+     * \param arrivals the arrivals of the PDUs
+     * \param deliveries the expected deliveries of the SDUs
+     */
+    LteRlcUmReorderingTestCase(std::string name,
+                               std::vector<Event> arrivals,
+                               std::vector<Event> deliveries);
+
+    void ReceivePdcpPdu(Ptr<Packet> p) override;
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Deliver the PDU of index n to the RLC entity
+     *
+     * \param n the index of the PDU
+     */
+    void ReceivePdu(uint32_t n);
+
+    Ptr<LteRlcUm> m_rlc;             ///< the receiving RLC entity
+    std::vector<Event> m_arrivals;   ///< the arrivals of the PDUs
+    std::vector<Event> m_deliveries; ///< the expected deliveries of the SDUs
+    std::vector<Event> m_delivered;  ///< the SDUs delivered by the RLC entity
+};
+
+LteRlcUmReorderingTestCase::LteRlcUmReorderingTestCase(std::string name,
+                                                       std::vector<Event> arrivals,
+                                                       std::vector<Event> deliveries)
+    : TestCase(name),
+      m_arrivals(arrivals),
+      m_deliveries(deliveries)
+{
+}
+
+void
+LteRlcUmReorderingTestCase::ReceivePdcpPdu(Ptr<Packet> p)
+{
+    m_delivered.push_back({p->GetSize() - 10, Simulator::Now()});
+}
+
+void
+LteRlcUmReorderingTestCase::ReceivePdu(uint32_t n)
+{
+    Ptr<Packet> p = Create<Packet>(10 + n);
+    LteRlcHeader rlcHeader;
+    rlcHeader.SetSequenceNumber(SequenceNumber10(n % LteRlcUmRxWindow::SN_SPACE));
+    rlcHeader.SetFramingInfo(LteRlcHeader::FIRST_BYTE | LteRlcHeader::LAST_BYTE);
+    rlcHeader.PushExtensionBit(LteRlcHeader::DATA_FIELD_FOLLOWS);
+    p->AddHeader(rlcHeader);
+    RlcTag rlcTag(Simulator::Now());
+    p->AddPacketTag(rlcTag);
+
+    LteMacSapUser::ReceivePduParameters params;
+    params.p = p;
+    params.rnti = 1;
+    params.lcid = 3;
+    m_rlc->GetLteMacSapUser()->ReceivePdu(params);
+}
+
+void
+LteRlcUmReorderingTestCase::DoRun()
+{
+    m_rlc = CreateObject<LteRlcUm>();
+    m_rlc->SetRnti(1);
+    m_rlc->SetLcId(3);
+    m_rlc->SetLteRlcSapUser(this);
+
+    for (const auto& arrival : m_arrivals)
+    {
+        Simulator::Schedule(arrival.time, &LteRlcUmReorderingTestCase::ReceivePdu, this, arrival.n);
+    }
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(m_delivered.size(), m_deliveries.size(), "wrong number of SDUs");
+    for (std::size_t i = 0; i < std::min(m_delivered.size(), m_deliveries.size()); ++i)
+    {
+        NS_TEST_ASSERT_MSG_EQ(m_delivered[i].n,
+                              m_deliveries[i].n,
+                              "wrong SDU delivered in position " << i);
+        NS_TEST_ASSERT_MSG_EQ(m_delivered[i].time,
+                              m_deliveries[i].time,
+                              "SDU " << m_delivered[i].n << " delivered at the wrong time");
+    }
+    m_rlc->Dispose();
+    m_rlc = nullptr;
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite for the UM RLC receive-side buffers.
+ */
+class LteRlcUmRxWindowTestSuite : public TestSuite
+{
+  public:
+    LteRlcUmRxWindowTestSuite();
+};
+
+LteRlcUmRxWindowTestSuite::LteRlcUmRxWindowTestSuite()
+    : TestSuite("lte-rlc-um-rx-window", Type::UNIT)
+{
+    AddTestCase(new LteRlcUmRxWindowTestCase(), Duration::QUICK);
+    AddTestCase(new LteRlcSduQueueTestCase(), Duration::QUICK);
+
+    // the PDUs before the wraparound, received in order
+    std::vector<LteRlcUmReorderingTestCase::Event> inOrder;
+    for (uint32_t n = 0; n < 1020; ++n)
+    {
+        inOrder.push_back({n, Seconds(0)});
+    }
+
+    // PDUs reordered around the wraparound: SN 1022 arrives after t-Reordering
+    // gave up on it, and SN 4 (n = 1028) is lost
+    std::vector<LteRlcUmReorderingTestCase::Event> arrivals = inOrder;
+    arrivals.insert(arrivals.end(),
+                    {{1021, MilliSeconds(1)},
+                     {1020, MilliSeconds(2)},
+                     {1023, MilliSeconds(3)},
+                     {1025, MilliSeconds(4)},
+                     {1024, MilliSeconds(6)},
+                     {1022, MilliSeconds(14)},
+                     {1027, MilliSeconds(15)},
+                     {1026, MilliSeconds(16)},
+                     {1029, MilliSeconds(17)}});
+    std::vector<LteRlcUmReorderingTestCase::Event> deliveries = inOrder;
+    deliveries.insert(deliveries.end(),
+                      {{1020, MilliSeconds(2)},
+                       {1021, MilliSeconds(2)},
+                       {1023, MilliSeconds(13)},
+                       {1024, MilliSeconds(13)},
+                       {1025, MilliSeconds(13)},
+                       {1026, MilliSeconds(16)},
+                       {1027, MilliSeconds(16)},
+                       {1029, MilliSeconds(27)}});
+    AddTestCase(new LteRlcUmReorderingTestCase("UM reordering across the SN wraparound",
+                                               arrivals,
+                                               deliveries),
+                Duration::QUICK);
+
+    // PDUs buffered on both sides of the wraparound (SNs 1021, 1023 and 2)
+    // fall outside the reordering window when SN 514 arrives, and are
+    // delivered in SN order. The std::map reception buffer used before the
+    // SN-indexed window walked them by raw SN value instead: it delivered SN 2
+    // and stopped at SN 514, so that SNs 1021 and 1023 were never delivered.
+    arrivals = inOrder;
+    arrivals.insert(arrivals.end(),
+                    {{1021, MilliSeconds(1)},
+                     {1023, MilliSeconds(1)},
+                     {1026, MilliSeconds(1)},
+                     {1538, MilliSeconds(2)}});
+    deliveries = inOrder;
+    deliveries.insert(deliveries.end(),
+                      {{1021, MilliSeconds(2)},
+                       {1023, MilliSeconds(2)},
+                       {1026, MilliSeconds(2)},
+                       {1538, MilliSeconds(12)}});
+    AddTestCase(new LteRlcUmReorderingTestCase("UM reassembly outside the reordering window "
+                                               "across the SN wraparound",
+                                               arrivals,
+                                               deliveries),
+                Duration::QUICK);
+}
+
+static LteRlcUmRxWindowTestSuite lteRlcUmRxWindowTestSuite; ///< the test suite
@@ -0,0 +1,183 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/epc-x2-header.h"
+#include "ns3/lte-ue-sinr-report.h"
+#include "ns3/packet.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Check that a UE SINR report survives the X2 header serialization
+ * bit-exactly and that delta reports only carry the changed entries.
+ */
+class LteUeSinrReportTestCase : public TestCase
+{
+  public:
+    LteUeSinrReportTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LteUeSinrReportTestCase::LteUeSinrReportTestCase()
+    : TestCase("UE SINR report serialization and deltas")
+{
+}
+
+void
+LteUeSinrReportTestCase::DoRun()
+{
+    UeSinrReport report;
+    report.Add(1, 0.1);
+    report.Add(2, 123.456789);
+    report.Add(300, 1e-7);
+    report.Add(1000000, 42.0);
+
+    EpcX2UeImsiSinrUpdateHeader header;
+    header.SetSourceCellId(7);
+    header.SetUeSinrReport(report);
+    Ptr<Packet> packet = Create<Packet>();
+    packet->AddHeader(header);
+    NS_TEST_ASSERT_MSG_EQ(packet->GetSize(),
+                          header.GetSerializedSize(),
+                          "wrong serialized size");
+
+    EpcX2UeImsiSinrUpdateHeader rxHeader;
+    packet->RemoveHeader(rxHeader);
+    const UeSinrReport& rxReport = rxHeader.GetUeSinrReport();
+    NS_TEST_ASSERT_MSG_EQ(rxHeader.GetSourceCellId(), 7, "wrong source cell");
+    NS_TEST_ASSERT_MSG_EQ(rxReport.GetSize(), report.GetSize(), "wrong number of entries");
+    for (uint32_t i = 0; i < report.GetSize(); ++i)
+    {
+        NS_TEST_ASSERT_MSG_EQ(rxReport.GetImsi(i), report.GetImsi(i), "wrong IMSI");
+        NS_TEST_ASSERT_MSG_EQ(rxReport.GetSinr(i), report.GetSinr(i), "SINR not bit-exact");
+    }
+
+    UeSinrReport lastSent;
+    UeSinrReport scratch;
+    UeSinrReport delta;
+    delta.BuildDelta(report, lastSent, scratch, 0);
+    NS_TEST_ASSERT_MSG_EQ(delta.IsDelta(), true, "report should be a delta");
+    NS_TEST_ASSERT_MSG_EQ(delta.GetSize(), 4, "all the UEs are new");
+
+    UeSinrReport next;
+    next.Add(1, 0.1);
+    next.Add(2, 124.0);
+    next.Add(300, 1e-7);
+    next.Add(400, 5.0);
+    delta.BuildDelta(next, lastSent, scratch, 0);
+    NS_TEST_ASSERT_MSG_EQ(delta.GetSize(), 2, "only the changed and new UEs are sent");
+    NS_TEST_ASSERT_MSG_EQ(delta.GetImsi(0), 2, "wrong changed UE");
+    NS_TEST_ASSERT_MSG_EQ(delta.GetImsi(1), 400, "wrong new UE");
+
+    // 124 vs 124.5 is about 0.02 dB, below the threshold
+    next.Clear();
+    next.Add(2, 124.5);
+    next.Add(400, 50.0);
+    delta.BuildDelta(next, lastSent, scratch, 1.0);
+    NS_TEST_ASSERT_MSG_EQ(delta.GetSize(), 1, "only the UE above the threshold is sent");
+    NS_TEST_ASSERT_MSG_EQ(delta.GetImsi(0), 400, "wrong UE above the threshold");
+    NS_TEST_ASSERT_MSG_EQ(lastSent.GetSinr(0), 124.0, "value below the threshold not kept");
+
+    UeSinrReport cc1;
+    cc1.Add(2, 130.0);
+    cc1.Add(400, 10.0);
+    next.MergeMax(cc1);
+    NS_TEST_ASSERT_MSG_EQ(next.GetSinr(0), 130.0, "wrong max SINR");
+    NS_TEST_ASSERT_MSG_EQ(next.GetSinr(1), 50.0, "wrong max SINR");
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Check that the coordinator SINR matrix keeps the values of all the
+ * cells when UEs and cells are added out of order.
+ */
+class LteUeCellSinrMatrixTestCase : public TestCase
+{
+  public:
+    LteUeCellSinrMatrixTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LteUeCellSinrMatrixTestCase::LteUeCellSinrMatrixTestCase()
+    : TestCase("UE-cell SINR matrix")
+{
+}
+
+void
+LteUeCellSinrMatrixTestCase::DoRun()
+{
+    UeCellSinrMatrix matrix;
+    UeSinrReport report;
+    report.Add(5, 1.0);
+    report.Add(9, 2.0);
+    matrix.Update(3, report);
+
+    report.Clear();
+    report.Add(1, 3.0);
+    report.Add(9, 4.0);
+    matrix.Update(2, report);
+
+    NS_TEST_ASSERT_MSG_EQ(matrix.GetNumUes(), 3, "wrong number of UEs");
+    NS_TEST_ASSERT_MSG_EQ(matrix.GetNumCells(), 2, "wrong number of cells");
+    NS_TEST_ASSERT_MSG_EQ(matrix.GetImsi(0), 1, "UEs not sorted");
+    NS_TEST_ASSERT_MSG_EQ(matrix.GetCellId(0), 2, "cells not sorted");
+    NS_TEST_ASSERT_MSG_EQ(matrix.HasSinr(0, 1), false, "cell 3 did not report UE 1");
+    NS_TEST_ASSERT_MSG_EQ(matrix.GetSinrByImsi(5, 3), 1.0, "wrong SINR for UE 5 in cell 3");
+    NS_TEST_ASSERT_MSG_EQ(matrix.GetSinrByImsi(9, 3), 2.0, "wrong SINR for UE 9 in cell 3");
+    NS_TEST_ASSERT_MSG_EQ(matrix.GetSinrByImsi(9, 2), 4.0, "wrong SINR for UE 9 in cell 2");
+    NS_TEST_ASSERT_MSG_EQ(matrix.GetSinrByImsi(9, 4), 0.0, "unknown cell should give 0");
+
+    // a delta report only updates the UEs it contains
+    report.Clear();
+    report.Add(5, 6.0);
+    matrix.Update(3, report);
+    NS_TEST_ASSERT_MSG_EQ(matrix.GetSinrByImsi(5, 3), 6.0, "SINR not updated");
+    NS_TEST_ASSERT_MSG_EQ(matrix.GetSinrByImsi(9, 3), 2.0, "SINR not kept");
+
+    matrix.Clear();
+    NS_TEST_ASSERT_MSG_EQ(matrix.GetNumUes(), 0, "matrix should be empty after Clear");
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite for the UE SINR reports sent to the LTE coordinator.
+ */
+class LteUeSinrReportTestSuite : public TestSuite
+{
+  public:
+    LteUeSinrReportTestSuite();
+};
+
+LteUeSinrReportTestSuite::LteUeSinrReportTestSuite()
+    : TestSuite("lte-ue-sinr-report", Type::UNIT)
+{
+    AddTestCase(new LteUeSinrReportTestCase(), Duration::QUICK);
+    AddTestCase(new LteUeCellSinrMatrixTestCase(), Duration::QUICK);
+}
+
+static LteUeSinrReportTestSuite lteUeSinrReportTestSuite; ///< the test suite
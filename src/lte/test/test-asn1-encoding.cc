@@ -369,6 +369,10 @@ RrcConnectionRequestTestCase::DoRun(void)
     // Remove header
     RrcConnectionRequestHeader destination;
     packet->RemoveHeader(destination);
+    NS_TEST_ASSERT_MSG_EQ(packet->GetSize(), 0, "header not entirely deserialized");
+    NS_TEST_ASSERT_MSG_EQ(destination.GetSerializedSize(),
+                          source.GetSerializedSize(),
+                          "Different serialized size!");
 
     // Log destination info
     TestUtils::LogPacketInfo<RrcConnectionRequestHeader>(destination, "DESTINATION");
@@ -423,6 +427,10 @@ RrcConnectionSetupTestCase::DoRun(void)
     // remove header
     RrcConnectionSetupHeader destination;
     packet->RemoveHeader(destination);
+    NS_TEST_ASSERT_MSG_EQ(packet->GetSize(), 0, "header not entirely deserialized");
+    NS_TEST_ASSERT_MSG_EQ(destination.GetSerializedSize(),
+                          source.GetSerializedSize(),
+                          "Different serialized size!");
 
     // Log destination info
     TestUtils::LogPacketInfo<RrcConnectionSetupHeader>(destination, "DESTINATION");
@@ -480,6 +488,10 @@ RrcConnectionSetupCompleteTestCase::DoRun(void)
     // Remove header
     RrcConnectionSetupCompleteHeader destination;
     packet->RemoveHeader(destination);
+    NS_TEST_ASSERT_MSG_EQ(packet->GetSize(), 0, "header not entirely deserialized");
+    NS_TEST_ASSERT_MSG_EQ(destination.GetSerializedSize(),
+                          source.GetSerializedSize(),
+                          "Different serialized size!");
 
     // Log destination info
     TestUtils::LogPacketInfo<RrcConnectionSetupCompleteHeader>(destination, "DESTINATION");
@@ -534,6 +546,10 @@ RrcConnectionReconfigurationCompleteTestCase::DoRun(void)
     // remove header
     RrcConnectionReconfigurationCompleteHeader destination;
     packet->RemoveHeader(destination);
+    NS_TEST_ASSERT_MSG_EQ(packet->GetSize(), 0, "header not entirely deserialized");
+    NS_TEST_ASSERT_MSG_EQ(destination.GetSerializedSize(),
+                          source.GetSerializedSize(),
+                          "Different serialized size!");
 
     // Log destination info
     TestUtils::LogPacketInfo<RrcConnectionReconfigurationCompleteHeader>(destination,
@@ -707,6 +723,10 @@ RrcConnectionReconfigurationTestCase::DoRun(void)
     // remove header
     RrcConnectionReconfigurationHeader destination;
     packet->RemoveHeader(destination);
+    NS_TEST_ASSERT_MSG_EQ(packet->GetSize(), 0, "header not entirely deserialized");
+    NS_TEST_ASSERT_MSG_EQ(destination.GetSerializedSize(),
+                          source.GetSerializedSize(),
+                          "Different serialized size!");
 
     // Log destination info
     TestUtils::LogPacketInfo<RrcConnectionReconfigurationHeader>(destination, "DESTINATION");
@@ -851,6 +871,10 @@ HandoverPreparationInfoTestCase::DoRun(void)
     // remove header
     HandoverPreparationInfoHeader destination;
     packet->RemoveHeader(destination);
+    NS_TEST_ASSERT_MSG_EQ(packet->GetSize(), 0, "header not entirely deserialized");
+    NS_TEST_ASSERT_MSG_EQ(destination.GetSerializedSize(),
+                          source.GetSerializedSize(),
+                          "Different serialized size!");
 
     // Log destination info
     TestUtils::LogPacketInfo<HandoverPreparationInfoHeader>(destination, "DESTINATION");
@@ -939,6 +963,10 @@ RrcConnectionReestablishmentRequestTestCase::DoRun(void)
     // remove header
     RrcConnectionReestablishmentRequestHeader destination;
     packet->RemoveHeader(destination);
+    NS_TEST_ASSERT_MSG_EQ(packet->GetSize(), 0, "header not entirely deserialized");
+    NS_TEST_ASSERT_MSG_EQ(destination.GetSerializedSize(),
+                          source.GetSerializedSize(),
+                          "Different serialized size!");
 
     // Log destination info
     TestUtils::LogPacketInfo<RrcConnectionReestablishmentRequestHeader>(destination, "DESTINATION");
@@ -998,6 +1026,10 @@ RrcConnectionReestablishmentTestCase::DoRun(void)
     // remove header
     RrcConnectionReestablishmentHeader destination;
     packet->RemoveHeader(destination);
+    NS_TEST_ASSERT_MSG_EQ(packet->GetSize(), 0, "header not entirely deserialized");
+    NS_TEST_ASSERT_MSG_EQ(destination.GetSerializedSize(),
+                          source.GetSerializedSize(),
+                          "Different serialized size!");
 
     // Log destination info
     TestUtils::LogPacketInfo<RrcConnectionReestablishmentHeader>(destination, "DESTINATION");
@@ -1054,6 +1086,10 @@ RrcConnectionReestablishmentCompleteTestCase::DoRun(void)
     // remove header
     RrcConnectionReestablishmentCompleteHeader destination;
     packet->RemoveHeader(destination);
+    NS_TEST_ASSERT_MSG_EQ(packet->GetSize(), 0, "header not entirely deserialized");
+    NS_TEST_ASSERT_MSG_EQ(destination.GetSerializedSize(),
+                          source.GetSerializedSize(),
+                          "Different serialized size!");
 
     // Log destination info
     TestUtils::LogPacketInfo<RrcConnectionReestablishmentCompleteHeader>(destination,
@@ -1109,6 +1145,10 @@ RrcConnectionRejectTestCase::DoRun(void)
     // remove header
     RrcConnectionRejectHeader destination;
     packet->RemoveHeader(destination);
+    NS_TEST_ASSERT_MSG_EQ(packet->GetSize(), 0, "header not entirely deserialized");
+    NS_TEST_ASSERT_MSG_EQ(destination.GetSerializedSize(),
+                          source.GetSerializedSize(),
+                          "Different serialized size!");
 
     // Log destination info
     TestUtils::LogPacketInfo<RrcConnectionRejectHeader>(destination, "DESTINATION");
@@ -1180,6 +1220,10 @@ MeasurementReportTestCase::DoRun(void)
     // remove header
     MeasurementReportHeader destination;
     packet->RemoveHeader(destination);
+    NS_TEST_ASSERT_MSG_EQ(packet->GetSize(), 0, "header not entirely deserialized");
+    NS_TEST_ASSERT_MSG_EQ(destination.GetSerializedSize(),
+                          source.GetSerializedSize(),
+                          "Different serialized size!");
 
     // Log destination info
     TestUtils::LogPacketInfo<MeasurementReportHeader>(destination, "DESTINATION");
@@ -0,0 +1,195 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/mmwave-helper.h"
+#include "ns3/mmwave-point-to-point-epc-helper.h"
+#include "ns3/mobility-module.h"
+#include "ns3/mpi-interface.h"
+#include "ns3/point-to-point-helper.h"
+
+using namespace ns3;
+using namespace mmwave;
+
+/**
+ * Distributed version of mmwave-simple-epc.  The SGW/PGW, the MME and the
+ * remote host run on rank 0, and the eNBs, each with its UEs, are spread
+ * over the other ranks.  The S1 links between the ranks give the lookahead.
+ * Every rank builds the whole topology, but installs the applications only
+ * on its own nodes.  Each rank prints the bytes received by its sinks; their
+ * sum does not depend on the number of ranks, and a run with one rank gives
+ * the reference.
+ *
+ * Sample usage: mpirun -np 3 ./ns3.42-mmwave-distributed-epc-default --numEnb=2
+ */
+NS_LOG_COMPONENT_DEFINE("MmWaveDistributedEpc");
+
+int
+main(int argc, char* argv[])
+{
+    uint16_t numEnb = 2;
+    uint16_t numUePerEnb = 2;
+    double simTime = 1.0;
+    double interPacketInterval = 1000;
+    bool nullmsg = false;
+
+    CommandLine cmd;
+    cmd.AddValue("numEnb", "Number of eNBs", numEnb);
+    cmd.AddValue("numUePerEnb", "Number of UEs per eNB", numUePerEnb);
+    cmd.AddValue("simTime", "Total duration of the simulation [s]", simTime);
+    cmd.AddValue("interPacketInterval", "Inter-packet interval [us]", interPacketInterval);
+    cmd.AddValue("nullmsg", "Enable the null-message algorithm", nullmsg);
+    cmd.Parse(argc, argv);
+
+    GlobalValue::Bind("SimulatorImplementationType",
+                      StringValue(nullmsg ? "ns3::NullMessageSimulatorImpl"
+                                          : "ns3::DistributedSimulatorImpl"));
+    MpiInterface::Enable(&argc, &argv);
+    uint32_t systemId = MpiInterface::GetSystemId();
+    uint32_t systemCount = MpiInterface::GetSize();
+
+    Ptr<MmWaveHelper> mmwaveHelper = CreateObject<MmWaveHelper>();
+    mmwaveHelper->SetSchedulerType("ns3::MmWaveFlexTtiMacScheduler");
+    Ptr<MmWavePointToPointEpcHelper> epcHelper =
+        CreateObjectWithAttributes<MmWavePointToPointEpcHelper>("CoreSystemId", UintegerValue(0));
+    mmwaveHelper->SetEpcHelper(epcHelper);
+
+    Ptr<Node> pgw = epcHelper->GetPgwNode();
+
+    // Create a single RemoteHost, with the core
+    NodeContainer remoteHostContainer;
+    remoteHostContainer.Create(1, 0);
+    Ptr<Node> remoteHost = remoteHostContainer.Get(0);
+    InternetStackHelper internet;
+    internet.Install(remoteHostContainer);
+
+    PointToPointHelper p2ph;
+    p2ph.SetDeviceAttribute("DataRate", DataRateValue(DataRate("100Gb/s")));
+    p2ph.SetDeviceAttribute("Mtu", UintegerValue(1500));
+    p2ph.SetChannelAttribute("Delay", TimeValue(Seconds(0.010)));
+    NetDeviceContainer internetDevices = p2ph.Install(pgw, remoteHost);
+    Ipv4AddressHelper ipv4h;
+    ipv4h.SetBase("1.0.0.0", "255.0.0.0");
+    Ipv4InterfaceContainer internetIpIfaces = ipv4h.Assign(internetDevices);
+    Ipv4Address remoteHostAddr = internetIpIfaces.GetAddress(1);
+
+    Ipv4StaticRoutingHelper ipv4RoutingHelper;
+    Ptr<Ipv4StaticRouting> remoteHostStaticRouting =
+        ipv4RoutingHelper.GetStaticRouting(remoteHost->GetObject<Ipv4>());
+    remoteHostStaticRouting->AddNetworkRouteTo(Ipv4Address("7.0.0.0"), Ipv4Mask("255.0.0.0"), 1);
+
+    // Each eNB cluster runs on one rank, after the core rank when there
+    // is more than one rank
+    NodeContainer enbNodes;
+    std::vector<NodeContainer> ueClusters(numEnb);
+    NodeContainer ueNodes;
+    for (uint16_t i = 0; i < numEnb; ++i)
+    {
+        uint32_t rank = systemCount > 1 ? 1 + i % (systemCount - 1) : 0;
+        enbNodes.Add(CreateObject<Node>(rank));
+        ueClusters[i].Create(numUePerEnb, rank);
+        ueNodes.Add(ueClusters[i]);
+    }
+
+    MobilityHelper mobility;
+    Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+    for (uint16_t i = 0; i < numEnb; ++i)
+    {
+        // clusters 1 km apart, with the UEs at 50 m from their eNB
+        positionAlloc->Add(Vector(1000.0 * i, 0.0, 10.0));
+    }
+    for (uint16_t i = 0; i < numEnb; ++i)
+    {
+        for (uint16_t u = 0; u < numUePerEnb; ++u)
+        {
+            positionAlloc->Add(Vector(1000.0 * i + 50.0, 10.0 * u, 1.5));
+        }
+    }
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.Install(enbNodes);
+    mobility.Install(ueNodes);
+
+    NetDeviceContainer enbDevs = mmwaveHelper->InstallEnbDevice(enbNodes);
+    NetDeviceContainer ueDevs = mmwaveHelper->InstallUeDevice(ueNodes);
+
+    internet.Install(ueNodes);
+    Ipv4InterfaceContainer ueIpIface = epcHelper->AssignUeIpv4Address(ueDevs);
+    for (uint32_t u = 0; u < ueNodes.GetN(); ++u)
+    {
+        Ptr<Ipv4StaticRouting> ueStaticRouting =
+            ipv4RoutingHelper.GetStaticRouting(ueNodes.Get(u)->GetObject<Ipv4>());
+        ueStaticRouting->SetDefaultRoute(epcHelper->GetUeDefaultGatewayAddress(), 1);
+    }
+
+    for (uint16_t i = 0; i < numEnb; ++i)
+    {
+        for (uint16_t u = 0; u < numUePerEnb; ++u)
+        {
+            mmwaveHelper->AttachToEnbWithIndex(ueDevs.Get(i * numUePerEnb + u), enbDevs, i);
+        }
+    }
+
+    // Install the applications on the nodes of this rank only
+    uint16_t dlPort = 1234;
+    uint16_t ulPort = 2000;
+    ApplicationContainer serverApps;
+    ApplicationContainer clientApps;
+    for (uint32_t u = 0; u < ueNodes.GetN(); ++u)
+    {
+        ++ulPort;
+        Ptr<Node> ue = ueNodes.Get(u);
+        if (ue->GetSystemId() == systemId)
+        {
+            PacketSinkHelper dlSink("ns3::UdpSocketFactory",
+                                    InetSocketAddress(Ipv4Address::GetAny(), dlPort));
+            serverApps.Add(dlSink.Install(ue));
+            UdpClientHelper ulClient(remoteHostAddr, ulPort);
+            ulClient.SetAttribute("Interval", TimeValue(MicroSeconds(interPacketInterval)));
+            ulClient.SetAttribute("MaxPackets", UintegerValue(1000000));
+            clientApps.Add(ulClient.Install(ue));
+        }
+        if (remoteHost->GetSystemId() == systemId)
+        {
+            PacketSinkHelper ulSink("ns3::UdpSocketFactory",
+                                    InetSocketAddress(Ipv4Address::GetAny(), ulPort));
+            serverApps.Add(ulSink.Install(remoteHost));
+            UdpClientHelper dlClient(ueIpIface.GetAddress(u), dlPort);
+            dlClient.SetAttribute("Interval", TimeValue(MicroSeconds(interPacketInterval)));
+            dlClient.SetAttribute("MaxPackets", UintegerValue(1000000));
+            clientApps.Add(dlClient.Install(remoteHost));
+        }
+    }
+    serverApps.Start(Seconds(0.1));
+    clientApps.Start(Seconds(0.1));
+
+    Simulator::Stop(Seconds(simTime));
+    Simulator::Run();
+
+    uint64_t rxBytes = 0;
+    for (uint32_t i = 0; i < serverApps.GetN(); ++i)
+    {
+        rxBytes += DynamicCast<PacketSink>(serverApps.Get(i))->GetTotalRx();
+    }
+    std::cout << "rank " << systemId << ": " << serverApps.GetN() << " sinks, " << rxBytes
+              << " bytes received" << std::endl;
+
+    Simulator::Destroy();
+    MpiInterface::Disable();
+    return 0;
+}
@@ -0,0 +1,178 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "mmwave-enb-position-index.h"
+
+#include <ns3/assert.h>
+#include <ns3/mobility-model.h>
+#include <ns3/node.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ns3
+{
+
+namespace mmwave
+{
+
+MmWaveEnbPositionIndex::MmWaveEnbPositionIndex()
+    : m_minX(0),
+      m_minY(0),
+      m_cellSize(1),
+      m_numCellsX(0),
+      m_numCellsY(0)
+{
+}
+
+void
+MmWaveEnbPositionIndex::Build(const NetDeviceContainer& enbDevices)
+{
+    std::vector<Vector> positions;
+    positions.reserve(enbDevices.GetN());
+    for (uint32_t i = 0; i < enbDevices.GetN(); ++i)
+    {
+        Ptr<MobilityModel> mm = enbDevices.Get(i)->GetNode()->GetObject<MobilityModel>();
+        NS_ASSERT_MSG(mm, "MobilityModel needs to be set on the eNB nodes");
+        positions.push_back(mm->GetPosition());
+    }
+    Build(positions);
+}
+
+void
+MmWaveEnbPositionIndex::Build(const std::vector<Vector>& positions)
+{
+    m_positions = positions;
+    m_cellStart.clear();
+    m_cellEnbs.clear();
+    if (m_positions.empty())
+    {
+        m_numCellsX = 0;
+        m_numCellsY = 0;
+        return;
+    }
+
+    double maxX = m_positions[0].x;
+    double maxY = m_positions[0].y;
+    m_minX = maxX;
+    m_minY = maxY;
+    for (const auto& pos : m_positions)
+    {
+        m_minX = std::min(m_minX, pos.x);
+        m_minY = std::min(m_minY, pos.y);
+        maxX = std::max(maxX, pos.x);
+        maxY = std::max(maxY, pos.y);
+    }
+
+    // about one eNB per cell, also when the eNBs are deployed along a line
+    double sizeX = maxX - m_minX;
+    double sizeY = maxY - m_minY;
+    double n = m_positions.size();
+    m_cellSize = std::max(std::sqrt(sizeX * sizeY / n), std::max(sizeX, sizeY) / n);
+    if (!(m_cellSize > 0))
+    {
+        m_cellSize = 1;
+    }
+    m_numCellsX = static_cast<uint32_t>(sizeX / m_cellSize) + 1;
+    m_numCellsY = static_cast<uint32_t>(sizeY / m_cellSize) + 1;
+
+    // counting sort of the eNBs by cell, which keeps the eNBs of a cell in increasing order
+    std::vector<uint32_t> cells(m_positions.size());
+    m_cellStart.assign(m_numCellsX * m_numCellsY + 1, 0);
+    for (uint32_t i = 0; i < m_positions.size(); ++i)
+    {
+        cells[i] = GetCell(m_positions[i].y, m_minY, m_numCellsY) * m_numCellsX +
+                   GetCell(m_positions[i].x, m_minX, m_numCellsX);
+        ++m_cellStart[cells[i] + 1];
+    }
+    for (uint32_t c = 0; c < m_numCellsX * m_numCellsY; ++c)
+    {
+        m_cellStart[c + 1] += m_cellStart[c];
+    }
+    std::vector<uint32_t> next(m_cellStart.begin(), m_cellStart.end() - 1);
+    m_cellEnbs.resize(m_positions.size());
+    for (uint32_t i = 0; i < m_positions.size(); ++i)
+    {
+        m_cellEnbs[next[cells[i]]++] = i;
+    }
+}
+
+int32_t
+MmWaveEnbPositionIndex::GetCell(double coord, double min, uint32_t numCells) const
+{
+    double cell = std::floor((coord - min) / m_cellSize);
+    if (!(cell > 0)) // also catches NaN
+    {
+        return 0;
+    }
+    return static_cast<int32_t>(std::min<double>(cell, numCells - 1));
+}
+
+uint32_t
+MmWaveEnbPositionIndex::FindClosest(const Vector& position) const
+{
+    NS_ASSERT_MSG(!m_positions.empty(), "empty enb position index");
+
+    int32_t cx = GetCell(position.x, m_minX, m_numCellsX);
+    int32_t cy = GetCell(position.y, m_minY, m_numCellsY);
+    int32_t maxRing = std::max(m_numCellsX, m_numCellsY);
+
+    double minDistance = std::numeric_limits<double>::infinity();
+    uint32_t closest = m_positions.size();
+    for (int32_t r = 0; r <= maxRing; ++r)
+    {
+        for (int32_t y = std::max(cy - r, 0); y <= std::min<int32_t>(cy + r, m_numCellsY - 1);
+             ++y)
+        {
+            // only the border of the ring, the inner cells have already been visited
+            bool border = (y == cy - r || y == cy + r);
+            int32_t step = border ? 1 : 2 * r;
+            for (int32_t x = cx - r; x <= cx + r; x += step)
+            {
+                if (x < 0 || x >= static_cast<int32_t>(m_numCellsX))
+                {
+                    continue;
+                }
+                uint32_t c = y * m_numCellsX + x;
+                for (uint32_t k = m_cellStart[c]; k < m_cellStart[c + 1]; ++k)
+                {
+                    uint32_t i = m_cellEnbs[k];
+                    double distance = CalculateDistance(position, m_positions[i]);
+                    if (distance < minDistance || (distance == minDistance && i < closest))
+                    {
+                        minDistance = distance;
+                        closest = i;
+                    }
+                }
+            }
+        }
+
+        // the eNBs in the cells outside ring r are at least r cells away in
+        // the horizontal plane; one cell of margin absorbs the rounding of the
+        // cell assignment, so that ties are still broken by index
+        if (minDistance < (r - 1) * m_cellSize)
+        {
+            break;
+        }
+    }
+    NS_ASSERT(closest < m_positions.size());
+    return closest;
+}
+
+} // namespace mmwave
+
+} // namespace ns3
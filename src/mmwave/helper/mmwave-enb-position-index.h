@@ -0,0 +1,98 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MMWAVE_ENB_POSITION_INDEX_H
+#define MMWAVE_ENB_POSITION_INDEX_H
+
+#include <ns3/net-device-container.h>
+#include <ns3/vector.h>
+
+#include <stdint.h>
+#include <vector>
+
+namespace ns3
+{
+
+namespace mmwave
+{
+
+/**
+ * Spatial index of the eNB positions, used by the MmWaveHelper to find the
+ * closest eNB of a large number of UEs.
+ *
+ * The positions are bucketed on a uniform grid in the horizontal plane, with
+ * about one eNB per cell, and a query visits the rings of cells around the
+ * UE until no unvisited cell can contain a closer eNB.  The result is the
+ * same as a linear scan with the 3D distance: the closest eNB, the one with
+ * the lowest index in case of ties.
+ */
+class MmWaveEnbPositionIndex
+{
+  public:
+    MmWaveEnbPositionIndex();
+
+    /**
+     * Build the index of the given positions
+     *
+     * \param positions the positions, the index of an eNB is its position in the vector
+     */
+    void Build(const std::vector<Vector>& positions);
+
+    /**
+     * Build the index of the positions of the nodes of the devices
+     *
+     * \param enbDevices the eNB devices, whose nodes must have a MobilityModel
+     */
+    void Build(const NetDeviceContainer& enbDevices);
+
+    /**
+     * \returns the number of eNBs in the index
+     */
+    uint32_t GetN() const
+    {
+        return m_positions.size();
+    }
+
+    /**
+     * \param position the position of the UE
+     * \returns the index of the closest eNB
+     */
+    uint32_t FindClosest(const Vector& position) const;
+
+  private:
+    /**
+     * \param coord the coordinate
+     * \param min the minimum coordinate of the grid
+     * \param numCells the number of cells along the axis
+     * \returns the cell containing the coordinate, clamped to the grid
+     */
+    int32_t GetCell(double coord, double min, uint32_t numCells) const;
+
+    std::vector<Vector> m_positions;   ///< the eNB positions
+    double m_minX;                     ///< minimum x of the grid
+    double m_minY;                     ///< minimum y of the grid
+    double m_cellSize;                 ///< side of the grid cells
+    uint32_t m_numCellsX;              ///< number of cells along x
+    uint32_t m_numCellsY;              ///< number of cells along y
+    std::vector<uint32_t> m_cellStart; ///< first entry of each cell in m_cellEnbs
+    std::vector<uint32_t> m_cellEnbs;  ///< eNB indexes, grouped by cell in increasing order
+};
+
+} // namespace mmwave
+
+} // namespace ns3
+
+#endif // MMWAVE_ENB_POSITION_INDEX_H
@@ -34,6 +34,8 @@
 
 #include "mmwave-helper.h"
 
+#include "mmwave-enb-position-index.h"
+
 #include <ns3/abort.h>
 #include <ns3/cc-helper.h>
 #include <ns3/channel-condition-model.h>
@@ -53,6 +55,7 @@
 #include <ns3/mmwave-lte-rrc-protocol-real.h>
 #include <ns3/mmwave-propagation-loss-model.h>
 #include <ns3/mmwave-rrc-protocol-ideal.h>
+#include <ns3/mmwave-spectrum-transmit-filter.h>
 #include <ns3/multi-model-spectrum-channel.h>
 #include <ns3/object-map.h>
 #include <ns3/pointer.h>
@@ -62,6 +65,7 @@
 #include <ns3/uinteger.h>
 #include <ns3/uniform-planar-array.h>
 
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -83,7 +87,9 @@ MmWaveHelper::MmWaveHelper(void)
       m_harqEnabled(false),
       m_rlcAmEnabled(false),
       m_snrTest(false),
-      m_useIdealRrc(false)
+      m_useIdealRrc(false),
+      m_useCodebookBeamforming(false),
+      m_enbErrorModelChecked(false)
 {
     NS_LOG_FUNCTION(this);
     m_channelFactory.SetTypeId(MultiModelSpectrumChannel::GetTypeId());
@@ -208,6 +214,17 @@ MmWaveHelper::GetTypeId(void)
                           BooleanValue(false),
                           MakeBooleanAccessor(&MmWaveHelper::m_useIdealRrc),
                           MakeBooleanChecker())
+            .AddAttribute("UseSpectrumTransmitFilter",
+                          "If true, the mmWave channels do not deliver to a device the signals "
+                          "that it would neglect (e.g., UE to UE signals, or control frames "
+                          "of other cells), and do not compute their propagation loss. The "
+                          "channels of these pairs of devices are then not generated, so that "
+                          "the random numbers drawn, and thus the results, change when the "
+                          "channels or their conditions are generated on demand; the pathloss "
+                          "and gain traces do not fire for these pairs either.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&MmWaveHelper::m_useSpectrumTransmitFilter),
+                          MakeBooleanChecker())
             .AddAttribute("BasicCellId",
                           "The next value will be the first cellId",
                           UintegerValue(1),
@@ -277,6 +294,7 @@ MmWaveHelper::DoDispose(void)
 {
     NS_LOG_FUNCTION(this);
     m_channel.clear();
+    m_ccInstallContext.clear();
     m_componentCarrierPhyParams.clear();
     m_lteComponentCarrierPhyParams.clear();
     Object::DoDispose();
@@ -286,6 +304,7 @@ void
 MmWaveHelper::DoInitialize()
 {
     NS_LOG_FUNCTION(this);
+    auto start = std::chrono::steady_clock::now();
 
     // cc initialization
     // if useCa=false and SetCcPhyParams() has not been called, setup a default CC.
@@ -332,6 +351,7 @@ MmWaveHelper::DoInitialize()
 
     m_cnStats = 0; // core network stats calculator
 
+    AddSetupTime("Initialize", start, 0);
     Object::DoInitialize();
 }
 
@@ -347,6 +367,10 @@ MmWaveHelper::MmWaveChannelModelInitialization(void)
          ++it)
     {
         Ptr<SpectrumChannel> channel = m_channelFactory.Create<SpectrumChannel>();
+        if (m_useSpectrumTransmitFilter)
+        {
+            channel->AddSpectrumTransmitFilter(CreateObject<MmWaveSpectrumTransmitFilter>());
+        }
         Ptr<MmWavePhyMacCommon> phyMacCommon =
             m_componentCarrierPhyParams.at(it->first).GetConfigurationParameters();
 
@@ -757,6 +781,8 @@ MmWaveHelper::InstallUeDevice(NodeContainer c)
 {
     NS_LOG_FUNCTION(this);
     Initialize(); // Run DoInitialize (), if necessary
+    auto start = std::chrono::steady_clock::now();
+    PrepareCcInstallContext();
     NetDeviceContainer devices;
     for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i)
     {
@@ -765,6 +791,7 @@ MmWaveHelper::InstallUeDevice(NodeContainer c)
         device->SetAddress(Mac64Address::Allocate());
         devices.Add(device);
     }
+    AddSetupTime("InstallUeDevice", start, devices.GetN());
     return devices;
 }
 
@@ -773,6 +800,8 @@ MmWaveHelper::InstallMcUeDevice(NodeContainer c)
 {
     NS_LOG_FUNCTION(this);
     Initialize(); // Run DoInitialize (), if necessary
+    auto start = std::chrono::steady_clock::now();
+    PrepareCcInstallContext();
     NetDeviceContainer devices;
     for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i)
     {
@@ -781,6 +810,7 @@ MmWaveHelper::InstallMcUeDevice(NodeContainer c)
         device->SetAddress(Mac64Address::Allocate());
         devices.Add(device);
     }
+    AddSetupTime("InstallMcUeDevice", start, devices.GetN());
     return devices;
 }
 
@@ -789,6 +819,7 @@ MmWaveHelper::InstallInterRatHoCapableUeDevice(NodeContainer c)
 {
     NS_LOG_FUNCTION(this);
     Initialize(); // Run DoInitialize (), if necessary
+    auto start = std::chrono::steady_clock::now();
     NetDeviceContainer devices;
     for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i)
     {
@@ -797,6 +828,7 @@ MmWaveHelper::InstallInterRatHoCapableUeDevice(NodeContainer c)
         device->SetAddress(Mac64Address::Allocate());
         devices.Add(device);
     }
+    AddSetupTime("InstallInterRatHoCapableUeDevice", start, devices.GetN());
     return devices;
 }
 
@@ -805,6 +837,9 @@ MmWaveHelper::InstallEnbDevice(NodeContainer c)
 {
     NS_LOG_FUNCTION(this);
     Initialize(); // Run DoInitialize (), if necessary
+    auto start = std::chrono::steady_clock::now();
+    PrepareCcInstallContext();
+    m_enbErrorModelChecked = false;
     NetDeviceContainer devices;
     for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i)
     {
@@ -813,6 +848,7 @@ MmWaveHelper::InstallEnbDevice(NodeContainer c)
         device->SetAddress(Mac64Address::Allocate());
         devices.Add(device);
     }
+    AddSetupTime("InstallEnbDevice", start, devices.GetN());
     return devices;
 }
 
@@ -821,6 +857,7 @@ MmWaveHelper::InstallLteEnbDevice(NodeContainer c)
 {
     NS_LOG_FUNCTION(this);
     Initialize(); // Run DoInitialize (), if necessary
+    auto start = std::chrono::steady_clock::now();
     NetDeviceContainer devices;
     for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i)
     {
@@ -829,9 +866,88 @@ MmWaveHelper::InstallLteEnbDevice(NodeContainer c)
         device->SetAddress(Mac64Address::Allocate());
         devices.Add(device);
     }
+    AddSetupTime("InstallLteEnbDevice", start, devices.GetN());
     return devices;
 }
 
+void
+MmWaveHelper::PrepareCcInstallContext()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_ccInstallContext.clear();
+    for (const auto& ccParams : m_componentCarrierPhyParams)
+    {
+        CcInstallContext context;
+        context.channel = m_channel.at(ccParams.first);
+
+        // initialize the 3GPP channel model
+        Ptr<ThreeGppSpectrumPropagationLossModel> threeGppSplm;
+        if (m_spectrumPropagationLossModelType == "ns3::ThreeGppSpectrumPropagationLossModel")
+        {
+            context.pSplm = context.channel->GetPhasedArraySpectrumPropagationLossModel();
+            threeGppSplm = DynamicCast<ThreeGppSpectrumPropagationLossModel>(context.pSplm);
+        }
+        else
+        {
+            context.splm = context.channel->GetSpectrumPropagationLossModel();
+            threeGppSplm = DynamicCast<ThreeGppSpectrumPropagationLossModel>(context.splm);
+        }
+        context.channelModel = threeGppSplm->GetChannelModel();
+
+        if (!m_pathlossModelType.empty())
+        {
+            context.pathlossModel =
+                m_pathlossModel.at(ccParams.first)->GetObject<PropagationLossModel>();
+        }
+        m_ccInstallContext[ccParams.first] = context;
+    }
+
+    m_useCodebookBeamforming =
+        (m_bfModelFactory.GetTypeId() == MmWaveCodebookBeamforming::GetTypeId());
+}
+
+void
+MmWaveHelper::AddSetupTime(const std::string& stage,
+                           std::chrono::steady_clock::time_point start,
+                           uint32_t devices)
+{
+    double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    NS_LOG_INFO(stage << ": " << devices << " devices in " << seconds << " s");
+
+    auto it = m_setupTimes.insert(std::make_pair(stage, SetupTime{0, 0, 0.0})).first;
+    it->second.calls++;
+    it->second.devices += devices;
+    it->second.seconds += seconds;
+}
+
+void
+MmWaveHelper::PrintSetupTimes(std::ostream& os) const
+{
+    double total = 0;
+    for (const auto& stage : m_setupTimes)
+    {
+        total += stage.second.seconds;
+    }
+    for (const auto& stage : m_setupTimes)
+    {
+        os << std::left << std::setw(34) << stage.first << std::right << std::setw(6)
+           << stage.second.calls << " calls " << std::setw(8) << stage.second.devices
+           << " devices " << std::fixed << std::setprecision(3) << std::setw(10)
+           << stage.second.seconds * 1e3 << " ms";
+        if (stage.second.devices > 0)
+        {
+            os << std::setw(10) << stage.second.seconds * 1e6 / stage.second.devices
+               << " us/device";
+        }
+        os << std::defaultfloat << std::endl;
+    }
+    os << std::left << std::setw(34) << "Total" << std::right << std::fixed
+       << std::setprecision(3) << std::setw(38) << total * 1e3 << " ms" << std::defaultfloat
+       << std::endl;
+}
+
 Ptr<NetDevice>
 MmWaveHelper::InstallSingleMcUeDevice(Ptr<Node> n)
 {
@@ -922,8 +1038,9 @@ MmWaveHelper::InstallSingleMcUeDevice(Ptr<Node> n)
           pCtrl->AddCallback (MakeCallback (&LteUePhy::GenerateCtrlCqiReport, phy));
         }*/
 
-        ulPhy->SetChannel(m_channel.at(it->first));
-        dlPhy->SetChannel(m_channel.at(it->first));
+        const CcInstallContext& context = m_ccInstallContext.at(it->first);
+        ulPhy->SetChannel(context.channel);
+        dlPhy->SetChannel(context.channel);
 
         Ptr<MobilityModel> mm = n->GetObject<MobilityModel>();
         NS_ASSERT_MSG(
@@ -935,29 +1052,10 @@ MmWaveHelper::InstallSingleMcUeDevice(Ptr<Node> n)
         Ptr<PhasedArrayModel> antenna = m_uePhasedArrayModelFactory.Create<PhasedArrayModel>();
         NS_ASSERT_MSG(antenna, "error in creating the AntennaModel object");
 
-        // initialize the 3GPP channel model
-
-        [[maybe_unused]] Ptr<SpectrumPropagationLossModel> splm;
-        [[maybe_unused]] Ptr<PhasedArraySpectrumPropagationLossModel> pSplm;
-
-        Ptr<ThreeGppSpectrumPropagationLossModel> threeGppSplm;
-
-        if (m_spectrumPropagationLossModelType == "ns3::ThreeGppSpectrumPropagationLossModel")
-        {
-            pSplm = m_channel.at(it->first)->GetPhasedArraySpectrumPropagationLossModel();
-            threeGppSplm = DynamicCast<ThreeGppSpectrumPropagationLossModel>(pSplm);
-        }
-        else
-        {
-            splm = m_channel.at(it->first)->GetSpectrumPropagationLossModel();
-            threeGppSplm = DynamicCast<ThreeGppSpectrumPropagationLossModel>(splm);
-        }
-
-        auto channelModel = threeGppSplm->GetChannelModel();
         Ptr<MmWaveBeamformingModel> bfModel = m_bfModelFactory.Create<MmWaveBeamformingModel>();
-        bfModel->SetAttributeFailSafe("Device", PointerValue(device));
-        bfModel->SetAttributeFailSafe("Antenna", PointerValue(antenna));
-        bfModel->SetAttributeFailSafe("ChannelModel", PointerValue(channelModel));
+        bfModel->SetDevice(device);
+        bfModel->SetAntenna(antenna);
+        bfModel->SetAttributeFailSafe("ChannelModel", PointerValue(context.channelModel));
         dlPhy->SetBeamformingModel(bfModel);
 
         it->second->SetPhy(phy);
@@ -1143,6 +1241,8 @@ MmWaveHelper::InstallSingleMcUeDevice(Ptr<Node> n)
             MakeCallback(&MmWaveUePhy::PhyDataPacketReceived, ccPhy));
         ccPhy->GetDlSpectrumPhy()->SetPhyRxCtrlEndOkCallback(
             MakeCallback(&MmWaveUePhy::ReceiveControlMessageList, ccPhy));
+        ccPhy->GetDlSpectrumPhy()->SetPhyRxCtrlBundleEndOkCallback(
+            MakeCallback(&MmWaveUePhy::ReceiveControlMessageBundle, ccPhy));
         // ccPhy->GetDlSpectrumPhy ()->SetLtePhyRxPssCallback (MakeCallback (&LteUePhy::ReceivePss,
         // ccPhy)); ccPhy->GetDlSpectrumPhy ()->SetLtePhyDlHarqFeedbackCallback (MakeCallback
         // (&LteUePhy::ReceiveLteDlHarqFeedback, ccPhy)); this is done before
@@ -1579,8 +1679,9 @@ MmWaveHelper::InstallSingleUeDevice(Ptr<Node> n)
           pCtrl->AddCallback (MakeCallback (&LteUePhy::GenerateCtrlCqiReport, phy));
         }*/
 
-        ulPhy->SetChannel(m_channel.at(it->first));
-        dlPhy->SetChannel(m_channel.at(it->first));
+        const CcInstallContext& context = m_ccInstallContext.at(it->first);
+        ulPhy->SetChannel(context.channel);
+        dlPhy->SetChannel(context.channel);
 
         Ptr<MobilityModel> mm = n->GetObject<MobilityModel>();
         NS_ASSERT_MSG(
@@ -1592,44 +1693,27 @@ MmWaveHelper::InstallSingleUeDevice(Ptr<Node> n)
         Ptr<PhasedArrayModel> antenna = m_uePhasedArrayModelFactory.Create<PhasedArrayModel>();
         NS_ASSERT_MSG(antenna, "error in creating the AntennaModel object");
 
-        // initialize the 3GPP channel model
-
-        [[maybe_unused]] Ptr<SpectrumPropagationLossModel> splm;
-        [[maybe_unused]] Ptr<PhasedArraySpectrumPropagationLossModel> pSplm;
-
-        Ptr<ThreeGppSpectrumPropagationLossModel> threeGppSplm;
-
-        if (m_spectrumPropagationLossModelType == "ns3::ThreeGppSpectrumPropagationLossModel")
-        {
-            pSplm = m_channel.at(it->first)->GetPhasedArraySpectrumPropagationLossModel();
-            threeGppSplm = DynamicCast<ThreeGppSpectrumPropagationLossModel>(pSplm);
-        }
-        else
-        {
-            splm = m_channel.at(it->first)->GetSpectrumPropagationLossModel();
-            threeGppSplm = DynamicCast<ThreeGppSpectrumPropagationLossModel>(splm);
-        }
-
-        auto channelModel = threeGppSplm->GetChannelModel();
 
+        // the channel objects are shared by the devices of the CC, see PrepareCcInstallContext
         Ptr<MmWaveBeamformingModel> bfModel = m_bfModelFactory.Create<MmWaveBeamformingModel>();
-        bfModel->SetAttributeFailSafe("Device", PointerValue(device));
-        bfModel->SetAttributeFailSafe("Antenna", PointerValue(antenna));
-        bfModel->SetAttributeFailSafe("ChannelModel", PointerValue(channelModel));
+        bfModel->SetDevice(device);
+        bfModel->SetAntenna(antenna);
+        bfModel->SetAttributeFailSafe("ChannelModel", PointerValue(context.channelModel));
 
-        if (pSplm)
+        if (context.pSplm)
         {
             bfModel->SetAttributeFailSafe("PhasedArraySpectrumPropagationLossModel",
-                                          PointerValue(pSplm));
+                                          PointerValue(context.pSplm));
         }
-        else if (splm)
+        else if (context.splm)
         {
-            bfModel->SetAttributeFailSafe("SpectrumPropagationLossModel", PointerValue(splm));
+            bfModel->SetAttributeFailSafe("SpectrumPropagationLossModel",
+                                          PointerValue(context.splm));
         }
 
         bfModel->SetAttributeFailSafe("MmWavePhyMacCommon",
                                       PointerValue(it->second->GetConfigurationParameters()));
-        if (m_bfModelFactory.GetTypeId() == MmWaveCodebookBeamforming::GetTypeId())
+        if (m_useCodebookBeamforming)
         {
             DynamicCast<MmWaveCodebookBeamforming>(bfModel)->SetBeamformingCodebookFactory(
                 m_ueBeamformingCodebookFactory);
@@ -1737,6 +1821,8 @@ MmWaveHelper::InstallSingleUeDevice(Ptr<Node> n)
             MakeCallback(&MmWaveUePhy::PhyDataPacketReceived, ccPhy));
         ccPhy->GetDlSpectrumPhy()->SetPhyRxCtrlEndOkCallback(
             MakeCallback(&MmWaveUePhy::ReceiveControlMessageList, ccPhy));
+        ccPhy->GetDlSpectrumPhy()->SetPhyRxCtrlBundleEndOkCallback(
+            MakeCallback(&MmWaveUePhy::ReceiveControlMessageBundle, ccPhy));
         // ccPhy->GetDlSpectrumPhy ()->SetLtePhyRxPssCallback (MakeCallback (&LteUePhy::ReceivePss,
         // ccPhy)); ccPhy->GetDlSpectrumPhy ()->SetLtePhyDlHarqFeedbackCallback (MakeCallback
         // (&LteUePhy::ReceiveLteDlHarqFeedback, ccPhy)); this is done before
@@ -1815,8 +1901,9 @@ MmWaveHelper::InstallSingleEnbDevice(Ptr<Node> n)
 
         phy->SetConfigurationParameters(ccEnb->GetConfigurationParameters());
 
-        ulPhy->SetChannel(m_channel.at(it->first));
-        dlPhy->SetChannel(m_channel.at(it->first));
+        const CcInstallContext& context = m_ccInstallContext.at(it->first);
+        ulPhy->SetChannel(context.channel);
+        dlPhy->SetChannel(context.channel);
 
         Ptr<MobilityModel> mm = n->GetObject<MobilityModel>();
         NS_ASSERT_MSG(mm,
@@ -1826,22 +1913,18 @@ MmWaveHelper::InstallSingleEnbDevice(Ptr<Node> n)
         dlPhy->SetMobility(mm);
 
         // hack to allow periodic computation of SINR at the eNB, without pilots
-        if (m_spectrumPropagationLossModelType == "ns3::ThreeGppSpectrumPropagationLossModel")
+        if (context.pSplm)
         {
-            phy->AddPhasedArraySpectrumPropagationLossModel(
-                m_channel.at(it->first)->GetPhasedArraySpectrumPropagationLossModel());
+            phy->AddPhasedArraySpectrumPropagationLossModel(context.pSplm);
         }
         else
         {
-            phy->AddSpectrumPropagationLossModel(
-                m_channel.at(it->first)->GetSpectrumPropagationLossModel());
+            phy->AddSpectrumPropagationLossModel(context.splm);
         }
 
-        if (!m_pathlossModelType.empty())
+        if (context.pathlossModel)
         {
-            Ptr<PropagationLossModel> splm =
-                m_pathlossModel.at(it->first)->GetObject<PropagationLossModel>();
-            phy->AddPropagationLossModel(splm);
+            phy->AddPropagationLossModel(context.pathlossModel);
         }
         else
         {
@@ -1852,43 +1935,26 @@ MmWaveHelper::InstallSingleEnbDevice(Ptr<Node> n)
         Ptr<PhasedArrayModel> antenna = m_enbPhasedArrayModelFactory.Create<PhasedArrayModel>();
         NS_ASSERT_MSG(antenna, "error in creating the AntennaModel object");
 
-        // initialize the 3GPP channel model
-        [[maybe_unused]] Ptr<SpectrumPropagationLossModel> splm;
-        [[maybe_unused]] Ptr<PhasedArraySpectrumPropagationLossModel> pSplm;
-
-        Ptr<ThreeGppSpectrumPropagationLossModel> threeGppSplm;
-
-        if (m_spectrumPropagationLossModelType == "ns3::ThreeGppSpectrumPropagationLossModel")
-        {
-            pSplm = m_channel.at(it->first)->GetPhasedArraySpectrumPropagationLossModel();
-            threeGppSplm = DynamicCast<ThreeGppSpectrumPropagationLossModel>(pSplm);
-        }
-        else
-        {
-            splm = m_channel.at(it->first)->GetSpectrumPropagationLossModel();
-            threeGppSplm = DynamicCast<ThreeGppSpectrumPropagationLossModel>(splm);
-        }
-
-        auto channelModel = threeGppSplm->GetChannelModel();
-
+        // the channel objects are shared by the devices of the CC, see PrepareCcInstallContext
         Ptr<MmWaveBeamformingModel> bfModel = m_bfModelFactory.Create<MmWaveBeamformingModel>();
-        bfModel->SetAttributeFailSafe("Device", PointerValue(device));
-        bfModel->SetAttributeFailSafe("Antenna", PointerValue(antenna));
-        bfModel->SetAttributeFailSafe("ChannelModel", PointerValue(channelModel));
+        bfModel->SetDevice(device);
+        bfModel->SetAntenna(antenna);
+        bfModel->SetAttributeFailSafe("ChannelModel", PointerValue(context.channelModel));
 
-        if (pSplm)
+        if (context.pSplm)
         {
             bfModel->SetAttributeFailSafe("PhasedArraySpectrumPropagationLossModel",
-                                          PointerValue(pSplm));
+                                          PointerValue(context.pSplm));
         }
-        else if (splm)
+        else if (context.splm)
         {
-            bfModel->SetAttributeFailSafe("SpectrumPropagationLossModel", PointerValue(splm));
+            bfModel->SetAttributeFailSafe("SpectrumPropagationLossModel",
+                                          PointerValue(context.splm));
         }
 
         bfModel->SetAttributeFailSafe("MmWavePhyMacCommon",
                                       PointerValue(it->second->GetConfigurationParameters()));
-        if (m_bfModelFactory.GetTypeId() == MmWaveCodebookBeamforming::GetTypeId())
+        if (m_useCodebookBeamforming)
         {
             DynamicCast<MmWaveCodebookBeamforming>(bfModel)->SetBeamformingCodebookFactory(
                 m_enbBeamformingCodebookFactory);
@@ -1925,17 +1991,23 @@ MmWaveHelper::InstallSingleEnbDevice(Ptr<Node> n)
         ccEnb->SetPhy(phy);
         it->second->SetAntenna(antenna);
 
-        // Check that the error model has been set in a consistent manner
-        TypeIdValue dlPhySpectrumEm, ulPhySpectrumEm, tempAmcEm;
-        dlPhy->GetAttribute("ErrorModelType", dlPhySpectrumEm);
-        ulPhy->GetAttribute("ErrorModelType", ulPhySpectrumEm);
-        Ptr<MmWaveAmc> tempAmc = CreateObject<MmWaveAmc>(ccEnb->GetConfigurationParameters());
-        tempAmc->GetAttribute("ErrorModelType", tempAmcEm);
-        NS_ASSERT_MSG(
-            (dlPhySpectrumEm.Get() == ulPhySpectrumEm.Get()) &&
-                (dlPhySpectrumEm.Get() == tempAmcEm.Get()),
-            "The same error model must be set in the MmWaveSpectrumPhy and MmWaveAmc classes!");
+        // Check that the error model has been set in a consistent manner. The
+        // attributes come from the defaults, so checking the first eNB of the
+        // batch is enough
+        if (!m_enbErrorModelChecked)
+        {
+            TypeIdValue dlPhySpectrumEm, ulPhySpectrumEm, tempAmcEm;
+            dlPhy->GetAttribute("ErrorModelType", dlPhySpectrumEm);
+            ulPhy->GetAttribute("ErrorModelType", ulPhySpectrumEm);
+            Ptr<MmWaveAmc> tempAmc = CreateObject<MmWaveAmc>(ccEnb->GetConfigurationParameters());
+            tempAmc->GetAttribute("ErrorModelType", tempAmcEm);
+            NS_ASSERT_MSG(
+                (dlPhySpectrumEm.Get() == ulPhySpectrumEm.Get()) &&
+                    (dlPhySpectrumEm.Get() == tempAmcEm.Get()),
+                "The same error model must be set in the MmWaveSpectrumPhy and MmWaveAmc classes!");
+        }
     }
+    m_enbErrorModelChecked = true;
 
     Ptr<LteEnbRrc> rrc = CreateObject<LteEnbRrc>();
     Ptr<LteEnbComponentCarrierManager> ccmEnbManager =
@@ -2450,11 +2522,15 @@ void
 MmWaveHelper::AttachToClosestEnb(NetDeviceContainer ueDevices, NetDeviceContainer enbDevices)
 {
     NS_LOG_FUNCTION(this);
+    auto start = std::chrono::steady_clock::now();
 
+    MmWaveEnbPositionIndex enbIndex;
+    enbIndex.Build(enbDevices);
     for (NetDeviceContainer::Iterator i = ueDevices.Begin(); i != ueDevices.End(); i++)
     {
-        AttachToClosestEnb(*i, enbDevices);
+        AttachToClosestEnb(*i, enbDevices, enbIndex);
     }
+    AddSetupTime("AttachToClosestEnb", start, ueDevices.GetN());
 }
 
 // for MC devices
@@ -2464,11 +2540,15 @@ MmWaveHelper::AttachToClosestEnb(NetDeviceContainer ueDevices,
                                  NetDeviceContainer lteEnbDevices)
 {
     NS_LOG_FUNCTION(this);
+    auto start = std::chrono::steady_clock::now();
 
+    MmWaveEnbPositionIndex lteEnbIndex;
+    lteEnbIndex.Build(lteEnbDevices);
     for (NetDeviceContainer::Iterator i = ueDevices.Begin(); i != ueDevices.End(); i++)
     {
-        AttachMcToClosestEnb(*i, mmWaveEnbDevices, lteEnbDevices);
+        AttachMcToClosestEnb(*i, mmWaveEnbDevices, lteEnbDevices, lteEnbIndex);
     }
+    AddSetupTime("AttachMcToClosestEnb", start, ueDevices.GetN());
 }
 
 // for InterRatHoCapable devices
@@ -2506,35 +2586,25 @@ MmWaveHelper::AttachIrToClosestEnb(NetDeviceContainer ueDevices,
 }
 
 void
-MmWaveHelper::AttachToClosestEnb(Ptr<NetDevice> ueDevice, NetDeviceContainer enbDevices)
+MmWaveHelper::AttachToClosestEnb(Ptr<NetDevice> ueDevice,
+                                 const NetDeviceContainer& enbDevices,
+                                 const MmWaveEnbPositionIndex& enbIndex)
 {
     NS_LOG_FUNCTION(this << ueDevice << enbDevices.GetN());
     NS_ASSERT_MSG(enbDevices.GetN() > 0, "empty enb device container");
     Vector uePos = ueDevice->GetNode()->GetObject<MobilityModel>()->GetPosition();
 
     // find the closest BS
-    double minDistance = std::numeric_limits<double>::infinity();
-    int closestEnbIndex = -1;
-    for (uint32_t i = 0; i < enbDevices.GetN(); ++i)
-    {
-        Vector enbPos = enbDevices.Get(i)->GetNode()->GetObject<MobilityModel>()->GetPosition();
-        double distance = CalculateDistance(uePos, enbPos);
-
-        if (distance < minDistance)
-        {
-            minDistance = distance;
-            closestEnbIndex = i;
-        }
-    }
-    NS_ASSERT_MSG(closestEnbIndex >= 0, "Closest eNB not found!");
+    uint32_t closestEnbIndex = enbIndex.FindClosest(uePos);
 
     AttachToEnbWithIndex(ueDevice, enbDevices, closestEnbIndex);
 }
 
 void
 MmWaveHelper::AttachMcToClosestEnb(Ptr<NetDevice> ueDevice,
-                                   NetDeviceContainer mmWaveEnbDevices,
-                                   NetDeviceContainer lteEnbDevices)
+                                   const NetDeviceContainer& mmWaveEnbDevices,
+                                   const NetDeviceContainer& lteEnbDevices,
+                                   const MmWaveEnbPositionIndex& lteEnbIndex)
 {
     NS_LOG_FUNCTION(this);
     Ptr<McUeNetDevice> mcDevice = ueDevice->GetObject<McUeNetDevice>();
@@ -2544,22 +2614,12 @@ MmWaveHelper::AttachMcToClosestEnb(Ptr<NetDevice> ueDevice,
 
     // Find the closest LTE station
     Vector uepos = ueDevice->GetNode()->GetObject<MobilityModel>()->GetPosition();
-    double minDistance = std::numeric_limits<double>::infinity();
-    Ptr<NetDevice> lteClosestEnbDevice;
-    for (NetDeviceContainer::Iterator i = lteEnbDevices.Begin(); i != lteEnbDevices.End(); ++i)
-    {
-        Vector enbpos = (*i)->GetNode()->GetObject<MobilityModel>()->GetPosition();
-        double distance = CalculateDistance(uepos, enbpos);
-        if (distance < minDistance)
-        {
-            minDistance = distance;
-            lteClosestEnbDevice = *i;
-        }
-    }
+    Ptr<NetDevice> lteClosestEnbDevice = lteEnbDevices.Get(lteEnbIndex.FindClosest(uepos));
     NS_ASSERT(lteClosestEnbDevice);
     NS_ASSERT(lteClosestEnbDevice->GetObject<LteEnbNetDevice>()); // stop if it is not an LTE eNB
 
     // Necessary operation to connect MmWave UE to eNB at lower layers
+    std::map<uint8_t, Ptr<MmWaveComponentCarrierUe>> ueCcMap = mcDevice->GetMmWaveCcMap();
     for (NetDeviceContainer::Iterator i = mmWaveEnbDevices.Begin(); i != mmWaveEnbDevices.End();
          ++i)
     {
@@ -2574,8 +2634,6 @@ MmWaveHelper::AttachMcToClosestEnb(Ptr<NetDevice> ueDevice,
             Ptr<MmWavePhyMacCommon> configParams = ccEnb->GetPhy()->GetConfigurationParameters();
             ccEnb->GetPhy()->AddUePhy(mcDevice->GetImsi(), ueDevice);
             // register MmWave eNBs informations in the MmWaveUePhy
-
-            std::map<uint8_t, Ptr<MmWaveComponentCarrierUe>> ueCcMap = mcDevice->GetMmWaveCcMap();
             for (auto itUe = ueCcMap.begin(); itUe != ueCcMap.end(); ++itUe)
             {
                 itUe->second->GetPhy()->RegisterOtherEnb(mmWaveCellId, configParams, mmWaveEnb);
@@ -2694,7 +2752,7 @@ MmWaveHelper::AttachIrToClosestEnb(Ptr<NetDevice> ueDevice,
 
 void
 MmWaveHelper::AttachToEnbWithIndex(Ptr<NetDevice> ueDevice,
-                                   NetDeviceContainer enbDevices,
+                                   const NetDeviceContainer& enbDevices,
                                    uint32_t index)
 {
     NS_LOG_FUNCTION(this << ueDevice << enbDevices.GetN() << index);
@@ -2706,6 +2764,7 @@ MmWaveHelper::AttachToEnbWithIndex(Ptr<NetDevice> ueDevice,
 
     // connect the UE to the target BS
     Ptr<MmWaveUeNetDevice> mmWaveUe = ueDevice->GetObject<MmWaveUeNetDevice>();
+    std::map<uint8_t, Ptr<MmWaveComponentCarrier>> ueCcMap = mmWaveUe->GetCcMap();
 
     // Necessary operation to connect MmWave UE to eNB at lower layers
     for (NetDeviceContainer::Iterator i = enbDevices.Begin(); i != enbDevices.End(); ++i)
@@ -2725,8 +2784,6 @@ MmWaveHelper::AttachToEnbWithIndex(Ptr<NetDevice> ueDevice,
             Ptr<MmWavePhyMacCommon> configParams = ccEnb->GetPhy()->GetConfigurationParameters();
             ccEnb->GetPhy()->AddUePhy(mmWaveUe->GetImsi(), ueDevice);
             // register MmWave eNBs informations in the MmWaveUePhy
-
-            std::map<uint8_t, Ptr<MmWaveComponentCarrier>> ueCcMap = mmWaveUe->GetCcMap();
             for (const auto& itUe : ueCcMap)
             {
                 DynamicCast<MmWaveComponentCarrierUe>(itUe.second)
@@ -2993,6 +3050,45 @@ MmWaveHelper::EnableTraces(void)
     EnableMcTraces();
 }
 
+int64_t
+MmWaveHelper::AssignStreams(NetDeviceContainer c, int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    int64_t currentStream = stream;
+    for (NetDeviceContainer::Iterator i = c.Begin(); i != c.End(); ++i)
+    {
+        Ptr<MmWaveEnbNetDevice> mmWaveEnb = DynamicCast<MmWaveEnbNetDevice>(*i);
+        if (mmWaveEnb)
+        {
+            for (const auto& cc : mmWaveEnb->GetCcMap())
+            {
+                Ptr<MmWaveComponentCarrierEnb> ccEnb =
+                    DynamicCast<MmWaveComponentCarrierEnb>(cc.second);
+                currentStream += ccEnb->GetPhy()->AssignStreams(currentStream);
+                currentStream += ccEnb->GetPhy()->GetDlSpectrumPhy()->AssignStreams(currentStream);
+                currentStream += ccEnb->GetPhy()->GetUlSpectrumPhy()->AssignStreams(currentStream);
+            }
+        }
+        Ptr<MmWaveUeNetDevice> mmWaveUe = DynamicCast<MmWaveUeNetDevice>(*i);
+        if (mmWaveUe)
+        {
+            for (const auto& cc : mmWaveUe->GetCcMap())
+            {
+                Ptr<MmWaveComponentCarrierUe> ccUe =
+                    DynamicCast<MmWaveComponentCarrierUe>(cc.second);
+                currentStream += ccUe->GetMac()->AssignStreams(currentStream);
+                currentStream += ccUe->GetPhy()->GetDlSpectrumPhy()->AssignStreams(currentStream);
+                currentStream += ccUe->GetPhy()->GetUlSpectrumPhy()->AssignStreams(currentStream);
+            }
+        }
+    }
+    if (m_epcHelper)
+    {
+        currentStream += m_epcHelper->AssignStreams(currentStream);
+    }
+    return (currentStream - stream);
+}
+
 void
 MmWaveHelper::EnableEnbSchedTrace()
 {
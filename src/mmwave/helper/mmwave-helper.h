@@ -54,6 +54,7 @@
 #include <ns3/lte-handover-algorithm.h>
 #include <ns3/lte-spectrum-value-helper.h>
 #include <ns3/lte-ue-rrc.h>
+#include <ns3/matrix-based-channel-model.h>
 #include <ns3/mc-stats-calculator.h>
 #include <ns3/mc-ue-net-device.h>
 #include <ns3/mmwave-bearer-stats-calculator.h>
@@ -77,6 +78,9 @@
 #include <ns3/simulator.h>
 #include <ns3/spectrum-phy.h>
 
+#include <chrono>
+#include <ostream>
+
 namespace ns3
 {
 
@@ -91,6 +95,7 @@ namespace mmwave
 class MmWaveUePhy;
 class MmWaveEnbPhy;
 class MmWaveSpectrumValueHelper;
+class MmWaveEnbPositionIndex;
 
 // class MmWave3gppChannel;
 
@@ -240,7 +245,7 @@ class MmWaveHelper : public Object
      * \param index an index to select the eNB (cellId - 1)
      */
     void AttachToEnbWithIndex(Ptr<NetDevice> ueDevice,
-                              NetDeviceContainer enbDevices,
+                              const NetDeviceContainer& enbDevices,
                               uint32_t index);
 
     /**
@@ -255,6 +260,26 @@ class MmWaveHelper : public Object
 
     void EnableTraces();
 
+    /**
+     * Assign a fixed random variable stream number to the random variables used by
+     * the mmWave eNB and UE devices of a container, and by the nodes of the core
+     * network via EpcHelper::AssignStreams, if an EPC helper is set.
+     *
+     * \param c the NetDeviceContainer of the mmWave devices
+     * \param stream the first stream index to use
+     * \return the number of stream indices assigned by this helper
+     */
+    int64_t AssignStreams(NetDeviceContainer c, int64_t stream);
+
+    /**
+     * Print the wall-clock time spent so far in each setup stage (installation
+     * of the channels and of the devices, attachment of the UEs), with the
+     * number of calls and of devices of each stage
+     *
+     * \param os the output stream
+     */
+    void PrintSetupTimes(std::ostream& os) const;
+
     void SetSchedulerType(std::string type);
     std::string GetSchedulerType() const;
 
@@ -378,10 +403,29 @@ class MmWaveHelper : public Object
     Ptr<NetDevice> InstallSingleLteEnbDevice(Ptr<Node> n);
     Ptr<NetDevice> InstallSingleInterRatHoCapableUeDevice(Ptr<Node> n);
 
-    void AttachToClosestEnb(Ptr<NetDevice> ueDevice, NetDeviceContainer enbDevices);
+    /**
+     * Resolve, once per installation batch, the channel objects and the
+     * attributes shared by the devices of each component carrier
+     */
+    void PrepareCcInstallContext();
+
+    /**
+     * Account the time spent in a setup stage
+     * \param stage the name of the stage
+     * \param start the time at which the stage started
+     * \param devices the number of devices handled
+     */
+    void AddSetupTime(const std::string& stage,
+                      std::chrono::steady_clock::time_point start,
+                      uint32_t devices);
+
+    void AttachToClosestEnb(Ptr<NetDevice> ueDevice,
+                            const NetDeviceContainer& enbDevices,
+                            const MmWaveEnbPositionIndex& enbIndex);
     void AttachMcToClosestEnb(Ptr<NetDevice> ueDevice,
-                              NetDeviceContainer mmWaveEnbDevices,
-                              NetDeviceContainer lteEnbDevices);
+                              const NetDeviceContainer& mmWaveEnbDevices,
+                              const NetDeviceContainer& lteEnbDevices,
+                              const MmWaveEnbPositionIndex& lteEnbIndex);
     void AttachIrToClosestEnb(Ptr<NetDevice> ueDevice,
                               NetDeviceContainer mmWaveEnbDevices,
                               NetDeviceContainer lteEnbDevices);
@@ -476,6 +520,7 @@ class MmWaveHelper : public Object
     bool m_rlcAmEnabled;
     bool m_snrTest;
     bool m_useIdealRrc; // Initialized as true in the constructor
+    bool m_useSpectrumTransmitFilter; //!< install a MmWaveSpectrumTransmitFilter in the channels
 
     Ptr<MmWaveBearerStatsCalculator> m_rlcStats;
     Ptr<MmWaveBearerStatsCalculator> m_pdcpStats;
@@ -516,6 +561,33 @@ class MmWaveHelper : public Object
      * and UE devices.
      */
     uint16_t m_noOfCcs;
+
+    /**
+     * Objects shared by all the devices of a component carrier, resolved once
+     * per installation batch instead of once per device
+     */
+    struct CcInstallContext
+    {
+        Ptr<SpectrumChannel> channel;                       ///< the channel of the CC
+        Ptr<PhasedArraySpectrumPropagationLossModel> pSplm; ///< the phased array SPLM, if used
+        Ptr<SpectrumPropagationLossModel> splm;             ///< the SPLM, otherwise
+        Ptr<MatrixBasedChannelModel> channelModel;          ///< the 3GPP channel model
+        Ptr<PropagationLossModel> pathlossModel;            ///< the pathloss model, if any
+    };
+
+    std::map<uint8_t, CcInstallContext> m_ccInstallContext; ///< per-CC installation context
+    bool m_useCodebookBeamforming; ///< whether m_bfModelFactory creates MmWaveCodebookBeamforming
+    bool m_enbErrorModelChecked;   ///< whether the eNB error model consistency has been checked
+
+    /// Wall-clock time spent in a setup stage
+    struct SetupTime
+    {
+        uint32_t calls;   ///< number of calls
+        uint32_t devices; ///< number of devices handled
+        double seconds;   ///< total time
+    };
+
+    std::map<std::string, SetupTime> m_setupTimes; ///< the time spent in each setup stage
 };
 
 } // namespace mmwave
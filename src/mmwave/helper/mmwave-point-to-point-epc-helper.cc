@@ -86,14 +86,25 @@ MmWavePointToPointEpcHelper::MmWavePointToPointEpcHelper()
 
     // we use a /64 IPv6 net all UEs
     m_uePgwAddressHelper6.SetBase("7777:f00d::", Ipv6Prefix(64));
+}
+
+void
+MmWavePointToPointEpcHelper::NotifyConstructionCompleted()
+{
+    NS_LOG_FUNCTION(this);
+    EpcHelper::NotifyConstructionCompleted();
+
+    // the core nodes are created here, once the CoreSystemId attribute is set.
+    // The SGW/PGW and the MME talk through the S11 SAP, which is a direct
+    // function call, so they must run on the same rank.
 
     // create SgwPgwNode
-    m_sgwPgw = CreateObject<Node>();
+    m_sgwPgw = CreateObject<Node>(m_coreSystemId);
     InternetStackHelper internet;
     internet.Install(m_sgwPgw);
 
     // create MmeNode
-    m_mmeNode = CreateObject<Node>();
+    m_mmeNode = CreateObject<Node>(m_coreSystemId);
     internet.Install(m_mmeNode);
 
     // create S1-U socket
@@ -229,7 +240,14 @@ MmWavePointToPointEpcHelper::GetTypeId(void)
                           "big X2 messages, you need a big MTU.",
                           UintegerValue(10000),
                           MakeUintegerAccessor(&MmWavePointToPointEpcHelper::m_x2LinkMtu),
-                          MakeUintegerChecker<uint16_t>());
+                          MakeUintegerChecker<uint16_t>())
+            .AddAttribute("CoreSystemId",
+                          "The system id (MPI rank) of the SGW/PGW and MME nodes in a "
+                          "distributed simulation. The eNBs run on the system id of their node.",
+                          TypeId::ATTR_CONSTRUCT,
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&MmWavePointToPointEpcHelper::m_coreSystemId),
+                          MakeUintegerChecker<uint32_t>());
     return tid;
 }
 
@@ -250,6 +268,12 @@ MmWavePointToPointEpcHelper::AddEnb(Ptr<Node> enb, Ptr<NetDevice> lteEnbNetDevic
     NS_LOG_FUNCTION(this << enb << lteEnbNetDevice << cellId);
 
     NS_ASSERT(enb == lteEnbNetDevice->GetNode());
+    // a link between two ranks is a PointToPointRemoteChannel, whose delay
+    // is the lookahead of the distributed simulation
+    NS_ABORT_MSG_IF(enb->GetSystemId() != m_coreSystemId &&
+                        (m_s1uLinkDelay.IsZero() || m_s1apLinkDelay.IsZero()),
+                    "The S1-U and S1-AP links of eNB "
+                        << cellId << " cross ranks, so their delays must be positive");
 
     // add an IPv4 stack to the previously created eNB
     InternetStackHelper internet;
@@ -386,6 +410,8 @@ void
 MmWavePointToPointEpcHelper::AddX2Interface(Ptr<Node> enb1, Ptr<Node> enb2)
 {
     NS_LOG_FUNCTION(this << enb1 << enb2);
+    NS_ABORT_MSG_IF(enb1->GetSystemId() != enb2->GetSystemId() && m_x2LinkDelay.IsZero(),
+                    "The X2 link crosses ranks, so its delay must be positive");
 
     // Create a point to point link between the two eNBs with
     // the corresponding new NetDevices on each side
@@ -522,7 +548,8 @@ MmWavePointToPointEpcHelper::ActivateEpsBearer(Ptr<NetDevice> ueDevice,
 
     uint8_t bearerId = m_mmeApp->AddBearer(imsi, tft, bearer);
     Ptr<mmwave::MmWaveUeNetDevice> ueLteDevice = ueDevice->GetObject<mmwave::MmWaveUeNetDevice>();
-    if (ueLteDevice)
+    // in a distributed simulation, only the rank of the UE activates its bearers
+    if (ueLteDevice && ueNode->GetSystemId() == Simulator::GetSystemId())
     {
         Simulator::ScheduleNow(&EpcUeNas::ActivateEpsBearer, ueLteDevice->GetNas(), bearer, tft);
     }
@@ -68,6 +68,13 @@ namespace mmwave
  * single node that implements both the SGW and PGW functionality, and
  * an MME node. The S1-U, S1-AP, X2-U and X2-C interfaces are realized over
  * PointToPoint links.
+ *
+ * In a distributed (MPI) simulation, the SGW/PGW and MME nodes run on the
+ * rank given by the CoreSystemId attribute, and each eNB runs on the system
+ * id of its node.  The S1 and X2 links between ranks then use a
+ * PointToPointRemoteChannel, and their delays give the lookahead.  Every
+ * rank must build the whole topology; the UEs of an eNB should be created
+ * with the system id of the eNB.
  */
 class MmWavePointToPointEpcHelper : public EpcHelper
 {
@@ -111,6 +118,10 @@ class MmWavePointToPointEpcHelper : public EpcHelper
     virtual Ipv6Address GetUeDefaultGatewayAddress6();
     virtual int64_t AssignStreams(int64_t stream) override;
 
+  protected:
+    // inherited from ObjectBase
+    void NotifyConstructionCompleted() override;
+
   private:
     MmWavePointToPointEpcHelper(const MmWavePointToPointEpcHelper&);
     /**
@@ -240,6 +251,11 @@ class MmWavePointToPointEpcHelper : public EpcHelper
      * because of some big X2 messages, you need a big MTU.
      */
     uint16_t m_x2LinkMtu;
+
+    /**
+     * The system id of the SGW/PGW and MME nodes
+     */
+    uint32_t m_coreSystemId;
 };
 
 } // namespace mmwave
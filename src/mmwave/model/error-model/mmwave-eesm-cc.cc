@@ -23,6 +23,8 @@
 
 #include <ns3/log.h>
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -54,43 +56,23 @@ MmWaveEesmCc::ComputeSINR(const SpectrumValue& sinr,
                           const std::vector<int>& map,
                           uint8_t mcs,
                           uint32_t sizeBit,
-                          const MmWaveErrorModel::MmWaveErrorModelHistory& sinrHistory) const
+                          const MmWaveErrorModel::MmWaveErrorModelHistory& sinrHistory)
 {
     NS_LOG_FUNCTION(this);
 
     // HARQ CHASE COMBINING: update SINReff, but not ECR after retx
     // repetition of coded bits
 
-    // make a vector of history that contains the last tx (but without modifying
-    // sinrHistory, as it will be modified by the caller when it will be the time)
-    Ptr<MmWaveEesmErrorModelOutput> last = Create<MmWaveEesmErrorModelOutput>(0.0);
-    last->m_map = map;
-    last->m_sinr = sinr;
-
-    MmWaveErrorModel::MmWaveErrorModelHistory total = sinrHistory;
-    total.push_back(last);
-
-    // evaluate SINR_eff over "total", as per Chase Combining
+    // evaluate SINR_eff over the history and the last tx, as per Chase Combining
+    // (without modifying sinrHistory, as it will be modified by the caller when
+    // it will be the time)
 
     NS_ASSERT(sinr.GetSpectrumModel()->GetNumBands() == sinr.GetValuesN());
 
-    SpectrumValue sinr_sum(sinr.GetSpectrumModel());
-    uint32_t historySize = static_cast<uint32_t>(total.size());
-    uint32_t maxRBUsed = 0;
-    for (uint32_t i = 0; i < historySize; ++i)
-    {
-        Ptr<MmWaveEesmErrorModelOutput> output =
-            DynamicCast<MmWaveEesmErrorModelOutput>(total.at(i));
-        maxRBUsed = std::max(maxRBUsed, static_cast<uint32_t>(output->m_map.size()));
-    }
-
-    std::vector<int> map_sum;
-    map_sum.reserve(maxRBUsed);
-
-    for (uint32_t i = 0; i < maxRBUsed; ++i)
+    std::size_t maxRBUsed = map.size();
+    for (uint32_t numRb : sinrHistory.m_numRbs)
     {
-        sinr_sum[i] = 0;
-        map_sum.push_back(static_cast<int>(i));
+        maxRBUsed = std::max<std::size_t>(maxRBUsed, numRb);
     }
 
     /* combine at the bit level. Example:
@@ -102,35 +84,43 @@ MmWaveEesmCc::ComputeSINR(const SpectrumValue& sinr,
      * map{2}=[0 1 2 3 4 6];
      * map{3}=[0];
      *
-     * MAP_SUM = [0 1 2 3 4 5]
+     * SINR_RB{1}=[10 20 10];
+     * SINR_RB{2}=[1 2 1 2 1 3];
+     * SINR_RB{3}=[5];
+     *
      * SINR_SUM = [16 27 16 17 26 18]
      *
-     * (the value at SINR_SUM[0] is SINR{1}[2] + SINR{2}[0] + SINR{3}[0])
+     * (the value at SINR_SUM[0] is SINR_RB{1}[0] + SINR_RB{2}[0] + SINR_RB{3}[0])
+     *
+     * The history holds the SINR_RB of the previous transmissions one after the
+     * other, so that they are combined without going through the RB maps again.
      */
-    for (uint32_t i = 0; i < historySize; ++i)
+    m_sinrSum.assign(maxRBUsed, 0.0);
+
+    NS_LOG_INFO("\tHISTORY:");
+    const double* sinrRb = sinrHistory.m_sinrRb.data();
+    for (uint32_t size : sinrHistory.m_numRbs)
     {
-        Ptr<MmWaveEesmErrorModelOutput> output =
-            DynamicCast<MmWaveEesmErrorModelOutput>(total.at(i));
-        uint32_t size = output->m_map.size();
-        for (uint32_t j = 0; j < maxRBUsed; ++j)
+        for (std::size_t j = 0; j < maxRBUsed; ++j)
         {
-            sinr_sum[j] += output->m_sinr[output->m_map[j % size]];
+            m_sinrSum[j] += sinrRb[j % size];
         }
+        NS_LOG_INFO("\tSINR_RB: " << PrintSinr(std::vector<double>(sinrRb, sinrRb + size)));
+        sinrRb += size;
     }
 
-    NS_LOG_INFO("\tHISTORY:");
-    for (const auto& element : total)
+    std::size_t size = map.size();
+    for (std::size_t j = 0; j < maxRBUsed; ++j)
     {
-        Ptr<MmWaveEesmErrorModelOutput> output = DynamicCast<MmWaveEesmErrorModelOutput>(element);
-        NS_LOG_INFO("\tMAP:" << PrintMap(output->m_map));
-        NS_LOG_INFO("\tSINR: " << output->m_sinr);
+        m_sinrSum[j] += sinr[map[j % size]];
     }
+    NS_LOG_INFO("\tMAP:" << PrintMap(map));
+    NS_LOG_INFO("\tSINR: " << sinr);
 
-    NS_LOG_INFO("MAP_SUM: " << PrintMap(map_sum));
-    NS_LOG_INFO("SINR_SUM: " << sinr_sum);
+    NS_LOG_INFO("SINR_SUM: " << PrintSinr(m_sinrSum));
 
-    // compute effective SINR with the sinr_sum vector and map_sum RB map
-    return SinrEff(sinr_sum, map_sum, mcs);
+    // compute effective SINR with the combined SINRs of the first maxRBUsed RBs
+    return SinrEff(m_sinrSum, mcs);
 }
 
 double
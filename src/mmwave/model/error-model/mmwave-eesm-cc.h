@@ -41,7 +41,8 @@ namespace mmwave
  * corresponding resources are summed across the retransmissions, and the combined
  * SINR values are used to get the effective SINR based on EESM.
  *
- * In HARQ-CC, the HARQ history contains the SINR per allocated RB. Given the current
+ * In HARQ-CC, the HARQ history contains the SINR per allocated RB, gathered
+ * in the order of the RB map. Given the current
  * SINR vector and RB map, and the HARQ history, the effective SINR is computed
  * according to EESM.
  *
@@ -80,7 +81,7 @@ class MmWaveEesmCc : public MmWaveEesmErrorModel
                        const std::vector<int>& map,
                        uint8_t mcs,
                        uint32_t sizeBit,
-                       const MmWaveErrorModel::MmWaveErrorModelHistory& sinrHistory) const override;
+                       const MmWaveErrorModel::MmWaveErrorModelHistory& sinrHistory) override;
 
     /**
      * \brief Returns the MCS corresponding to the ECR after retransmissions. As the ECR
@@ -91,6 +92,9 @@ class MmWaveEesmCc : public MmWaveEesmErrorModel
      * \return The equivalent MCS after retransmissions
      */
     double GetMcsEq(uint8_t mcsTx) const override;
+
+  private:
+    std::vector<double> m_sinrSum; //!< combined SINRs of the RBs, reused across the TBs
 };
 
 } // namespace mmwave
@@ -30,6 +30,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <map>
 
 namespace ns3
 {
@@ -85,13 +86,12 @@ MmWaveEesmErrorModel::SinrEff(const SpectrumValue& sinr,
 
     double SINR = 0.0;
     double SINRsum = 0.0;
-    SpectrumValue sinrCopy = sinr;
 
     double beta = GetBetaTable()->at(mcs);
 
     for (uint32_t i = 0; i < map.size(); i++)
     {
-        double sinrLin = sinrCopy[map.at(i)];
+        double sinrLin = sinr[map.at(i)];
         SINR = exp(-sinrLin / beta);
         SINRsum += SINR;
     }
@@ -103,6 +103,29 @@ MmWaveEesmErrorModel::SinrEff(const SpectrumValue& sinr,
     return SINR;
 }
 
+double
+MmWaveEesmErrorModel::SinrEff(const std::vector<double>& sinrRb, uint8_t mcs) const
+{
+    NS_LOG_FUNCTION(this << sinrRb.size() << (uint8_t)mcs);
+    NS_ABORT_MSG_IF(sinrRb.size() == 0,
+                    " Error: number of allocated RBs cannot be 0 - EESM method - SinrEff function");
+
+    double SINRsum = 0.0;
+
+    double beta = GetBetaTable()->at(mcs);
+
+    for (double sinrLin : sinrRb)
+    {
+        SINRsum += exp(-sinrLin / beta);
+    }
+
+    double SINR = -beta * log(SINRsum / sinrRb.size());
+
+    NS_LOG_INFO(" Effective SINR = " << SINR);
+
+    return SINR;
+}
+
 const std::vector<double>&
 MmWaveEesmErrorModel::GetSinrDbVectorFromSimulatedValues(MmWaveEesmErrorModel::GraphType graphType,
                                                          uint8_t mcs,
@@ -271,7 +294,62 @@ MmWaveEesmErrorModel::GetTbDecodificationStats(const SpectrumValue& sinr,
                                                uint8_t mcs,
                                                const MmWaveErrorModelHistory& sinrHistory)
 {
-    return GetTbBitDecodificationStats(sinr, map, size * 8, mcs, sinrHistory);
+    NS_ABORT_IF(mcs > GetMaxMcs());
+    return GetTbBitDecodificationStats(sinr,
+                                       map,
+                                       size * 8,
+                                       mcs,
+                                       sinrHistory,
+                                       SinrEff(sinr, map, mcs));
+}
+
+std::vector<Ptr<MmWaveErrorModelOutput>>
+MmWaveEesmErrorModel::GetBatchDecodificationStats(const SpectrumValue& sinr,
+                                                  const std::vector<TbDecodificationRequest>& tbs)
+{
+    NS_LOG_FUNCTION(this << tbs.size());
+
+    // exp(-sinr/beta) of each RB, for each MCS, computed only for the RBs in use
+    // (the terms are positive, so that a negative value marks a missing term)
+    std::map<uint8_t, std::vector<double>> expTerms;
+
+    std::vector<Ptr<MmWaveErrorModelOutput>> outputs;
+    outputs.reserve(tbs.size());
+    for (const auto& tb : tbs)
+    {
+        NS_ABORT_IF(tb.m_mcs > GetMaxMcs());
+        NS_ABORT_MSG_IF(tb.m_map->size() == 0,
+                        " Error: number of allocated RBs cannot be 0 - EESM method - "
+                        "GetBatchDecodificationStats function");
+
+        double beta = GetBetaTable()->at(tb.m_mcs);
+        auto terms = expTerms.find(tb.m_mcs);
+        if (terms == expTerms.end())
+        {
+            terms = expTerms.emplace(tb.m_mcs, std::vector<double>(sinr.GetValuesN(), -1.0)).first;
+        }
+
+        // the same sum as SinrEff, so that the effective SINR is the same
+        double sum = 0.0;
+        for (int rb : *tb.m_map)
+        {
+            double& term = terms->second.at(rb);
+            if (term < 0)
+            {
+                term = exp(-sinr[rb] / beta);
+            }
+            sum += term;
+        }
+        double tbSinr = -beta * log(sum / tb.m_map->size());
+
+        outputs.push_back(GetTbBitDecodificationStats(sinr,
+                                                      *tb.m_map,
+                                                      tb.m_size * 8,
+                                                      tb.m_mcs,
+                                                      *tb.m_history,
+                                                      tbSinr));
+    }
+    return outputs;
 }
 
 std::string
@@ -287,25 +365,39 @@ MmWaveEesmErrorModel::PrintMap(const std::vector<int>& map) const
     return ss.str();
 }
 
+std::string
+MmWaveEesmErrorModel::PrintSinr(const std::vector<double>& sinrRb) const
+{
+    std::stringstream ss;
+
+    for (const auto& v : sinrRb)
+    {
+        ss << v << ", ";
+    }
+
+    return ss.str();
+}
+
 Ptr<MmWaveErrorModelOutput>
 MmWaveEesmErrorModel::GetTbBitDecodificationStats(const SpectrumValue& sinr,
                                                   const std::vector<int>& map,
                                                   uint32_t sizeBit,
                                                   uint8_t mcs,
-                                                  const MmWaveErrorModelHistory& sinrHistory)
+                                                  const MmWaveErrorModelHistory& sinrHistory,
+                                                  double tbSinr)
 {
     NS_LOG_FUNCTION(this);
     NS_ABORT_IF(mcs > GetMaxMcs());
 
-    double tbSinr = SinrEff(sinr, map, mcs);
     double SINR = tbSinr;
 
     NS_LOG_DEBUG(" mcs " << +mcs << " TBSize in bit " << sizeBit << " history elements: "
-                         << sinrHistory.size() << " SINR of the tx: " << tbSinr << std::endl
+                         << sinrHistory.m_outputs.size() << " SINR of the tx: " << tbSinr
+                         << std::endl
                          << "MAP: " << PrintMap(map) << std::endl
                          << "SINR: " << sinr);
 
-    if (sinrHistory.size() > 0)
+    if (!sinrHistory.m_outputs.empty())
     {
         SINR = ComputeSINR(sinr, map, mcs, sizeBit, sinrHistory);
     }
@@ -325,7 +417,7 @@ MmWaveEesmErrorModel::GetTbBitDecodificationStats(const SpectrumValue& sinr,
                                           << " bits");
 
     uint8_t mcs_eq = mcs;
-    if ((sinrHistory.size() > 0) && (mcs > 0))
+    if (!sinrHistory.m_outputs.empty() && (mcs > 0))
     {
         mcs_eq = GetMcsEq(mcs);
     }
@@ -348,8 +440,6 @@ MmWaveEesmErrorModel::GetTbBitDecodificationStats(const SpectrumValue& sinr,
     NS_ASSERT(GetMcsEcrTable() != nullptr);
 
     Ptr<MmWaveEesmErrorModelOutput> ret = Create<MmWaveEesmErrorModelOutput>(errorRate);
-    ret->m_sinr = sinr;
-    ret->m_map = map;
     ret->m_sinrEff = SINR;
     ret->m_infoBits = sizeBit;
     ret->m_codeBits = sizeBit / GetMcsEcrTable()->at(mcs);
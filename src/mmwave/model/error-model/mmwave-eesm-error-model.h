@@ -55,8 +55,6 @@ struct MmWaveEesmErrorModelOutput : public MmWaveErrorModelOutput
     }
 
     double m_sinrEff{0.0};  //!< Effective SINR
-    SpectrumValue m_sinr;   //!< perceived SINRs in the whole bandwidth
-    std::vector<int> m_map; //!< map of the active RBs
     uint32_t m_infoBits{0}; //!< number of info bits
     uint32_t m_codeBits{0}; //!< number of code bits
 };
@@ -125,8 +123,8 @@ class MmWaveEesmErrorModel : public MmWaveErrorModel
      * \param size Transport block size in Bytes
      * \param mcs MCS
      * \param sinrHistory History of the retransmission
-     * \return A pointer to an output, with the tbler and SINR vector, effective
-     * SINR, RB map, code bits, and info bits.
+     * \return A pointer to an output, with the tbler, the SINRs of the active
+     * RBs, effective SINR, code bits, and info bits.
      */
     virtual Ptr<MmWaveErrorModelOutput> GetTbDecodificationStats(
         const SpectrumValue& sinr,
@@ -135,6 +133,18 @@ class MmWaveEesmErrorModel : public MmWaveErrorModel
         uint8_t mcs,
         const MmWaveErrorModelHistory& sinrHistory) override;
 
+    /**
+     * \brief Get the outputs of the transport blocks which share the SINR
+     * vector. The exponential terms of the EESM are computed once per RB and
+     * MCS, and shared by all the transport blocks with the same MCS.
+     * \param sinr SINR vector shared by the transport blocks
+     * \param tbs the transport blocks
+     * \return the outputs, in the order of the transport blocks
+     */
+    virtual std::vector<Ptr<MmWaveErrorModelOutput>> GetBatchDecodificationStats(
+        const SpectrumValue& sinr,
+        const std::vector<TbDecodificationRequest>& tbs) override;
+
     /**
      * \brief Get the SE for a given CQI, following the CQIs in NR Table1/Table2
      * in TS38.214
@@ -183,6 +193,13 @@ class MmWaveEesmErrorModel : public MmWaveErrorModel
      */
     std::string PrintMap(const std::vector<int>& map) const;
 
+    /**
+     * \brief function to print the SINRs of the active RBs
+     * \param sinrRb the SINRs of the active RBs
+     * \return a string that contains the SINRs in a readable way
+     */
+    std::string PrintSinr(const std::vector<double>& sinrRb) const;
+
     /**
      * \brief compute the effective SINR for the specified MCS and SINR, according
      * to the EESM method
@@ -194,6 +211,16 @@ class MmWaveEesmErrorModel : public MmWaveErrorModel
      */
     double SinrEff(const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs) const;
 
+    /**
+     * \brief compute the effective SINR for the specified MCS and the SINRs of
+     * the active RBs, according to the EESM method
+     *
+     * \param sinrRb the perceived sinrs of the active RBs of the TB
+     * \param mcs the MCS of the TB
+     * \return the effective SINR
+     */
+    double SinrEff(const std::vector<double>& sinrRb, uint8_t mcs) const;
+
     /**
      * \brief Compute the effective SINR after retransmission combining
      * \param sinr SINR of the new transmission
@@ -215,7 +242,7 @@ class MmWaveEesmErrorModel : public MmWaveErrorModel
         const std::vector<int>& map,
         uint8_t mcs,
         uint32_t sizeBit,
-        const MmWaveErrorModel::MmWaveErrorModelHistory& sinrHistory) const = 0;
+        const MmWaveErrorModel::MmWaveErrorModelHistory& sinrHistory) = 0;
 
     /**
      * \brief Get the "Equivalent MCS" after retransmission combining
@@ -277,15 +304,17 @@ class MmWaveEesmErrorModel : public MmWaveErrorModel
      * \param size Transport block size in BITS
      * \param mcs MCS
      * \param sinrHistory History of the retransmission
-     * \return A pointer to an output, with the tbler and SINR vector, effective
-     * SINR, RB map, code bits, and info bits.
+     * \param tbSinr the effective SINR of this transmission, given by SinrEff
+     * \return A pointer to an output, with the tbler, the SINRs of the active
+     * RBs, effective SINR, code bits, and info bits.
      */
     Ptr<MmWaveErrorModelOutput> GetTbBitDecodificationStats(
         const SpectrumValue& sinr,
         const std::vector<int>& map,
         uint32_t size,
         uint8_t mcs,
-        const MmWaveErrorModelHistory& sinrHistory);
+        const MmWaveErrorModelHistory& sinrHistory,
+        double tbSinr);
 
     /**
      * \brief Type of base graph for LDPC coding
@@ -55,36 +55,34 @@ MmWaveEesmIr::ComputeSINR(const SpectrumValue& sinr,
                           const std::vector<int>& map,
                           uint8_t mcs,
                           uint32_t sizeBit,
-                          const MmWaveErrorModel::MmWaveErrorModelHistory& sinrHistory) const
+                          const MmWaveErrorModel::MmWaveErrorModelHistory& sinrHistory)
 {
     NS_LOG_FUNCTION(this);
     // HARQ INCREMENTAL REDUNDANCY: update SINReff and ECR after retx
     // no repetition of coded bits
 
-    std::vector<int> map_sum = map;
-
-    // evaluate SINR_eff over "total", as per Incremental Redundancy.
+    // evaluate SINR_eff over the RBs of the last tx, as per Incremental Redundancy.
     // combine at the bit level.
-    SpectrumValue sinr_sum = sinr;
     double SINReff_previousTx =
-        DynamicCast<MmWaveEesmErrorModelOutput>(sinrHistory.back())->m_sinrEff;
+        DynamicCast<MmWaveEesmErrorModelOutput>(sinrHistory.m_outputs.back())->m_sinrEff;
     NS_LOG_INFO("\tHISTORY:");
     NS_LOG_INFO("\tSINReff: " << SINReff_previousTx);
 
-    for (uint32_t i = 0; i < map.size(); i++)
+    m_sinrSum.clear();
+    for (int rb : map)
     {
-        sinr_sum[map.at(i)] += SINReff_previousTx;
+        m_sinrSum.push_back(sinr[rb] + SINReff_previousTx);
     }
 
-    NS_LOG_INFO("MAP_SUM: " << PrintMap(map_sum));
-    NS_LOG_INFO("SINR_SUM: " << sinr_sum);
+    NS_LOG_INFO("MAP_SUM: " << PrintMap(map));
+    NS_LOG_INFO("SINR_SUM: " << PrintSinr(m_sinrSum));
 
     // compute equivalent effective code rate after retransmissions
     uint32_t codeBitsSum = 0;
-    uint32_t infoBits = DynamicCast<MmWaveEesmErrorModelOutput>(sinrHistory.front())
+    uint32_t infoBits = DynamicCast<MmWaveEesmErrorModelOutput>(sinrHistory.m_outputs.front())
                             ->m_infoBits; // information bits of the first TB
 
-    for (const Ptr<MmWaveErrorModelOutput>& output : sinrHistory)
+    for (const Ptr<MmWaveErrorModelOutput>& output : sinrHistory.m_outputs)
     {
         Ptr<MmWaveEesmErrorModelOutput> sinrHistorytemp =
             DynamicCast<MmWaveEesmErrorModelOutput>(output);
@@ -99,12 +97,12 @@ MmWaveEesmIr::ComputeSINR(const SpectrumValue& sinr,
 
     codeBitsSum += sizeBit / GetMcsEcrTable()->at(mcs);
     ;
-    const_cast<MmWaveEesmIr*>(this)->m_Reff = infoBits / static_cast<double>(codeBitsSum);
+    m_Reff = infoBits / static_cast<double>(codeBitsSum);
 
-    NS_LOG_INFO(" Reff " << m_Reff << " HARQ history (previous) " << sinrHistory.size());
+    NS_LOG_INFO(" Reff " << m_Reff << " HARQ history (previous) " << sinrHistory.m_outputs.size());
 
-    // compute effective SINR with the sinr_sum vector and map_sum RB map
-    return SinrEff(sinr_sum, map_sum, mcs);
+    // compute effective SINR with the combined SINRs of the RB map
+    return SinrEff(m_sinrSum, mcs);
 }
 
 double
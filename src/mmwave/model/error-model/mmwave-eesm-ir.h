@@ -84,7 +84,7 @@ class MmWaveEesmIr : public MmWaveEesmErrorModel
                        const std::vector<int>& map,
                        uint8_t mcs,
                        uint32_t sizeBit,
-                       const MmWaveErrorModel::MmWaveErrorModelHistory& sinrHistory) const override;
+                       const MmWaveErrorModel::MmWaveErrorModelHistory& sinrHistory) override;
 
     /**
      * \brief Returns the MCS corresponding to the ECR after retransmissions. In case of
@@ -99,6 +99,8 @@ class MmWaveEesmIr : public MmWaveEesmErrorModel
 
   private:
     double m_Reff{0.0}; //!< equivalent effective code rate after retransmissions
+
+    std::vector<double> m_sinrSum; //!< combined SINRs of the RBs, reused across the TBs
 };
 
 } // namespace mmwave
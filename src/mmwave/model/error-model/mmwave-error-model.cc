@@ -54,5 +54,41 @@ MmWaveErrorModel::GetInstanceTypeId() const
     return MmWaveErrorModel::GetTypeId();
 }
 
+void
+MmWaveErrorModel::MmWaveErrorModelHistory::Add(const Ptr<MmWaveErrorModelOutput>& output,
+                                               const SpectrumValue& sinr,
+                                               const std::vector<int>& map)
+{
+    m_outputs.push_back(output);
+    for (int rb : map)
+    {
+        m_sinrRb.push_back(sinr[rb]);
+    }
+    m_numRbs.push_back(map.size());
+}
+
+void
+MmWaveErrorModel::MmWaveErrorModelHistory::Clear()
+{
+    m_outputs.clear();
+    m_sinrRb.clear();
+    m_numRbs.clear();
+}
+
+std::vector<Ptr<MmWaveErrorModelOutput>>
+MmWaveErrorModel::GetBatchDecodificationStats(const SpectrumValue& sinr,
+                                              const std::vector<TbDecodificationRequest>& tbs)
+{
+    NS_LOG_FUNCTION(this << tbs.size());
+    std::vector<Ptr<MmWaveErrorModelOutput>> outputs;
+    outputs.reserve(tbs.size());
+    for (const auto& tb : tbs)
+    {
+        outputs.push_back(
+            GetTbDecodificationStats(sinr, *tb.m_map, tb.m_size, tb.m_mcs, *tb.m_history));
+    }
+    return outputs;
+}
+
 } // namespace mmwave
 } // namespace ns3
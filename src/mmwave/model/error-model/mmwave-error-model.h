@@ -125,13 +125,35 @@ class MmWaveErrorModel : public Object
     };
 
     /**
-     * \brief Vector of previous output
+     * \brief HARQ history of a transport block
      *
-     *
-     * Used in case of HARQ: any result will ve stored in this vector and used
-     * to decode next retransmissions.
+     * Used in case of HARQ: the output of each transmission of the transport block
+     * which is not decoded is stored in the history, and used to decode the next
+     * retransmissions. The SINRs of the allocated RBs of these transmissions are
+     * gathered in a single buffer, one transmission after the other, each in the
+     * order of its RB map, for the error models which combine them.
      */
-    typedef std::vector<Ptr<MmWaveErrorModelOutput>> MmWaveErrorModelHistory;
+    struct MmWaveErrorModelHistory
+    {
+        /**
+         * \brief Add a transmission to the history
+         * \param output the output of the error model for the transmission
+         * \param sinr the SINR vector of the transmission
+         * \param map the RB map of the transmission
+         */
+        void Add(const Ptr<MmWaveErrorModelOutput>& output,
+                 const SpectrumValue& sinr,
+                 const std::vector<int>& map);
+
+        /**
+         * \brief Remove the transmissions, keeping the storage for the next transport block
+         */
+        void Clear();
+
+        std::vector<Ptr<MmWaveErrorModelOutput>> m_outputs; //!< outputs of the transmissions
+        std::vector<double> m_sinrRb;   //!< SINRs of the allocated RBs of the transmissions
+        std::vector<uint32_t> m_numRbs; //!< number of allocated RBs of each transmission
+    };
 
     /**
      * \brief Get an output for the decodification error probability of a given
@@ -159,6 +181,35 @@ class MmWaveErrorModel : public Object
         uint8_t mcs,
         const MmWaveErrorModelHistory& history) = 0;
 
+    /**
+     * \brief A transport block to decode in a batch, together with the other
+     * transport blocks received with the same SINR
+     */
+    struct TbDecodificationRequest
+    {
+        const std::vector<int>* m_map;            //!< RB map
+        uint32_t m_size;                          //!< Transport block size
+        uint8_t m_mcs;                            //!< MCS
+        const MmWaveErrorModelHistory* m_history; //!< History of the retransmission
+    };
+
+    /**
+     * \brief Get the outputs for the decodification error probability of the
+     * transport blocks which end in the same TTI, and thus share the SINR vector.
+     *
+     * The default implementation calls GetTbDecodificationStats for each
+     * transport block. The error models which can share the work among the
+     * transport blocks override this method, which must return the same
+     * outputs as GetTbDecodificationStats.
+     *
+     * \param sinr SINR vector shared by the transport blocks
+     * \param tbs the transport blocks
+     * \return the outputs, in the order of the transport blocks
+     */
+    virtual std::vector<Ptr<MmWaveErrorModelOutput>> GetBatchDecodificationStats(
+        const SpectrumValue& sinr,
+        const std::vector<TbDecodificationRequest>& tbs);
+
     /**
      * \brief Get the SpectralEfficiency for a given CQI
      * \param cqi CQI to take into consideration
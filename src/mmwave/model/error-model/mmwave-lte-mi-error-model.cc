@@ -950,11 +950,10 @@ MmWaveLteMiErrorModel::Mib(const SpectrumValue& sinr, const std::vector<int>& ma
 
     double MI;
     double MIsum = 0.0;
-    SpectrumValue sinrCopy = sinr;
 
     for (uint32_t i = 0; i < map.size(); i++)
     {
-        double sinrLin = sinrCopy[map.at(i)];
+        double sinrLin = sinr[map.at(i)];
         if (mcs <= MI_QPSK_MAX_ID) // QPSK
         {
             if (sinrLin > MI_map_qpsk_axis[MI_MAP_QPSK_SIZE - 1])
@@ -1113,14 +1112,14 @@ MmWaveLteMiErrorModel::GetTbBitDecodificationStats(
     double MI = tbMi;
     double Reff = 0.0;
 
-    if (history.size() > 0)
+    if (history.m_outputs.size() > 0)
     {
         uint32_t codeBitsSum = 0;
         double miSum = 0.0;
-        uint32_t infoBits = DynamicCast<MmWaveLteMiErrorModelOutput>(history.front())
+        uint32_t infoBits = DynamicCast<MmWaveLteMiErrorModelOutput>(history.m_outputs.front())
                                 ->m_infoBits; // information bits of the first TB
 
-        for (const Ptr<MmWaveErrorModelOutput>& output : history)
+        for (const Ptr<MmWaveErrorModelOutput>& output : history.m_outputs)
         {
             Ptr<MmWaveLteMiErrorModelOutput> miHistory =
                 DynamicCast<MmWaveLteMiErrorModelOutput>(output);
@@ -1139,7 +1138,7 @@ MmWaveLteMiErrorModel::GetTbBitDecodificationStats(
         MI = miSum / static_cast<double>(codeBitsSum);
     }
 
-    NS_LOG_INFO(" MI " << MI << " Reff " << Reff << " HARQ " << history.size());
+    NS_LOG_INFO(" MI " << MI << " Reff " << Reff << " HARQ " << history.m_outputs.size());
 
     // estimate CB size (according to sec 5.1.2 of TS 36.212)
     uint16_t Z = 6144; // max size of a codeblock (including CRC)
@@ -1198,7 +1197,7 @@ MmWaveLteMiErrorModel::GetTbBitDecodificationStats(
 
     double errorRate = 1.0;
     uint8_t ecrId = 0;
-    if (history.size() == 0)
+    if (history.m_outputs.size() == 0)
     {
         // first tx -> get ECR from MCS
         ecrId = McsEcrBlerTableMapping[mcs];
@@ -1207,7 +1206,7 @@ MmWaveLteMiErrorModel::GetTbBitDecodificationStats(
     }
     else
     {
-        NS_LOG_INFO("HARQ block no. " << history.size());
+        NS_LOG_INFO("HARQ block no. " << history.m_outputs.size());
         // harq retx -> get closest ECR to Reff from available ones
         if (mcs <= MI_QPSK_MAX_ID)
         {
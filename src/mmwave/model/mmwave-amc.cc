@@ -34,6 +34,8 @@
 #include <ns3/object-factory.h>
 #include <ns3/uinteger.h>
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -62,6 +64,7 @@ MmWaveAmc::SetDlMode()
 {
     NS_LOG_FUNCTION(this);
     m_emMode = MmWaveErrorModel::DL;
+    UpdateTables();
 }
 
 void
@@ -69,6 +72,7 @@ MmWaveAmc::SetUlMode()
 {
     NS_LOG_FUNCTION(this);
     m_emMode = MmWaveErrorModel::UL;
+    UpdateTables();
 }
 
 TypeId
@@ -113,6 +117,7 @@ void
 MmWaveAmc::SetBer(double ber)
 {
     m_ber = ber;
+    m_shannonGap = -std::log(5.0 * m_ber) / 1.5;
 }
 
 uint8_t
@@ -121,14 +126,7 @@ MmWaveAmc::GetMcsFromCqi(uint8_t cqi) const
     NS_LOG_FUNCTION(cqi);
     NS_ASSERT_MSG(cqi >= 0 && cqi <= 15, "CQI must be in [0..15] = " << cqi);
 
-    double spectralEfficiency = m_errorModel->GetSpectralEfficiencyForCqi(cqi);
-    uint8_t mcs = 0;
-
-    while ((mcs < m_errorModel->GetMaxMcs()) &&
-           (m_errorModel->GetSpectralEfficiencyForMcs(mcs + 1) <= spectralEfficiency))
-    {
-        ++mcs;
-    }
+    uint8_t mcs = m_mcsForCqi[cqi];
 
     NS_LOG_LOGIC("mcs = " << mcs);
 
@@ -140,10 +138,23 @@ MmWaveAmc::CalculateTbSize(uint8_t mcs, uint8_t nSym) const
 {
     NS_LOG_FUNCTION(this << +mcs);
 
-    NS_ASSERT_MSG(mcs <= m_errorModel->GetMaxMcs(),
-                  "MCS=" << +mcs << " while maximum MCS is " << +(m_errorModel->GetMaxMcs()));
+    NS_ASSERT_MSG(mcs <= m_maxMcs, "MCS=" << +mcs << " while maximum MCS is " << m_maxMcs);
 
-    uint32_t payloadSize = GetPayloadSize(mcs, nSym);
+    if (nSym > m_symbolsPerSlot)
+    {
+        return ComputeTbSize(mcs, nSym);
+    }
+    uint32_t tbSize = m_tbSizeTable[mcs * (m_symbolsPerSlot + 1) + nSym];
+
+    NS_LOG_INFO(" mcs:" << (unsigned)mcs << " TB size:" << tbSize);
+
+    return tbSize;
+}
+
+uint32_t
+MmWaveAmc::ComputeTbSize(uint8_t mcs, uint8_t nSym) const
+{
+    uint32_t payloadSize = ComputePayloadSize(mcs, nSym);
     uint32_t tbSize = payloadSize;
 
     if (payloadSize >= m_crcLen)
@@ -161,28 +172,35 @@ MmWaveAmc::CalculateTbSize(uint8_t mcs, uint8_t nSym) const
                                                       // blocks, in case of code block segmentation
     }
 
-    NS_LOG_INFO(" mcs:" << (unsigned)mcs << " TB size:" << tbSize);
-
     return tbSize;
 }
 
 uint8_t
 MmWaveAmc::GetMinNumSymForTbSize(uint32_t tbSize, uint8_t mcs) const
 {
-    uint32_t effTbSize{0};
-    uint8_t numSym{0};
-    while (effTbSize < tbSize && numSym < m_phyMacConfig->GetSymbPerSlot())
-    {
-        numSym++;
-        effTbSize = CalculateTbSize(mcs, numSym);
-    }
-    NS_ABORT_MSG_IF(effTbSize < tbSize, "No way to create such TB size, something went wrong!");
+    NS_ABORT_MSG_IF(mcs > m_maxMcs, "MCS=" << +mcs << " while maximum MCS is " << m_maxMcs);
+
+    // the first number of symbols whose largest TB size so far is large enough
+    auto first = m_maxTbSizeTable.begin() + mcs * (m_symbolsPerSlot + 1);
+    auto last = first + m_symbolsPerSlot + 1;
+    auto it = std::lower_bound(first, last, tbSize);
+    NS_ABORT_MSG_IF(it == last, "No way to create such TB size, something went wrong!");
 
-    return numSym;
+    return it - first;
 }
 
 uint32_t
 MmWaveAmc::GetPayloadSize(uint8_t mcs, uint8_t nSym) const
+{
+    if (mcs > m_maxMcs || nSym > m_symbolsPerSlot)
+    {
+        return ComputePayloadSize(mcs, nSym);
+    }
+    return m_payloadSizeTable[mcs * (m_symbolsPerSlot + 1) + nSym];
+}
+
+uint32_t
+MmWaveAmc::ComputePayloadSize(uint8_t mcs, uint8_t nSym) const
 {
     uint32_t effNumRb{static_cast<uint32_t>(nSym) * m_phyMacConfig->GetNumRb()};
     return m_errorModel->GetPayloadSize(MmWavePhyMacCommon::SUBCARRIERS_PER_RB -
@@ -226,7 +244,7 @@ MmWaveAmc::CreateCqiFeedbackWbTdma(const SpectrumValue& sinr, uint8_t& mcs) cons
                  * NB: SINR must be expressed in linear units
                  */
 
-                double se = log2(1 + (itSinr / ((-std::log(5.0 * m_ber)) / 1.5)));
+                double se = log2(1 + (itSinr / m_shannonGap));
                 seAvg += se;
 
                 int cqi = GetCqiFromSpectralEfficiency(se);
@@ -292,12 +310,7 @@ MmWaveAmc::CreateCqiFeedbackWbTdma(const SpectrumValue& sinr, uint8_t& mcs) cons
         }
         else
         {
-            double s = m_errorModel->GetSpectralEfficiencyForMcs(mcs);
-            cqi = 0;
-            while ((cqi < 15) && (m_errorModel->GetSpectralEfficiencyForCqi(cqi + 1) <= s))
-            {
-                ++cqi;
-            }
+            cqi = m_cqiForMcs[mcs];
         }
         NS_LOG_DEBUG(this << "\t MCS " << (uint16_t)mcs << "-> CQI " << cqi);
     }
@@ -309,11 +322,9 @@ MmWaveAmc::GetCqiFromSpectralEfficiency(double s) const
 {
     NS_LOG_FUNCTION(s);
     NS_ASSERT_MSG(s >= 0.0, "negative spectral efficiency = " << s);
-    uint8_t cqi = 0;
-    while ((cqi < 15) && (m_errorModel->GetSpectralEfficiencyForCqi(cqi + 1) < s))
-    {
-        ++cqi;
-    }
+    // the number of CQIs above 0 with a spectral efficiency lower than s
+    uint8_t cqi = std::lower_bound(m_seForCqi.begin() + 1, m_seForCqi.end(), s) -
+                  (m_seForCqi.begin() + 1);
     NS_LOG_LOGIC("cqi = " << cqi);
     return cqi;
 }
@@ -323,12 +334,9 @@ MmWaveAmc::GetMcsFromSpectralEfficiency(double s) const
 {
     NS_LOG_FUNCTION(s);
     NS_ASSERT_MSG(s >= 0.0, "negative spectral efficiency = " << s);
-    uint8_t mcs = 0;
-    while ((mcs < m_errorModel->GetMaxMcs()) &&
-           (m_errorModel->GetSpectralEfficiencyForMcs(mcs + 1) < s))
-    {
-        ++mcs;
-    }
+    // the number of MCSs above 0 with a spectral efficiency lower than s
+    uint8_t mcs = std::lower_bound(m_seForMcs.begin() + 1, m_seForMcs.end(), s) -
+                  (m_seForMcs.begin() + 1);
     NS_LOG_LOGIC("cqi = " << mcs);
     return mcs;
 }
@@ -337,7 +345,7 @@ uint32_t
 MmWaveAmc::GetMaxMcs() const
 {
     NS_LOG_FUNCTION(this);
-    return m_errorModel->GetMaxMcs();
+    return m_maxMcs;
 }
 
 void
@@ -364,6 +372,7 @@ MmWaveAmc::SetErrorModelType(const TypeId& type)
     factory.SetTypeId(m_errorModelType);
     m_errorModel = DynamicCast<MmWaveErrorModel>(factory.Create());
     NS_ASSERT(m_errorModel != nullptr);
+    UpdateTables();
 }
 
 TypeId
@@ -373,6 +382,64 @@ MmWaveAmc::GetErrorModelType() const
     return m_errorModelType;
 }
 
+void
+MmWaveAmc::UpdateTables()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_errorModel == nullptr)
+    {
+        return;
+    }
+
+    m_maxMcs = m_errorModel->GetMaxMcs();
+    m_symbolsPerSlot = m_phyMacConfig->GetSymbPerSlot();
+    m_tbSizeTable.clear();
+    m_payloadSizeTable.clear();
+    m_maxTbSizeTable.clear();
+    for (uint32_t mcs = 0; mcs <= m_maxMcs; mcs++)
+    {
+        uint32_t maxTbSize = 0;
+        for (uint32_t nSym = 0; nSym <= m_symbolsPerSlot; nSym++)
+        {
+            m_payloadSizeTable.push_back(ComputePayloadSize(mcs, nSym));
+            m_tbSizeTable.push_back(ComputeTbSize(mcs, nSym));
+            if (nSym > 0)
+            {
+                maxTbSize = std::max(maxTbSize, m_tbSizeTable.back());
+            }
+            m_maxTbSizeTable.push_back(maxTbSize);
+        }
+    }
+
+    m_seForMcs.clear();
+    for (uint32_t mcs = 0; mcs <= m_maxMcs; mcs++)
+    {
+        m_seForMcs.push_back(m_errorModel->GetSpectralEfficiencyForMcs(mcs));
+    }
+    m_seForCqi.clear();
+    for (uint8_t cqi = 0; cqi <= 15; cqi++)
+    {
+        m_seForCqi.push_back(m_errorModel->GetSpectralEfficiencyForCqi(cqi));
+    }
+    NS_ABORT_MSG_UNLESS(std::is_sorted(m_seForMcs.begin(), m_seForMcs.end()) &&
+                            std::is_sorted(m_seForCqi.begin() + 1, m_seForCqi.end()),
+                        "The spectral efficiency of " << m_errorModelType.GetName()
+                                                      << " must not decrease with the MCS or CQI");
+
+    m_mcsForCqi.clear();
+    for (double s : m_seForCqi)
+    {
+        m_mcsForCqi.push_back(std::upper_bound(m_seForMcs.begin() + 1, m_seForMcs.end(), s) -
+                              (m_seForMcs.begin() + 1));
+    }
+    m_cqiForMcs.clear();
+    for (double s : m_seForMcs)
+    {
+        m_cqiForMcs.push_back(std::upper_bound(m_seForCqi.begin() + 1, m_seForCqi.end(), s) -
+                              (m_seForCqi.begin() + 1));
+    }
+}
+
 } // end namespace mmwave
 
 } // end namespace ns3
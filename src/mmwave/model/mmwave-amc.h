@@ -28,6 +28,8 @@
 
 #include <ns3/mmwave-error-model.h>
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -46,6 +48,11 @@ namespace mmwave
  * configure the ErrorModel type, which must be the same as the one set in the
  * MmWaveSpectrumPhy class.
  *
+ * The TB and payload sizes of every MCS and number of OFDM symbols in a slot,
+ * and the mappings between CQI, MCS and spectral efficiency, are computed when
+ * the error model type or the mode are set, so that the schedulers only look
+ * them up.
+ *
  * \todo Pass MmWaveAmc parameters through RRC, and don't pass pointers to AMC
  * between GNB and UE
  */
@@ -222,7 +229,30 @@ class MmWaveAmc : public Object
     uint32_t GetPayloadSize(uint8_t mcs, uint8_t nSym) const;
 
   private:
+    /**
+     * \brief Compute the TB size (in bytes) with the error model
+     * \param mcs the MCS of the transmission
+     * \param nSym the number of allocated OFDM symbols
+     * \return the TBS in bytes
+     */
+    uint32_t ComputeTbSize(uint8_t mcs, uint8_t nSym) const;
+
+    /**
+     * \brief Compute the payload size (in bytes) with the error model
+     * \param mcs the MCS of the transmission
+     * \param nSym the number of allocated OFDM symbols
+     * \return the payload size in bytes
+     */
+    uint32_t ComputePayloadSize(uint8_t mcs, uint8_t nSym) const;
+
+    /**
+     * \brief Fill the TB size, payload size, CQI and MCS tables for the current
+     * error model and mode
+     */
+    void UpdateTables();
+
     double m_ber;                       //!< The target BER. Used only by the ShannonModel AMC
+    double m_shannonGap{0};             //!< The SNR gap of the ShannonModel, -ln(5*BER)/1.5
     AmcModel m_amcModel;                //!< Type of the CQI feedback model
     Ptr<MmWaveErrorModel> m_errorModel; //!< Pointer to an instance of ErrorModel
     TypeId m_errorModelType;            //!< Type of the error model
@@ -232,6 +262,19 @@ class MmWaveAmc : public Object
         12; //!< The number of PDSCH OFDM symbols to be used for CQI determination. See Sec. 5.2.2.5
             //!< of TS 38.214
     Ptr<MmWavePhyMacCommon> m_phyMacConfig; //!< Pointer to an instance of MmWavePhyMacCommon
+
+    uint32_t m_maxMcs{0};                     //!< The maximum MCS of the error model
+    uint32_t m_symbolsPerSlot{0};             //!< The number of OFDM symbols in a slot
+    std::vector<uint32_t> m_tbSizeTable;      //!< TB size of MCS m and n OFDM symbols, at
+                                              //!< index m * (m_symbolsPerSlot + 1) + n
+    std::vector<uint32_t> m_payloadSizeTable; //!< Payload sizes, laid out as m_tbSizeTable
+    std::vector<uint32_t> m_maxTbSizeTable;   //!< Largest TB size with at most n OFDM symbols,
+                                              //!< laid out as m_tbSizeTable
+    std::vector<double> m_seForMcs;           //!< Spectral efficiency of each MCS
+    std::vector<double> m_seForCqi;           //!< Spectral efficiency of each CQI
+    std::vector<uint8_t> m_mcsForCqi;         //!< MCS of each CQI, see GetMcsFromCqi
+    std::vector<uint8_t> m_cqiForMcs;         //!< Highest CQI not above the spectral
+                                              //!< efficiency of each MCS
 };
 
 } // end namespace mmwave
@@ -255,5 +255,65 @@ MmWaveDlHarqFeedbackMessage::GetDlHarqFeedback(void)
     return m_dlHarqInfo;
 }
 
+MmWaveControlMessageBundle::MmWaveControlMessageBundle(
+    const std::list<Ptr<MmWaveControlMessage>>& msgList)
+    : m_messages(msgList.begin(), msgList.end())
+{
+    for (std::size_t i = 0; i < m_messages.size(); i++)
+    {
+        if (m_messages[i]->GetMessageType() == MmWaveControlMessage::DCI_TDMA)
+        {
+            Ptr<MmWaveTdmaDciMessage> dciMsg = DynamicCast<MmWaveTdmaDciMessage>(m_messages[i]);
+            m_dcis[dciMsg->GetDciInfoElement().m_rnti].push_back(i);
+        }
+        else
+        {
+            m_common.push_back(i);
+        }
+    }
+}
+
+bool
+MmWaveControlMessageBundle::IsEmpty() const
+{
+    return m_messages.empty();
+}
+
+std::list<Ptr<MmWaveControlMessage>>
+MmWaveControlMessageBundle::GetMessages() const
+{
+    return std::list<Ptr<MmWaveControlMessage>>(m_messages.begin(), m_messages.end());
+}
+
+std::list<Ptr<MmWaveControlMessage>>
+MmWaveControlMessageBundle::GetMessages(uint16_t rnti) const
+{
+    std::list<Ptr<MmWaveControlMessage>> msgList;
+    auto dcis = m_dcis.find(rnti);
+    if (dcis == m_dcis.end())
+    {
+        for (std::size_t i : m_common)
+        {
+            msgList.push_back(m_messages[i]);
+        }
+        return msgList;
+    }
+    // merge the two lists of positions
+    auto common = m_common.begin();
+    for (std::size_t i : dcis->second)
+    {
+        while (common != m_common.end() && *common < i)
+        {
+            msgList.push_back(m_messages[*common++]);
+        }
+        msgList.push_back(m_messages[i]);
+    }
+    while (common != m_common.end())
+    {
+        msgList.push_back(m_messages[*common++]);
+    }
+    return msgList;
+}
+
 } // namespace mmwave
 } // namespace ns3
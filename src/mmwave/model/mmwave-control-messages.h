@@ -36,6 +36,8 @@
 #include <ns3/simple-ref-count.h>
 
 #include <list>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -312,6 +314,47 @@ class MmWaveDlHarqFeedbackMessage : public MmWaveControlMessage
     DlHarqInfo m_dlHarqInfo;
 };
 
+/**
+ * \ingroup mmwave
+ * The control messages sent by an eNB in a DL control frame, indexed by the
+ * RNTI of the DCIs, so that each UE of the cell finds its own DCIs without
+ * inspecting the DCIs of the other UEs. The bundle is immutable, and shared
+ * by all the receivers of the frame.
+ */
+class MmWaveControlMessageBundle : public SimpleRefCount<MmWaveControlMessageBundle>
+{
+  public:
+    /**
+     * \brief Create the bundle of a list of control messages
+     * \param msgList the control messages, in the order in which they are sent
+     */
+    MmWaveControlMessageBundle(const std::list<Ptr<MmWaveControlMessage>>& msgList);
+
+    /**
+     * \return true if the bundle has no control message
+     */
+    bool IsEmpty() const;
+
+    /**
+     * \return all the control messages, in the order in which they are sent
+     */
+    std::list<Ptr<MmWaveControlMessage>> GetMessages() const;
+
+    /**
+     * \brief Get the control messages of interest for a UE
+     * \param rnti the RNTI of the UE
+     * \return the DCIs for the RNTI and the messages which are not DCIs, in
+     *         the order in which they are sent
+     */
+    std::list<Ptr<MmWaveControlMessage>> GetMessages(uint16_t rnti) const;
+
+  private:
+    std::vector<Ptr<MmWaveControlMessage>> m_messages; //!< the messages, in order
+    std::vector<std::size_t> m_common; //!< the positions of the messages which are not DCIs
+    std::unordered_map<uint16_t, std::vector<std::size_t>>
+        m_dcis; //!< the positions of the DCIs of each RNTI
+};
+
 } // namespace mmwave
 
 } // namespace ns3
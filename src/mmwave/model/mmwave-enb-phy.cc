@@ -108,7 +108,9 @@ MmWaveEnbPhy::GetTypeId(void)
                           MakeDoubleChecker<double>())
             .AddAttribute(
                 "NoiseAndFilter",
-                "If true, use noisy SINR samples, filtered. If false, just use the SINR measure",
+                "If true, use noisy SINR samples, filtered. If false, just use the SINR measure. "
+                "The noise of the samples of all the UEs is drawn from a single random variable "
+                "of the eNB, whose stream MmWaveHelper::AssignStreams fixes",
                 BooleanValue(false),
                 MakeBooleanAccessor(&MmWaveEnbPhy::m_noiseAndFilter),
                 MakeBooleanChecker())
@@ -169,6 +171,7 @@ void
 MmWaveEnbPhy::DoInitialize(void)
 {
     NS_LOG_FUNCTION(this);
+    m_numerology = MmWaveNumerology(m_phyMacConfig);
     Ptr<SpectrumValue> noisePsd =
         MmWaveSpectrumValueHelper::CreateNoisePowerSpectralDensity(m_phyMacConfig, m_noiseFigure);
     m_downlinkSpectrumPhy->SetNoisePowerSpectralDensity(noisePsd);
@@ -199,6 +202,10 @@ MmWaveEnbPhy::DoInitialize(void)
     NS_LOG_DEBUG("In mmWaveEnbPhy, the transient duration is: " << m_transient << " microseconds");
     if (m_noiseAndFilter)
     {
+        // created only when needed, so that the other random variables keep their streams
+        m_sinrNoise =
+            CreateObjectWithAttributes<NormalRandomVariable>("Stream",
+                                                             IntegerValue(m_sinrNoiseStream));
         NS_ASSERT_MSG(
             (double)m_transient / m_updateSinrPeriod >= 16,
             "Window too small to compute the variance according to the ApplyFilter method");
@@ -212,241 +219,109 @@ MmWaveEnbPhy::DoDispose(void)
 {
 }
 
-// TODO remove these methods
-// Function for average
-double
-MmWaveEnbPhy::MakeAvg(std::vector<double> v)
+void
+MmWaveSinrHistory::Add(double sinr, double noisySinr, bool grow)
 {
-    double return_value = 0.0;
-    int n = v.size();
-
-    for (int i = 0; i < n; i++)
+    Sample sample;
+    sample.sinr = sinr;
+    sample.noisySinr = noisySinr;
+    sample.noisySinrDb = 10 * std::log10(noisySinr);
+    sample.var = std::nan("");
+    sample.lowVarRun = 0;
+    sample.highSinrRun = sample.noisySinrDb > 10 ? 1 : 0;
+    if (!m_samples.empty())
     {
-        return_value += v.at(i);
+        const Sample& previous = GetSample(m_samples.size() - 1);
+        double mean = (previous.noisySinrDb + sample.noisySinrDb) / 2;
+        sample.var = (std::pow(previous.noisySinrDb - mean, 2) +
+                      std::pow(sample.noisySinrDb - mean, 2)) /
+                     2;
+        sample.lowVarRun = sample.var < 1 ? previous.lowVarRun + 1 : 0;
+        sample.highSinrRun = sample.highSinrRun > 0 ? previous.highSinrRun + 1 : 0;
     }
 
-    return (return_value / v.size());
-}
-
-//****************End of average funtion****************
-
-// Function for variance
-double
-MmWaveEnbPhy::MakeVar(std::vector<double> v, double mean)
-{
-    double sum = 0.0;
-    double temp = 0.0;
-    double var = 0.0;
-    int n = v.size();
-
-    for (int j = 0; j < n; j++)
+    // the filter needs at least two samples, even for the UEs which attach after the transient
+    if (grow || m_samples.size() < 2)
+    {
+        std::rotate(m_samples.begin(), m_samples.begin() + m_head, m_samples.end());
+        m_head = 0;
+        m_samples.push_back(sample);
+    }
+    else
     {
-        temp = std::pow((v.at(j) - mean), 2);
-        sum += temp;
+        m_samples[m_head] = sample;
+        m_head = (m_head + 1) % m_samples.size();
     }
+}
 
-    return var = sum / (v.size());
+uint32_t
+MmWaveSinrHistory::GetSize() const
+{
+    return m_samples.size();
 }
 
-//****************End of variance funtion****************
+const MmWaveSinrHistory::Sample&
+MmWaveSinrHistory::GetSample(uint32_t i) const
+{
+    return m_samples[(m_head + i) % m_samples.size()];
+}
 
 double
-MmWaveEnbPhy::AddGaussianNoise(double LastSinrValue)
+MmWaveSinrHistory::GetLastNoisySinr() const
 {
-    double N0 = 3.98107170e-12;
-    std::complex<double> gaussianNoise;
-    double signalEnergy;
-    double noisySample;
-
-    Ptr<NormalRandomVariable> randomVariable = CreateObject<NormalRandomVariable>();
-    double gaussianSampleRe = randomVariable->GetValue();
-    double gaussianSampleIm = randomVariable->GetValue();
-    gaussianNoise = std::complex<double>(sqrt(0.5) * sqrt(N0) * gaussianSampleRe,
-                                         sqrt(0.5) * sqrt(N0) * gaussianSampleIm);
-
-    signalEnergy = LastSinrValue * N0;
-
-    noisySample = (std::pow(std::abs(sqrt(signalEnergy) + gaussianNoise), 2) - N0) / N0;
-
-    return noisySample;
+    NS_ASSERT_MSG(!m_samples.empty(), "The SINR history is empty");
+    return GetSample(m_samples.size() - 1).noisySinr;
 }
 
-std::pair<uint64_t, uint64_t>
-MmWaveEnbPhy::ApplyFilter(std::vector<double> noisySinr)
+double
+MmWaveSinrHistory::GetFilteredSinr() const
 {
-    std::vector<double> noisySinrdB;
-    for (uint64_t i = 0; i < noisySinr.size(); ++i)
-    {
-        noisySinrdB.push_back(10 * std::log10(noisySinr.at(i)));
-    }
+    NS_ASSERT_MSG(!m_samples.empty(), "The SINR history is empty");
+    const uint32_t size = m_samples.size();
+    const Sample& last = GetSample(size - 1);
 
-    std::vector<double> vectorVar;
-    NS_LOG_DEBUG("noisySinrdBSize() " << noisySinrdB.size());
-    for (uint64_t i = 0; i < noisySinrdB.size() - 1; ++i)
+    // the filter is applied only if the last sample has a high variance or a low SINR
+    if (size < 3 || !(last.var > 5 || std::isnan(last.var) || last.noisySinr < 10))
     {
-        std::vector<double> partialSamples;
-        partialSamples.push_back(noisySinrdB.at(i));
-        partialSamples.push_back(noisySinrdB.at(i + 1));
-        double meanValue = MakeAvg(partialSamples);
-        double varValue = MakeVar(partialSamples, meanValue);
-        vectorVar.push_back(varValue);
-        partialSamples.clear();
+        return last.noisySinr;
     }
+    uint32_t end = size - 1;
 
-    uint64_t startFilter = 1e6;
-    uint64_t endFilter = 1e6;
-
-    bool flagStartFilter = true;
-    bool flagEndFilter = true;
-
-    uint64_t noisySinrIndex = 0;
-
-    for (uint64_t varIndex = vectorVar.size() - 1; varIndex > 0;
-         varIndex--) // start filter when variance of the noisy trace is high
-    {
-        NS_LOG_DEBUG("varIndex " << varIndex);
-        noisySinrIndex = varIndex + 1;
-        NS_LOG_DEBUG("vectorVar[i] " << vectorVar.at(varIndex));
-        NS_LOG_DEBUG("vectorVar[i] == NaN " << (std::isnan(vectorVar.at(varIndex))));
-        bool highVariance = (vectorVar.at(varIndex) > 5 || std::isnan(vectorVar.at(varIndex)));
-        bool lowSinr = noisySinr.at(noisySinrIndex) < 10;
-
-        if (highVariance ||
-            (lowSinr && !highVariance)) // filter is applied only for low-SINR regimes [dB]
-        {
-            endFilter = noisySinrIndex;
-            flagEndFilter = false; // a "start" sample has been identified
-            break;
-        }
-    }
-
-    if (flagEndFilter) // in this case, we can avoid the filtering
-    {
-        endFilter = 0;
-    }
-
-    /* in this case, consider at least a window of 15 samples, after which we can consider
-     * as we are leaving the blockage phase and we start coming back to LOS PL regimes
+    /* the blockage starts after the last window of at least 16 samples in which the variance of
+     * the noisy trace is low, or the SINR is high
      */
-    uint64_t varIndex = 0;
-    uint64_t numberOfVarWindow = 16;
-    NS_LOG_DEBUG("VectorVarSize() " << vectorVar.size());
-    for (uint64_t noisySinrIndex = endFilter; noisySinrIndex > numberOfVarWindow;
-         --noisySinrIndex) // must be at least after the beginnning of the blocakge
+    const uint32_t window = 16;
+    uint32_t start = 0;
+    for (uint32_t i = end; i > window; i--)
     {
-        NS_LOG_DEBUG("noisySinrIndex " << noisySinrIndex);
-        varIndex = noisySinrIndex - 1;
-
-        std::vector<double>::const_iterator first = vectorVar.begin() + varIndex;
-        std::vector<double>::const_iterator last =
-            vectorVar.begin() + varIndex -
-            (numberOfVarWindow - 1); // vectorVar has one sample less than noisySinrdB
-        std::vector<double> prov(last, first);
-
-        std::vector<double>::const_iterator firstNoisy = noisySinrdB.begin() + noisySinrIndex;
-        std::vector<double>::const_iterator lastNoisy =
-            noisySinrdB.begin() + noisySinrIndex - numberOfVarWindow;
-        std::vector<double> provNoisy(lastNoisy, firstNoisy);
-
-        NS_LOG_INFO("provNoisy.size " << provNoisy.size());
-        for (std::vector<double>::const_iterator h = provNoisy.begin(); h != provNoisy.end(); h++)
-        {
-            NS_LOG_INFO("h " << *h);
-            NS_LOG_INFO("i " << noisySinrIndex);
-            NS_LOG_INFO("hh " << *(noisySinrdB.begin() + noisySinrIndex - numberOfVarWindow));
-        }
-
-        /* the filtering ends when the variance of the noisy trace is almost the same, so when
-         * the SINR is on sufficiently high values
-         */
-
-        if (Simulator::Now() > Seconds(2.1) && Simulator::Now() < Seconds(2.3))
-        {
-            NS_LOG_DEBUG(
-                "(std::all_of(prov.begin(),prov.end(), [](double j){return j < 1;})) "
-                << (std::all_of(prov.begin(), prov.end(), [](double j) { return j < 1; })));
-            NS_LOG_DEBUG("(std::all_of(prov.begin(),prov.end(), [](double j){nan;})) "
-                         << (std::all_of(prov.begin(), prov.end(), [](double k) {
-                                return !std::isnan(k);
-                            })));
-            NS_LOG_DEBUG(
-                "(std::all_of(provNoisy.begin(),provNoisy.end(), [](double p){return p > 10;})) "
-                << (std::all_of(provNoisy.begin(), provNoisy.end(), [](double p) {
-                       return p > 10;
-                   })));
-        }
-
-        if (((std::all_of(prov.begin(), prov.end(), [](double j) { return j < 1; })) &&
-             (std::all_of(prov.begin(), prov.end(), [](double k) { return !std::isnan(k); }))) ||
-            (std::all_of(provNoisy.begin(), provNoisy.end(), [](double p) { return p > 10; })))
+        const Sample& previous = GetSample(i - 1);
+        if (previous.lowVarRun >= window - 1 || previous.highSinrRun >= window)
         {
-            startFilter = noisySinrIndex;
-            flagStartFilter = false; // a "end" sample has been identified
+            start = i;
             break;
         }
-
-        // bool lowVariance = (vectorVar.at(varIndex) < 1 && !std::isnan(vectorVar.at(varIndex)));
-        // bool highSinr = noisySinr.at(noisySinrIndex) > 10;
-
-        // if (highSinr && lowVariance)  // filter is applied only for low-SINR regimes [dB]
-        // {
-        //        startFilter = noisySinrIndex;
-        //        flagStartFilter = false; // a "start" sample has been identified
-        //        break;
-        // }
     }
-
-    if (flagStartFilter) // in this case, filter till the end of the trace
+    if (start == end)
     {
-        startFilter = 0;
+        return last.noisySinr;
     }
 
-    std::pair<uint64_t, uint64_t> pairFiltering = std::make_pair(startFilter, endFilter);
-
-    return pairFiltering;
-}
-
-std::vector<double>
-MmWaveEnbPhy::MakeFilter(std::vector<double> noisySinr,
-                         std::vector<double> realSinr,
-                         std::pair<uint64_t, uint64_t> pairFiltering)
-{
-    for (uint64_t i = 0; i < noisySinr.size(); ++i)
-    {
-        NS_LOG_DEBUG("() " << noisySinr.at(i));
-    }
-    // const uint64_t lengthFiltering  = (std::get<1>(pairFiltering) - std::get<0>(pairFiltering));
-    /* find best alpha parameter for the Kalman estimation */
-    int rep = 0;
+    /* find the best alpha parameter for the exponential average during the blockage */
     std::array<double, 100> meanError;
+    uint32_t rep = 0;
     for (double alpha = 0; alpha < 1; alpha = alpha + 0.01)
     {
-        std::vector<double> x;
-        x.push_back(0); // initialization of array
-        int counter = 0;
-
-        for (uint64_t i = std::get<0>(pairFiltering); i < std::get<1>(pairFiltering); i++)
-        {
-            x.push_back((1 - alpha) * x.at(counter) + alpha * (noisySinr.at(i)));
-            counter++;
-        }
-
-        std::vector<double> errorEstimation;
-        counter = 0;
-        for (uint64_t i = std::get<0>(pairFiltering); i < std::get<1>(pairFiltering); i++)
+        double x = 0;
+        double error = 0;
+        for (uint32_t i = start; i < end; i++)
         {
-            errorEstimation.push_back(std::abs(x.at(counter + 1) - realSinr.at(i)));
-            counter++;
-        }
-
-        meanError.at(rep) = MakeAvg(errorEstimation);
-        if (Simulator::Now() > Seconds(2.1) && Simulator::Now() < Seconds(2.3))
-        {
-            NS_LOG_DEBUG("meanError " << meanError.at(rep) << " rep " << rep);
+            const Sample& sample = GetSample(i);
+            x = (1 - alpha) * x + alpha * sample.noisySinr;
+            error += std::abs(x - sample.sinr);
         }
+        meanError.at(rep) = error / (end - start);
         rep++;
     }
-
     int posMinAlpha =
         std::distance(meanError.begin(), std::min_element(meanError.begin(), meanError.end()));
     double minAlpha = (posMinAlpha + 1) * 0.01;
@@ -454,61 +329,44 @@ MmWaveEnbPhy::MakeFilter(std::vector<double> noisySinr,
     {
         minAlpha = 0.2;
     }
-    NS_LOG_DEBUG("! " << minAlpha);
 
-    std::vector<double> blockageTrace;
-    blockageTrace.push_back(0);
-    int counter = 0;
-    for (uint64_t i = std::get<0>(pairFiltering); i < std::get<1>(pairFiltering); i++)
+    /* the filtered trace stops one sample before the end of the blockage */
+    if (end - start == 1)
     {
-        NS_LOG_DEBUG(noisySinr.at(i));
-        blockageTrace.push_back((1 - minAlpha) * blockageTrace.at(counter) +
-                                minAlpha * (noisySinr.at(i)));
-        NS_LOG_DEBUG("fff " << blockageTrace.at(counter));
-        counter++;
+        return GetSample(start).noisySinr;
     }
-
-    std::vector<double> retFinalTrace;
-    /* first piece */
-    std::vector<double>::const_iterator firstPieceStart = noisySinr.begin();
-    std::vector<double>::const_iterator firstPieceEnd =
-        noisySinr.begin() + std::get<0>(pairFiltering) + 1;
-    std::vector<double> firstPiece;
-    firstPiece.insert(firstPiece.begin(), firstPieceStart, firstPieceEnd);
-    for (std::vector<double>::const_iterator i = firstPiece.begin(); i != firstPiece.end(); i++)
+    double filtered = 0;
+    for (uint32_t i = start; i < end - 1; i++)
     {
-        NS_LOG_DEBUG("/ " << *i);
-    }
-
-    /*last piece*/
-    std::vector<double>::const_iterator lastPieceStart =
-        noisySinr.begin() + std::get<1>(pairFiltering) + 1;
-    std::vector<double>::const_iterator lastPieceEnd = noisySinr.end();
-    std::vector<double> lastPiece;
-
-    firstPiece.insert(firstPiece.end(), blockageTrace.begin() + 1, blockageTrace.end() - 1);
-    for (std::vector<double>::const_iterator i = firstPiece.begin(); i != firstPiece.end(); i++)
-    {
-        NS_LOG_DEBUG("// " << *i);
+        filtered = (1 - minAlpha) * filtered + minAlpha * GetSample(i).noisySinr;
     }
+    return filtered;
+}
 
-    firstPiece.insert(firstPiece.end(), lastPieceStart, lastPieceEnd);
-    for (std::vector<double>::const_iterator i = firstPiece.begin(); i != firstPiece.end(); i++)
+int64_t
+MmWaveEnbPhy::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    m_sinrNoiseStream = stream;
+    if (m_sinrNoise)
     {
-        NS_LOG_DEBUG("/// " << *i);
+        m_sinrNoise->SetStream(stream);
     }
+    return 1;
+}
 
-    /* insert blockageTrace (from begin + 1, in order to AVOID THE TRANSIENT, to end) in the
-     * noisySinr trace, after std::get<0>(pairFiltering) +1 samples, which are the samples in which
-     * we estimate that a blockage occurs and the Kalmn filter is applied
-     */
-    // std::copy(blockageTrace.begin(),blockageTrace.end(),noisySinr.begin()+std::get<0>(pairFiltering)
-    // );
-    // std::copy(blockageTrace.begin()+1,blockageTrace.end(),noisySinr.begin()+std::get<0>(pairFiltering)+1
-    // ); // AVOID TRANSIENT
-
-    return firstPiece; // this noisySinr trace has already been updated with the filtered samples,
-                       // where applied.
+double
+MmWaveEnbPhy::AddGaussianNoise(double LastSinrValue)
+{
+    const double N0 = 3.98107170e-12;
+    const double noiseStdDev = sqrt(0.5) * sqrt(N0);
+    double gaussianSampleRe = m_sinrNoise->GetValue();
+    double gaussianSampleIm = m_sinrNoise->GetValue();
+    std::complex<double> gaussianNoise(noiseStdDev * gaussianSampleRe,
+                                       noiseStdDev * gaussianSampleIm);
+    double signalEnergy = LastSinrValue * N0;
+
+    return (std::pow(std::abs(sqrt(signalEnergy) + gaussianNoise), 2) - N0) / N0;
 }
 
 void
@@ -726,166 +584,31 @@ MmWaveEnbPhy::UpdateUeSinrEstimate()
         if (m_noiseAndFilter)
         {
             pairDevices_t pairDevices =
-                std::make_pair(ue->first, m_cellId);            // this is the current pair (UE-eNB)
-            auto iteratorSinr = m_sinrVector.find(pairDevices); // pair [pairDevices,Sinrvalue]
-            if (iteratorSinr != m_sinrVector.end()) // this map has already been initialized, so I
-                                                    // can add a new element for the SINR collection
-            {
-                if (Now().GetMicroSeconds() <= m_transient)
-                {
-                    m_sinrVector.at(pairDevices)
-                        .push_back(sinrAvg); // before transient, so just collect SINR values
-                }
-                else
-                {
-                    m_sinrVector.at(pairDevices).erase(m_sinrVector.at(pairDevices).begin());
-                    m_sinrVector.at(pairDevices)
-                        .push_back(sinrAvg); // before transient, so just collect SINR values
-                }
-
-                NS_LOG_DEBUG("At time " << Now().GetMicroSeconds() << " push back the REAL SINR "
-                                        << 10 * std::log10(sinrAvg) << " for pair with CellId "
-                                        << m_cellId << " and UE " << ue->first);
-            }
-            else // vector is not initialized, so it means that we are still in the initial
-                 // transient phase, for that pair
+                std::make_pair(ue->first, m_cellId); // this is the current pair (UE-eNB)
+            MmWaveSinrHistory& history = m_sinrHistory[pairDevices];
+
+            /* generate Gaussian noise for the current SINR value, and collect both. During the
+             * transient the history grows, then the oldest sample is removed at each update */
+            bool transient = Now().GetMicroSeconds() <= m_transient;
+            history.Add(sinrAvg, AddGaussianNoise(sinrAvg), transient);
+            NS_LOG_DEBUG("At time " << Now().GetMicroSeconds() << " push back the REAL SINR "
+                                    << 10 * std::log10(sinrAvg) << " for pair with CellId "
+                                    << m_cellId << " and UE " << ue->first);
+
+            /* before the transient is over, just forward the (last) noisy sample, without
+             * filtering it. Otherwise, apply the filter where the SINR is too low and we are in
+             * a blockage situation */
+            double sampleToForward =
+                transient ? history.GetLastNoisySinr() : history.GetFilteredSinr();
+            if (sampleToForward < 0) // this would be converted in NaN, in the log scale
             {
-                m_sinrVector.insert(std::make_pair(pairDevices, std::vector<double>()));
-                m_sinrVector.at(pairDevices).push_back(sinrAvg); // push back a new SINR value
-                NS_LOG_DEBUG("At time " << Now().GetMicroSeconds()
-                                        << " first initializazion and push back the SINR "
-                                        << 10 * std::log10(sinrAvg) << " for pair with CellId "
-                                        << m_cellId << " and UE " << ue->first);
+                sampleToForward = 1e-20;
             }
-
-            auto iteratorFinalTrace =
-                m_finalSinrVector.find(pairDevices); // pair [pairDevices,Sinrvalue]
-            if (iteratorFinalTrace == m_finalSinrVector.end())
-            {
-                m_samplesFilter.insert(
-                    std::make_pair(pairDevices, std::pair<uint64_t, uint64_t>()));
-                m_finalSinrVector.insert(std::make_pair(pairDevices, std::vector<double>()));
-            }
-
-            auto iteratorSinrToFilter =
-                m_sinrVectorToFilter.find(pairDevices); // pair [pairDevices,Sinrvalue]
-            if (iteratorSinrToFilter == m_sinrVectorToFilter.end())
-            {
-                m_sinrVectorToFilter.insert(std::make_pair(pairDevices, std::vector<double>()));
-                m_sinrVectorNoisy.insert(std::make_pair(pairDevices, std::vector<double>()));
-            }
-
-            /* generate Gaussian noise for the last SINR value (that is the current one) */
-            double sinrNoisy = AddGaussianNoise(m_sinrVector.at(pairDevices).back());
-
-            /* UPDATE TRACE TO BE FILTERED */
-            if (Now().GetMicroSeconds() <= m_transient)
-            {
-                m_sinrVectorNoisy.at(pairDevices).push_back(sinrNoisy);
-
-                // if (sinrNoisy < 0)
-                // {
-                //        NS_LOG_DEBUG("Old SINR value was " << 10*std::log10(sinrNoisy) << " while
-                //        now is " << 10*std::log10(0.1)); sinrNoisy = 0.1;
-                // }
-                m_sinrVectorToFilter.at(pairDevices).push_back(sinrNoisy);
-            }
-            else
-            {
-                m_sinrVectorNoisy.at(pairDevices).erase(m_sinrVectorNoisy.at(pairDevices).begin());
-                m_sinrVectorNoisy.at(pairDevices).push_back(sinrNoisy);
-
-                // if (sinrNoisy < 0)
-                // {
-                //        NS_LOG_DEBUG("Old SINR value was " << 10*std::log10(sinrNoisy) << " while
-                //        now is " << 10*std::log10(0.1)); sinrNoisy = 0.1;
-                // }
-
-                double toPlot = *m_sinrVectorToFilter.at(pairDevices).begin();
-                double toPlotbis = sinrNoisy;
-                NS_LOG_DEBUG("(Remove SINR)  " << toPlot);
-                NS_LOG_DEBUG("(Add SINR)  " << toPlotbis);
-
-                m_sinrVectorToFilter.at(pairDevices)
-                    .erase(m_sinrVectorToFilter.at(pairDevices).begin());
-                m_sinrVectorToFilter.at(pairDevices).push_back(sinrNoisy);
-            }
-
-            if (Now().GetMicroSeconds() > m_transient) // apply filter only when I have a
-                                                       // sufficiently large set of SINR samples
-            {
-                std::vector<double> vectorNoisy = m_sinrVectorNoisy.at(pairDevices);
-                std::pair<uint64_t, uint64_t> pairFiltering = ApplyFilter(
-                    vectorNoisy); // find where to apply the filter, according to the variance
-                m_samplesFilter.at(pairDevices) = pairFiltering; // where to apply the linear filter
-                NS_LOG_DEBUG("Noisy vector start at sample " << std::get<0>(pairFiltering));
-                NS_LOG_DEBUG("Noisy vector end at sample " << std::get<1>(pairFiltering));
-
-                /* just apply filter where the SINR is too low and we are in a blockage situation */
-                if (std::get<0>(m_samplesFilter.at(pairDevices)) ==
-                    std::get<1>(m_samplesFilter.at(pairDevices))) // if start = end
-                {
-                    m_finalSinrVector.at(pairDevices) =
-                        m_sinrVectorToFilter.at(pairDevices); // no need to apply the filter
-                    NS_LOG_DEBUG("At time "
-                                 << Now().GetMicroSeconds()
-                                 << " there is no need to apply the Kalman filter for mmWave eNB "
-                                 << m_cellId << " and UE " << ue->first);
-                }
-                else
-                {
-                    std::vector<double> vectorToFilter = m_sinrVectorToFilter.at(pairDevices);
-                    std::vector<double> sinrVector = m_sinrVector.at(pairDevices);
-                    std::pair<uint64_t, uint64_t> filterPair = m_samplesFilter.at(pairDevices);
-                    m_finalSinrVector.at(pairDevices) =
-                        MakeFilter(vectorNoisy, sinrVector, filterPair);
-                    NS_LOG_DEBUG("finaltrace " << m_finalSinrVector.at(pairDevices).back());
-                }
-
-                /* the last sample in the filtered sequence is referred to the current time instant,
-                 * referred to the uplink reference signal that is used to build the RT in the
-                 * LteEnbRrc class */
-                double sampleToForward = m_finalSinrVector.at(pairDevices).back();
-                if (sampleToForward < 0) // this would be converted in NaN, in the log scale
-                {
-                    sampleToForward = 1e-20;
-                }
-                NS_LOG_DEBUG(" mmWave eNB " << m_cellId << " reports the SINR "
-                                            << 10 * std::log10(sampleToForward) << " for UE "
-                                            << ue->first);
-                m_sinrMap[ue->first] =
-                    sampleToForward; // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< in order to
-                                     // FORWARD to LteEnbRrc the value of SINR for the RT
-
-                // m_sinrVectorToFilter.at(pairDevices).erase(m_sinrVectorToFilter.at(pairDevices).begin());
-                // m_sinrVectorToFilter.at(pairDevices).push_back(m_finalSinrVector.at(pairDevices).back());
-                m_sinrVectorToFilter.at(pairDevices).pop_back();
-                m_sinrVectorToFilter.at(pairDevices)
-                    .push_back(m_finalSinrVector.at(pairDevices).back());
-            }
-            else // before the transient is over, just forwart the (last) noisy sample, without
-                 // having filtered
-            {
-                double sampleToForward = m_sinrVectorToFilter.at(pairDevices).back();
-                if (sampleToForward < 0) // this would be converted in NaN, in the log scale
-                {
-                    sampleToForward = 1e-20;
-                }
-                NS_LOG_DEBUG(" mmWave eNB " << m_cellId << " FIRST reports the SINR "
-                                            << 10 * std::log10(sampleToForward) << " for UE "
-                                            << ue->first);
-                m_sinrMap[ue->first] =
-                    sampleToForward; // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< in order to
-                                     // FORWARD to LteEnbRrc the value of SINR for the RT
-            }
-
-            /* after the SINR sample is forwarded, I need to REFRESH all the maps, so that
-             * a new SINR sequence can be created, to generate a new SINR sample
-             * for the next RT
-             */
-            m_finalSinrVector.erase(pairDevices);
-            m_samplesFilter.erase(pairDevices);
-            NS_LOG_DEBUG("ERASE MAPS FOR RT");
+            NS_LOG_DEBUG(" mmWave eNB " << m_cellId << " reports the SINR "
+                                        << 10 * std::log10(sampleToForward) << " for UE "
+                                        << ue->first);
+            // forward to LteEnbRrc the value of SINR for the RT
+            m_sinrMap[ue->first] = sampleToForward;
         }
         else // noise and filtering processes are not applied!
         {
@@ -920,7 +643,10 @@ MmWaveEnbPhy::UpdateUeSinrEstimate()
     }
 
     LteEnbCphySapUser::UeAssociatedSinrInfo info;
-    info.ueImsiSinrMap = m_sinrMap;
+    for (const auto& ueSinr : m_sinrMap)
+    {
+        info.ueSinrReport.Add(ueSinr.first, ueSinr.second);
+    }
     info.componentCarrierId = m_componentCarrierId;
     m_enbCphySapUser->UpdateUeSinrEstimate(info);
 
@@ -934,6 +660,12 @@ MmWaveEnbPhy::StartSlot(void)
 {
     NS_LOG_FUNCTION(this);
 
+    if (m_frameNum == 0 && m_sfNum == 0 && m_slotNum == 0 && !IsOnLocalNode())
+    {
+        // another rank of the distributed simulation runs this eNB
+        return;
+    }
+
     m_lastSlotStart = Simulator::Now();
     m_currSlotAllocInfo = m_slotAllocInfo[m_slotNum];
     NS_LOG_DEBUG("currSlotAllocInfo referring to: frame "
@@ -1022,7 +754,7 @@ MmWaveEnbPhy::StartTti(void)
         }
 
         unsigned ulSlotNum =
-            (m_slotNum + m_phyMacConfig->GetUlSchedDelay()) % m_phyMacConfig->GetSlotsPerSubframe();
+            (m_slotNum + m_numerology.GetUlSchedDelay()) % m_numerology.GetSlotsPerSubframe();
         for (unsigned iTti = 0; iTti < m_slotAllocInfo[ulSlotNum].m_ttiAllocInfo.size(); iTti++)
         {
             if (m_slotAllocInfo[ulSlotNum].m_ttiAllocInfo[iTti].m_ttiType != TtiAllocInfo::CTRL &&
@@ -1043,8 +775,7 @@ MmWaveEnbPhy::StartTti(void)
         }
 
         // DL control data duration
-        ttiPeriod = NanoSeconds(m_phyMacConfig->GetSymbolPeriod().GetNanoSeconds() *
-                                m_phyMacConfig->GetDlCtrlSymbols());
+        ttiPeriod = m_numerology.GetSymbolsDuration(m_numerology.GetDlCtrlSymbols());
         NS_LOG_DEBUG("ENB " << m_cellId << " TXing DL CTRL frame " << m_frameNum << " subframe "
                             << (unsigned)m_sfNum << " slot " << (uint16_t)m_slotNum << " symbols "
                             << (unsigned)currTti.m_dci.m_symStart << "-"
@@ -1061,8 +792,7 @@ MmWaveEnbPhy::StartTti(void)
     }
     else if (m_ttiIndex == m_currSlotNumTti - 1) // Last TTI of this slot: reserved UL control
     {
-        ttiPeriod = NanoSeconds(m_phyMacConfig->GetSymbolPeriod().GetNanoSeconds() *
-                                m_phyMacConfig->GetUlCtrlSymbols());
+        ttiPeriod = m_numerology.GetSymbolsDuration(m_numerology.GetUlCtrlSymbols());
         NS_LOG_DEBUG("ENB " << m_cellId << " RXing UL CTRL frame " << m_frameNum << " subframe "
                             << (unsigned)m_sfNum << " slot " << (uint16_t)m_slotNum << " symbols "
                             << (unsigned)currTti.m_dci.m_symStart << "-"
@@ -1072,8 +802,7 @@ MmWaveEnbPhy::StartTti(void)
     }
     else if (currTti.m_tddMode == TtiAllocInfo::DL_slotAllocInfo) // Scheduled DL data Tti
     {
-        ttiPeriod = NanoSeconds(m_phyMacConfig->GetSymbolPeriod().GetNanoSeconds() *
-                                currTti.m_dci.m_numSym);
+        ttiPeriod = m_numerology.GetSymbolsDuration(currTti.m_dci.m_numSym);
         NS_ASSERT(currTti.m_tddMode == TtiAllocInfo::DL_slotAllocInfo);
 
         Ptr<PacketBurst> pktBurst =
@@ -1123,8 +852,7 @@ MmWaveEnbPhy::StartTti(void)
     }
     else if (currTti.m_tddMode == TtiAllocInfo::UL_slotAllocInfo) // Scheduled UL data Tti
     {
-        ttiPeriod = NanoSeconds(m_phyMacConfig->GetSymbolPeriod().GetNanoSeconds() *
-                                currTti.m_dci.m_numSym);
+        ttiPeriod = m_numerology.GetSymbolsDuration(currTti.m_dci.m_numSym);
         // NS_LOG_DEBUG ("Slot " << (uint8_t)m_slotNum << " scheduled for Uplink");
         m_downlinkSpectrumPhy->AddExpectedTb(currTti.m_dci.m_rnti,
                                              currTti.m_dci.m_ndi,
@@ -1192,8 +920,8 @@ MmWaveEnbPhy::EndTti(void)
     else
     {
         m_ttiIndex++;
-        Time nextTtiStart = m_phyMacConfig->GetSymbolPeriod() *
-                            m_currSlotAllocInfo.m_ttiAllocInfo[m_ttiIndex].m_dci.m_symStart;
+        Time nextTtiStart = m_numerology.GetSymbolsDuration(
+            m_currSlotAllocInfo.m_ttiAllocInfo[m_ttiIndex].m_dci.m_symStart);
         Simulator::Schedule(nextTtiStart + m_lastSlotStart - Simulator::Now(),
                             &MmWaveEnbPhy::StartTti,
                             this);
@@ -1207,10 +935,10 @@ MmWaveEnbPhy::EndSlot(void)
 
     m_ttiIndex = 0;
 
-    if (m_slotNum == m_phyMacConfig->GetSlotsPerSubframe() - 1) // End of this subframe
+    if (m_slotNum == m_numerology.GetSlotsPerSubframe() - 1) // End of this subframe
     {
         m_slotNum = 0;
-        if (m_sfNum == m_phyMacConfig->GetSubframesPerFrame() - 1) // End of the frame as well
+        if (m_sfNum == m_numerology.GetSubframesPerFrame() - 1) // End of the frame as well
         {
             m_sfNum = 0;
             m_frameNum++;
@@ -1311,7 +1039,7 @@ void
 MmWaveEnbPhy::PhyDataPacketReceived(Ptr<Packet> p)
 {
     Simulator::ScheduleWithContext(m_netDevice->GetNode()->GetId(),
-                                   MicroSeconds(m_phyMacConfig->GetTbDecodeLatency()),
+                                   m_numerology.GetTbDecodeLatency(),
                                    &MmWaveEnbPhySapUser::ReceivePhyPdu,
                                    m_phySapUser,
                                    p);
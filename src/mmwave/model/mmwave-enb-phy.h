@@ -42,6 +42,7 @@
 #include <ns3/lte-enb-cphy-sap.h>
 #include <ns3/lte-enb-phy-sap.h>
 #include <ns3/mmwave-harq-phy.h>
+#include <ns3/random-variable-stream.h>
 
 namespace ns3
 {
@@ -57,6 +58,73 @@ class MmWaveNetDevice;
 class MmWaveUePhy;
 class MmWaveEnbMac;
 
+/**
+ * \brief The history of the SINR samples of a UE, used by MmWaveEnbPhy to filter
+ * the noisy SINR estimates when NoiseAndFilter is true.
+ *
+ * The samples are kept in a ring buffer, which grows during the transient and
+ * then keeps its length. The dB value, the variance with the previous sample and
+ * the length of the runs of low variances and high SINRs are computed once, when
+ * a sample is added, so that the filter does not go through the whole history
+ * at every update.
+ */
+class MmWaveSinrHistory
+{
+  public:
+    /**
+     * \brief Add a sample
+     * \param sinr the SINR, in linear units
+     * \param noisySinr the SINR with the estimation noise, in linear units
+     * \param grow if true, the history grows, otherwise the oldest sample is removed
+     */
+    void Add(double sinr, double noisySinr, bool grow);
+
+    /**
+     * \return the number of samples in the history
+     */
+    uint32_t GetSize() const;
+
+    /**
+     * \return the noisy SINR of the last sample
+     */
+    double GetLastNoisySinr() const;
+
+    /**
+     * \brief Filter the noisy SINR of the last sample
+     *
+     * An exponential moving average of the noisy SINR is used when the last
+     * sample belongs to a blockage, i.e., to a run of samples with a low SINR
+     * or a high variance, and the weight of the average is the one which best
+     * tracks the SINR during the blockage.
+     *
+     * \return the filtered SINR of the last sample
+     */
+    double GetFilteredSinr() const;
+
+  private:
+    /**
+     * \brief A sample of the history
+     */
+    struct Sample
+    {
+        double sinr;          //!< the SINR
+        double noisySinr;     //!< the noisy SINR
+        double noisySinrDb;   //!< the noisy SINR in dB
+        double var;           //!< the variance in dB of this and the previous noisy SINR
+        uint32_t lowVarRun;   //!< number of consecutive samples up to this one with var < 1
+        uint32_t highSinrRun; //!< number of consecutive samples up to this one above 10 dB
+    };
+
+    /**
+     * \param i the index of a sample, from the oldest one
+     * \return the sample
+     */
+    const Sample& GetSample(uint32_t i) const;
+
+    std::vector<Sample> m_samples; //!< the ring buffer of the samples
+    uint32_t m_head{0};            //!< the position of the oldest sample in m_samples
+};
+
 class MmWaveEnbPhy : public MmWavePhy
 {
     friend class MemberLteEnbCphySapProvider<MmWaveEnbPhy>;
@@ -166,15 +234,15 @@ class MmWaveEnbPhy : public MmWavePhy
 
     double AddGaussianNoise(double sample);
 
-    std::pair<uint64_t, uint64_t> ApplyFilter(std::vector<double>);
-
-    double MakeAvg(std::vector<double>);
-
-    double MakeVar(std::vector<double>, double);
-
-    std::vector<double> MakeFilter(std::vector<double>,
-                                   std::vector<double>,
-                                   std::pair<uint64_t, uint64_t>);
+    /**
+     * Assign a fixed random variable stream number to the random variables
+     * used by this model.  Return the number of streams (possibly zero) that
+     * have been assigned.
+     *
+     * \param stream first stream index to use
+     * \return the number of stream indices assigned by this model
+     */
+    int64_t AssignStreams(int64_t stream);
 
   private:
     bool AddUePhy(uint16_t rnti);
@@ -224,17 +292,10 @@ class MmWaveEnbPhy : public MmWavePhy
     std::map<uint64_t, Ptr<NetDevice>> m_ueAttachedImsiMap;
     std::map<uint64_t, double> m_sinrMap;
     std::map<uint64_t, Ptr<SpectrumValue>> m_rxPsdMap;
-    std::map<pairDevices_t, std::vector<double>>
-        m_sinrVector; // array containing all SINR values for a specific pair (UE-eNB)
-    std::map<pairDevices_t, std::vector<double>>
-        m_sinrVectorToFilter; // array containing the  SINR values that must be filtered
-    std::map<pairDevices_t, std::vector<double>>
-        m_sinrVectorNoisy; // array containing the  noisy SINR values that must be filteredF
-    std::map<pairDevices_t, std::vector<double>>
-        m_finalSinrVector; // array containing all  SINR values after the filtering for a specific
-                           // pair (UE-eNB)
-    std::map<pairDevices_t, std::pair<uint64_t, uint64_t>>
-        m_samplesFilter; // array containing all noisy SINR values for a specific pair (UE-eNB)
+    std::map<pairDevices_t, MmWaveSinrHistory>
+        m_sinrHistory; // the SINR samples collected for a specific pair (UE-eNB)
+    Ptr<NormalRandomVariable> m_sinrNoise; // the noise of the SINR samples, if NoiseAndFilter
+    int64_t m_sinrNoiseStream{-1};         // the stream of m_sinrNoise, -1 if not assigned
 
     int m_updateSinrPeriod;               // the period of SINR update for eNBs
     double m_ueUpdateSinrPeriod;          // the period of SINR reporting to the UEs
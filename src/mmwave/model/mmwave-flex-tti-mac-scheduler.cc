@@ -319,8 +319,9 @@ MmWaveFlexTtiMacScheduler::ConfigureCommonParameters(Ptr<MmWavePhyMacCommon> con
     m_amc = CreateObject<MmWaveAmc>(m_phyMacConfig);
     m_numHarqProcess = m_phyMacConfig->GetNumHarqProcess();
     m_harqTimeout = m_phyMacConfig->GetHarqTimeout();
-    m_numDataSymbols = m_phyMacConfig->GetSymbPerSlot() - m_phyMacConfig->GetDlCtrlSymbols() -
-                       m_phyMacConfig->GetUlCtrlSymbols();
+    m_numerology = MmWaveNumerology(m_phyMacConfig);
+    m_numDataSymbols = m_numerology.GetSymbPerSlot() - m_numerology.GetDlCtrlSymbols() -
+                       m_numerology.GetUlCtrlSymbols();
 }
 
 void
@@ -432,7 +433,7 @@ MmWaveFlexTtiMacScheduler::DoSchedUlCqiInfoReq(
                              << m_ulAllocationMap.size());
             return;
         }
-        NS_ASSERT_MSG(itMap->second.m_rntiPerChunk.size() == m_phyMacConfig->GetNumRb(),
+        NS_ASSERT_MSG(itMap->second.m_rntiPerChunk.size() == m_numerology.GetNumRb(),
                       "SINR chunk map must cover full BW in TDMA mode");
         for (unsigned i = 0; i < itMap->second.m_rntiPerChunk.size(); i++)
         {
@@ -443,7 +444,7 @@ MmWaveFlexTtiMacScheduler::DoSchedUlCqiInfoReq(
             {
                 // create a new entry
                 std::vector<double> newCqi;
-                for (uint32_t j = 0; j < m_phyMacConfig->GetNumRb(); j++)
+                for (uint32_t j = 0; j < m_numerology.GetNumRb(); j++)
                 {
                     unsigned chunkInd = i;
                     if (chunkInd == j)
@@ -505,9 +506,9 @@ MmWaveFlexTtiMacScheduler::RefreshHarqProcesses()
     for (itTimers = m_dlHarqProcessesTimer.begin(); itTimers != m_dlHarqProcessesTimer.end();
          itTimers++)
     {
-        for (uint16_t i = 0; i < m_phyMacConfig->GetNumHarqProcess(); i++)
+        for (uint16_t i = 0; i < m_numHarqProcess; i++)
         {
-            if ((*itTimers).second.at(i) == m_phyMacConfig->GetHarqTimeout())
+            if ((*itTimers).second.at(i) == m_harqTimeout)
             { // reset HARQ process
                 NS_LOG_INFO(this << " Reset HARQ proc " << i << " for RNTI " << (*itTimers).first);
                 std::map<uint16_t, DlHarqProcessesStatus_t>::iterator itStat =
@@ -531,9 +532,9 @@ MmWaveFlexTtiMacScheduler::RefreshHarqProcesses()
     for (itTimers2 = m_ulHarqProcessesTimer.begin(); itTimers2 != m_ulHarqProcessesTimer.end();
          itTimers2++)
     {
-        for (uint16_t i = 0; i < m_phyMacConfig->GetNumHarqProcess(); i++)
+        for (uint16_t i = 0; i < m_numHarqProcess; i++)
         {
-            if ((*itTimers2).second.at(i) == m_phyMacConfig->GetHarqTimeout())
+            if ((*itTimers2).second.at(i) == m_harqTimeout)
             { // reset HARQ process
                 NS_LOG_INFO(this << " Reset HARQ proc " << i << " for RNTI " << (*itTimers2).first);
                 std::map<uint16_t, UlHarqProcessesStatus_t>::iterator itStat =
@@ -562,7 +563,7 @@ MmWaveFlexTtiMacScheduler::UpdateDlHarqProcessId(uint16_t rnti)
     if (m_harqOn == false)
     {
         uint8_t tbUid = m_tbUid;
-        m_tbUid = (m_tbUid + 1) % m_phyMacConfig->GetNumHarqProcess();
+        m_tbUid = (m_tbUid + 1) % m_numHarqProcess;
         return tbUid;
     }
 
@@ -579,8 +580,8 @@ MmWaveFlexTtiMacScheduler::UpdateDlHarqProcessId(uint16_t rnti)
     }
 
     // search for available process ID, if none available return numHarqProcess
-    uint8_t harqId = m_phyMacConfig->GetNumHarqProcess();
-    for (unsigned i = 0; i < m_phyMacConfig->GetNumHarqProcess(); i++)
+    uint8_t harqId = m_numHarqProcess;
+    for (unsigned i = 0; i < m_numHarqProcess; i++)
     {
         if (itStat->second[i] == 0)
         {
@@ -618,7 +619,7 @@ MmWaveFlexTtiMacScheduler::UpdateUlHarqProcessId(uint16_t rnti)
     if (m_harqOn == false)
     {
         uint8_t tbUid = m_tbUid;
-        m_tbUid = (m_tbUid + 1) % m_phyMacConfig->GetNumHarqProcess();
+        m_tbUid = (m_tbUid + 1) % m_numHarqProcess;
         return tbUid;
     }
 
@@ -635,8 +636,8 @@ MmWaveFlexTtiMacScheduler::UpdateUlHarqProcessId(uint16_t rnti)
     }
 
     // search for available process ID, if none available return numHarqProcess+1
-    uint8_t harqId = m_phyMacConfig->GetNumHarqProcess();
-    for (unsigned i = 0; i < m_phyMacConfig->GetNumHarqProcess(); i++)
+    uint8_t harqId = m_numHarqProcess;
+    for (unsigned i = 0; i < m_numHarqProcess; i++)
     {
         if (itStat->second[i] == 0)
         {
@@ -656,7 +657,7 @@ MmWaveFlexTtiMacScheduler::CalcMinTbSizeNumSym(unsigned mcs, unsigned bufSize, u
     MmWaveMacPduHeader dummyMacHeader;
     // unsigned macHdrSize = 10; //dummyMacHeader.GetSerializedSize ();
     int numSymLow = 0;
-    int numSymHigh = m_phyMacConfig->GetSymbPerSlot();
+    int numSymHigh = m_numerology.GetSymbPerSlot();
 
     int diff = 0;
     tbSize = m_amc->CalculateTbSize(mcs, numSymHigh); // start with max value, in number of bytes
@@ -722,11 +723,11 @@ MmWaveFlexTtiMacScheduler::DoSchedTriggerReq(
     dlCtrlSlot.m_dci.m_numSym = 1;
     dlCtrlSlot.m_dci.m_symStart = 0;
     ret.m_slotAllocInfo.m_ttiAllocInfo.push_back(dlCtrlSlot);
-    int resvCtrl = m_phyMacConfig->GetDlCtrlSymbols() + m_phyMacConfig->GetUlCtrlSymbols();
-    int symAvail = m_phyMacConfig->GetSymbPerSlot() - resvCtrl;
+    int resvCtrl = m_numerology.GetDlCtrlSymbols() + m_numerology.GetUlCtrlSymbols();
+    int symAvail = m_numerology.GetSymbPerSlot() - resvCtrl;
     uint8_t ttiIdx = 1;
     uint8_t symIdx =
-        m_phyMacConfig->GetDlCtrlSymbols(); // symbols reserved for control at beginning of subframe
+        m_numerology.GetDlCtrlSymbols(); // symbols reserved for control at beginning of subframe
 
     // process received CQIs
     RefreshDlCqiMaps();
@@ -902,8 +903,8 @@ MmWaveFlexTtiMacScheduler::DoSchedTriggerReq(
                     symAvail -= dciInfoReTx.m_numSym;
                     dciInfoReTx.m_symStart = symIdx;
                     symIdx += dciInfoReTx.m_numSym;
-                    NS_ASSERT(symIdx <= m_phyMacConfig->GetSymbPerSlot() -
-                                            m_phyMacConfig->GetUlCtrlSymbols());
+                    NS_ASSERT(symIdx <= m_numerology.GetSymbPerSlot() -
+                                            m_numerology.GetUlCtrlSymbols());
                     dciInfoReTx.m_rv++;
                     dciInfoReTx.m_ndi = 0;
                     itHarq->second.at(harqId) = dciInfoReTx;
@@ -1015,8 +1016,8 @@ MmWaveFlexTtiMacScheduler::DoSchedTriggerReq(
                     symAvail -= dciInfoReTx.m_numSym;
                     dciInfoReTx.m_symStart = symIdx;
                     symIdx += dciInfoReTx.m_numSym;
-                    NS_ASSERT(symIdx <= m_phyMacConfig->GetSymbPerSlot() -
-                                            m_phyMacConfig->GetUlCtrlSymbols());
+                    NS_ASSERT(symIdx <= m_numerology.GetSymbPerSlot() -
+                                            m_numerology.GetUlCtrlSymbols());
                     dciInfoReTx.m_rv++;
                     dciInfoReTx.m_ndi = 0;
                     itStat->second.at(harqId) = itStat->second.at(harqId) + 1;
@@ -1184,7 +1185,7 @@ MmWaveFlexTtiMacScheduler::DoSchedTriggerReq(
                     SpectrumValue specVals(
                         MmWaveSpectrumValueHelper::GetSpectrumModel(m_phyMacConfig));
                     Values::iterator specIt = specVals.ValuesBegin();
-                    for (uint32_t ichunk = 0; ichunk < m_phyMacConfig->GetNumRb(); ichunk++)
+                    for (uint32_t ichunk = 0; ichunk < m_numerology.GetNumRb(); ichunk++)
                     {
                         NS_ASSERT(specIt != specVals.ValuesEnd());
                         *specIt = itCqi->second.m_ueUlCqi.at(ichunk); // sinrLin;
@@ -1234,7 +1235,7 @@ MmWaveFlexTtiMacScheduler::DoSchedTriggerReq(
         // Add TTI for UL control at the end of the slot
         TtiAllocInfo ulCtrlTti(ttiIdx, TtiAllocInfo::UL_slotAllocInfo, TtiAllocInfo::CTRL, 0);
         ulCtrlTti.m_dci.m_numSym = 1;
-        ulCtrlTti.m_dci.m_symStart = m_phyMacConfig->GetSymbPerSlot() - 1;
+        ulCtrlTti.m_dci.m_symStart = m_numerology.GetSymbPerSlot() - 1;
         ret.m_slotAllocInfo.m_ttiAllocInfo.push_back(ulCtrlTti);
         m_macSchedSapUser->SchedConfigInd(ret);
         return;
@@ -1469,11 +1470,10 @@ MmWaveFlexTtiMacScheduler::DoSchedTriggerReq(
                     dci.m_mcs--;
                     dci.m_tbSize = m_amc->CalculateTbSize (dci.m_mcs, dci.m_numSym) / 8;
             }*/
-            NS_ASSERT(symIdx <=
-                      m_phyMacConfig->GetSymbPerSlot() - m_phyMacConfig->GetUlCtrlSymbols());
+            NS_ASSERT(symIdx <= m_numerology.GetSymbPerSlot() - m_numerology.GetUlCtrlSymbols());
             dci.m_rv = 0;
             dci.m_harqProcess = UpdateDlHarqProcessId(itUeInfo->first);
-            NS_ASSERT(dci.m_harqProcess < m_phyMacConfig->GetNumHarqProcess());
+            NS_ASSERT(dci.m_harqProcess < m_numHarqProcess);
             NS_LOG_DEBUG("UE" << itUeInfo->first << " DL harqId " << +dci.m_harqProcess
                               << " HARQ process assigned");
             TtiAllocInfo ttiInfo(ttiIdx++,
@@ -1603,8 +1603,7 @@ MmWaveFlexTtiMacScheduler::DoSchedTriggerReq(
             DciInfoElementTdma dci;
             dci.m_rnti = itUeInfo->first;
             dci.m_format = 1;
-            NS_ASSERT(symIdx <=
-                      m_phyMacConfig->GetSymbPerSlot() - m_phyMacConfig->GetUlCtrlSymbols());
+            NS_ASSERT(symIdx <= m_numerology.GetSymbPerSlot() - m_numerology.GetUlCtrlSymbols());
             dci.m_numSym = ueSchedInfo.m_ulSymbols;
             dci.m_symStart = symIdx;
             symIdx += ueSchedInfo.m_ulSymbols;
@@ -1614,7 +1613,7 @@ MmWaveFlexTtiMacScheduler::DoSchedTriggerReq(
             dci.m_harqProcess = UpdateUlHarqProcessId(itUeInfo->first);
             NS_LOG_DEBUG("UE" << itUeInfo->first << " UL harqId " << +dci.m_harqProcess
                               << " HARQ process assigned");
-            NS_ASSERT(dci.m_harqProcess < m_phyMacConfig->GetNumHarqProcess());
+            NS_ASSERT(dci.m_harqProcess < m_numHarqProcess);
 
             TtiAllocInfo ttiInfo(ttiIdx++,
                                  TtiAllocInfo::UL_slotAllocInfo,
@@ -1632,7 +1631,7 @@ MmWaveFlexTtiMacScheduler::DoSchedTriggerReq(
             ret.m_slotAllocInfo.m_ttiAllocInfo.push_back(ttiInfo); // add to front
             ret.m_slotAllocInfo.m_numSymAlloc += dci.m_numSym;
             std::vector<uint16_t> ueChunkMap;
-            for (uint32_t i = 0; i < m_phyMacConfig->GetNumRb(); i++)
+            for (uint32_t i = 0; i < m_numerology.GetNumRb(); i++)
             {
                 ueChunkMap.push_back(dci.m_rnti);
             }
@@ -1680,7 +1679,7 @@ MmWaveFlexTtiMacScheduler::DoSchedTriggerReq(
     // Add TTI for UL control at the end of the slot
     TtiAllocInfo ulCtrlTti(ttiIdx, TtiAllocInfo::UL_slotAllocInfo, TtiAllocInfo::CTRL, 0);
     ulCtrlTti.m_dci.m_numSym = 1;
-    ulCtrlTti.m_dci.m_symStart = m_phyMacConfig->GetSymbPerSlot() - 1;
+    ulCtrlTti.m_dci.m_symStart = m_numerology.GetSymbPerSlot() - 1;
     ret.m_slotAllocInfo.m_ttiAllocInfo.push_back(ulCtrlTti);
 
     m_macSchedSapUser->SchedConfigInd(ret);
@@ -1929,19 +1928,19 @@ MmWaveFlexTtiMacScheduler::DoCschedUeConfigReq(
     {
         // m_dlHarqCurrentProcessId.insert (std::pair <uint16_t,uint8_t > (params.m_rnti, 0));
         DlHarqProcessesStatus_t dlHarqPrcStatus;
-        dlHarqPrcStatus.resize(m_phyMacConfig->GetNumHarqProcess(), 0);
+        dlHarqPrcStatus.resize(m_numHarqProcess, 0);
         m_dlHarqProcessesStatus.insert(
             std::pair<uint16_t, DlHarqProcessesStatus_t>(params.m_rnti, dlHarqPrcStatus));
         DlHarqProcessesTimer_t dlHarqProcessesTimer;
-        dlHarqProcessesTimer.resize(m_phyMacConfig->GetNumHarqProcess(), 0);
+        dlHarqProcessesTimer.resize(m_numHarqProcess, 0);
         m_dlHarqProcessesTimer.insert(
             std::pair<uint16_t, DlHarqProcessesTimer_t>(params.m_rnti, dlHarqProcessesTimer));
         DlHarqProcessesDciInfoList_t dlHarqTbInfoList;
-        dlHarqTbInfoList.resize(m_phyMacConfig->GetNumHarqProcess());
+        dlHarqTbInfoList.resize(m_numHarqProcess);
         m_dlHarqProcessesDciInfoMap.insert(
             std::pair<uint16_t, DlHarqProcessesDciInfoList_t>(params.m_rnti, dlHarqTbInfoList));
         DlHarqRlcPduList_t dlHarqRlcPduList;
-        dlHarqRlcPduList.resize(m_phyMacConfig->GetNumHarqProcess());
+        dlHarqRlcPduList.resize(m_numHarqProcess);
         m_dlHarqProcessesRlcPduMap.insert(
             std::pair<uint16_t, DlHarqRlcPduList_t>(params.m_rnti, dlHarqRlcPduList));
     }
@@ -1950,15 +1949,15 @@ MmWaveFlexTtiMacScheduler::DoCschedUeConfigReq(
     {
         //              m_ulHarqCurrentProcessId.insert (std::pair <uint16_t,uint8_t > (rnti, 0));
         UlHarqProcessesStatus_t ulHarqPrcStatus;
-        ulHarqPrcStatus.resize(m_phyMacConfig->GetNumHarqProcess(), 0);
+        ulHarqPrcStatus.resize(m_numHarqProcess, 0);
         m_ulHarqProcessesStatus.insert(
             std::pair<uint16_t, UlHarqProcessesStatus_t>(params.m_rnti, ulHarqPrcStatus));
         UlHarqProcessesTimer_t ulHarqProcessesTimer;
-        ulHarqProcessesTimer.resize(m_phyMacConfig->GetNumHarqProcess(), 0);
+        ulHarqProcessesTimer.resize(m_numHarqProcess, 0);
         m_ulHarqProcessesTimer.insert(
             std::pair<uint16_t, UlHarqProcessesTimer_t>(params.m_rnti, ulHarqProcessesTimer));
         UlHarqProcessesDciInfoList_t ulHarqTbInfoList;
-        ulHarqTbInfoList.resize(m_phyMacConfig->GetNumHarqProcess());
+        ulHarqTbInfoList.resize(m_numHarqProcess);
         m_ulHarqProcessesDciInfoMap.insert(
             std::pair<uint16_t, UlHarqProcessesDciInfoList_t>(params.m_rnti, ulHarqTbInfoList));
     }
@@ -310,8 +310,9 @@ MmWaveFlexTtiMaxWeightMacScheduler::ConfigureCommonParameters(Ptr<MmWavePhyMacCo
     m_amc = CreateObject<MmWaveAmc>(m_phyMacConfig);
     m_numHarqProcess = m_phyMacConfig->GetNumHarqProcess();
     m_harqTimeout = m_phyMacConfig->GetHarqTimeout();
-    m_numDataSymbols = m_phyMacConfig->GetSymbPerSlot() - m_phyMacConfig->GetDlCtrlSymbols() -
-                       m_phyMacConfig->GetUlCtrlSymbols();
+    m_numerology = MmWaveNumerology(m_phyMacConfig);
+    m_numDataSymbols = m_numerology.GetSymbPerSlot() - m_numerology.GetDlCtrlSymbols() -
+                       m_numerology.GetUlCtrlSymbols();
 }
 
 void
@@ -422,11 +423,11 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedUlMacCtrlInfoReq(
                             // and sent at least by the end of the prev. subframe, the maximum delay
                             // is one SF (in microseconds)
                             itUe->second.m_flowStatsUl[lcg].m_txPacketDelays.push_back(
-                                m_phyMacConfig->GetSubframePeriod().GetMicroSeconds());
+                                m_numerology.GetSubframePeriod().GetMicroSeconds());
                             if (itUe->second.m_flowStatsUl[lcg].m_txQueueHolDelay == 0)
                             {
                                 itUe->second.m_flowStatsUl[lcg].m_txQueueHolDelay =
-                                    m_phyMacConfig->GetSubframePeriod().GetMicroSeconds();
+                                    m_numerology.GetSubframePeriod().GetMicroSeconds();
                             }
                         }
                     }
@@ -507,7 +508,7 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedUlCqiInfoReq(
                              << m_ulAllocationMap.size());
             return;
         }
-        NS_ASSERT_MSG(itMap->second.m_rntiPerChunk.size() == m_phyMacConfig->GetNumRb(),
+        NS_ASSERT_MSG(itMap->second.m_rntiPerChunk.size() == m_numerology.GetNumRb(),
                       "SINR chunk map must cover full BW in TDMA mode");
         for (unsigned i = 0; i < itMap->second.m_rntiPerChunk.size(); i++)
         {
@@ -518,7 +519,7 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedUlCqiInfoReq(
             {
                 // create a new entry
                 std::vector<double> newCqi;
-                for (uint32_t j = 0; j < m_phyMacConfig->GetNumRb(); j++)
+                for (uint32_t j = 0; j < m_numerology.GetNumRb(); j++)
                 {
                     unsigned chunkInd = i;
                     if (chunkInd == j)
@@ -590,9 +591,9 @@ MmWaveFlexTtiMaxWeightMacScheduler::RefreshHarqProcesses()
     for (itTimers = m_dlHarqProcessesTimer.begin(); itTimers != m_dlHarqProcessesTimer.end();
          itTimers++)
     {
-        for (uint16_t i = 0; i < m_phyMacConfig->GetNumHarqProcess(); i++)
+        for (uint16_t i = 0; i < m_numHarqProcess; i++)
         {
-            if ((*itTimers).second.at(i) == m_phyMacConfig->GetHarqTimeout())
+            if ((*itTimers).second.at(i) == m_harqTimeout)
             { // reset HARQ process
                 NS_LOG_INFO(this << " Reset HARQ proc " << i << " for RNTI " << (*itTimers).first);
                 std::map<uint16_t, DlHarqProcessesStatus_t>::iterator itStat =
@@ -616,9 +617,9 @@ MmWaveFlexTtiMaxWeightMacScheduler::RefreshHarqProcesses()
     for (itTimers2 = m_ulHarqProcessesTimer.begin(); itTimers2 != m_ulHarqProcessesTimer.end();
          itTimers2++)
     {
-        for (uint16_t i = 0; i < m_phyMacConfig->GetNumHarqProcess(); i++)
+        for (uint16_t i = 0; i < m_numHarqProcess; i++)
         {
-            if ((*itTimers2).second.at(i) == m_phyMacConfig->GetHarqTimeout())
+            if ((*itTimers2).second.at(i) == m_harqTimeout)
             { // reset HARQ process
                 NS_LOG_INFO(this << " Reset HARQ proc " << i << " for RNTI " << (*itTimers2).first);
                 std::map<uint16_t, UlHarqProcessesStatus_t>::iterator itStat =
@@ -647,7 +648,7 @@ MmWaveFlexTtiMaxWeightMacScheduler::UpdateDlHarqProcessId(uint16_t rnti)
     if (m_harqOn == false)
     {
         uint8_t tbUid = m_tbUid;
-        m_tbUid = (m_tbUid + 1) % m_phyMacConfig->GetNumHarqProcess();
+        m_tbUid = (m_tbUid + 1) % m_numHarqProcess;
         return tbUid;
     }
 
@@ -664,8 +665,8 @@ MmWaveFlexTtiMaxWeightMacScheduler::UpdateDlHarqProcessId(uint16_t rnti)
     }
 
     // search for available process ID, if none available return numHarqProcess
-    uint8_t harqId = m_phyMacConfig->GetNumHarqProcess();
-    for (unsigned i = 0; i < m_phyMacConfig->GetNumHarqProcess(); i++)
+    uint8_t harqId = m_numHarqProcess;
+    for (unsigned i = 0; i < m_numHarqProcess; i++)
     {
         if (itStat->second[i] == 0)
         {
@@ -703,7 +704,7 @@ MmWaveFlexTtiMaxWeightMacScheduler::UpdateUlHarqProcessId(uint16_t rnti)
     if (m_harqOn == false)
     {
         uint8_t tbUid = m_tbUid;
-        m_tbUid = (m_tbUid + 1) % m_phyMacConfig->GetNumHarqProcess();
+        m_tbUid = (m_tbUid + 1) % m_numHarqProcess;
         return tbUid;
     }
 
@@ -720,8 +721,8 @@ MmWaveFlexTtiMaxWeightMacScheduler::UpdateUlHarqProcessId(uint16_t rnti)
     }
 
     // search for available process ID, if none available return numHarqProcess+1
-    uint8_t harqId = m_phyMacConfig->GetNumHarqProcess();
-    for (unsigned i = 0; i < m_phyMacConfig->GetNumHarqProcess(); i++)
+    uint8_t harqId = m_numHarqProcess;
+    for (unsigned i = 0; i < m_numHarqProcess; i++)
     {
         if (itStat->second[i] == 0)
         {
@@ -759,7 +760,7 @@ MmWaveFlexTtiMaxWeightMacScheduler::CalcMinTbSizeNumSym(unsigned mcs,
     MmWaveMacPduHeader dummyMacHeader;
     // unsigned macHdrSize = 10; //dummyMacHeader.GetSerializedSize ();
     int numSymLow = 0;
-    int numSymHigh = m_phyMacConfig->GetSymbPerSlot();
+    int numSymHigh = m_numerology.GetSymbPerSlot();
 
     int diff = 0;
     tbSize = m_amc->CalculateTbSize(mcs, numSymHigh); // start with max value, in number of bytes
@@ -823,13 +824,13 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedTriggerReq(
     //scheduler for UL allocations      m_ulSfAllocInfo.pop_front ();
     //  }
     SfnSf ulSfn = ret.m_sfnSf;
-    if (ret.m_sfnSf.m_sfNum + m_phyMacConfig->GetUlSchedDelay() >=
-        m_phyMacConfig->GetSubframesPerFrame())
+    if (ret.m_sfnSf.m_sfNum + m_numerology.GetUlSchedDelay() >=
+        m_numerology.GetSubframesPerFrame())
     {
         ulSfn.m_frameNum++;
     }
-    ulSfn.m_sfNum = (ret.m_sfnSf.m_sfNum + m_phyMacConfig->GetUlSchedDelay()) %
-                    m_phyMacConfig->GetSubframesPerFrame();
+    ulSfn.m_sfNum = (ret.m_sfnSf.m_sfNum + m_numerology.GetUlSchedDelay()) %
+                    m_numerology.GetSubframesPerFrame();
     NS_LOG_DEBUG("Scheduling DL frame " << +frameNum << " subframe " << +sfNum << " UL frame "
                                         << +ulSfn.m_frameNum << " subframe " << +ulSfn.m_sfNum);
     // Add TTI for DL control at the beginning of the slot
@@ -837,11 +838,11 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedTriggerReq(
     dlCtrlSlot.m_dci.m_numSym = 1;
     dlCtrlSlot.m_dci.m_symStart = 0;
     ret.m_slotAllocInfo.m_ttiAllocInfo.push_back(dlCtrlSlot);
-    int resvCtrl = m_phyMacConfig->GetDlCtrlSymbols() + m_phyMacConfig->GetUlCtrlSymbols();
-    int symAvail = m_phyMacConfig->GetSymbPerSlot() - resvCtrl;
+    int resvCtrl = m_numerology.GetDlCtrlSymbols() + m_numerology.GetUlCtrlSymbols();
+    int symAvail = m_numerology.GetSymbPerSlot() - resvCtrl;
     uint8_t ttiIdx = 1;
     uint8_t symIdx =
-        m_phyMacConfig->GetDlCtrlSymbols(); // symbols reserved for control at beginning of subframe
+        m_numerology.GetDlCtrlSymbols(); // symbols reserved for control at beginning of subframe
 
     // process received CQIs
     RefreshDlCqiMaps();
@@ -956,8 +957,8 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedTriggerReq(
                     symAvail -= dciInfoReTx.m_numSym;
                     dciInfoReTx.m_symStart = symIdx;
                     symIdx += dciInfoReTx.m_numSym;
-                    NS_ASSERT(symIdx <= m_phyMacConfig->GetSymbPerSlot() -
-                                            m_phyMacConfig->GetUlCtrlSymbols());
+                    NS_ASSERT(symIdx <= m_numerology.GetSymbPerSlot() -
+                                            m_numerology.GetUlCtrlSymbols());
                     dciInfoReTx.m_rv++;
                     dciInfoReTx.m_ndi = 0;
                     itHarq->second.at(harqId) = dciInfoReTx;
@@ -1070,8 +1071,8 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedTriggerReq(
                     symAvail -= dciInfoReTx.m_numSym;
                     dciInfoReTx.m_symStart = symIdx;
                     symIdx += dciInfoReTx.m_numSym;
-                    NS_ASSERT(symIdx <= m_phyMacConfig->GetSymbPerSlot() -
-                                            m_phyMacConfig->GetUlCtrlSymbols());
+                    NS_ASSERT(symIdx <= m_numerology.GetSymbPerSlot() -
+                                            m_numerology.GetUlCtrlSymbols());
                     dciInfoReTx.m_rv++;
                     dciInfoReTx.m_ndi = 0;
                     itStat->second.at(harqId) = itStat->second.at(harqId) + 1;
@@ -1119,7 +1120,7 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedTriggerReq(
         // add slot for UL control
         TtiAllocInfo ulCtrlSlot(0xFF, TtiAllocInfo::UL_slotAllocInfo, TtiAllocInfo::CTRL, 0);
         ulCtrlSlot.m_dci.m_numSym = 1;
-        ulCtrlSlot.m_dci.m_symStart = m_phyMacConfig->GetSymbPerSlot() - 1;
+        ulCtrlSlot.m_dci.m_symStart = m_numerology.GetSymbPerSlot() - 1;
         // ret.m_ulSfAllocInfo.m_ttiAllocInfo.push_back (ulCtrlSlot);
         ret.m_slotAllocInfo.m_ttiAllocInfo.push_back(ulCtrlSlot);
         // m_ulSfAllocInfo.push_back (ret.m_ulSfAllocInfo); // add UL SF info for later calls to
@@ -1288,7 +1289,7 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedTriggerReq(
                         SpectrumValue specVals(
                             MmWaveSpectrumValueHelper::GetSpectrumModel(m_phyMacConfig));
                         Values::iterator specIt = specVals.ValuesBegin();
-                        for (uint32_t ichunk = 0; ichunk < m_phyMacConfig->GetNumRb(); ichunk++)
+                        for (uint32_t ichunk = 0; ichunk < m_numerology.GetNumRb(); ichunk++)
                         {
                             NS_ASSERT(specIt != specVals.ValuesEnd());
                             *specIt = itCqi->second.m_ueUlCqi.at(ichunk); // sinrLin;
@@ -1381,7 +1382,7 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedTriggerReq(
                         flow->m_totalBufSize -= sduSize;
                         flow->m_schedPacketSizes.push_front(sduSize);
                         if (1 ||
-                            flow->m_schedPacketSizes.size() > m_phyMacConfig->GetUlSchedDelay())
+                            flow->m_schedPacketSizes.size() > m_numerology.GetUlSchedDelay())
                         {
                             // flow->m_totalSchedSize -= flow->m_schedPacketSizes.back ();
                             flow->m_schedPacketSizes.pop_back();
@@ -1416,7 +1417,7 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedTriggerReq(
                  delayIt != (*flowIt)->m_txPacketDelays.end();
                  delayIt++)
             {
-                *delayIt += double(m_phyMacConfig->GetSubframePeriod().GetMicroSeconds());
+                *delayIt += double(m_numerology.GetSubframePeriod().GetMicroSeconds());
             }
             if ((*flowIt)->m_txPacketDelays.size() > 0)
             {
@@ -1432,7 +1433,7 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedTriggerReq(
         // add slot for UL control
         TtiAllocInfo ulCtrlSlot(0xFF, TtiAllocInfo::UL_slotAllocInfo, TtiAllocInfo::CTRL, 0);
         ulCtrlSlot.m_dci.m_numSym = 1;
-        ulCtrlSlot.m_dci.m_symStart = m_phyMacConfig->GetSymbPerSlot() - 1;
+        ulCtrlSlot.m_dci.m_symStart = m_numerology.GetSymbPerSlot() - 1;
         // ret.m_ulSfAllocInfo.m_ttiAllocInfo.push_back (ulCtrlSlot);
         ret.m_slotAllocInfo.m_ttiAllocInfo.push_back(ulCtrlSlot);
         // m_ulSfAllocInfo.push_back (ret.m_ulSfAllocInfo); // add UL SF info for later calls to
@@ -1469,13 +1470,13 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedTriggerReq(
             dci.m_numSym = ueInfo->m_dlSymbols;
             symIdx += ueInfo->m_dlSymbols;
             NS_ASSERT(symIdx <=
-                      m_phyMacConfig->GetSymbPerSlot() - m_phyMacConfig->GetUlCtrlSymbols());
+                      m_numerology.GetSymbPerSlot() - m_numerology.GetUlCtrlSymbols());
             dci.m_mcs = ueInfo->m_dlMcs;
             dci.m_rv = 0;
             dci.m_ndi = 1;
             dci.m_tbSize = m_amc->CalculateTbSize(dci.m_mcs, dci.m_numSym);
             dci.m_harqProcess = UpdateDlHarqProcessId(ueInfo->m_rnti);
-            NS_ASSERT(dci.m_harqProcess < m_phyMacConfig->GetNumHarqProcess());
+            NS_ASSERT(dci.m_harqProcess < m_numHarqProcess);
             // NS_LOG_DEBUG ("UE" << ueInfo->m_rnti << " DL harqId " << (unsigned)dci.m_harqProcess
             // << " HARQ process assigned");
             TtiAllocInfo ttiInfo(ttiIdx++,
@@ -1597,14 +1598,14 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedTriggerReq(
             dci.m_numSym = ueInfo->m_ulSymbols;
             symIdx += ueInfo->m_ulSymbols;
             NS_ASSERT(symIdx <=
-                      m_phyMacConfig->GetSymbPerSlot() - m_phyMacConfig->GetUlCtrlSymbols());
+                      m_numerology.GetSymbPerSlot() - m_numerology.GetUlCtrlSymbols());
             dci.m_mcs = ueInfo->m_ulMcs;
             dci.m_ndi = 1;
             dci.m_tbSize = m_amc->CalculateTbSize(dci.m_mcs, dci.m_numSym);
             dci.m_harqProcess = UpdateUlHarqProcessId(ueInfo->m_rnti);
             // NS_LOG_DEBUG ("UE" << ueInfo->m_rnti << " UL harqId " << (unsigned)dci.m_harqProcess
             // << " HARQ process assigned");
-            NS_ASSERT(dci.m_harqProcess < m_phyMacConfig->GetNumHarqProcess());
+            NS_ASSERT(dci.m_harqProcess < m_numHarqProcess);
             TtiAllocInfo ttiInfo(ttiIdx++,
                                  TtiAllocInfo::UL_slotAllocInfo,
                                  TtiAllocInfo::CTRL_DATA,
@@ -1619,7 +1620,7 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedTriggerReq(
             ret.m_slotAllocInfo.m_ttiAllocInfo.push_back(ttiInfo);
             ret.m_slotAllocInfo.m_numSymAlloc += dci.m_numSym;
             std::vector<uint16_t> ueChunkMap;
-            for (uint32_t i = 0; i < m_phyMacConfig->GetNumRb(); i++)
+            for (uint32_t i = 0; i < m_numerology.GetNumRb(); i++)
             {
                 ueChunkMap.push_back(dci.m_rnti);
             }
@@ -1675,7 +1676,7 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoSchedTriggerReq(
     // add slot for UL control
     TtiAllocInfo ulCtrlSlot(0xFF, TtiAllocInfo::UL_slotAllocInfo, TtiAllocInfo::CTRL, 0);
     ulCtrlSlot.m_dci.m_numSym = 1;
-    ulCtrlSlot.m_dci.m_symStart = m_phyMacConfig->GetSymbPerSlot() - 1;
+    ulCtrlSlot.m_dci.m_symStart = m_numerology.GetSymbPerSlot() - 1;
     // ret.m_ulSfAllocInfo.m_ttiAllocInfo.push_back (ulCtrlSlot);
     ret.m_slotAllocInfo.m_ttiAllocInfo.push_back(ulCtrlSlot);
 
@@ -1878,19 +1879,19 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoCschedUeConfigReq(
     {
         // m_dlHarqCurrentProcessId.insert (std::pair <uint16_t,uint8_t > (params.m_rnti, 0));
         DlHarqProcessesStatus_t dlHarqPrcStatus;
-        dlHarqPrcStatus.resize(m_phyMacConfig->GetNumHarqProcess(), 0);
+        dlHarqPrcStatus.resize(m_numHarqProcess, 0);
         m_dlHarqProcessesStatus.insert(
             std::pair<uint16_t, DlHarqProcessesStatus_t>(params.m_rnti, dlHarqPrcStatus));
         DlHarqProcessesTimer_t dlHarqProcessesTimer;
-        dlHarqProcessesTimer.resize(m_phyMacConfig->GetNumHarqProcess(), 0);
+        dlHarqProcessesTimer.resize(m_numHarqProcess, 0);
         m_dlHarqProcessesTimer.insert(
             std::pair<uint16_t, DlHarqProcessesTimer_t>(params.m_rnti, dlHarqProcessesTimer));
         DlHarqProcessesDciInfoList_t dlHarqTbInfoList;
-        dlHarqTbInfoList.resize(m_phyMacConfig->GetNumHarqProcess());
+        dlHarqTbInfoList.resize(m_numHarqProcess);
         m_dlHarqProcessesDciInfoMap.insert(
             std::pair<uint16_t, DlHarqProcessesDciInfoList_t>(params.m_rnti, dlHarqTbInfoList));
         DlHarqRlcPduList_t dlHarqRlcPduList;
-        dlHarqRlcPduList.resize(m_phyMacConfig->GetNumHarqProcess());
+        dlHarqRlcPduList.resize(m_numHarqProcess);
         m_dlHarqProcessesRlcPduMap.insert(
             std::pair<uint16_t, DlHarqRlcPduList_t>(params.m_rnti, dlHarqRlcPduList));
     }
@@ -1899,15 +1900,15 @@ MmWaveFlexTtiMaxWeightMacScheduler::DoCschedUeConfigReq(
     {
         //              m_ulHarqCurrentProcessId.insert (std::pair <uint16_t,uint8_t > (rnti, 0));
         UlHarqProcessesStatus_t ulHarqPrcStatus;
-        ulHarqPrcStatus.resize(m_phyMacConfig->GetNumHarqProcess(), 0);
+        ulHarqPrcStatus.resize(m_numHarqProcess, 0);
         m_ulHarqProcessesStatus.insert(
             std::pair<uint16_t, UlHarqProcessesStatus_t>(params.m_rnti, ulHarqPrcStatus));
         UlHarqProcessesTimer_t ulHarqProcessesTimer;
-        ulHarqProcessesTimer.resize(m_phyMacConfig->GetNumHarqProcess(), 0);
+        ulHarqProcessesTimer.resize(m_numHarqProcess, 0);
         m_ulHarqProcessesTimer.insert(
             std::pair<uint16_t, UlHarqProcessesTimer_t>(params.m_rnti, ulHarqProcessesTimer));
         UlHarqProcessesDciInfoList_t ulHarqTbInfoList;
-        ulHarqTbInfoList.resize(m_phyMacConfig->GetNumHarqProcess());
+        ulHarqTbInfoList.resize(m_numHarqProcess);
         m_ulHarqProcessesDciInfoMap.insert(
             std::pair<uint16_t, UlHarqProcessesDciInfoList_t>(params.m_rnti, ulHarqTbInfoList));
     }
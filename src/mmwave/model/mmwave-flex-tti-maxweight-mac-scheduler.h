@@ -373,6 +373,7 @@ class MmWaveFlexTtiMaxWeightMacScheduler : public MmWaveMacScheduler
     uint8_t m_tbUid;
     uint32_t m_numChunks;
     uint32_t m_numDataSymbols;
+    MmWaveNumerology m_numerology; //!< snapshot of m_phyMacConfig, read in the scheduling loops
 
     MmWaveMacSchedSapProvider* m_macSchedSapProvider;
     MmWaveMacSchedSapUser* m_macSchedSapUser;
@@ -301,10 +301,11 @@ MmWaveFlexTtiPfMacScheduler::ConfigureCommonParameters(Ptr<MmWavePhyMacCommon> c
     m_amc = CreateObject<MmWaveAmc>(m_phyMacConfig);
     m_numHarqProcess = m_phyMacConfig->GetNumHarqProcess();
     m_harqTimeout = m_phyMacConfig->GetHarqTimeout();
-    m_numDataSymbols = m_phyMacConfig->GetSymbPerSlot() - m_phyMacConfig->GetDlCtrlSymbols() -
-                       m_phyMacConfig->GetUlCtrlSymbols();
+    m_numerology = MmWaveNumerology(m_phyMacConfig);
+    m_numDataSymbols = m_numerology.GetSymbPerSlot() - m_numerology.GetDlCtrlSymbols() -
+                       m_numerology.GetUlCtrlSymbols();
 
-    for (unsigned i = 0; i < m_phyMacConfig->GetUlSchedDelay(); i++)
+    for (unsigned i = 0; i < m_numerology.GetUlSchedDelay(); i++)
     {
         m_ulSfAllocInfo.push_back(SlotAllocInfo(SfnSf(0, i, 0)));
     }
@@ -428,11 +429,11 @@ MmWaveFlexTtiPfMacScheduler::DoSchedUlMacCtrlInfoReq(
                             // and sent at least by the end of the prev. subframe, the maximum delay
                             // is one SF (in microseconds)
                             itUe->second.m_flowStatsUl[lcg].m_txPacketDelays.push_back(
-                                m_phyMacConfig->GetSlotPeriod().GetMicroSeconds());
+                                m_numerology.GetSlotPeriod().GetMicroSeconds());
                             if (itUe->second.m_flowStatsUl[lcg].m_txQueueHolDelay == 0)
                             {
                                 itUe->second.m_flowStatsUl[lcg].m_txQueueHolDelay =
-                                    m_phyMacConfig->GetSlotPeriod().GetMicroSeconds();
+                                    m_numerology.GetSlotPeriod().GetMicroSeconds();
                             }
                         }
                     }
@@ -513,7 +514,7 @@ MmWaveFlexTtiPfMacScheduler::DoSchedUlCqiInfoReq(
                              << m_ulAllocationMap.size());
             return;
         }
-        NS_ASSERT_MSG(itMap->second.m_rntiPerChunk.size() == m_phyMacConfig->GetNumRb(),
+        NS_ASSERT_MSG(itMap->second.m_rntiPerChunk.size() == m_numerology.GetNumRb(),
                       "SINR chunk map must cover full BW in TDMA mode");
         for (unsigned i = 0; i < itMap->second.m_rntiPerChunk.size(); i++)
         {
@@ -524,7 +525,7 @@ MmWaveFlexTtiPfMacScheduler::DoSchedUlCqiInfoReq(
             {
                 // create a new entry
                 std::vector<double> newCqi;
-                for (uint32_t j = 0; j < m_phyMacConfig->GetNumRb(); j++)
+                for (uint32_t j = 0; j < m_numerology.GetNumRb(); j++)
                 {
                     unsigned chunkInd = i;
                     if (chunkInd == j)
@@ -596,9 +597,9 @@ MmWaveFlexTtiPfMacScheduler::RefreshHarqProcesses()
     for (itTimers = m_dlHarqProcessesTimer.begin(); itTimers != m_dlHarqProcessesTimer.end();
          itTimers++)
     {
-        for (uint16_t i = 0; i < m_phyMacConfig->GetNumHarqProcess(); i++)
+        for (uint16_t i = 0; i < m_numHarqProcess; i++)
         {
-            if ((*itTimers).second.at(i) == m_phyMacConfig->GetHarqTimeout())
+            if ((*itTimers).second.at(i) == m_harqTimeout)
             { // reset HARQ process
                 NS_LOG_INFO(this << " Reset HARQ proc " << i << " for RNTI " << (*itTimers).first);
                 std::map<uint16_t, DlHarqProcessesStatus_t>::iterator itStat =
@@ -622,9 +623,9 @@ MmWaveFlexTtiPfMacScheduler::RefreshHarqProcesses()
     for (itTimers2 = m_ulHarqProcessesTimer.begin(); itTimers2 != m_ulHarqProcessesTimer.end();
          itTimers2++)
     {
-        for (uint16_t i = 0; i < m_phyMacConfig->GetNumHarqProcess(); i++)
+        for (uint16_t i = 0; i < m_numHarqProcess; i++)
         {
-            if ((*itTimers2).second.at(i) == m_phyMacConfig->GetHarqTimeout())
+            if ((*itTimers2).second.at(i) == m_harqTimeout)
             { // reset HARQ process
                 NS_LOG_INFO(this << " Reset HARQ proc " << i << " for RNTI " << (*itTimers2).first);
                 std::map<uint16_t, UlHarqProcessesStatus_t>::iterator itStat =
@@ -653,7 +654,7 @@ MmWaveFlexTtiPfMacScheduler::UpdateDlHarqProcessId(uint16_t rnti)
     if (m_harqOn == false)
     {
         uint8_t tbUid = m_tbUid;
-        m_tbUid = (m_tbUid + 1) % m_phyMacConfig->GetNumHarqProcess();
+        m_tbUid = (m_tbUid + 1) % m_numHarqProcess;
         return tbUid;
     }
 
@@ -670,8 +671,8 @@ MmWaveFlexTtiPfMacScheduler::UpdateDlHarqProcessId(uint16_t rnti)
     }
 
     // search for available process ID, if none available return numHarqProcess
-    uint8_t harqId = m_phyMacConfig->GetNumHarqProcess();
-    for (unsigned i = 0; i < m_phyMacConfig->GetNumHarqProcess(); i++)
+    uint8_t harqId = m_numHarqProcess;
+    for (unsigned i = 0; i < m_numHarqProcess; i++)
     {
         if (itStat->second[i] == 0)
         {
@@ -709,7 +710,7 @@ MmWaveFlexTtiPfMacScheduler::UpdateUlHarqProcessId(uint16_t rnti)
     if (m_harqOn == false)
     {
         uint8_t tbUid = m_tbUid;
-        m_tbUid = (m_tbUid + 1) % m_phyMacConfig->GetNumHarqProcess();
+        m_tbUid = (m_tbUid + 1) % m_numHarqProcess;
         return tbUid;
     }
 
@@ -726,8 +727,8 @@ MmWaveFlexTtiPfMacScheduler::UpdateUlHarqProcessId(uint16_t rnti)
     }
 
     // search for available process ID, if none available return numHarqProcess+1
-    uint8_t harqId = m_phyMacConfig->GetNumHarqProcess();
-    for (unsigned i = 0; i < m_phyMacConfig->GetNumHarqProcess(); i++)
+    uint8_t harqId = m_numHarqProcess;
+    for (unsigned i = 0; i < m_numHarqProcess; i++)
     {
         if (itStat->second[i] == 0)
         {
@@ -763,7 +764,7 @@ MmWaveFlexTtiPfMacScheduler::CalcMinTbSizeNumSym(unsigned mcs, unsigned bufSize,
     MmWaveMacPduHeader dummyMacHeader;
     // unsigned macHdrSize = 10; //dummyMacHeader.GetSerializedSize ();
     int numSymLow = 0;
-    int numSymHigh = m_phyMacConfig->GetSymbPerSlot();
+    int numSymHigh = m_numerology.GetSymbPerSlot();
 
     int diff = 0;
     tbSize = m_amc->CalculateTbSize(mcs, numSymHigh); // start with max value, in number of bytes
@@ -827,11 +828,11 @@ MmWaveFlexTtiPfMacScheduler::DoSchedTriggerReq(
     dlCtrlSlot.m_dci.m_numSym = 1;
     dlCtrlSlot.m_dci.m_symStart = 0;
     ret.m_slotAllocInfo.m_ttiAllocInfo.push_back(dlCtrlSlot);
-    int resvCtrl = m_phyMacConfig->GetDlCtrlSymbols() + m_phyMacConfig->GetUlCtrlSymbols();
-    int symAvail = m_phyMacConfig->GetSymbPerSlot() - resvCtrl;
+    int resvCtrl = m_numerology.GetDlCtrlSymbols() + m_numerology.GetUlCtrlSymbols();
+    int symAvail = m_numerology.GetSymbPerSlot() - resvCtrl;
     uint8_t ttiIdx = 1;
     uint8_t symIdx =
-        m_phyMacConfig->GetDlCtrlSymbols(); // symbols reserved for control at beginning of subframe
+        m_numerology.GetDlCtrlSymbols(); // symbols reserved for control at beginning of subframe
 
     // process received CQIs
     RefreshDlCqiMaps();
@@ -946,8 +947,8 @@ MmWaveFlexTtiPfMacScheduler::DoSchedTriggerReq(
                     symAvail -= dciInfoReTx.m_numSym;
                     dciInfoReTx.m_symStart = symIdx;
                     symIdx += dciInfoReTx.m_numSym;
-                    NS_ASSERT(symIdx <= m_phyMacConfig->GetSymbPerSlot() -
-                                            m_phyMacConfig->GetUlCtrlSymbols());
+                    NS_ASSERT(symIdx <= m_numerology.GetSymbPerSlot() -
+                                            m_numerology.GetUlCtrlSymbols());
                     dciInfoReTx.m_rv++;
                     dciInfoReTx.m_ndi = 0;
                     itHarq->second.at(harqId) = dciInfoReTx;
@@ -1060,8 +1061,8 @@ MmWaveFlexTtiPfMacScheduler::DoSchedTriggerReq(
                     symAvail -= dciInfoReTx.m_numSym;
                     dciInfoReTx.m_symStart = symIdx;
                     symIdx += dciInfoReTx.m_numSym;
-                    NS_ASSERT(symIdx <= m_phyMacConfig->GetSymbPerSlot() -
-                                            m_phyMacConfig->GetUlCtrlSymbols());
+                    NS_ASSERT(symIdx <= m_numerology.GetSymbPerSlot() -
+                                            m_numerology.GetUlCtrlSymbols());
                     dciInfoReTx.m_rv++;
                     dciInfoReTx.m_ndi = 0;
                     itStat->second.at(harqId) = itStat->second.at(harqId) + 1;
@@ -1112,7 +1113,7 @@ MmWaveFlexTtiPfMacScheduler::DoSchedTriggerReq(
         // add slot for UL control
         TtiAllocInfo ulCtrlSlot(0xFF, TtiAllocInfo::UL_slotAllocInfo, TtiAllocInfo::CTRL, 0);
         ulCtrlSlot.m_dci.m_numSym = 1;
-        ulCtrlSlot.m_dci.m_symStart = m_phyMacConfig->GetSymbPerSlot() - 1;
+        ulCtrlSlot.m_dci.m_symStart = m_numerology.GetSymbPerSlot() - 1;
         // ret.m_ulSfAllocInfo.m_ttiAllocInfo.push_back (ulCtrlSlot);
         ret.m_slotAllocInfo.m_ttiAllocInfo.push_back(ulCtrlSlot);
         // m_ulSfAllocInfo.push_back (ret.m_ulSfAllocInfo); // add UL SF info for later calls to
@@ -1172,7 +1173,7 @@ MmWaveFlexTtiPfMacScheduler::DoSchedTriggerReq(
                 uint32_t tbSizeMax =
                     m_amc->CalculateTbSize(ueInfo->m_dlMcs, 1) * 8; // Bytes -> Bits
                 ueInfo->m_currTputDl = std::min(ueInfo->m_totBufDl, tbSizeMax) /
-                                       (m_phyMacConfig->GetSlotPeriod().GetSeconds());
+                                       (m_numerology.GetSlotPeriod().GetSeconds());
                 m_ueStatHeap.push_back(ueInfo);
                 itUeAllocMap = ueAllocMap.find(ueInfo->m_rnti);
                 if (itUeAllocMap == ueAllocMap.end())
@@ -1192,7 +1193,7 @@ MmWaveFlexTtiPfMacScheduler::DoSchedTriggerReq(
             // translate vector of doubles to SpectrumValue's
             SpectrumValue specVals(MmWaveSpectrumValueHelper::GetSpectrumModel(m_phyMacConfig));
             Values::iterator specIt = specVals.ValuesBegin();
-            for (uint32_t ichunk = 0; ichunk < m_phyMacConfig->GetNumRb(); ichunk++)
+            for (uint32_t ichunk = 0; ichunk < m_numerology.GetNumRb(); ichunk++)
             {
                 NS_ASSERT(specIt != specVals.ValuesEnd());
                 *specIt = itCqiUl->second.m_ueUlCqi.at(ichunk); // sinrLin;
@@ -1221,7 +1222,7 @@ MmWaveFlexTtiPfMacScheduler::DoSchedTriggerReq(
                 uint32_t tbSizeMax =
                     m_amc->CalculateTbSize(ueInfo->m_ulMcs, 1) * 8; // Bytes -> Bits
                 ueInfo->m_currTputUl = std::min(ueInfo->m_totBufUl, tbSizeMax) /
-                                       (m_phyMacConfig->GetSlotPeriod().GetSeconds());
+                                       (m_numerology.GetSlotPeriod().GetSeconds());
                 if (!dlAdded)
                 {
                     m_ueStatHeap.push_back(ueInfo);
@@ -1290,11 +1291,11 @@ MmWaveFlexTtiPfMacScheduler::DoSchedTriggerReq(
                 uint32_t tbSize = m_amc->CalculateTbSize(ueInfo->m_ulMcs, ueInfo->m_ulSymbols) *
                                   8; // Bytes -> Bits
                 ueInfo->m_currTputUl = std::min(ueInfo->m_totBufUl, tbSize) /
-                                       (m_phyMacConfig->GetSlotPeriod().GetSeconds());
+                                       (m_numerology.GetSlotPeriod().GetSeconds());
                 ueInfo->m_avgTputUl =
                     ((1.0 - (1.0 / m_timeWindow)) * ueInfo->m_lastAvgTputUl) +
                     ((1.0 / m_timeWindow) *
-                     ((double)ueInfo->m_ulTbSize / (m_phyMacConfig->GetSlotPeriod().GetSeconds())));
+                     ((double)ueInfo->m_ulTbSize / (m_numerology.GetSlotPeriod().GetSeconds())));
                 ueAlloc = true;
             }
             else if (!ueInfo->m_dlAllocDone)
@@ -1312,11 +1313,11 @@ MmWaveFlexTtiPfMacScheduler::DoSchedTriggerReq(
                 uint32_t tbSize = m_amc->CalculateTbSize(ueInfo->m_dlMcs, ueInfo->m_dlSymbols) *
                                   8; // Bytes -> Bits
                 ueInfo->m_currTputDl = std::min(ueInfo->m_totBufDl, tbSize) /
-                                       (m_phyMacConfig->GetSlotPeriod().GetSeconds());
+                                       (m_numerology.GetSlotPeriod().GetSeconds());
                 ueInfo->m_avgTputDl =
                     ((1.0 - (1.0 / m_timeWindow)) * ueInfo->m_lastAvgTputDl) +
                     ((1.0 / m_timeWindow) *
-                     ((double)ueInfo->m_dlTbSize / (m_phyMacConfig->GetSlotPeriod().GetSeconds())));
+                     ((double)ueInfo->m_dlTbSize / (m_numerology.GetSlotPeriod().GetSeconds())));
                 ueAlloc = true;
             }
 
@@ -1335,7 +1336,7 @@ MmWaveFlexTtiPfMacScheduler::DoSchedTriggerReq(
         // add slot for UL control
         TtiAllocInfo ulCtrlSlot(0xFF, TtiAllocInfo::UL_slotAllocInfo, TtiAllocInfo::CTRL, 0);
         ulCtrlSlot.m_dci.m_numSym = 1;
-        ulCtrlSlot.m_dci.m_symStart = m_phyMacConfig->GetSymbPerSlot() - 1;
+        ulCtrlSlot.m_dci.m_symStart = m_numerology.GetSymbPerSlot() - 1;
         // ret.m_ulSfAllocInfo.m_ttiAllocInfo.push_back (ulCtrlSlot);
         ret.m_slotAllocInfo.m_ttiAllocInfo.push_back(ulCtrlSlot);
         // m_ulSfAllocInfo.push_back (ret.m_ulSfAllocInfo); // add UL SF info for later calls to
@@ -1386,13 +1387,13 @@ MmWaveFlexTtiPfMacScheduler::DoSchedTriggerReq(
             dci.m_numSym = ueInfo->m_dlSymbols;
             symIdx += ueInfo->m_dlSymbols;
             NS_ASSERT(symIdx <=
-                      m_phyMacConfig->GetSymbPerSlot() - m_phyMacConfig->GetUlCtrlSymbols());
+                      m_numerology.GetSymbPerSlot() - m_numerology.GetUlCtrlSymbols());
             dci.m_mcs = ueInfo->m_dlMcs;
             dci.m_rv = 0;
             dci.m_ndi = 1;
             dci.m_tbSize = m_amc->CalculateTbSize(dci.m_mcs, dci.m_numSym);
             dci.m_harqProcess = UpdateDlHarqProcessId(ueInfo->m_rnti);
-            NS_ASSERT(dci.m_harqProcess < m_phyMacConfig->GetNumHarqProcess());
+            NS_ASSERT(dci.m_harqProcess < m_numHarqProcess);
             // NS_LOG_DEBUG ("UE" << ueInfo->m_rnti << " DL harqId " << (unsigned)dci.m_harqProcess
             // << " HARQ process assigned");
             TtiAllocInfo ttiInfo(ttiIdx++,
@@ -1563,14 +1564,14 @@ MmWaveFlexTtiPfMacScheduler::DoSchedTriggerReq(
             dci.m_numSym = ueInfo->m_ulSymbols;
             symIdx += ueInfo->m_ulSymbols;
             NS_ASSERT(symIdx <=
-                      m_phyMacConfig->GetSymbPerSlot() - m_phyMacConfig->GetUlCtrlSymbols());
+                      m_numerology.GetSymbPerSlot() - m_numerology.GetUlCtrlSymbols());
             dci.m_mcs = ueInfo->m_ulMcs;
             dci.m_ndi = 1;
             dci.m_tbSize = m_amc->CalculateTbSize(dci.m_mcs, dci.m_numSym);
             dci.m_harqProcess = UpdateUlHarqProcessId(ueInfo->m_rnti);
             // NS_LOG_DEBUG ("UE" << ueInfo->m_rnti << " UL harqId " << (unsigned)dci.m_harqProcess
             // << " HARQ process assigned");
-            NS_ASSERT(dci.m_harqProcess < m_phyMacConfig->GetNumHarqProcess());
+            NS_ASSERT(dci.m_harqProcess < m_numHarqProcess);
             TtiAllocInfo ttiInfo(ttiIdx++,
                                  TtiAllocInfo::UL_slotAllocInfo,
                                  TtiAllocInfo::CTRL_DATA,
@@ -1585,7 +1586,7 @@ MmWaveFlexTtiPfMacScheduler::DoSchedTriggerReq(
             ret.m_slotAllocInfo.m_ttiAllocInfo.push_back(ttiInfo);
             ret.m_slotAllocInfo.m_numSymAlloc += dci.m_numSym;
             std::vector<uint16_t> ueChunkMap;
-            for (uint32_t i = 0; i < m_phyMacConfig->GetNumRb(); i++)
+            for (uint32_t i = 0; i < m_numerology.GetNumRb(); i++)
             {
                 ueChunkMap.push_back(dci.m_rnti);
             }
@@ -1649,7 +1650,7 @@ MmWaveFlexTtiPfMacScheduler::DoSchedTriggerReq(
     // add slot for UL control
     TtiAllocInfo ulCtrlSlot(0xFF, TtiAllocInfo::UL_slotAllocInfo, TtiAllocInfo::CTRL, 0);
     ulCtrlSlot.m_dci.m_numSym = 1;
-    ulCtrlSlot.m_dci.m_symStart = m_phyMacConfig->GetSymbPerSlot() - 1;
+    ulCtrlSlot.m_dci.m_symStart = m_numerology.GetSymbPerSlot() - 1;
     // ret.m_ulSfAllocInfo.m_ttiAllocInfo.push_back (ulCtrlSlot);
     ret.m_slotAllocInfo.m_ttiAllocInfo.push_back(ulCtrlSlot);
 
@@ -1850,19 +1851,19 @@ MmWaveFlexTtiPfMacScheduler::DoCschedUeConfigReq(
     {
         // m_dlHarqCurrentProcessId.insert (std::pair <uint16_t,uint8_t > (params.m_rnti, 0));
         DlHarqProcessesStatus_t dlHarqPrcStatus;
-        dlHarqPrcStatus.resize(m_phyMacConfig->GetNumHarqProcess(), 0);
+        dlHarqPrcStatus.resize(m_numHarqProcess, 0);
         m_dlHarqProcessesStatus.insert(
             std::pair<uint16_t, DlHarqProcessesStatus_t>(params.m_rnti, dlHarqPrcStatus));
         DlHarqProcessesTimer_t dlHarqProcessesTimer;
-        dlHarqProcessesTimer.resize(m_phyMacConfig->GetNumHarqProcess(), 0);
+        dlHarqProcessesTimer.resize(m_numHarqProcess, 0);
         m_dlHarqProcessesTimer.insert(
             std::pair<uint16_t, DlHarqProcessesTimer_t>(params.m_rnti, dlHarqProcessesTimer));
         DlHarqProcessesDciInfoList_t dlHarqTbInfoList;
-        dlHarqTbInfoList.resize(m_phyMacConfig->GetNumHarqProcess());
+        dlHarqTbInfoList.resize(m_numHarqProcess);
         m_dlHarqProcessesDciInfoMap.insert(
             std::pair<uint16_t, DlHarqProcessesDciInfoList_t>(params.m_rnti, dlHarqTbInfoList));
         DlHarqRlcPduList_t dlHarqRlcPduList;
-        dlHarqRlcPduList.resize(m_phyMacConfig->GetNumHarqProcess());
+        dlHarqRlcPduList.resize(m_numHarqProcess);
         m_dlHarqProcessesRlcPduMap.insert(
             std::pair<uint16_t, DlHarqRlcPduList_t>(params.m_rnti, dlHarqRlcPduList));
     }
@@ -1871,15 +1872,15 @@ MmWaveFlexTtiPfMacScheduler::DoCschedUeConfigReq(
     {
         //              m_ulHarqCurrentProcessId.insert (std::pair <uint16_t,uint8_t > (rnti, 0));
         UlHarqProcessesStatus_t ulHarqPrcStatus;
-        ulHarqPrcStatus.resize(m_phyMacConfig->GetNumHarqProcess(), 0);
+        ulHarqPrcStatus.resize(m_numHarqProcess, 0);
         m_ulHarqProcessesStatus.insert(
             std::pair<uint16_t, UlHarqProcessesStatus_t>(params.m_rnti, ulHarqPrcStatus));
         UlHarqProcessesTimer_t ulHarqProcessesTimer;
-        ulHarqProcessesTimer.resize(m_phyMacConfig->GetNumHarqProcess(), 0);
+        ulHarqProcessesTimer.resize(m_numHarqProcess, 0);
         m_ulHarqProcessesTimer.insert(
             std::pair<uint16_t, UlHarqProcessesTimer_t>(params.m_rnti, ulHarqProcessesTimer));
         UlHarqProcessesDciInfoList_t ulHarqTbInfoList;
-        ulHarqTbInfoList.resize(m_phyMacConfig->GetNumHarqProcess());
+        ulHarqTbInfoList.resize(m_numHarqProcess);
         m_ulHarqProcessesDciInfoMap.insert(
             std::pair<uint16_t, UlHarqProcessesDciInfoList_t>(params.m_rnti, ulHarqTbInfoList));
     }
@@ -22,7 +22,6 @@
 
 #include "mmwave-harq-phy.h"
 
-#include <ns3/assert.h>
 #include <ns3/log.h>
 
 NS_LOG_COMPONENT_DEFINE("MmWaveHarqPhy");
@@ -33,6 +32,10 @@ namespace ns3
 namespace mmwave
 {
 
+// the history of a process is reset after the transmission with RV 3, and thus
+// holds the outputs of the transmissions with RV 0 to 2 at most
+static const std::size_t MAX_HARQ_HISTORY_SIZE = 3;
+
 MmWaveHarqPhy::~MmWaveHarqPhy()
 {
     NS_LOG_FUNCTION(this);
@@ -57,10 +60,12 @@ MmWaveHarqPhy::GetHarqProcessInfoUl(uint16_t rnti, uint8_t harqProcId)
 void
 MmWaveHarqPhy::UpdateDlHarqProcessStatus(uint16_t rnti,
                                          uint8_t harqProcId,
-                                         const Ptr<MmWaveErrorModelOutput>& output)
+                                         const Ptr<MmWaveErrorModelOutput>& output,
+                                         const SpectrumValue& sinr,
+                                         const std::vector<int>& map)
 {
     NS_LOG_FUNCTION(this);
-    UpdateHarqProcessStatus(&m_dlHistory, rnti, harqProcId, output);
+    UpdateHarqProcessStatus(&m_dlHistory, rnti, harqProcId, output, sinr, map);
 }
 
 void
@@ -73,10 +78,12 @@ MmWaveHarqPhy::ResetDlHarqProcessStatus(uint16_t rnti, uint8_t id)
 void
 MmWaveHarqPhy::UpdateUlHarqProcessStatus(uint16_t rnti,
                                          uint8_t harqProcId,
-                                         const Ptr<MmWaveErrorModelOutput>& output)
+                                         const Ptr<MmWaveErrorModelOutput>& output,
+                                         const SpectrumValue& sinr,
+                                         const std::vector<int>& map)
 {
     NS_LOG_FUNCTION(this);
-    UpdateHarqProcessStatus(&m_ulHistory, rnti, harqProcId, output);
+    UpdateHarqProcessStatus(&m_ulHistory, rnti, harqProcId, output, sinr, map);
 }
 
 void
@@ -86,38 +93,28 @@ MmWaveHarqPhy::ResetUlHarqProcessStatus(uint16_t rnti, uint8_t id)
     ResetHarqProcessStatus(&m_ulHistory, rnti, id);
 }
 
-MmWaveHarqPhy::HistoryMap::iterator
-MmWaveHarqPhy::GetHistoryMapOf(MmWaveHarqPhy::HistoryMap* map, uint16_t rnti) const
+MmWaveHarqPhy::ProcIdHistories&
+MmWaveHarqPhy::GetHistoriesOf(MmWaveHarqPhy::HistoryMap* map, uint16_t rnti) const
 {
     NS_LOG_FUNCTION(this);
 
-    MmWaveHarqPhy::HistoryMap::iterator it = map->find(rnti);
-    if (it == map->end())
-    {
-        auto ret = map->insert(std::make_pair(rnti, ProcIdHistoryMap()));
-        NS_ASSERT(ret.second);
-
-        it = ret.first;
-    }
-
-    return it;
+    // an RNTI without histories gets an empty ProcIdHistories
+    return (*map)[rnti];
 }
 
-MmWaveHarqPhy::ProcIdHistoryMap::iterator
-MmWaveHarqPhy::GetProcIdHistoryMapOf(MmWaveHarqPhy::ProcIdHistoryMap* map, uint16_t procId) const
+MmWaveErrorModel::MmWaveErrorModelHistory&
+MmWaveHarqPhy::GetHistoryOf(MmWaveHarqPhy::ProcIdHistories* histories, uint8_t procId) const
 {
     NS_LOG_FUNCTION(this);
 
-    MmWaveHarqPhy::ProcIdHistoryMap::iterator it = map->find(procId);
-    if (it == map->end())
+    while (procId >= histories->size())
     {
-        auto ret = map->insert(std::make_pair(procId, MmWaveErrorModel::MmWaveErrorModelHistory()));
-        NS_ASSERT(ret.second);
-
-        it = ret.first;
+        histories->emplace_back();
+        histories->back().m_outputs.reserve(MAX_HARQ_HISTORY_SIZE);
+        histories->back().m_numRbs.reserve(MAX_HARQ_HISTORY_SIZE);
     }
 
-    return it;
+    return (*histories)[procId];
 }
 
 void
@@ -127,26 +124,27 @@ MmWaveHarqPhy::ResetHarqProcessStatus(MmWaveHarqPhy::HistoryMap* map,
 {
     NS_LOG_FUNCTION(this);
 
-    MmWaveHarqPhy::HistoryMap::iterator historyMap = GetHistoryMapOf(map, rnti);
-
-    ProcIdHistoryMap* procIdMap = &(historyMap->second);
-
-    GetProcIdHistoryMapOf(procIdMap, harqProcId)->second.clear();
+    GetHistoryOf(&GetHistoriesOf(map, rnti), harqProcId).Clear();
 }
 
 void
 MmWaveHarqPhy::UpdateHarqProcessStatus(MmWaveHarqPhy::HistoryMap* map,
                                        uint16_t rnti,
                                        uint8_t harqProcId,
-                                       const Ptr<MmWaveErrorModelOutput>& output) const
+                                       const Ptr<MmWaveErrorModelOutput>& output,
+                                       const SpectrumValue& sinr,
+                                       const std::vector<int>& rbMap) const
 {
     NS_LOG_FUNCTION(this);
 
-    MmWaveHarqPhy::HistoryMap::iterator historyMap = GetHistoryMapOf(map, rnti);
-
-    ProcIdHistoryMap* procIdMap = &(historyMap->second);
-
-    GetProcIdHistoryMapOf(procIdMap, harqProcId)->second.emplace_back(output);
+    MmWaveErrorModel::MmWaveErrorModelHistory& history =
+        GetHistoryOf(&GetHistoriesOf(map, rnti), harqProcId);
+    if (history.m_sinrRb.capacity() == 0)
+    {
+        // room for all the RBs of all the transmissions of the TBs of the process
+        history.m_sinrRb.reserve(MAX_HARQ_HISTORY_SIZE * sinr.GetValuesN());
+    }
+    history.Add(output, sinr, rbMap);
 }
 
 const MmWaveErrorModel::MmWaveErrorModelHistory&
@@ -156,11 +154,7 @@ MmWaveHarqPhy::GetHarqProcessInfo(MmWaveHarqPhy::HistoryMap* map,
 {
     NS_LOG_FUNCTION(this);
 
-    MmWaveHarqPhy::HistoryMap::iterator historyMap = GetHistoryMapOf(map, rnti);
-
-    ProcIdHistoryMap* procIdMap = &(historyMap->second);
-
-    return GetProcIdHistoryMapOf(procIdMap, harqProcId)->second;
+    return GetHistoryOf(&GetHistoriesOf(map, rnti), harqProcId);
 }
 
 } // namespace mmwave
@@ -26,6 +26,7 @@
 #include <ns3/mmwave-error-model.h>
 #include <ns3/simple-ref-count.h>
 
+#include <deque>
 #include <unordered_map>
 #include <vector>
 
@@ -77,10 +78,14 @@ class MmWaveHarqPhy : public SimpleRefCount<MmWaveHarqPhy>
      * \param rnti the RNTI
      * \param harqProcId the HARQ process id
      * \param output output of the error model
+     * \param sinr the SINR vector of the transmission
+     * \param map the RB map of the transmission
      */
     void UpdateDlHarqProcessStatus(uint16_t rnti,
                                    uint8_t harqProcId,
-                                   const Ptr<MmWaveErrorModelOutput>& output);
+                                   const Ptr<MmWaveErrorModelOutput>& output,
+                                   const SpectrumValue& sinr,
+                                   const std::vector<int>& map);
 
     /**
      * \brief Reset the info associated to the decodification of an HARQ process
@@ -96,10 +101,14 @@ class MmWaveHarqPhy : public SimpleRefCount<MmWaveHarqPhy>
      * \param rnti the RNTI
      * \param harqProcId the HARQ process id
      * \param output output of the error model
+     * \param sinr the SINR vector of the transmission
+     * \param map the RB map of the transmission
      */
     void UpdateUlHarqProcessStatus(uint16_t rnti,
                                    uint8_t harqProcId,
-                                   const Ptr<MmWaveErrorModelOutput>& output);
+                                   const Ptr<MmWaveErrorModelOutput>& output,
+                                   const SpectrumValue& sinr,
+                                   const std::vector<int>& map);
 
     /**
      * \brief Reset the info associated to the decodification of an HARQ process
@@ -111,29 +120,40 @@ class MmWaveHarqPhy : public SimpleRefCount<MmWaveHarqPhy>
 
   private:
     /**
-     * \brief Map between a process id and its HARQ history (a vector of pointers)
+     * \brief HARQ histories of the process ids of an RNTI, indexed by process id
      *
      * The HARQ history depends on the error model (LTE error model stores MI (MIESM-based), while
-     * NR error model stores SINR (EESM-based)) as well as on the HARQ combining method.
+     * NR error model stores the SINR of the allocated RBs (EESM-based)) as well as on the HARQ
+     * combining method. Each history also gathers the SINRs of the allocated RBs of its
+     * transmissions, as doubles, in a single buffer of the process.
+     *
+     * A history is created with room for the outputs of all the transmissions of a TB, and its
+     * SINR buffer gets room for all the RBs of these transmissions at the first transmission.
+     * The history is cleared, but not released, when its process is reset, so that the
+     * retransmissions of the following TBs of the process reuse its storage. A deque keeps the
+     * references to the histories valid when new process ids are added.
      */
-    typedef std::unordered_map<uint8_t, MmWaveErrorModel::MmWaveErrorModelHistory> ProcIdHistoryMap;
+    typedef std::deque<MmWaveErrorModel::MmWaveErrorModelHistory> ProcIdHistories;
     /**
-     * \brief Map between an RNTI and its ProcIdHistoryMap
+     * \brief Map between an RNTI and its ProcIdHistories
      */
-    typedef std::unordered_map<uint16_t, ProcIdHistoryMap> HistoryMap;
+    typedef std::unordered_map<uint16_t, ProcIdHistories> HistoryMap;
     /**
-     * \brief Return the HARQ history map of the retransmissions of all process ids of a particular
-     * RNTI \param rnti the RNTI \param map the Map between RNTIs and their history \return the
-     * HistoryMap of such RNTI
+     * \brief Return the HARQ histories of the retransmissions of all process ids of a particular
+     * RNTI
+     * \param map the Map between RNTIs and their histories
+     * \param rnti the RNTI
+     * \return the ProcIdHistories of such RNTI
      */
-    HistoryMap::iterator GetHistoryMapOf(HistoryMap* map, uint16_t rnti) const;
+    ProcIdHistories& GetHistoriesOf(HistoryMap* map, uint16_t rnti) const;
     /**
      * \brief Return the HARQ history of a particular process id
+     * \param histories the HARQ histories of the process ids
      * \param procId the process id
-     * \param map the Map between processes ids and their history
-     * \return the ProcIdHistoryMap of such process id
+     * \return the HARQ history of such process id
      */
-    ProcIdHistoryMap::iterator GetProcIdHistoryMapOf(ProcIdHistoryMap* map, uint16_t procId) const;
+    MmWaveErrorModel::MmWaveErrorModelHistory& GetHistoryOf(ProcIdHistories* histories,
+                                                            uint8_t procId) const;
 
     /**
      * \brief Reset the HARQ history of a particular process id
@@ -148,11 +168,15 @@ class MmWaveHarqPhy : public SimpleRefCount<MmWaveHarqPhy>
      * \param id the HARQ process id
      * \param map the Map between RNTIs and their history
      * \param output the new HARQ history to be included
+     * \param sinr the SINR vector of the transmission
+     * \param rbMap the RB map of the transmission
      */
     void UpdateHarqProcessStatus(HistoryMap* map,
                                  uint16_t rnti,
                                  uint8_t harqProcId,
-                                 const Ptr<MmWaveErrorModelOutput>& output) const;
+                                 const Ptr<MmWaveErrorModelOutput>& output,
+                                 const SpectrumValue& sinr,
+                                 const std::vector<int>& rbMap) const;
     /**
      * \brief Return the HARQ history of a particular process id
      * \param rnti the RNTI
@@ -43,9 +43,7 @@ namespace mmwave
 {
 
 mmWaveInterference::mmWaveInterference()
-    : m_receiving(false),
-      m_lastSignalId(0),
-      m_lastSignalIdBeforeReset(0)
+    : m_receiving(false)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -64,6 +62,8 @@ mmWaveInterference::DoDispose()
     m_rxSignal = 0;
     m_allSignals = 0;
     m_noise = 0;
+    m_sinr = 0;
+    m_signalEnds.clear();
     Object::DoDispose();
 }
 
@@ -78,6 +78,7 @@ void
 mmWaveInterference::StartRx(Ptr<const SpectrumValue> rxPsd)
 {
     NS_LOG_FUNCTION(this << *rxPsd);
+    SubtractEndedSignals(Now());
     if (m_receiving == false)
     {
         NS_LOG_LOGIC("first signal");
@@ -120,7 +121,8 @@ mmWaveInterference::EndRx()
     }
     else
     {
-        ConditionallyEvaluateChunk();
+        SubtractEndedSignals(Now());
+        ConditionallyEvaluateChunk(Now());
         m_receiving = false;
         for (std::list<Ptr<mmWaveChunkProcessor>>::const_iterator it =
                  m_PowerChunkProcessorList.begin();
@@ -143,60 +145,52 @@ void
 mmWaveInterference::AddSignal(Ptr<const SpectrumValue> spd, const Time duration)
 {
     NS_LOG_FUNCTION(this << *spd << duration);
-    DoAddSignal(spd);
-    uint32_t signalId = ++m_lastSignalId;
-    if (signalId == m_lastSignalIdBeforeReset)
-    {
-        // This happens when m_lastSignalId eventually wraps around. Given that so
-        // many signals have elapsed since the last reset, we hope that by now there is
-        // no stale pending signal (i.e., a signal that was scheduled
-        // for subtraction before the reset). So we just move the
-        // boundary further.
-        m_lastSignalIdBeforeReset += 0x10000000;
-    }
-    Simulator::Schedule(duration, &mmWaveInterference::DoSubtractSignal, this, spd, signalId);
-}
-
-void
-mmWaveInterference::DoAddSignal(Ptr<const SpectrumValue> spd)
-{
-    NS_LOG_FUNCTION(this << *spd);
-    ConditionallyEvaluateChunk();
+    Time now = Now();
+    SubtractEndedSignals(now);
+    ConditionallyEvaluateChunk(now);
     (*m_allSignals) += (*spd);
+    m_signalEnds[now + duration].push_back(spd);
 }
 
 void
-mmWaveInterference::DoSubtractSignal(Ptr<const SpectrumValue> spd, uint32_t signalId)
+mmWaveInterference::SubtractEndedSignals(Time now)
 {
-    NS_LOG_FUNCTION(this << *spd);
-    ConditionallyEvaluateChunk();
-    int32_t deltaSignalId = signalId - m_lastSignalIdBeforeReset;
-    if (deltaSignalId > 0)
-    {
-        (*m_allSignals) -= (*spd);
-    }
-    else
+    NS_LOG_FUNCTION(this << now);
+    while (!m_signalEnds.empty() && m_signalEnds.begin()->first <= now)
     {
-        NS_LOG_INFO("ignoring signal scheduled for subtraction before last reset");
+        auto ended = m_signalEnds.begin();
+        ConditionallyEvaluateChunk(ended->first);
+        for (const auto& spd : ended->second)
+        {
+            (*m_allSignals) -= (*spd);
+        }
+        m_signalEnds.erase(ended);
     }
 }
 
 void
-mmWaveInterference::ConditionallyEvaluateChunk()
+mmWaveInterference::ConditionallyEvaluateChunk(Time now)
 {
     NS_LOG_FUNCTION(this);
     if (m_receiving)
     {
         NS_LOG_DEBUG(this << " Receiving");
     }
-    NS_LOG_DEBUG(this << " now " << Now() << " last " << m_lastChangeTime);
-    if (m_receiving && (Now() > m_lastChangeTime))
+    NS_LOG_DEBUG(this << " now " << now << " last " << m_lastChangeTime);
+    if (m_receiving && (now > m_lastChangeTime))
     {
         NS_LOG_LOGIC(this << " signal = " << *m_rxSignal << " allSignals = " << *m_allSignals
                           << " noise = " << *m_noise);
-        SpectrumValue interf = (*m_allSignals) - (*m_rxSignal) + (*m_noise);
-        SpectrumValue sinr = (*m_rxSignal) / interf;
-        Time duration = Now() - m_lastChangeTime;
+        // SINR = signal / (all signals - signal + noise), without temporaries
+        auto sinr = m_sinr->ValuesBegin();
+        auto signal = m_rxSignal->ConstValuesBegin();
+        auto all = m_allSignals->ConstValuesBegin();
+        for (auto noise = m_noise->ConstValuesBegin(); noise != m_noise->ConstValuesEnd();
+             ++noise, ++sinr, ++signal, ++all)
+        {
+            *sinr = *signal / (*all - *signal + *noise);
+        }
+        Time duration = now - m_lastChangeTime;
         for (std::list<Ptr<mmWaveChunkProcessor>>::const_iterator it =
                  m_PowerChunkProcessorList.begin();
              it != m_PowerChunkProcessorList.end();
@@ -209,9 +203,9 @@ mmWaveInterference::ConditionallyEvaluateChunk()
              it != m_sinrChunkProcessorList.end();
              ++it)
         {
-            (*it)->EvaluateChunk(sinr, duration);
+            (*it)->EvaluateChunk(*m_sinr, duration);
         }
-        m_lastChangeTime = Now();
+        m_lastChangeTime = now;
     }
 }
 
@@ -219,15 +213,18 @@ void
 mmWaveInterference::SetNoisePowerSpectralDensity(Ptr<const SpectrumValue> noisePsd)
 {
     NS_LOG_FUNCTION(this << *noisePsd);
-    ConditionallyEvaluateChunk();
+    SubtractEndedSignals(Now());
+    ConditionallyEvaluateChunk(Now());
     m_noise = noisePsd;
     m_allSignals = Create<SpectrumValue>(noisePsd->GetSpectrumModel());
+    m_sinr = Create<SpectrumValue>(noisePsd->GetSpectrumModel());
     if (m_receiving == true)
     {
         // abort rx
         m_receiving = false;
     }
-    m_lastSignalIdBeforeReset = m_lastSignalId;
+    // the signals received before the reset are not subtracted from the new sum
+    m_signalEnds.clear();
 }
 
 void
@@ -34,7 +34,9 @@
 #include <ns3/packet.h>
 #include <ns3/spectrum-value.h>
 
+#include <map>
 #include <string.h>
+#include <vector>
 
 namespace ns3
 {
@@ -57,9 +59,19 @@ class mmWaveInterference : public Object
     void AddSinrChunkProcessor(Ptr<mmWaveChunkProcessor> p);
 
   private:
-    void ConditionallyEvaluateChunk();
-    void DoAddSignal(Ptr<const SpectrumValue> spd);
-    void DoSubtractSignal(Ptr<const SpectrumValue> spd, uint32_t signalId);
+    /**
+     * Evaluate the chunk which started at the last change, if receiving
+     *
+     * \param now the end of the chunk
+     */
+    void ConditionallyEvaluateChunk(Time now);
+    /**
+     * Evaluate the chunks and remove the signals which ended up to now, in
+     * the order in which the signals end
+     *
+     * \param now the current time
+     */
+    void SubtractEndedSignals(Time now);
     std::list<Ptr<mmWaveChunkProcessor>> m_PowerChunkProcessorList;
     std::list<Ptr<mmWaveChunkProcessor>> m_sinrChunkProcessorList;
 
@@ -68,11 +80,16 @@ class mmWaveInterference : public Object
     Ptr<SpectrumValue> m_rxSignal;
     Ptr<SpectrumValue> m_allSignals;
     Ptr<const SpectrumValue> m_noise;
+    Ptr<SpectrumValue> m_sinr; //!< buffer of the SINR of the last chunk
 
     Time m_lastChangeTime;
 
-    uint32_t m_lastSignalId;
-    uint32_t m_lastSignalIdBeforeReset;
+    /**
+     * The signals in m_allSignals, grouped by the time at which they end. In
+     * TDD all the signals of a TTI end together, so that they are removed
+     * together, without an event per signal.
+     */
+    std::map<Time, std::vector<Ptr<const SpectrumValue>>> m_signalEnds;
 };
 
 } // namespace mmwave
@@ -159,6 +159,30 @@ MmWavePhyMacCommon::SetUlSchedDelay(uint32_t delay)
     m_ulSchedDelay = delay;
 }
 
+MmWaveNumerology::MmWaveNumerology()
+{
+}
+
+MmWaveNumerology::MmWaveNumerology(Ptr<MmWavePhyMacCommon> config)
+    : m_symbolsPerSlot(config->GetSymbPerSlot()),
+      m_slotsPerSubframe(config->GetSlotsPerSubframe()),
+      m_subframesPerFrame(config->GetSubframesPerFrame()),
+      m_dlCtrlSymbols(config->GetDlCtrlSymbols()),
+      m_ulCtrlSymbols(config->GetUlCtrlSymbols()),
+      m_ulSchedDelay(config->GetUlSchedDelay()),
+      m_numRbs(config->GetNumRb()),
+      m_symbolPeriod(config->GetSymbolPeriod()),
+      m_slotPeriod(config->GetSlotPeriod()),
+      m_subframePeriod(config->GetSubframePeriod()),
+      m_tbDecodeLatency(MicroSeconds(config->GetTbDecodeLatency()))
+{
+    NS_LOG_FUNCTION(this);
+    for (uint32_t numSym = 0; numSym <= m_symbolsPerSlot; numSym++)
+    {
+        m_symbolsDuration.push_back(numSym * m_symbolPeriod);
+    }
+}
+
 } // namespace mmwave
 
 } // namespace ns3
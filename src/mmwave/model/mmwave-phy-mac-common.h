@@ -22,6 +22,7 @@
 #ifndef SRC_MMWAVE_MODEL_MMWAVE_PHY_MAC_COMMON_H
 #define SRC_MMWAVE_MODEL_MMWAVE_PHY_MAC_COMMON_H
 
+#include <ns3/abort.h>
 #include <ns3/log.h>
 #include <ns3/nstime.h>
 #include <ns3/object.h>
@@ -765,6 +766,143 @@ class MmWavePhyMacCommon : public Object
     uint8_t m_componentCarrierId; //!< the component carrier ID
 };
 
+/**
+ * An immutable snapshot of the numerology of a MmWavePhyMacCommon, taken by the
+ * PHY layers and by the flex TTI scheduler when they are configured. It holds the
+ * values that are read at every TTI, and the durations of the TTIs, which are
+ * computed once for each number of OFDM symbols instead of being derived from the
+ * symbol period at every TTI.
+ * The snapshot does not follow the changes of the MmWavePhyMacCommon.
+ */
+class MmWaveNumerology
+{
+  public:
+    /**
+     * Create an empty snapshot, to be replaced before use
+     */
+    MmWaveNumerology();
+
+    /**
+     * Take the snapshot of a configuration
+     *
+     * \param config the configuration
+     */
+    MmWaveNumerology(Ptr<MmWavePhyMacCommon> config);
+
+    /**
+     * \return the number of OFDM symbols inside a slot
+     */
+    inline uint32_t GetSymbPerSlot(void) const
+    {
+        return m_symbolsPerSlot;
+    }
+
+    /**
+     * \return the number of slots inside a subframe
+     */
+    inline uint32_t GetSlotsPerSubframe(void) const
+    {
+        return m_slotsPerSubframe;
+    }
+
+    /**
+     * \return the number of subframes inside a frame
+     */
+    inline uint32_t GetSubframesPerFrame(void) const
+    {
+        return m_subframesPerFrame;
+    }
+
+    /**
+     * \return the number of OFDM symbols of the DL control region
+     */
+    inline uint32_t GetDlCtrlSymbols(void) const
+    {
+        return m_dlCtrlSymbols;
+    }
+
+    /**
+     * \return the number of OFDM symbols of the UL control region
+     */
+    inline uint32_t GetUlCtrlSymbols(void) const
+    {
+        return m_ulCtrlSymbols;
+    }
+
+    /**
+     * \return the delay between a UL DCI and the slot it refers to, in slots
+     */
+    inline uint8_t GetUlSchedDelay(void) const
+    {
+        return m_ulSchedDelay;
+    }
+
+    /**
+     * \return the number of Resource Blocks
+     */
+    inline uint32_t GetNumRb(void) const
+    {
+        return m_numRbs;
+    }
+
+    /**
+     * \return the duration of an OFDM symbol
+     */
+    inline Time GetSymbolPeriod(void) const
+    {
+        return m_symbolPeriod;
+    }
+
+    /**
+     * \param numSym a number of OFDM symbols, at most the number of symbols in a slot
+     * \return the duration of numSym OFDM symbols
+     */
+    inline Time GetSymbolsDuration(uint32_t numSym) const
+    {
+        NS_ABORT_MSG_IF(numSym >= m_symbolsDuration.size(),
+                        "A slot has only " << m_symbolsPerSlot << " OFDM symbols");
+        return m_symbolsDuration[numSym];
+    }
+
+    /**
+     * \return the duration of a slot
+     */
+    inline Time GetSlotPeriod(void) const
+    {
+        return m_slotPeriod;
+    }
+
+    /**
+     * \return the duration of a subframe
+     */
+    inline Time GetSubframePeriod(void) const
+    {
+        return m_subframePeriod;
+    }
+
+    /**
+     * \return the time required by the PHY layer to decode a transport block
+     */
+    inline Time GetTbDecodeLatency(void) const
+    {
+        return m_tbDecodeLatency;
+    }
+
+  private:
+    uint32_t m_symbolsPerSlot{0};           //!< number of OFDM symbols in a slot
+    uint32_t m_slotsPerSubframe{0};         //!< number of slots in a subframe
+    uint32_t m_subframesPerFrame{0};        //!< number of subframes in a frame
+    uint32_t m_dlCtrlSymbols{0};            //!< num OFDM symbols for downlink control
+    uint32_t m_ulCtrlSymbols{0};            //!< num OFDM symbols for uplink control
+    uint8_t m_ulSchedDelay{0};              //!< UL scheduling delay, in slots
+    uint32_t m_numRbs{0};                   //!< number of Resource Blocks
+    Time m_symbolPeriod;                    //!< time duration of a single OFDM symbol
+    std::vector<Time> m_symbolsDuration;    //!< duration of 0 to m_symbolsPerSlot OFDM symbols
+    Time m_slotPeriod;                      //!< time duration of a slot
+    Time m_subframePeriod;                  //!< time duration of a subframe
+    Time m_tbDecodeLatency;                 //!< time required to decode a transport block
+};
+
 } // namespace mmwave
 
 } // namespace ns3
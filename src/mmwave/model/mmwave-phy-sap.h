@@ -62,6 +62,12 @@ class MmWavePhySapProvider
      * \param slotAllocInfo the slot allocation info created by the scheduler.
      */
     virtual void SetSlotAllocInfo(SlotAllocInfo slotAllocInfo) = 0;
+
+    /**
+     * Asks the PHY to resume the slot indications, if it stopped them while the MAC had nothing
+     * to send.
+     */
+    virtual void ResumeSlotIndications() = 0;
 };
 
 /* Phy to Mac comm */
@@ -145,6 +151,12 @@ class MmWaveUePhySapUser
      */
     virtual void SetConfigurationParameters(Ptr<MmWavePhyMacCommon> params) = 0;
 
+    /**
+     * \returns true if the MAC has no buffer status report to send, i.e., if it does not need
+     * the next slot indications
+     */
+    virtual bool IsIdle() = 0;
+
     // virtual void NotifyHarqDeliveryFailure (uint8_t harqId) = 0;
 };
 
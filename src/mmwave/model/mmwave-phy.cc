@@ -71,6 +71,8 @@ class MmWaveMemberPhySapProvider : public MmWavePhySapProvider
 
     virtual void SetSlotAllocInfo(SlotAllocInfo slotAllocInfo);
 
+    virtual void ResumeSlotIndications();
+
   private:
     MmWavePhy* m_phy;
 };
@@ -105,6 +107,12 @@ MmWaveMemberPhySapProvider::SetSlotAllocInfo(SlotAllocInfo slotAllocInfo)
     m_phy->DoSetSlotAllocInfo(slotAllocInfo);
 }
 
+void
+MmWaveMemberPhySapProvider::ResumeSlotIndications()
+{
+    m_phy->ResumeSlotIndications();
+}
+
 TypeId
 MmWavePhy::GetTypeId()
 {
@@ -164,6 +172,16 @@ MmWavePhy::GetDevice()
     return m_netDevice;
 }
 
+bool
+MmWavePhy::IsOnLocalNode() const
+{
+    if (!m_netDevice || !m_netDevice->GetNode())
+    {
+        return true;
+    }
+    return m_netDevice->GetNode()->GetSystemId() == Simulator::GetSystemId();
+}
+
 void
 MmWavePhy::SetChannel(Ptr<SpectrumChannel> c)
 {
@@ -270,6 +288,11 @@ MmWavePhy::SetControlMessage(Ptr<MmWaveControlMessage> m)
     }
 }
 
+void
+MmWavePhy::ResumeSlotIndications()
+{
+}
+
 std::list<Ptr<MmWaveControlMessage>>
 MmWavePhy::GetControlMessages(void)
 {
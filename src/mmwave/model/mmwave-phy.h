@@ -78,6 +78,12 @@ class MmWavePhy : public Object
 
     Ptr<NetDevice> GetDevice();
 
+    /**
+     * \returns false if the node of this PHY is simulated by another rank
+     * of a distributed simulation
+     */
+    bool IsOnLocalNode() const;
+
     void SetChannel(Ptr<SpectrumChannel> c);
 
     /**
@@ -108,13 +114,21 @@ class MmWavePhy : public Object
     void SetNoiseFigure(double nf);
     double GetNoiseFigure(void) const;
 
-    void SetControlMessage(Ptr<MmWaveControlMessage> m);
+    virtual void SetControlMessage(Ptr<MmWaveControlMessage> m);
     std::list<Ptr<MmWaveControlMessage>> GetControlMessages(void);
 
     virtual void SetMacPdu(Ptr<Packet> pb);
 
     virtual void SendRachPreamble(uint32_t PreambleId, uint32_t Rnti);
 
+    /**
+     * Resumes the slot indications to the MAC, if the PHY stopped them.
+     *
+     * The MAC calls this function when it has something to send. The default implementation
+     * does nothing, as the PHY runs every slot.
+     */
+    virtual void ResumeSlotIndications();
+
     //  virtual Ptr<PacketBurst> GetPacketBurst (void);
     virtual Ptr<PacketBurst> GetPacketBurst(SfnSf);
 
@@ -172,6 +186,7 @@ class MmWavePhy : public Object
     uint16_t m_cellId;
 
     Ptr<MmWavePhyMacCommon> m_phyMacConfig;
+    MmWaveNumerology m_numerology; //!< snapshot of m_phyMacConfig, read at every TTI
 
     std::map<uint64_t, Ptr<PacketBurst>> m_packetBurstMap;
     std::vector<std::list<Ptr<MmWaveControlMessage>>> m_controlMessageQueue;
@@ -51,12 +51,15 @@
 #include <ns3/mmwave-lte-mi-error-model.h>
 #include <ns3/mmwave-ue-net-device.h>
 #include <ns3/mmwave-ue-phy.h>
+#include <ns3/node.h>
 #include <ns3/object-factory.h>
 #include <ns3/phased-array-model.h>
+#include <ns3/propagation-delay-model.h>
 #include <ns3/ptr.h>
 #include <ns3/simulator.h>
 #include <ns3/trace-source-accessor.h>
 
+#include <algorithm>
 #include <cmath>
 #include <stdio.h>
 
@@ -70,6 +73,9 @@ namespace mmwave
 
 NS_OBJECT_ENSURE_REGISTERED(MmWaveSpectrumPhy);
 
+// the number of receivers of the DL control frames added so far, which orders them
+static uint64_t g_dlCtrlReceiversAdded = 0;
+
 MmWaveSpectrumPhy::MmWaveSpectrumPhy()
     : m_cellId(0),
       m_state(IDLE),
@@ -124,6 +130,18 @@ MmWaveSpectrumPhy::GetTypeId(void)
                           MakeTypeIdAccessor(&MmWaveSpectrumPhy::SetErrorModelType,
                                              &MmWaveSpectrumPhy::GetErrorModelType),
                           MakeTypeIdChecker())
+            .AddAttribute("DirectDlCtrlDelivery",
+                          "Deliver the DL control frames directly to the UEs of the cell, "
+                          "without computing their propagation through the channel. The "
+                          "control frames are error-free and do not interfere with the data, "
+                          "so that only their propagation delay matters. The frames then do "
+                          "not fire the traces of the channel and are not subject to its "
+                          "MaxLossDb, and the random numbers drawn by the propagation models, "
+                          "and thus the results, change when shadowing is enabled or the "
+                          "channels are generated on demand.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&MmWaveSpectrumPhy::m_directDlCtrlDelivery),
+                          MakeBooleanChecker())
             .AddAttribute("FileName",
                           "file name",
                           StringValue("no"),
@@ -136,6 +154,8 @@ MmWaveSpectrumPhy::GetTypeId(void)
 void
 MmWaveSpectrumPhy::DoDispose()
 {
+    m_errorModel = nullptr;
+    m_dlCtrlReceivers.clear();
 }
 
 void
@@ -148,6 +168,7 @@ MmWaveSpectrumPhy::Reset()
     m_endRxDataEvent.Cancel();
     m_endRxDlCtrlEvent.Cancel();
     m_rxControlMessageList.clear();
+    m_rxControlMessageBundle = nullptr;
     m_transportBlocks.clear();
     m_rxPacketBurstList.clear();
     // m_txPacketBurst = 0;
@@ -167,7 +188,6 @@ MmWaveSpectrumPhy::SetDevice(Ptr<NetDevice> d)
 
     Ptr<MmWaveEnbNetDevice> enbNetDev = DynamicCast<MmWaveEnbNetDevice>(GetDevice());
 
-    // TODO m_isEnb is never used
     if (enbNetDev)
     {
         m_isEnb = true;
@@ -212,6 +232,7 @@ void
 MmWaveSpectrumPhy::SetErrorModelType(TypeId errorModelType)
 {
     m_errorModelType = errorModelType;
+    m_errorModel = nullptr;
 }
 
 Ptr<Object>
@@ -274,6 +295,12 @@ MmWaveSpectrumPhy::SetPhyRxCtrlEndOkCallback(MmWavePhyRxCtrlEndOkCallback c)
     m_phyRxCtrlEndOkCallback = c;
 }
 
+void
+MmWaveSpectrumPhy::SetPhyRxCtrlBundleEndOkCallback(MmWavePhyRxCtrlBundleEndOkCallback c)
+{
+    m_phyRxCtrlBundleEndOkCallback = c;
+}
+
 void
 MmWaveSpectrumPhy::AddExpectedTb(uint16_t rnti,
                                  uint8_t ndi,
@@ -420,6 +447,24 @@ MmWaveSpectrumPhy::StartRx(Ptr<SpectrumSignalParameters> params)
     }
 }
 
+bool
+MmWaveSpectrumPhy::IsListening(Ptr<const SpectrumSignalParameters> params) const
+{
+    // the same checks as StartRx, which only depend on the transmitter
+    bool enbTx = static_cast<bool>(DynamicCast<MmWaveEnbNetDevice>(params->txPhy->GetDevice()));
+    if (enbTx == m_isEnb)
+    {
+        return false;
+    }
+    Ptr<const MmWaveSpectrumSignalParametersDlCtrlFrame> ctrlParams =
+        DynamicCast<const MmWaveSpectrumSignalParametersDlCtrlFrame>(params);
+    if (ctrlParams)
+    {
+        return ctrlParams->cellId == m_cellId;
+    }
+    return true;
+}
+
 void
 MmWaveSpectrumPhy::StartRxData(Ptr<MmwaveSpectrumSignalParametersDataFrame> params)
 {
@@ -514,9 +559,9 @@ MmWaveSpectrumPhy::StartRxCtrl(Ptr<MmWaveSpectrumSignalParametersDlCtrlFrame> dl
             NS_ASSERT((m_firstRxStart == Simulator::Now()) &&
                       (m_firstRxDuration == dlCtrlRxParams->duration));
 
-            m_rxControlMessageList.insert(m_rxControlMessageList.end(),
-                                          dlCtrlRxParams->ctrlMsgList.begin(),
-                                          dlCtrlRxParams->ctrlMsgList.end());
+            std::list<Ptr<MmWaveControlMessage>> ctrlMsgList =
+                dlCtrlRxParams->ctrlMsgBundle->GetMessages();
+            m_rxControlMessageList.splice(m_rxControlMessageList.end(), ctrlMsgList);
         }
         else
         {
@@ -536,13 +581,20 @@ MmWaveSpectrumPhy::StartRxCtrl(Ptr<MmWaveSpectrumSignalParametersDlCtrlFrame> dl
             NS_LOG_LOGIC(this << " synchronized with this signal (cellId=" << m_cellId << ")");
 
             // first transmission, i.e., we're IDLE and we start RX
-            NS_ASSERT(m_rxControlMessageList.empty());
+            NS_ASSERT(m_rxControlMessageList.empty() && !m_rxControlMessageBundle);
             m_firstRxStart = Simulator::Now();
             m_firstRxDuration = dlCtrlRxParams->duration;
             NS_LOG_LOGIC(this << " scheduling EndRx with delay " << dlCtrlRxParams->duration);
 
             // store the DCIs
-            m_rxControlMessageList = dlCtrlRxParams->ctrlMsgList;
+            if (m_phyRxCtrlBundleEndOkCallback.IsNull())
+            {
+                m_rxControlMessageList = dlCtrlRxParams->ctrlMsgBundle->GetMessages();
+            }
+            else
+            {
+                m_rxControlMessageBundle = dlCtrlRxParams->ctrlMsgBundle;
+            }
             m_endRxDlCtrlEvent =
                 Simulator::Schedule(dlCtrlRxParams->duration, &MmWaveSpectrumPhy::EndRxCtrl, this);
             ChangeState(RX_CTRL);
@@ -569,72 +621,71 @@ MmWaveSpectrumPhy::EndRxData()
 
     m_interferenceData->EndRx(); // trigger the SINR computation
 
-    // check if the transmissions succeeded or failed
-    auto itTb = m_transportBlocks.begin();
-    while (itTb != m_transportBlocks.end())
+    // the TBs of this TTI share the SINR, so that its average and minimum are
+    // computed once, and the TBs are decoded in a single batch
+    double sinrAvg = Sum(m_sinrPerceived) / (m_sinrPerceived.GetSpectrumModel()->GetNumBands());
+    double sinrMin = MmWaveSpectrumPhy::Min(m_sinrPerceived);
+    NS_LOG_DEBUG("m_sinrPerceived=" << m_sinrPerceived << ", sinrMin=" << sinrMin
+                                    << ", sinrAvg=" << sinrAvg
+                                    << ", Avg SINR dB=" << 10 * std::log10(sinrAvg)
+                                    << ", GetNumBands="
+                                    << m_sinrPerceived.GetSpectrumModel()->GetNumBands());
+
+    std::vector<MmWaveErrorModel::TbDecodificationRequest> decodeRequests;
+    for (auto& tb : m_transportBlocks)
     {
-        // compute the average SINR
-        itTb->second.m_sinrAvg =
-            Sum(m_sinrPerceived) / (m_sinrPerceived.GetSpectrumModel()->GetNumBands());
-        itTb->second.m_sinrMin = MmWaveSpectrumPhy::Min(m_sinrPerceived);
-        NS_LOG_DEBUG("m_sinrPerceived="
-                     << m_sinrPerceived << ", sinrMin=" << itTb->second.m_sinrMin
-                     << ", sinrAvg=" << itTb->second.m_sinrAvg
-                     << ", Avg SINR dB=" << 10 * std::log10(itTb->second.m_sinrAvg)
-                     << ", GetNumBands=" << m_sinrPerceived.GetSpectrumModel()->GetNumBands());
+        tb.second.m_sinrAvg = sinrAvg;
+        tb.second.m_sinrMin = sinrMin;
 
         if ((m_dataErrorModelEnabled) && (m_rxPacketBurstList.size() > 0))
         {
             // Retrieve HARQ history
-            std::function<const MmWaveErrorModel::MmWaveErrorModelHistory&(uint16_t, uint8_t)>
-                RetrieveHistory;
-
-            if (itTb->second.m_expected.m_isDownlink)
-            {
-                RetrieveHistory = std::bind(&MmWaveHarqPhy::GetHarqProcessInfoDl,
-                                            m_harqPhyModule,
-                                            std::placeholders::_1,
-                                            std::placeholders::_2);
-            }
-            else
-            {
-                RetrieveHistory = std::bind(&MmWaveHarqPhy::GetHarqProcessInfoUl,
-                                            m_harqPhyModule,
-                                            std::placeholders::_1,
-                                            std::placeholders::_2);
-            }
-
             const MmWaveErrorModel::MmWaveErrorModelHistory& harqInfoList =
-                RetrieveHistory(itTb->first, itTb->second.m_expected.m_harqProcessId);
+                tb.second.m_expected.m_isDownlink
+                    ? m_harqPhyModule->GetHarqProcessInfoDl(tb.first,
+                                                            tb.second.m_expected.m_harqProcessId)
+                    : m_harqPhyModule->GetHarqProcessInfoUl(tb.first,
+                                                            tb.second.m_expected.m_harqProcessId);
+            decodeRequests.push_back({&tb.second.m_expected.m_rbBitmap,
+                                      tb.second.m_expected.m_tbSize,
+                                      tb.second.m_expected.m_mcs,
+                                      &harqInfoList});
+        }
+    }
 
-            // Obtain pointer to the specific error model used
+    if (!decodeRequests.empty())
+    {
+        // The error model is stateless between TBs, so that a single instance
+        // serves all the TBs received by this PHY
+        if (!m_errorModel)
+        {
             NS_ABORT_MSG_IF(!m_errorModelType.IsChildOf(MmWaveErrorModel::GetTypeId()),
                             "The error model must be a subclass of MmWaveErrorModel!");
             ObjectFactory emFactory;
             emFactory.SetTypeId(m_errorModelType);
-            Ptr<MmWaveErrorModel> em = DynamicCast<MmWaveErrorModel>(emFactory.Create());
-
-            // Check whether the TB is corrupted or not, update TB info accordingly
-            itTb->second.m_outputOfEM =
-                em->GetTbDecodificationStats(m_sinrPerceived,
-                                             itTb->second.m_expected.m_rbBitmap,
-                                             itTb->second.m_expected.m_tbSize,
-                                             itTb->second.m_expected.m_mcs,
-                                             harqInfoList);
-            itTb->second.m_isCorrupted =
-                m_random->GetValue() > itTb->second.m_outputOfEM->m_tbler ? false : true;
-
-            if (itTb->second.m_isCorrupted)
+            m_errorModel = DynamicCast<MmWaveErrorModel>(emFactory.Create());
+        }
+        std::vector<Ptr<MmWaveErrorModelOutput>> outputs =
+            m_errorModel->GetBatchDecodificationStats(m_sinrPerceived, decodeRequests);
+
+        // Check whether the TBs are corrupted or not, update TB info accordingly
+        auto output = outputs.begin();
+        for (auto& tb : m_transportBlocks)
+        {
+            tb.second.m_outputOfEM = *output++;
+            tb.second.m_isCorrupted =
+                m_random->GetValue() > tb.second.m_outputOfEM->m_tbler ? false : true;
+
+            if (tb.second.m_isCorrupted)
             {
-                NS_LOG_INFO(" RNTI " << itTb->first << " size " << itTb->second.m_expected.m_tbSize
-                                     << " mcs " << +itTb->second.m_expected.m_mcs << " bitmap "
-                                     << itTb->second.m_expected.m_rbBitmap.size() << " rv "
-                                     << +itTb->second.m_expected.m_rv << " TBLER "
-                                     << itTb->second.m_outputOfEM->m_tbler << " corrupted "
-                                     << itTb->second.m_isCorrupted);
+                NS_LOG_INFO(" RNTI " << tb.first << " size " << tb.second.m_expected.m_tbSize
+                                     << " mcs " << +tb.second.m_expected.m_mcs << " bitmap "
+                                     << tb.second.m_expected.m_rbBitmap.size() << " rv "
+                                     << +tb.second.m_expected.m_rv << " TBLER "
+                                     << tb.second.m_outputOfEM->m_tbler << " corrupted "
+                                     << tb.second.m_isCorrupted);
             }
         }
-        itTb++;
     }
 
     // fire the traces and send the ACKs/NACKs
@@ -654,7 +705,7 @@ MmWaveSpectrumPhy::EndRxData()
                 NS_FATAL_ERROR("No radio bearer tag found");
             }
             uint16_t rnti = bearerTag.GetRnti();
-            itTb = m_transportBlocks.find(rnti);
+            auto itTb = m_transportBlocks.find(rnti);
             if (itTb != m_transportBlocks.end())
             {
                 if (!itTb->second.m_isCorrupted)
@@ -750,7 +801,9 @@ MmWaveSpectrumPhy::EndRxData()
                             m_harqPhyModule->UpdateUlHarqProcessStatus(
                                 rnti,
                                 itTb->second.m_expected.m_harqProcessId,
-                                itTb->second.m_outputOfEM);
+                                itTb->second.m_outputOfEM,
+                                m_sinrPerceived,
+                                itTb->second.m_expected.m_rbBitmap);
                         }
                     }
                     else
@@ -803,7 +856,9 @@ MmWaveSpectrumPhy::EndRxData()
                             m_harqPhyModule->UpdateDlHarqProcessStatus(
                                 rnti,
                                 itTb->second.m_expected.m_harqProcessId,
-                                itTb->second.m_outputOfEM);
+                                itTb->second.m_outputOfEM,
+                                m_sinrPerceived,
+                                itTb->second.m_expected.m_rbBitmap);
                         }
                     }
                 }
@@ -847,7 +902,11 @@ MmWaveSpectrumPhy::EndRxCtrl()
 
     // control error model not supported
     // forward control messages of this frame to LtePhy
-    if (!m_rxControlMessageList.empty())
+    if (m_rxControlMessageBundle && !m_rxControlMessageBundle->IsEmpty())
+    {
+        m_phyRxCtrlBundleEndOkCallback(m_rxControlMessageBundle);
+    }
+    else if (!m_rxControlMessageList.empty())
     {
         if (!m_phyRxCtrlEndOkCallback.IsNull())
         {
@@ -857,6 +916,7 @@ MmWaveSpectrumPhy::EndRxCtrl()
 
     ChangeState(IDLE);
     m_rxControlMessageList.clear();
+    m_rxControlMessageBundle = nullptr;
 }
 
 bool
@@ -936,10 +996,37 @@ MmWaveSpectrumPhy::StartTxDlControlFrames(std::list<Ptr<MmWaveControlMessage>> c
         txParams->psd = m_txPsd;
         txParams->cellId = m_cellId;
         txParams->pss = true;
-        txParams->ctrlMsgList = ctrlMsgList;
+        txParams->ctrlMsgBundle = Create<MmWaveControlMessageBundle>(ctrlMsgList);
         txParams->txAntenna = nullptr; // TODO: do we need to know the antenna?
 
-        m_channel->StartTx(txParams);
+        // the UEs send their UL control frames with this method as well, and
+        // those always go through the channel
+        if (m_isEnb && m_directDlCtrlDelivery)
+        {
+            // the receivers share the parameters, whose PSD is not used for control
+            Ptr<PropagationDelayModel> delayModel = m_channel->GetPropagationDelayModel();
+            for (const auto& receiver : m_dlCtrlReceivers)
+            {
+                if (!receiver.phy->IsListening(txParams))
+                {
+                    continue;
+                }
+                Time delay{0};
+                if (delayModel && m_mobility && receiver.phy->GetMobility())
+                {
+                    delay = delayModel->GetDelay(m_mobility, receiver.phy->GetMobility());
+                }
+                Simulator::ScheduleWithContext(receiver.phy->GetDevice()->GetNode()->GetId(),
+                                               delay,
+                                               &MmWaveSpectrumPhy::StartRx,
+                                               receiver.phy,
+                                               txParams);
+            }
+        }
+        else
+        {
+            m_channel->StartTx(txParams);
+        }
 
         ChangeState(TX);
 
@@ -950,6 +1037,38 @@ MmWaveSpectrumPhy::StartTxDlControlFrames(std::list<Ptr<MmWaveControlMessage>> c
     return false;
 }
 
+void
+MmWaveSpectrumPhy::AddDlCtrlReceiver(Ptr<MmWaveSpectrumPhy> phy)
+{
+    NS_LOG_FUNCTION(this << phy);
+    RemoveDlCtrlReceiver(phy);
+    // a MultiModelSpectrumChannel groups its receivers by RX spectrum model,
+    // and appends a receiver to its group each time it is added
+    DlCtrlReceiver receiver{phy, phy->GetRxSpectrumModel()->GetUid(), g_dlCtrlReceiversAdded++};
+    auto channelOrder = [](const DlCtrlReceiver& a, const DlCtrlReceiver& b) {
+        return a.modelUid < b.modelUid ||
+               (a.modelUid == b.modelUid && a.addedIndex < b.addedIndex);
+    };
+    m_dlCtrlReceivers.insert(std::upper_bound(m_dlCtrlReceivers.begin(),
+                                              m_dlCtrlReceivers.end(),
+                                              receiver,
+                                              channelOrder),
+                             receiver);
+}
+
+void
+MmWaveSpectrumPhy::RemoveDlCtrlReceiver(Ptr<MmWaveSpectrumPhy> phy)
+{
+    NS_LOG_FUNCTION(this << phy);
+    auto it = std::find_if(m_dlCtrlReceivers.begin(),
+                           m_dlCtrlReceivers.end(),
+                           [phy](const DlCtrlReceiver& receiver) { return receiver.phy == phy; });
+    if (it != m_dlCtrlReceivers.end())
+    {
+        m_dlCtrlReceivers.erase(it);
+    }
+}
+
 void
 MmWaveSpectrumPhy::EndTx()
 {
@@ -1001,6 +1120,14 @@ MmWaveSpectrumPhy::SetHarqPhyModule(Ptr<MmWaveHarqPhy> harq)
     m_harqPhyModule = harq;
 }
 
+int64_t
+MmWaveSpectrumPhy::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    m_random->SetStream(stream);
+    return 1;
+}
+
 double
 MmWaveSpectrumPhy::Min(const SpectrumValue& specVal)
 {
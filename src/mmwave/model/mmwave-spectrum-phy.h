@@ -136,6 +136,13 @@ typedef std::unordered_map<uint16_t, TransportBlockInfo>
 typedef Callback<void, Ptr<Packet>> MmWavePhyRxDataEndOkCallback;
 typedef Callback<void, std::list<Ptr<MmWaveControlMessage>>> MmWavePhyRxCtrlEndOkCallback;
 
+/**
+ * This method is used by the MmWaveSpectrumPhy to forward to the PHY the
+ * bundle of control messages of a DL control frame, so that the PHY can
+ * extract the messages of interest without copying the whole list
+ */
+typedef Callback<void, Ptr<const MmWaveControlMessageBundle>> MmWavePhyRxCtrlBundleEndOkCallback;
+
 /**
  * This method is used by the LteSpectrumPhy to notify the PHY about
  * the status of a certain DL HARQ process
@@ -218,6 +225,18 @@ class MmWaveSpectrumPhy : public SpectrumPhy
     void SetNoisePowerSpectralDensity(Ptr<const SpectrumValue> noisePsd);
     void SetTxPowerSpectralDensity(Ptr<SpectrumValue> TxPsd);
     void StartRx(Ptr<SpectrumSignalParameters> params) override;
+
+    /**
+     * Tells whether StartRx could process a signal, either as a useful signal or as an
+     * interferer, so that the channel can discard the other signals before computing their
+     * propagation loss and scheduling their reception. Signals between devices of the same
+     * type and control frames of other cells are discarded. Data frames are always kept,
+     * since whether a UE is receiving is only known when the signal arrives.
+     *
+     * \param params the parameters of the signal
+     * \return false if StartRx would discard the signal
+     */
+    bool IsListening(Ptr<const SpectrumSignalParameters> params) const;
     void StartRxData(Ptr<MmwaveSpectrumSignalParametersDataFrame> params);
     void StartRxCtrl(Ptr<MmWaveSpectrumSignalParametersDlCtrlFrame> params);
     Ptr<SpectrumChannel> GetSpectrumChannel();
@@ -240,6 +259,13 @@ class MmWaveSpectrumPhy : public SpectrumPhy
 
     void SetPhyRxDataEndOkCallback(MmWavePhyRxDataEndOkCallback c);
     void SetPhyRxCtrlEndOkCallback(MmWavePhyRxCtrlEndOkCallback c);
+
+    /**
+     * Set the callback which receives the DL control frames as a bundle. When
+     * set, it replaces the MmWavePhyRxCtrlEndOkCallback for the DL control frames.
+     * \param c the callback
+     */
+    void SetPhyRxCtrlBundleEndOkCallback(MmWavePhyRxCtrlBundleEndOkCallback c);
     void SetPhyDlHarqFeedbackCallback(MmWavePhyDlHarqFeedbackCallback c);
     void SetPhyUlHarqFeedbackCallback(MmWavePhyUlHarqFeedbackCallback c);
 
@@ -275,6 +301,33 @@ class MmWaveSpectrumPhy : public SpectrumPhy
 
     void SetHarqPhyModule(Ptr<MmWaveHarqPhy> harq);
 
+    /**
+     * Assign a fixed random variable stream number to the random variables
+     * used by this model.  Return the number of streams (possibly zero) that
+     * have been assigned.
+     *
+     * \param stream first stream index to use
+     * \return the number of stream indices assigned by this model
+     */
+    int64_t AssignStreams(int64_t stream);
+
+    /**
+     * Add a receiver of the DL control frames transmitted by this phy, used when
+     * the frames are delivered directly, without going through the channel. It
+     * must be called right after the receiver is added to the channel. The
+     * receivers are sorted as in a MultiModelSpectrumChannel, by RX spectrum
+     * model and then in the order in which they were last added, so that the
+     * frames reach them in the same order as through the channel.
+     * \param phy the DL spectrum phy of a UE of the cell
+     */
+    void AddDlCtrlReceiver(Ptr<MmWaveSpectrumPhy> phy);
+
+    /**
+     * Remove a receiver of the DL control frames transmitted by this phy
+     * \param phy the DL spectrum phy of a UE which leaves the cell
+     */
+    void RemoveDlCtrlReceiver(Ptr<MmWaveSpectrumPhy> phy);
+
   private:
     /**
      * \brief change the state
@@ -300,6 +353,8 @@ class MmWaveSpectrumPhy : public SpectrumPhy
     // Ptr<PacketBurst> m_txPacketBurst;
     std::list<Ptr<PacketBurst>> m_rxPacketBurstList;
     std::list<Ptr<MmWaveControlMessage>> m_rxControlMessageList;
+    Ptr<const MmWaveControlMessageBundle>
+        m_rxControlMessageBundle; //!< the DL control frame being received, if forwarded as bundle
 
     Time m_firstRxStart;
     Time m_firstRxDuration;
@@ -313,6 +368,7 @@ class MmWaveSpectrumPhy : public SpectrumPhy
     uint8_t m_componentCarrierId; ///< the component carrier ID
 
     MmWavePhyRxCtrlEndOkCallback m_phyRxCtrlEndOkCallback;
+    MmWavePhyRxCtrlBundleEndOkCallback m_phyRxCtrlBundleEndOkCallback;
     MmWavePhyRxDataEndOkCallback m_phyRxDataEndOkCallback;
 
     MmWavePhyDlHarqFeedbackCallback m_phyDlHarqFeedbackCallback;
@@ -332,11 +388,27 @@ class MmWaveSpectrumPhy : public SpectrumPhy
                                   // frame
     TypeId m_errorModelType{
         Object::GetTypeId()}; //!< Error model type by default is MmWaveLteMiErrorModel
+    Ptr<MmWaveErrorModel> m_errorModel; //!< Error model instance, created on the first decode
 
     Ptr<MmWaveHarqPhy> m_harqPhyModule;
 
     bool m_isEnb;
 
+    /**
+     * A receiver of the DL control frames delivered directly, with the keys of
+     * its position among the receivers of the channel
+     */
+    struct DlCtrlReceiver
+    {
+        Ptr<MmWaveSpectrumPhy> phy;  //!< the DL spectrum phy of the UE
+        SpectrumModelUid_t modelUid; //!< the UID of the RX spectrum model of the phy
+        uint64_t addedIndex;         //!< the number of receivers added before the phy
+    };
+
+    bool m_directDlCtrlDelivery; //!< when true the DL control frames skip the channel
+    std::vector<DlCtrlReceiver>
+        m_dlCtrlReceivers; //!< the receivers of the DL control frames, in the channel order
+
     EventId m_endTxEvent;
     EventId m_endRxDataEvent;
     EventId m_endRxDlCtrlEvent;
@@ -101,7 +101,7 @@ MmWaveSpectrumSignalParametersDlCtrlFrame::MmWaveSpectrumSignalParametersDlCtrlF
     NS_LOG_FUNCTION(this << &p);
     cellId = p.cellId;
     pss = p.pss;
-    ctrlMsgList = p.ctrlMsgList;
+    ctrlMsgBundle = p.ctrlMsgBundle;
 }
 
 Ptr<SpectrumSignalParameters>
@@ -40,6 +40,7 @@ namespace mmwave
 {
 
 class MmWaveControlMessage;
+class MmWaveControlMessageBundle;
 
 /**
  * \ingroup mmwave
@@ -103,7 +104,7 @@ struct MmWaveSpectrumSignalParametersDlCtrlFrame : public SpectrumSignalParamete
      */
     MmWaveSpectrumSignalParametersDlCtrlFrame(const MmWaveSpectrumSignalParametersDlCtrlFrame& p);
 
-    std::list<Ptr<MmWaveControlMessage>> ctrlMsgList;
+    Ptr<const MmWaveControlMessageBundle> ctrlMsgBundle; //!< shared by all the receivers
 
     bool pss;
     uint16_t cellId;
@@ -0,0 +1,71 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "mmwave-spectrum-transmit-filter.h"
+
+#include "mmwave-spectrum-phy.h"
+
+#include <ns3/log.h>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("MmWaveSpectrumTransmitFilter");
+
+namespace mmwave
+{
+
+NS_OBJECT_ENSURE_REGISTERED(MmWaveSpectrumTransmitFilter);
+
+MmWaveSpectrumTransmitFilter::MmWaveSpectrumTransmitFilter()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+TypeId
+MmWaveSpectrumTransmitFilter::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::MmWaveSpectrumTransmitFilter")
+                            .SetParent<SpectrumTransmitFilter>()
+                            .SetGroupName("MmWave")
+                            .AddConstructor<MmWaveSpectrumTransmitFilter>();
+    return tid;
+}
+
+bool
+MmWaveSpectrumTransmitFilter::DoFilter(Ptr<const SpectrumSignalParameters> params,
+                                       Ptr<const SpectrumPhy> receiverPhy)
+{
+    NS_LOG_FUNCTION(this << params);
+
+    Ptr<const MmWaveSpectrumPhy> mmwavePhy = DynamicCast<const MmWaveSpectrumPhy>(receiverPhy);
+    if (!mmwavePhy)
+    {
+        NS_LOG_DEBUG("Sending a signal to a non mmWave device: do not filter");
+        return false;
+    }
+    return !mmwavePhy->IsListening(params);
+}
+
+int64_t
+MmWaveSpectrumTransmitFilter::DoAssignStreams(int64_t stream)
+{
+    return 0;
+}
+
+} // namespace mmwave
+
+} // namespace ns3
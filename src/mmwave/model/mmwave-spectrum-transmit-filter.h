@@ -0,0 +1,62 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MMWAVE_SPECTRUM_TRANSMIT_FILTER_H
+#define MMWAVE_SPECTRUM_TRANSMIT_FILTER_H
+
+#include <ns3/spectrum-transmit-filter.h>
+
+namespace ns3
+{
+
+namespace mmwave
+{
+
+/**
+ * Transmit filter which discards, before the propagation loss is computed and
+ * the reception is scheduled, the signals that a MmWaveSpectrumPhy would
+ * neglect in StartRx, as told by MmWaveSpectrumPhy::IsListening.
+ */
+class MmWaveSpectrumTransmitFilter : public SpectrumTransmitFilter
+{
+  public:
+    MmWaveSpectrumTransmitFilter();
+
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    /**
+     * \brief Ignore the signal if the receiver is a MmWaveSpectrumPhy which is not listening to it
+     *
+     * \param params the parameters of the signal being received
+     * \param receiverPhy the SpectrumPhy of the receiver
+     * \return whether the signal being received should be ignored
+     */
+    bool DoFilter(Ptr<const SpectrumSignalParameters> params,
+                  Ptr<const SpectrumPhy> receiverPhy) override;
+
+  protected:
+    int64_t DoAssignStreams(int64_t stream) override;
+};
+
+} // namespace mmwave
+
+} // namespace ns3
+
+#endif /* MMWAVE_SPECTRUM_TRANSMIT_FILTER_H */
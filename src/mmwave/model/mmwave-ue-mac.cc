@@ -173,6 +173,8 @@ class MacUeMemberPhySapUser : public MmWaveUePhySapUser
 
     virtual void SetConfigurationParameters(Ptr<MmWavePhyMacCommon> params);
 
+    virtual bool IsIdle();
+
     // virtual void NotifyHarqDeliveryFailure (uint8_t harqId);
 
   private:
@@ -208,6 +210,12 @@ MacUeMemberPhySapUser::SetConfigurationParameters(Ptr<MmWavePhyMacCommon> params
     m_mac->SetConfigurationParameters(params);
 }
 
+bool
+MacUeMemberPhySapUser::IsIdle()
+{
+    return m_mac->DoIsIdle();
+}
+
 // void
 // MacUeMemberPhySapUser::NotifyHarqDeliveryFailure (uint8_t harqId)
 //{
@@ -404,6 +412,12 @@ MmWaveUeMac::DoReportBufferStatus(LteMacSapProvider::ReportBufferStatusParameter
             std::pair<uint8_t, LteMacSapProvider::ReportBufferStatusParameters>(params.lcid,
                                                                                 params));
     }
+    if (!m_freshUlBsr)
+    {
+        // wake the PHY before flagging the report, so that it brings the slot counters of the
+        // MAC up to date while the MAC is still idle
+        m_phySapProvider->ResumeSlotIndications();
+    }
     m_freshUlBsr = true;
 }
 
@@ -528,6 +542,12 @@ MmWaveUeMac::DoSlotIndication(SfnSf sfn)
     }
 }
 
+bool
+MmWaveUeMac::DoIsIdle() const
+{
+    return !m_freshUlBsr;
+}
+
 void
 MmWaveUeMac::DoReceivePhyPdu(Ptr<Packet> p)
 {
@@ -76,6 +76,11 @@ class MmWaveUeMac : public Object
      */
     void DoSlotIndication(SfnSf sfn);
 
+    /**
+     * \returns true if there is no buffer status report to send
+     */
+    bool DoIsIdle() const;
+
     MmWaveUePhySapUser* GetPhySapUser();
     void SetPhySapProvider(MmWavePhySapProvider* ptr);
 
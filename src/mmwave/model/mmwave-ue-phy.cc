@@ -35,9 +35,12 @@
 #include "mmwave-ue-phy.h"
 
 #include "mc-ue-net-device.h"
+#include "mmwave-component-carrier-enb.h"
+#include "mmwave-enb-phy.h"
 #include "mmwave-spectrum-value-helper.h"
 #include "mmwave-ue-net-device.h"
 
+#include <ns3/boolean.h>
 #include <ns3/double.h>
 #include <ns3/log.h>
 #include <ns3/node.h>
@@ -67,7 +70,8 @@ MmWaveUePhy::MmWaveUePhy()
 MmWaveUePhy::MmWaveUePhy(Ptr<MmWaveSpectrumPhy> dlPhy, Ptr<MmWaveSpectrumPhy> ulPhy)
     : MmWavePhy(dlPhy, ulPhy),
       m_prevSlot(0),
-      m_rnti(0)
+      m_rnti(0),
+      m_sleeping(false)
 {
     NS_LOG_FUNCTION(this);
     m_wbCqiLast = Simulator::Now();
@@ -147,7 +151,23 @@ MmWaveUePhy::GetTypeId(void)
                           "The period of the DL wideband CQI update, in number of slots",
                           UintegerValue(10),
                           MakeUintegerAccessor(&MmWaveUePhy::SetWbCqiPeriod),
-                          MakeUintegerChecker<uint16_t>());
+                          MakeUintegerChecker<uint16_t>())
+            .AddAttribute("SkipIdleSlots",
+                          "If true, the PHY stops the slot and TTI events after the DL control "
+                          "of a slot in which the UE has nothing to receive or to send, and "
+                          "resumes them at the next DCI for the UE, control message or buffer "
+                          "status report. The slot timing is kept virtually, and the receptions "
+                          "are the same, with these exceptions: the empty UL control frames of "
+                          "the skipped slots are not sent, so the ReportUlPhyTransmission trace "
+                          "does not report them, and the channels generated on demand when a "
+                          "frame is first propagated may be drawn in another order (the control "
+                          "frames add no interference); and an event at the boundary of a "
+                          "skipped slot runs as if before the slot indication, which is not "
+                          "guaranteed otherwise, so e.g. a buffer status report may be sent one "
+                          "slot earlier.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&MmWaveUePhy::m_skipIdleSlots),
+                          MakeBooleanChecker());
 
     return tid;
 }
@@ -156,6 +176,7 @@ void
 MmWaveUePhy::DoInitialize(void)
 {
     NS_LOG_FUNCTION(this);
+    m_numerology = MmWaveNumerology(m_phyMacConfig);
 
     for (uint32_t i = 0; i < m_phyMacConfig->GetSlotsPerSubframe(); i++)
     {
@@ -178,6 +199,7 @@ void
 MmWaveUePhy::DoDispose(void)
 {
     m_registeredEnb.clear();
+    m_servingEnbDlSpectrumPhy = nullptr;
 }
 
 void
@@ -337,14 +359,24 @@ MmWaveUePhy::DoSendControlMessage(Ptr<MmWaveControlMessage> msg)
     SetControlMessage(msg);
 }
 
+void
+MmWaveUePhy::SetControlMessage(Ptr<MmWaveControlMessage> m)
+{
+    NS_LOG_FUNCTION(this << m);
+    ResumeSlotIndications();
+    MmWavePhy::SetControlMessage(m);
+}
+
 void
 MmWaveUePhy::RegisterToEnb(uint16_t cellId, Ptr<MmWavePhyMacCommon> config)
 {
     NS_LOG_FUNCTION(this);
+    ResumeSlotIndications();
     m_cellId = cellId;
     m_phyReset = false;
     // TBD how to assign bandwitdh and earfcn
     m_phyMacConfig = config;
+    m_numerology = MmWaveNumerology(config);
     m_phySapUser->SetConfigurationParameters(config);
 
     Ptr<MmWaveEnbNetDevice> enbNetDevice = m_registeredEnb.find(cellId)->second.second;
@@ -374,6 +406,25 @@ MmWaveUePhy::RegisterToEnb(uint16_t cellId, Ptr<MmWavePhyMacCommon> config)
     m_downlinkSpectrumPhy->SetNoisePowerSpectralDensity(noisePsd);
     m_downlinkSpectrumPhy->GetSpectrumChannel()->AddRx(m_downlinkSpectrumPhy);
     m_downlinkSpectrumPhy->SetCellId(m_cellId);
+
+    // receive the DL control frames of the eNB carrier sharing the channel,
+    // if they are delivered directly
+    if (m_servingEnbDlSpectrumPhy)
+    {
+        m_servingEnbDlSpectrumPhy->RemoveDlCtrlReceiver(m_downlinkSpectrumPhy);
+        m_servingEnbDlSpectrumPhy = nullptr;
+    }
+    for (const auto& cc : enbNetDevice->GetCcMap())
+    {
+        Ptr<MmWaveSpectrumPhy> enbDlPhy =
+            DynamicCast<MmWaveComponentCarrierEnb>(cc.second)->GetPhy()->GetDlSpectrumPhy();
+        if (enbDlPhy->GetSpectrumChannel() == m_downlinkSpectrumPhy->GetSpectrumChannel())
+        {
+            enbDlPhy->AddDlCtrlReceiver(m_downlinkSpectrumPhy);
+            m_servingEnbDlSpectrumPhy = enbDlPhy;
+            break;
+        }
+    }
     NS_LOG_INFO("Registered to eNB with CellId " << m_cellId);
 }
 
@@ -401,11 +452,48 @@ MmWaveUePhy::GetUlSpectrumPhy() const
     return m_uplinkSpectrumPhy;
 }
 
+void
+MmWaveUePhy::ReceiveControlMessageBundle(Ptr<const MmWaveControlMessageBundle> bundle)
+{
+    NS_LOG_FUNCTION(this);
+    ReceiveControlMessageList(bundle->GetMessages(m_rnti));
+}
+
 void
 MmWaveUePhy::ReceiveControlMessageList(std::list<Ptr<MmWaveControlMessage>> msgList)
 {
     NS_LOG_FUNCTION(this);
 
+    if (m_sleeping)
+    {
+        // resume the slot indications only if the UE is scheduled in this slot
+        bool scheduled = false;
+        for (const auto& msg : msgList)
+        {
+            if (msg->GetMessageType() == MmWaveControlMessage::DCI_TDMA)
+            {
+                Ptr<MmWaveTdmaDciMessage> dciMsg = DynamicCast<MmWaveTdmaDciMessage>(msg);
+                scheduled = scheduled || dciMsg->GetDciInfoElement().m_rnti == m_rnti;
+            }
+            else if (msg->GetMessageType() == MmWaveControlMessage::RAR)
+            {
+                Ptr<MmWaveRarMessage> rarMsg = DynamicCast<MmWaveRarMessage>(msg);
+                for (auto it = rarMsg->RarListBegin(); it != rarMsg->RarListEnd(); ++it)
+                {
+                    scheduled = scheduled || it->rapId == m_raPreambleId;
+                }
+            }
+        }
+        if (scheduled)
+        {
+            ResumeSlotIndications();
+        }
+        else
+        {
+            CatchUpSlots();
+        }
+    }
+
     std::list<Ptr<MmWaveControlMessage>>::iterator it;
     for (it = msgList.begin(); it != msgList.end(); it++)
     {
@@ -471,14 +559,14 @@ MmWaveUePhy::ReceiveControlMessageList(std::list<Ptr<MmWaveControlMessage>> msgL
             else if (dciInfoElem.m_format ==
                      DciInfoElementTdma::UL_dci) // set UL slot schedule for t+ulSchedDelay slot
             {
-                uint8_t ulSlotIdx = (m_slotNum + m_phyMacConfig->GetUlSchedDelay()) %
-                                    m_phyMacConfig->GetSlotsPerSubframe();
-                uint8_t dciSubframe = m_sfNum + (((m_slotNum + m_phyMacConfig->GetUlSchedDelay()) /
-                                                  m_phyMacConfig->GetSlotsPerSubframe()) %
-                                                 m_phyMacConfig->GetSubframesPerFrame());
-                uint32_t dciFrame = m_frameNum + (((m_slotNum + m_phyMacConfig->GetUlSchedDelay()) /
-                                                   m_phyMacConfig->GetSlotsPerSubframe()) /
-                                                  m_phyMacConfig->GetSubframesPerFrame());
+                uint8_t ulSlotIdx = (m_slotNum + m_numerology.GetUlSchedDelay()) %
+                                    m_numerology.GetSlotsPerSubframe();
+                uint8_t dciSubframe = m_sfNum + (((m_slotNum + m_numerology.GetUlSchedDelay()) /
+                                                  m_numerology.GetSlotsPerSubframe()) %
+                                                 m_numerology.GetSubframesPerFrame());
+                uint32_t dciFrame = m_frameNum + (((m_slotNum + m_numerology.GetUlSchedDelay()) /
+                                                   m_numerology.GetSlotsPerSubframe()) /
+                                                  m_numerology.GetSubframesPerFrame());
 
                 NS_LOG_DEBUG(
                     "UE" << m_rnti << " UL-DCI received for frame " << dciFrame << " subframe "
@@ -540,8 +628,8 @@ MmWaveUePhy::ReceiveControlMessageList(std::list<Ptr<MmWaveControlMessage>> msgL
 void
 MmWaveUePhy::InitializeSlotAllocation(uint32_t frameNum, uint8_t sfNum, uint8_t slotNum)
 {
-    uint8_t nextSf = (sfNum + 1) % m_phyMacConfig->GetSubframesPerFrame();
-    uint32_t nextFrame = frameNum + (sfNum + 1) / m_phyMacConfig->GetSubframesPerFrame();
+    uint8_t nextSf = (sfNum + 1) % m_numerology.GetSubframesPerFrame();
+    uint32_t nextFrame = frameNum + (sfNum + 1) / m_numerology.GetSubframesPerFrame();
 
     NS_ASSERT((nextSf > sfNum && frameNum == nextFrame) || (nextFrame > frameNum && nextSf == 0));
 
@@ -557,6 +645,11 @@ MmWaveUePhy::SlotIndication(uint32_t frameNum, uint8_t sfNum, uint8_t slotNum)
                              << (uint16_t)slotNum << " current frame " << m_frameNum
                              << " current subframe " << (uint16_t)m_sfNum << " current slot "
                              << (uint16_t)m_slotNum);
+    if (frameNum == 0 && sfNum == 0 && slotNum == 0 && !IsOnLocalNode())
+    {
+        // another rank of the distributed simulation runs this UE
+        return;
+    }
     m_frameNum = frameNum;
     m_sfNum = sfNum;
     m_slotNum = slotNum;
@@ -573,6 +666,114 @@ MmWaveUePhy::SlotIndication(uint32_t frameNum, uint8_t sfNum, uint8_t slotNum)
     StartTti();
 }
 
+bool
+MmWaveUePhy::IsIdle()
+{
+    if (m_cellId == 0 || m_rnti == 0 || m_phyReset || !m_phySapUser->IsIdle())
+    {
+        return false;
+    }
+    // only the DL and UL control TTIs, in this slot and in the next ones
+    if (m_currSlotAllocInfo.m_ttiAllocInfo.size() != 2)
+    {
+        return false;
+    }
+    for (const auto& slotAllocInfo : m_slotAllocInfo)
+    {
+        if (slotAllocInfo.m_ttiAllocInfo.size() != 2)
+        {
+            return false;
+        }
+    }
+    for (const auto& ctrlMsgs : m_controlMessageQueue)
+    {
+        if (!ctrlMsgs.empty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+MmWaveUePhy::CatchUpSlots()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(m_sleeping);
+    Time now = Simulator::Now();
+    // a slot boundary belongs to the slot which ends there: an event at the boundary runs
+    // before the slot indication, as do the events scheduled before the end of that slot
+    int64_t skipped = (now - m_lastSlotStart - TimeStep(1)).GetTimeStep() /
+                      m_slotPeriod.GetTimeStep();
+    if (skipped > 0)
+    {
+        uint32_t slotsPerSubframe = m_numerology.GetSlotsPerSubframe();
+        uint32_t subframesPerFrame = m_numerology.GetSubframesPerFrame();
+        uint64_t slot = m_slotNum + skipped;
+        uint64_t subframe = m_sfNum + slot / slotsPerSubframe;
+        m_slotNum = slot % slotsPerSubframe;
+        m_sfNum = subframe % subframesPerFrame;
+        m_frameNum += subframe / subframesPerFrame;
+        m_lastSlotStart += m_slotPeriod * skipped;
+
+        // all the skipped slots were idle: the slots of this subframe not started yet are
+        // the ones initialized in the previous subframe, the others are initialized for the
+        // next subframe
+        for (uint32_t i = 0; i < slotsPerSubframe; i++)
+        {
+            m_slotAllocInfo[i] = SlotAllocInfo(SfnSf(m_frameNum, m_sfNum, i));
+            MmWavePhy::SetSlotCtrlStructure(i);
+        }
+        m_currSlotAllocInfo = m_slotAllocInfo[m_slotNum];
+        for (uint32_t i = 0; i <= m_slotNum; i++)
+        {
+            InitializeSlotAllocation(m_frameNum, m_sfNum, i);
+        }
+    }
+
+    // the MAC has seen the last TTI started so far, i.e., the DL or the UL control
+    uint8_t ulCtrlSymStart = m_currSlotAllocInfo.m_ttiAllocInfo.back().m_dci.m_symStart;
+    Time ulCtrlStart = m_lastSlotStart + m_numerology.GetSymbolsDuration(ulCtrlSymStart);
+    m_currTti = now > ulCtrlStart ? m_currSlotAllocInfo.m_ttiAllocInfo.back()
+                                  : m_currSlotAllocInfo.m_ttiAllocInfo.front();
+    m_prevTtiDir = m_currTti.m_tddMode;
+    m_phySapUser->SlotIndication(SfnSf(m_frameNum, m_sfNum, m_slotNum, m_currTti.m_dci.m_symStart));
+}
+
+void
+MmWaveUePhy::ResumeSlotIndications()
+{
+    if (!m_sleeping)
+    {
+        return;
+    }
+    NS_LOG_FUNCTION(this);
+    CatchUpSlots();
+    m_sleeping = false;
+
+    Time now = Simulator::Now();
+    Time dlCtrlEnd =
+        m_lastSlotStart + m_numerology.GetSymbolsDuration(m_numerology.GetDlCtrlSymbols());
+    uint8_t ulCtrlSymStart = m_currSlotAllocInfo.m_ttiAllocInfo.back().m_dci.m_symStart;
+    Time ulCtrlStart = m_lastSlotStart + m_numerology.GetSymbolsDuration(ulCtrlSymStart);
+    if (now < dlCtrlEnd)
+    {
+        m_ttiIndex = 0;
+        Simulator::Schedule(dlCtrlEnd - now, &MmWaveUePhy::EndTti, this);
+    }
+    else if (now <= ulCtrlStart)
+    {
+        m_ttiIndex = m_currSlotAllocInfo.m_ttiAllocInfo.size() - 1;
+        Simulator::Schedule(ulCtrlStart - now, &MmWaveUePhy::StartTti, this);
+    }
+    else
+    {
+        // the UL control TTI is over as well: schedule the next slot
+        m_ttiIndex = m_currSlotAllocInfo.m_ttiAllocInfo.size() - 1;
+        EndTti();
+    }
+}
+
 void
 MmWaveUePhy::StartTti()
 {
@@ -599,7 +800,7 @@ MmWaveUePhy::StartTti()
 
     if (m_ttiIndex == 0) // First TTI: reserved DL control
     {
-        currTtiDuration = m_phyMacConfig->GetDlCtrlSymbols() * m_phyMacConfig->GetSymbolPeriod();
+        currTtiDuration = m_numerology.GetSymbolsDuration(m_numerology.GetDlCtrlSymbols());
         NS_LOG_DEBUG("UE" << m_rnti << " imsi" << m_imsi << " RXing DL CTRL frame " << m_frameNum
                           << " subframe " << (unsigned)m_sfNum << " symbols "
                           << (unsigned)currTti.m_dci.m_symStart << "-"
@@ -611,7 +812,7 @@ MmWaveUePhy::StartTti()
                                1) // Last TTI of this slot: reserved UL control
     {
         SetSubChannelsForTransmission(m_channelChunks);
-        currTtiDuration = m_phyMacConfig->GetUlCtrlSymbols() * m_phyMacConfig->GetSymbolPeriod();
+        currTtiDuration = m_numerology.GetSymbolsDuration(m_numerology.GetUlCtrlSymbols());
         std::list<Ptr<MmWaveControlMessage>> ctrlMsg = GetControlMessages();
         NS_LOG_DEBUG("UE" << m_rnti << " imsi" << m_imsi << " TXing UL CTRL frame " << m_frameNum
                           << " subframe " << (unsigned)m_sfNum << " symbols "
@@ -628,7 +829,7 @@ MmWaveUePhy::StartTti()
     else if (currTti.m_dci.m_format == DciInfoElementTdma::DL_dci) // Scheduled DL data Tti
     {
         m_receptionEnabled = true;
-        currTtiDuration = currTti.m_dci.m_numSym * m_phyMacConfig->GetSymbolPeriod();
+        currTtiDuration = m_numerology.GetSymbolsDuration(currTti.m_dci.m_numSym);
         m_downlinkSpectrumPhy->AddExpectedTb(currTti.m_dci.m_rnti,
                                              currTti.m_dci.m_ndi,
                                              currTti.m_dci.m_tbSize,
@@ -650,7 +851,7 @@ MmWaveUePhy::StartTti()
     else if (currTti.m_dci.m_format == DciInfoElementTdma::UL_dci) // Scheduled UL data Tti
     {
         SetSubChannelsForTransmission(m_channelChunks);
-        currTtiDuration = currTti.m_dci.m_numSym * m_phyMacConfig->GetSymbolPeriod();
+        currTtiDuration = m_numerology.GetSymbolsDuration(currTti.m_dci.m_numSym);
         Ptr<PacketBurst> pktBurst =
             GetPacketBurst(SfnSf(m_frameNum, m_sfNum, m_slotNum, currTti.m_dci.m_symStart));
         if (pktBurst && pktBurst->GetNPackets() > 0)
@@ -720,9 +921,9 @@ MmWaveUePhy::EndTti()
         uint32_t frameNum = m_frameNum;
         uint8_t sfNum = m_sfNum;
         uint8_t slotNum{0};
-        if (m_slotNum == m_phyMacConfig->GetSlotsPerSubframe() - 1) // End of this subframe
+        if (m_slotNum == m_numerology.GetSlotsPerSubframe() - 1) // End of this subframe
         {
-            if (m_sfNum == m_phyMacConfig->GetSubframesPerFrame() - 1) // End of the frame as well
+            if (m_sfNum == m_numerology.GetSubframesPerFrame() - 1) // End of the frame as well
             {
                 sfNum = 0;
                 frameNum = m_frameNum + 1;
@@ -746,14 +947,21 @@ MmWaveUePhy::EndTti()
                             sfNum,
                             slotNum);
     }
+    else if (m_ttiIndex == 0 && m_skipIdleSlots && IsIdle())
+    {
+        // nothing to receive or to send until a DCI, a control message or a BSR: stop here
+        // and keep the slot timing virtually, see ResumeSlotIndications
+        NS_LOG_LOGIC("UE " << m_rnti << " skips the idle slots");
+        m_sleeping = true;
+    }
     else
     {
         m_ttiIndex++;
-        Time nexTtiStart = m_phyMacConfig->GetSymbolPeriod() * // Find out when the next TTI starts
-                           m_currSlotAllocInfo.m_ttiAllocInfo[m_ttiIndex].m_dci.m_symStart;
+        Time nexTtiStart = m_numerology.GetSymbolsDuration( // Find out when the next TTI starts
+            m_currSlotAllocInfo.m_ttiAllocInfo[m_ttiIndex].m_dci.m_symStart);
 
         NS_LOG_INFO("Symbol period: "
-                    << m_phyMacConfig->GetSymbolPeriod() << " next TTI at symbol #: "
+                    << m_numerology.GetSymbolPeriod() << " next TTI at symbol #: "
                     << (uint16_t)m_currSlotAllocInfo.m_ttiAllocInfo[m_ttiIndex].m_dci.m_symStart);
         NS_LOG_INFO("nextTtiStart " << nexTtiStart << " m_lastSlotStart " << m_lastSlotStart
                                     << " now " << Simulator::Now());
@@ -775,7 +983,7 @@ MmWaveUePhy::PhyDataPacketReceived(Ptr<Packet> p)
 {
     if (!m_phyReset)
     {
-        Simulator::Schedule(MicroSeconds(m_phyMacConfig->GetTbDecodeLatency()),
+        Simulator::Schedule(m_numerology.GetTbDecodeLatency(),
                             &MmWaveUePhy::DelayPhyDataPacketReceived,
                             this,
                             p);
@@ -888,7 +1096,7 @@ MmWaveUePhy::GenerateDlCqiReport(const SpectrumValue& sinr)
 {
     if (m_ulConfigured && (m_rnti > 0) && m_receptionEnabled)
     {
-        if (Simulator::Now() > m_wbCqiLast + m_wbCqiPeriod * m_phyMacConfig->GetSlotPeriod())
+        if (Simulator::Now() > m_wbCqiLast + m_wbCqiPeriod * m_numerology.GetSlotPeriod())
         {
             SpectrumValue newSinr = sinr;
             Ptr<MmWaveDlCqiMessage> msg = CreateDlCqiFeedbackMessage(newSinr);
@@ -910,7 +1118,7 @@ MmWaveUePhy::ReceiveLteDlHarqFeedback(DlHarqInfo m)
     Ptr<MmWaveDlHarqFeedbackMessage> msg = Create<MmWaveDlHarqFeedbackMessage>();
     msg->SetDlHarqFeedback(m);
     m_sendDlHarqFeedbackEvent =
-        Simulator::Schedule(MicroSeconds(m_phyMacConfig->GetTbDecodeLatency()),
+        Simulator::Schedule(m_numerology.GetTbDecodeLatency(),
                             &MmWaveUePhy::DoSendControlMessage,
                             this,
                             msg);
@@ -942,6 +1150,7 @@ void
 MmWaveUePhy::DoReset()
 {
     NS_LOG_FUNCTION(this);
+    ResumeSlotIndications();
     m_rnti = 0;
     m_cellId = 0;
     m_raPreambleId = 255; // value out of range
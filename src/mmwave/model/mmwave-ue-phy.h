@@ -104,6 +104,20 @@ class MmWaveUePhy : public MmWavePhy
 
     void DoSendControlMessage(Ptr<MmWaveControlMessage> msg);
 
+    /**
+     * Queues a control message for the next UL control TTIs, and resumes the slot
+     * indications if the PHY stopped them.
+     *
+     * \param m the control message
+     */
+    void SetControlMessage(Ptr<MmWaveControlMessage> m) override;
+
+    /**
+     * Resumes the slot, TTI and MAC indications stopped by an idle slot, see the SkipIdleSlots
+     * attribute. The slot counters are first brought up to date with the slots skipped.
+     */
+    void ResumeSlotIndications() override;
+
     void RegisterToEnb(uint16_t cellId, Ptr<MmWavePhyMacCommon> config);
     void RegisterOtherEnb(uint16_t cellId,
                           Ptr<MmWavePhyMacCommon> config,
@@ -113,6 +127,13 @@ class MmWaveUePhy : public MmWavePhy
 
     void ReceiveControlMessageList(std::list<Ptr<MmWaveControlMessage>> msgList);
 
+    /**
+     * Receive the bundle of control messages of a DL control frame, and process
+     * only the DCIs of this UE and the messages which are not DCIs
+     * \param bundle the control messages of the frame
+     */
+    void ReceiveControlMessageBundle(Ptr<const MmWaveControlMessageBundle> bundle);
+
     /**
      * Marks the beginning of a new NR slot.
      *
@@ -218,6 +239,19 @@ class MmWaveUePhy : public MmWavePhy
 
     void ReceiveDataPeriod(uint32_t slotNum);
 
+    /**
+     * \returns true if the current slot and the next ones have nothing to receive or to send
+     * so far, i.e., if the PHY can stop the slot indications until a DCI, a control message or
+     * a buffer status report
+     */
+    bool IsIdle();
+
+    /**
+     * Brings the slot counters and the slot allocation info up to date with the idle slots
+     * skipped since the PHY stopped the slot indications, as if it had run them.
+     */
+    void CatchUpSlots();
+
     MmWaveUePhySapUser* m_phySapUser;
 
     LteUeCphySapProvider* m_ueCphySapProvider;
@@ -264,6 +298,11 @@ class MmWaveUePhy : public MmWavePhy
     TtiAllocInfo m_currTti; //!< Holds the allocation info for the current Tti.
 
     std::map<uint16_t, std::pair<Ptr<MmWavePhyMacCommon>, Ptr<MmWaveEnbNetDevice>>> m_registeredEnb;
+    Ptr<MmWaveSpectrumPhy>
+        m_servingEnbDlSpectrumPhy; //!< the DL spectrum phy of the serving eNB, on this channel
+
+    bool m_skipIdleSlots; //!< True if the PHY stops the slot indications in idle slots
+    bool m_sleeping; //!< True if the slot indications are stopped, see ResumeSlotIndications
 
     EventId m_sendDataChannelEvent;
     EventId m_sendDlHarqFeedbackEvent;
@@ -0,0 +1,232 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/mmwave-amc.h"
+#include "ns3/mmwave-eesm-cc-t1.h"
+#include "ns3/mmwave-eesm-cc-t2.h"
+#include "ns3/mmwave-eesm-ir-t1.h"
+#include "ns3/mmwave-eesm-ir-t2.h"
+#include "ns3/mmwave-lte-mi-error-model.h"
+#include "ns3/object-factory.h"
+#include "ns3/test.h"
+#include "ns3/type-id.h"
+
+#include <cmath>
+
+using namespace ns3;
+using namespace mmwave;
+
+/**
+ * This test case checks the TB sizes, numbers of OFDM symbols, MCSs and CQIs
+ * looked up in the tables of the MmWaveAmc against the ones computed with the
+ * error model, as the MmWaveAmc did before filling the tables.
+ */
+class MmWaveAmcTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param errorModelType the type of the error model
+     * \param ulMode whether the MmWaveAmc is in UL mode
+     */
+    MmWaveAmcTestCase(TypeId errorModelType, bool ulMode);
+
+    /**
+     * Destructor
+     */
+    virtual ~MmWaveAmcTestCase();
+
+  private:
+    /**
+     * Run the test
+     */
+    virtual void DoRun(void);
+
+    /**
+     * Compute the TB size with the error model
+     *
+     * \param mcs the MCS
+     * \param nSym the number of OFDM symbols
+     * \return the TB size in bytes
+     */
+    uint32_t ExpectedTbSize(uint8_t mcs, uint8_t nSym) const;
+
+    TypeId m_errorModelType;            //!< the type of the error model
+    bool m_ulMode;                      //!< whether the MmWaveAmc is in UL mode
+    Ptr<MmWaveErrorModel> m_errorModel; //!< the error model used for the expected values
+    Ptr<MmWavePhyMacCommon> m_config;   //!< the configuration of the MmWaveAmc
+};
+
+MmWaveAmcTestCase::MmWaveAmcTestCase(TypeId errorModelType, bool ulMode)
+    : TestCase("Checks the tables of the MmWaveAmc with " + errorModelType.GetName() +
+               (ulMode ? " in UL" : " in DL")),
+      m_errorModelType(errorModelType),
+      m_ulMode(ulMode)
+{
+}
+
+MmWaveAmcTestCase::~MmWaveAmcTestCase()
+{
+}
+
+uint32_t
+MmWaveAmcTestCase::ExpectedTbSize(uint8_t mcs, uint8_t nSym) const
+{
+    const uint32_t crcLen = 24 / 8;
+    uint32_t payloadSize = m_errorModel->GetPayloadSize(
+        MmWavePhyMacCommon::SUBCARRIERS_PER_RB - MmWavePhyMacCommon::REF_SUBCARRIERS_PER_RB,
+        mcs,
+        nSym * m_config->GetNumRb(),
+        m_ulMode ? MmWaveErrorModel::UL : MmWaveErrorModel::DL);
+    uint32_t tbSize = payloadSize >= crcLen ? payloadSize - crcLen : payloadSize;
+    uint32_t cbSize = m_errorModel->GetMaxCbSize(payloadSize, mcs);
+    if (tbSize > cbSize)
+    {
+        tbSize = payloadSize - static_cast<uint32_t>(std::ceil(tbSize / cbSize) * crcLen);
+    }
+    return tbSize;
+}
+
+void
+MmWaveAmcTestCase::DoRun(void)
+{
+    ObjectFactory factory;
+    factory.SetTypeId(m_errorModelType);
+    m_errorModel = DynamicCast<MmWaveErrorModel>(factory.Create());
+    m_config = CreateObject<MmWavePhyMacCommon>();
+    Ptr<MmWaveAmc> amc = CreateObject<MmWaveAmc>(m_config);
+    amc->SetAttribute("ErrorModelType", TypeIdValue(m_errorModelType));
+    if (m_ulMode)
+    {
+        amc->SetUlMode();
+    }
+
+    uint8_t maxMcs = m_errorModel->GetMaxMcs();
+    uint8_t symPerSlot = m_config->GetSymbPerSlot();
+    NS_TEST_ASSERT_MSG_EQ(amc->GetMaxMcs(), maxMcs, "Wrong maximum MCS");
+    for (uint8_t mcs = 0; mcs <= maxMcs; mcs++)
+    {
+        // the TB sizes, also beyond the number of OFDM symbols in a slot
+        for (uint8_t nSym = 0; nSym <= symPerSlot + 2; nSym++)
+        {
+            NS_TEST_ASSERT_MSG_EQ(amc->CalculateTbSize(mcs, nSym),
+                                  ExpectedTbSize(mcs, nSym),
+                                  "Wrong TB size of MCS " << +mcs << " and " << +nSym
+                                                          << " OFDM symbols");
+        }
+
+        // the minimum number of OFDM symbols, for TB sizes around the ones of each number
+        for (uint8_t nSym = 1; nSym <= symPerSlot; nSym++)
+        {
+            uint32_t size = ExpectedTbSize(mcs, nSym);
+            for (uint32_t tbSize : {size - 1, size, size + 1})
+            {
+                uint32_t effTbSize = 0;
+                uint8_t expected = 0;
+                while (effTbSize < tbSize && expected < symPerSlot)
+                {
+                    expected++;
+                    effTbSize = ExpectedTbSize(mcs, expected);
+                }
+                if (effTbSize >= tbSize)
+                {
+                    NS_TEST_ASSERT_MSG_EQ(+amc->GetMinNumSymForTbSize(tbSize, mcs),
+                                          +expected,
+                                          "Wrong number of OFDM symbols for " << tbSize
+                                                                              << " bytes and MCS "
+                                                                              << +mcs);
+                }
+            }
+        }
+        NS_TEST_ASSERT_MSG_EQ(+amc->GetMinNumSymForTbSize(0, mcs),
+                              0,
+                              "Wrong number of OFDM symbols for an empty TB");
+    }
+
+    // the MCS of each CQI
+    for (uint8_t cqi = 0; cqi <= 15; cqi++)
+    {
+        uint8_t expected = 0;
+        while (expected < maxMcs && m_errorModel->GetSpectralEfficiencyForMcs(expected + 1) <=
+                                        m_errorModel->GetSpectralEfficiencyForCqi(cqi))
+        {
+            expected++;
+        }
+        NS_TEST_ASSERT_MSG_EQ(+amc->GetMcsFromCqi(cqi), +expected, "Wrong MCS of CQI " << +cqi);
+    }
+
+    // the CQI and MCS of spectral efficiencies between and equal to the ones of the tables
+    std::vector<double> efficiencies;
+    for (double s = 0; s < 8; s += 0.01)
+    {
+        efficiencies.push_back(s);
+    }
+    for (uint8_t mcs = 0; mcs <= maxMcs; mcs++)
+    {
+        efficiencies.push_back(m_errorModel->GetSpectralEfficiencyForMcs(mcs));
+    }
+    for (uint8_t cqi = 0; cqi <= 15; cqi++)
+    {
+        efficiencies.push_back(m_errorModel->GetSpectralEfficiencyForCqi(cqi));
+    }
+    for (double s : efficiencies)
+    {
+        uint8_t expectedCqi = 0;
+        while (expectedCqi < 15 && m_errorModel->GetSpectralEfficiencyForCqi(expectedCqi + 1) < s)
+        {
+            expectedCqi++;
+        }
+        NS_TEST_ASSERT_MSG_EQ(+amc->GetCqiFromSpectralEfficiency(s),
+                              +expectedCqi,
+                              "Wrong CQI of spectral efficiency " << s);
+        uint8_t expectedMcs = 0;
+        while (expectedMcs < maxMcs &&
+               m_errorModel->GetSpectralEfficiencyForMcs(expectedMcs + 1) < s)
+        {
+            expectedMcs++;
+        }
+        NS_TEST_ASSERT_MSG_EQ(+amc->GetMcsFromSpectralEfficiency(s),
+                              +expectedMcs,
+                              "Wrong MCS of spectral efficiency " << s);
+    }
+}
+
+/**
+ * Test suite of the MmWaveAmc
+ */
+class MmWaveAmcTestSuite : public TestSuite
+{
+  public:
+    MmWaveAmcTestSuite();
+};
+
+MmWaveAmcTestSuite::MmWaveAmcTestSuite()
+    : TestSuite("mmwave-amc-test", Type::UNIT)
+{
+    for (TypeId type : {MmWaveLteMiErrorModel::GetTypeId(),
+                        MmWaveEesmIrT1::GetTypeId(),
+                        MmWaveEesmIrT2::GetTypeId(),
+                        MmWaveEesmCcT1::GetTypeId(),
+                        MmWaveEesmCcT2::GetTypeId()})
+    {
+        AddTestCase(new MmWaveAmcTestCase(type, false), Duration::QUICK);
+        AddTestCase(new MmWaveAmcTestCase(type, true), Duration::QUICK);
+    }
+}
+
+static MmWaveAmcTestSuite mmwaveAmcTestSuite; //!< the test suite
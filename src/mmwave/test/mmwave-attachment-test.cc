@@ -15,11 +15,15 @@
  *
  */
 
+#include "ns3/mmwave-enb-position-index.h"
 #include "ns3/mmwave-helper.h"
 #include "ns3/mobility-helper.h"
 #include "ns3/node-container.h"
+#include "ns3/random-variable-stream.h"
 #include "ns3/test.h"
 
+#include <limits>
+
 NS_LOG_COMPONENT_DEFINE("MmWaveAttachmentTest");
 
 using namespace ns3;
@@ -151,6 +155,122 @@ MmWaveAttachmentTestCase::DoRun(void)
     NS_TEST_ASSERT_MSG_EQ(bsNetDevs.Get(1), targetBs2, "UE 2 should be attached to BS 2");
 }
 
+/**
+ * This test case checks that the spatial index used to attach the UEs selects
+ * the same eNB as a linear scan, including the ties
+ */
+class MmWaveEnbPositionIndexTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    MmWaveEnbPositionIndexTestCase();
+
+  private:
+    /**
+     * Run the test
+     */
+    void DoRun() override;
+
+    /**
+     * \param positions the eNB positions
+     * \param uePos the UE position
+     * \returns the index of the closest eNB found with a linear scan
+     */
+    uint32_t FindClosestLinear(const std::vector<Vector>& positions, const Vector& uePos);
+
+    /**
+     * Check the index against the linear scan for a set of UE positions
+     * \param positions the eNB positions
+     * \param uePositions the UE positions
+     * \param name the name of the deployment
+     */
+    void Check(const std::vector<Vector>& positions,
+               const std::vector<Vector>& uePositions,
+               std::string name);
+};
+
+MmWaveEnbPositionIndexTestCase::MmWaveEnbPositionIndexTestCase()
+    : TestCase("Checks that the eNB position index finds the closest eNB")
+{
+}
+
+uint32_t
+MmWaveEnbPositionIndexTestCase::FindClosestLinear(const std::vector<Vector>& positions,
+                                                  const Vector& uePos)
+{
+    double minDistance = std::numeric_limits<double>::infinity();
+    uint32_t closest = 0;
+    for (uint32_t i = 0; i < positions.size(); ++i)
+    {
+        double distance = CalculateDistance(uePos, positions[i]);
+        if (distance < minDistance)
+        {
+            minDistance = distance;
+            closest = i;
+        }
+    }
+    return closest;
+}
+
+void
+MmWaveEnbPositionIndexTestCase::Check(const std::vector<Vector>& positions,
+                                      const std::vector<Vector>& uePositions,
+                                      std::string name)
+{
+    MmWaveEnbPositionIndex index;
+    index.Build(positions);
+    for (const auto& uePos : uePositions)
+    {
+        NS_TEST_ASSERT_MSG_EQ(index.FindClosest(uePos),
+                              FindClosestLinear(positions, uePos),
+                              "wrong eNB for UE at " << uePos << " (" << name << ")");
+    }
+}
+
+void
+MmWaveEnbPositionIndexTestCase::DoRun()
+{
+    Ptr<UniformRandomVariable> rv = CreateObject<UniformRandomVariable>();
+    rv->SetStream(1);
+
+    std::vector<Vector> uePositions;
+    for (uint32_t i = 0; i < 2000; ++i)
+    {
+        uePositions.emplace_back(rv->GetValue(-1500, 1500), rv->GetValue(-1500, 1500), 1.6);
+    }
+
+    std::vector<Vector> random;
+    for (uint32_t i = 0; i < 150; ++i)
+    {
+        random.emplace_back(rv->GetValue(-1000, 1000), rv->GetValue(-1000, 1000), 25);
+    }
+    Check(random, uePositions, "random");
+
+    // a regular grid with duplicated sites at different heights gives many
+    // ties, also for the UEs placed on the grid
+    std::vector<Vector> grid;
+    std::vector<Vector> gridUes;
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        grid.emplace_back((i % 10) * 100.0, (i / 10 % 5) * 200.0, (i < 50) ? 10.0 : 30.0);
+        gridUes.emplace_back((i % 20) * 50.0, (i / 5) * 50.0, 20.0);
+    }
+    Check(grid, gridUes, "grid");
+    Check(grid, uePositions, "grid");
+
+    std::vector<Vector> line;
+    for (uint32_t i = 0; i < 40; ++i)
+    {
+        line.emplace_back(i * 50.0, 0, 25);
+    }
+    Check(line, uePositions, "line");
+
+    Check({Vector(5, 5, 25)}, uePositions, "single");
+    Check({Vector(5, 5, 25), Vector(5, 5, 25)}, uePositions, "same position");
+}
+
 /**
  * This suite tests if the beamforming module works properly
  */
@@ -164,6 +284,7 @@ MmWaveAttachmentTest::MmWaveAttachmentTest()
     : TestSuite("mmwave-attachment-test", Type::UNIT)
 {
     AddTestCase(new MmWaveAttachmentTestCase, Duration::QUICK);
+    AddTestCase(new MmWaveEnbPositionIndexTestCase, Duration::QUICK);
 }
 
 // Do not forget to allocate an instance of this TestSuite
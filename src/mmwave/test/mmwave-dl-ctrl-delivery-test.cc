@@ -0,0 +1,198 @@
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "mmwave-test-scenario.h"
+
+#include "ns3/boolean.h"
+#include "ns3/config.h"
+#include "ns3/mmwave-control-messages.h"
+#include "ns3/test.h"
+
+#include <list>
+
+NS_LOG_COMPONENT_DEFINE("MmWaveDlCtrlDeliveryTest");
+
+using namespace ns3;
+using namespace mmwave;
+
+/**
+ * This test case checks that a MmWaveControlMessageBundle gives to each UE
+ * its DCIs and the messages which are not DCIs, in the order in which they
+ * are sent
+ */
+class MmWaveControlMessageBundleTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    MmWaveControlMessageBundleTestCase();
+
+  private:
+    /**
+     * Run the test
+     */
+    void DoRun() override;
+
+    /**
+     * Create a DCI
+     * \param rnti the RNTI of the DCI
+     * \return the DCI message
+     */
+    static Ptr<MmWaveControlMessage> CreateDci(uint16_t rnti);
+};
+
+MmWaveControlMessageBundleTestCase::MmWaveControlMessageBundleTestCase()
+    : TestCase("Checks the messages that each UE extracts from a MmWaveControlMessageBundle")
+{
+}
+
+Ptr<MmWaveControlMessage>
+MmWaveControlMessageBundleTestCase::CreateDci(uint16_t rnti)
+{
+    DciInfoElementTdma dci;
+    dci.m_rnti = rnti;
+    Ptr<MmWaveTdmaDciMessage> msg = Create<MmWaveTdmaDciMessage>();
+    msg->SetDciInfoElement(dci);
+    return msg;
+}
+
+void
+MmWaveControlMessageBundleTestCase::DoRun()
+{
+    Ptr<MmWaveControlMessage> mib = Create<MmWaveMibMessage>();
+    Ptr<MmWaveControlMessage> sib1 = Create<MmWaveSib1Message>();
+    Ptr<MmWaveControlMessage> rar = Create<MmWaveRarMessage>();
+    Ptr<MmWaveControlMessage> dci1a = CreateDci(1);
+    Ptr<MmWaveControlMessage> dci1b = CreateDci(1);
+    Ptr<MmWaveControlMessage> dci2a = CreateDci(2);
+    Ptr<MmWaveControlMessage> dci2b = CreateDci(2);
+    Ptr<MmWaveControlMessage> dci3 = CreateDci(3);
+
+    // the DCIs of a UE come before, between and after the common messages
+    std::list<Ptr<MmWaveControlMessage>> msgList{dci2a, mib, dci1a, sib1, dci1b, dci2b, rar, dci3};
+    Ptr<MmWaveControlMessageBundle> bundle = Create<MmWaveControlMessageBundle>(msgList);
+
+    NS_TEST_ASSERT_MSG_EQ(bundle->IsEmpty(), false, "The bundle should not be empty");
+    NS_TEST_ASSERT_MSG_EQ((bundle->GetMessages() == msgList),
+                          true,
+                          "The bundle should give all the messages in order");
+
+    std::list<Ptr<MmWaveControlMessage>> expected1{mib, dci1a, sib1, dci1b, rar};
+    NS_TEST_ASSERT_MSG_EQ((bundle->GetMessages(1) == expected1),
+                          true,
+                          "Wrong messages for a UE whose DCIs are between the common messages");
+    std::list<Ptr<MmWaveControlMessage>> expected2{dci2a, mib, sib1, dci2b, rar};
+    NS_TEST_ASSERT_MSG_EQ((bundle->GetMessages(2) == expected2),
+                          true,
+                          "Wrong messages for a UE with a DCI before the common messages");
+    std::list<Ptr<MmWaveControlMessage>> expected3{mib, sib1, rar, dci3};
+    NS_TEST_ASSERT_MSG_EQ((bundle->GetMessages(3) == expected3),
+                          true,
+                          "Wrong messages for a UE with a DCI after the common messages");
+    std::list<Ptr<MmWaveControlMessage>> expected4{mib, sib1, rar};
+    NS_TEST_ASSERT_MSG_EQ((bundle->GetMessages(4) == expected4),
+                          true,
+                          "Wrong messages for a UE without DCIs");
+
+    Ptr<MmWaveControlMessageBundle> dcisOnly =
+        Create<MmWaveControlMessageBundle>(std::list<Ptr<MmWaveControlMessage>>{dci1a, dci2a});
+    NS_TEST_ASSERT_MSG_EQ((dcisOnly->GetMessages(1) == std::list<Ptr<MmWaveControlMessage>>{dci1a}),
+                          true,
+                          "Wrong messages for a UE in a bundle of DCIs");
+    NS_TEST_ASSERT_MSG_EQ(dcisOnly->GetMessages(3).empty(),
+                          true,
+                          "A UE without DCIs should get no message from a bundle of DCIs");
+
+    Ptr<MmWaveControlMessageBundle> empty =
+        Create<MmWaveControlMessageBundle>(std::list<Ptr<MmWaveControlMessage>>());
+    NS_TEST_ASSERT_MSG_EQ(empty->IsEmpty(), true, "The bundle should be empty");
+}
+
+/**
+ * This test case runs a scenario with two cells with the DL control frames
+ * delivered directly and through the channel, and checks that the packets
+ * received by the applications and the TBs received by the PHYs are the same
+ */
+class MmWaveDirectDlCtrlDeliveryTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    MmWaveDirectDlCtrlDeliveryTestCase();
+
+  private:
+    /**
+     * Run the test
+     */
+    void DoRun() override;
+
+    /**
+     * Restore the default values of the attributes
+     */
+    void DoTeardown() override;
+};
+
+MmWaveDirectDlCtrlDeliveryTestCase::MmWaveDirectDlCtrlDeliveryTestCase()
+    : TestCase("Checks that the direct delivery of the DL control keeps the receptions")
+{
+}
+
+void
+MmWaveDirectDlCtrlDeliveryTestCase::DoRun()
+{
+    MmWaveTestScenario scenario(2, 2, MilliSeconds(20), MilliSeconds(400));
+    Config::SetDefault("ns3::MmWaveSpectrumPhy::DirectDlCtrlDelivery", BooleanValue(false));
+    MmWaveTestScenario::Results channel = scenario.Run();
+    Config::SetDefault("ns3::MmWaveSpectrumPhy::DirectDlCtrlDelivery", BooleanValue(true));
+    MmWaveTestScenario::Results direct = scenario.Run();
+
+    NS_TEST_ASSERT_MSG_GT(channel.packets.size(), 0, "No packet received");
+    NS_TEST_ASSERT_MSG_EQ(direct.packets.size(),
+                          channel.packets.size(),
+                          "Wrong number of packets received");
+    NS_TEST_ASSERT_MSG_EQ((direct.packets == channel.packets),
+                          true,
+                          "The packets should be received at the same times");
+    NS_TEST_ASSERT_MSG_EQ(direct.tbs.size(), channel.tbs.size(), "Wrong number of TBs received");
+    NS_TEST_ASSERT_MSG_EQ((direct.tbs == channel.tbs), true, "The TBs should be the same");
+}
+
+void
+MmWaveDirectDlCtrlDeliveryTestCase::DoTeardown()
+{
+    Config::Reset();
+}
+
+/**
+ * Test suite for the delivery of the DL control frames
+ */
+class MmWaveDlCtrlDeliveryTest : public TestSuite
+{
+  public:
+    MmWaveDlCtrlDeliveryTest();
+};
+
+MmWaveDlCtrlDeliveryTest::MmWaveDlCtrlDeliveryTest()
+    : TestSuite("mmwave-dl-ctrl-delivery-test", Type::UNIT)
+{
+    AddTestCase(new MmWaveControlMessageBundleTestCase, Duration::QUICK);
+    AddTestCase(new MmWaveDirectDlCtrlDeliveryTestCase, Duration::QUICK);
+}
+
+// Do not forget to allocate an instance of this TestSuite
+static MmWaveDlCtrlDeliveryTest mmwaveDlCtrlDeliveryTestSuite;
@@ -0,0 +1,137 @@
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "mmwave-test-scenario.h"
+
+#include "ns3/config.h"
+#include "ns3/mmwave-point-to-point-epc-helper.h"
+#include "ns3/node-list.h"
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+NS_LOG_COMPONENT_DEFINE("MmWaveEpcHelperTest");
+
+using namespace ns3;
+using namespace mmwave;
+
+/**
+ * This test case checks that the MmWavePointToPointEpcHelper creates the
+ * SGW/PGW and MME nodes of the core network on system 0 by default, in the
+ * same order as before they were created by NotifyConstructionCompleted
+ */
+class MmWaveEpcHelperCoreNodesTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    MmWaveEpcHelperCoreNodesTestCase();
+
+  private:
+    /**
+     * Run the test
+     */
+    void DoRun() override;
+};
+
+MmWaveEpcHelperCoreNodesTestCase::MmWaveEpcHelperCoreNodesTestCase()
+    : TestCase("Checks the core network nodes created by the MmWavePointToPointEpcHelper")
+{
+}
+
+void
+MmWaveEpcHelperCoreNodesTestCase::DoRun()
+{
+    uint32_t numNodes = NodeList::GetNNodes();
+    Ptr<MmWavePointToPointEpcHelper> epcHelper = CreateObject<MmWavePointToPointEpcHelper>();
+    NS_TEST_ASSERT_MSG_EQ(NodeList::GetNNodes(),
+                          numNodes + 2,
+                          "The helper should create the SGW/PGW and MME nodes when constructed");
+    NS_TEST_ASSERT_MSG_EQ(epcHelper->GetPgwNode()->GetId(), numNodes, "Wrong SGW/PGW node");
+    NS_TEST_ASSERT_MSG_EQ(epcHelper->GetMmeNode()->GetId(), numNodes + 1, "Wrong MME node");
+    NS_TEST_ASSERT_MSG_EQ(epcHelper->GetPgwNode()->GetSystemId(), 0, "Wrong SGW/PGW system");
+    NS_TEST_ASSERT_MSG_EQ(epcHelper->GetMmeNode()->GetSystemId(), 0, "Wrong MME system");
+    Simulator::Destroy();
+}
+
+/**
+ * This test case runs a small EPC scenario with the default CoreSystemId,
+ * and checks that the packets and TBs received are those received before
+ * the core network nodes were created by NotifyConstructionCompleted
+ */
+class MmWaveEpcHelperScenarioTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    MmWaveEpcHelperScenarioTestCase();
+
+  private:
+    /**
+     * Run the test
+     */
+    void DoRun() override;
+
+    /**
+     * Restore the default values of the attributes
+     */
+    void DoTeardown() override;
+};
+
+MmWaveEpcHelperScenarioTestCase::MmWaveEpcHelperScenarioTestCase()
+    : TestCase("Checks the receptions of an EPC scenario with the default CoreSystemId")
+{
+}
+
+void
+MmWaveEpcHelperScenarioTestCase::DoRun()
+{
+    MmWaveTestScenario scenario(2, 2, MilliSeconds(20), MilliSeconds(400));
+    MmWaveTestScenario::Results results = scenario.Run();
+
+    // reference values, which the helper gives both when it creates the core
+    // network nodes in NotifyConstructionCompleted and in its constructor
+    NS_TEST_ASSERT_MSG_EQ(results.packets.size(), 75, "Wrong number of packets received");
+    NS_TEST_ASSERT_MSG_EQ(results.tbs.size(), 103, "Wrong number of TBs received");
+    NS_TEST_ASSERT_MSG_EQ(results.GetDigest(), 1246480726512825628U, "Wrong receptions");
+}
+
+void
+MmWaveEpcHelperScenarioTestCase::DoTeardown()
+{
+    Config::Reset();
+}
+
+/**
+ * Test suite for the MmWavePointToPointEpcHelper
+ */
+class MmWaveEpcHelperTest : public TestSuite
+{
+  public:
+    MmWaveEpcHelperTest();
+};
+
+MmWaveEpcHelperTest::MmWaveEpcHelperTest()
+    : TestSuite("mmwave-epc-helper-test", Type::UNIT)
+{
+    AddTestCase(new MmWaveEpcHelperCoreNodesTestCase, Duration::QUICK);
+    AddTestCase(new MmWaveEpcHelperScenarioTestCase, Duration::QUICK);
+}
+
+// Do not forget to allocate an instance of this TestSuite
+static MmWaveEpcHelperTest mmwaveEpcHelperTestSuite;
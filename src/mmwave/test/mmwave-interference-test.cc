@@ -0,0 +1,253 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/mmwave-chunk-processor.h"
+#include "ns3/mmwave-interference.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulator.h"
+#include "ns3/spectrum-model.h"
+#include "ns3/spectrum-value.h"
+#include "ns3/test.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace ns3;
+using namespace mmwave;
+
+/**
+ * This test case checks the SINR computed by the mmWaveInterference against
+ * the SINR obtained by adding up, for each interval between the start and the
+ * end of two signals, the power of the signals active during the interval.
+ * The interferers start and end either together with the TTIs, as in TDD, or
+ * at any time, and the noise is reset in the middle of the run.
+ */
+class MmWaveInterferenceTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    MmWaveInterferenceTestCase();
+
+    /**
+     * Destructor
+     */
+    virtual ~MmWaveInterferenceTestCase();
+
+  private:
+    /**
+     * A signal received by the mmWaveInterference
+     */
+    struct Signal
+    {
+        Time start;             //!< the start of the signal
+        Time end;               //!< the end of the signal
+        Ptr<SpectrumValue> psd; //!< the PSD of the signal
+        bool isRx;              //!< whether the signal is the one being received
+        uint32_t noiseEpoch;    //!< the number of noise resets before the signal starts
+    };
+
+    /**
+     * Run the test
+     */
+    virtual void DoRun(void);
+
+    /**
+     * Store the SINR computed at the end of a reception
+     *
+     * \param sinr the average SINR of the reception
+     */
+    void ReportSinr(const SpectrumValue& sinr);
+
+    /**
+     * Compute the average SINR of a reception with the power of the active signals
+     *
+     * \param rx the signal being received
+     * \param noise the noise PSD during the reception
+     * \return the average SINR
+     */
+    SpectrumValue ExpectedSinr(const Signal& rx, const SpectrumValue& noise) const;
+
+    std::vector<Signal> m_signals;     //!< the signals
+    std::vector<SpectrumValue> m_sinr; //!< the SINR computed at the end of each reception
+};
+
+MmWaveInterferenceTestCase::MmWaveInterferenceTestCase()
+    : TestCase("Checks the SINR computed by the mmWaveInterference")
+{
+}
+
+MmWaveInterferenceTestCase::~MmWaveInterferenceTestCase()
+{
+}
+
+void
+MmWaveInterferenceTestCase::ReportSinr(const SpectrumValue& sinr)
+{
+    m_sinr.push_back(sinr);
+}
+
+SpectrumValue
+MmWaveInterferenceTestCase::ExpectedSinr(const Signal& rx, const SpectrumValue& noise) const
+{
+    std::vector<Time> boundaries{rx.start, rx.end};
+    for (const auto& signal : m_signals)
+    {
+        for (Time t : {signal.start, signal.end})
+        {
+            if (t > rx.start && t < rx.end)
+            {
+                boundaries.push_back(t);
+            }
+        }
+    }
+    std::sort(boundaries.begin(), boundaries.end());
+    boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+
+    SpectrumValue sum(noise.GetSpectrumModel());
+    for (std::size_t i = 0; i + 1 < boundaries.size(); ++i)
+    {
+        SpectrumValue interference = noise;
+        for (const auto& signal : m_signals)
+        {
+            if (!signal.isRx && signal.noiseEpoch == rx.noiseEpoch &&
+                signal.start <= boundaries[i] && signal.end >= boundaries[i + 1])
+            {
+                interference += *signal.psd;
+            }
+        }
+        sum += (*rx.psd) / interference * (boundaries[i + 1] - boundaries[i]).GetSeconds();
+    }
+    return sum / (rx.end - rx.start).GetSeconds();
+}
+
+void
+MmWaveInterferenceTestCase::DoRun(void)
+{
+    const uint32_t numBands = 8;
+    std::vector<double> frequencies;
+    for (uint32_t i = 0; i < numBands; ++i)
+    {
+        frequencies.push_back(28e9 + i * 1e6);
+    }
+    Ptr<SpectrumModel> model = Create<SpectrumModel>(frequencies);
+
+    Ptr<UniformRandomVariable> uniform = CreateObject<UniformRandomVariable>();
+    uniform->SetStream(1);
+    auto randomPsd = [&](double scale) {
+        Ptr<SpectrumValue> psd = Create<SpectrumValue>(model);
+        for (uint32_t i = 0; i < numBands; ++i)
+        {
+            (*psd)[i] = scale * uniform->GetValue(0.1, 1);
+        }
+        return psd;
+    };
+
+    Ptr<mmWaveInterference> interference = CreateObject<mmWaveInterference>();
+    Ptr<mmWaveChunkProcessor> sinrProcessor = Create<mmWaveChunkProcessor>();
+    sinrProcessor->AddCallback(MakeCallback(&MmWaveInterferenceTestCase::ReportSinr, this));
+    interference->AddSinrChunkProcessor(sinrProcessor);
+    std::vector<Ptr<SpectrumValue>> noise{randomPsd(1e-3), randomPsd(2e-3)};
+    interference->SetNoisePowerSpectralDensity(noise[0]);
+
+    // TTIs of 10 us: the received signal occupies a TTI out of two, the TDD
+    // interferers start and end with the TTIs, the other interferers do not
+    const Time tti = MicroSeconds(10);
+    const uint32_t numTtis = 20;
+    const uint32_t resetTti = 11;
+    for (uint32_t n = 0; n < numTtis; ++n)
+    {
+        Time start = n * tti;
+        uint32_t epoch = n < resetTti ? 0 : 1;
+        for (uint32_t k = 0; k < 3; ++k)
+        {
+            m_signals.push_back(Signal{start, start + tti, randomPsd(1e-2), false, epoch});
+        }
+        Time offset = NanoSeconds(uniform->GetInteger(1, 9999));
+        Time duration = NanoSeconds(uniform->GetInteger(1, 25000));
+        m_signals.push_back(
+            Signal{start + offset, start + offset + duration, randomPsd(1e-2), false, epoch});
+        if (n % 2 == 1)
+        {
+            m_signals.push_back(Signal{start, start + tti, randomPsd(1), true, epoch});
+        }
+    }
+
+    // the receptions are started and ended as MmWaveSpectrumPhy does
+    for (const auto& signal : m_signals)
+    {
+        Simulator::Schedule(signal.start,
+                            &mmWaveInterference::AddSignal,
+                            interference,
+                            signal.psd,
+                            signal.end - signal.start);
+        if (signal.isRx)
+        {
+            Simulator::Schedule(signal.start,
+                                &mmWaveInterference::StartRx,
+                                interference,
+                                signal.psd);
+            Simulator::Schedule(signal.end, &mmWaveInterference::EndRx, interference);
+        }
+    }
+    // the reset happens between two receptions, while some interferers are active
+    Simulator::Schedule(resetTti * tti - NanoSeconds(1),
+                        &mmWaveInterference::SetNoisePowerSpectralDensity,
+                        interference,
+                        noise[1]);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    std::size_t reception = 0;
+    for (const auto& signal : m_signals)
+    {
+        if (!signal.isRx)
+        {
+            continue;
+        }
+        NS_TEST_ASSERT_MSG_LT(reception, m_sinr.size(), "Missing SINR report");
+        SpectrumValue expected = ExpectedSinr(signal, *noise[signal.noiseEpoch]);
+        for (uint32_t i = 0; i < numBands; ++i)
+        {
+            NS_TEST_ASSERT_MSG_EQ_TOL(m_sinr[reception][i],
+                                      expected[i],
+                                      expected[i] * 1e-9,
+                                      "Wrong SINR of reception " << reception << " in band "
+                                                                 << i);
+        }
+        reception++;
+    }
+    NS_TEST_ASSERT_MSG_EQ(m_sinr.size(), reception, "Unexpected SINR report");
+}
+
+/**
+ * Test suite of the mmWaveInterference
+ */
+class MmWaveInterferenceTestSuite : public TestSuite
+{
+  public:
+    MmWaveInterferenceTestSuite();
+};
+
+MmWaveInterferenceTestSuite::MmWaveInterferenceTestSuite()
+    : TestSuite("mmwave-interference-test", Type::UNIT)
+{
+    AddTestCase(new MmWaveInterferenceTestCase, Duration::QUICK);
+}
+
+static MmWaveInterferenceTestSuite mmwaveInterferenceTestSuite; //!< the test suite
@@ -22,8 +22,12 @@
 #include "ns3/mmwave-eesm-error-model.h"
 #include "ns3/mmwave-eesm-ir-t1.h"
 #include "ns3/mmwave-eesm-ir-t2.h"
+#include "ns3/spectrum-model.h"
+#include "ns3/spectrum-value.h"
 #include "ns3/test.h"
 
+#include <algorithm>
+
 using namespace ns3;
 using namespace mmwave;
 
@@ -32,9 +36,12 @@ using namespace mmwave;
  * \ingroup test
  *
  * \brief This test validates specific functions of the NR PHY abstraction model.
- * The test checks two issues: 1) LDPC base graph (BG) selection works properly, and 2)
+ * The test checks three issues: 1) LDPC base graph (BG) selection works properly, 2)
  * BLER values are properly obtained from the BLER-SINR look up tables for different
- * block sizes, MCS Tables, BG types, and SINR values.
+ * block sizes, MCS Tables, BG types, and SINR values, 3) the batch decodification
+ * of the TBs of a TTI gives the same outputs as the decodification of each TB, and 4)
+ * the HARQ combining of the retransmissions gives the effective SINR of the combined
+ * SINR vector.
  *
  */
 
@@ -63,6 +70,8 @@ class MmWaveL2smEesmTestCase : public TestCase
     void TestMappingSinrBler2(const Ptr<MmWaveEesmErrorModel>& em);
     void TestBgType1(const Ptr<MmWaveEesmErrorModel>& em);
     void TestBgType2(const Ptr<MmWaveEesmErrorModel>& em);
+    void TestBatchDecodification(const Ptr<MmWaveEesmErrorModel>& em);
+    void TestHarqCombining(const Ptr<MmWaveEesmErrorModel>& em, bool chaseCombining);
 
     void TestEesmCcTable1();
     void TestEesmCcTable2();
@@ -225,6 +234,134 @@ MmWaveL2smEesmTestCase::TestMappingSinrBler2(const Ptr<MmWaveEesmErrorModel>& em
     }
 }
 
+void
+MmWaveL2smEesmTestCase::TestBatchDecodification(const Ptr<MmWaveEesmErrorModel>& em)
+{
+    // the TBs of a TTI, with the same and different MCSs and RB maps, a TB
+    // without allocated RBs in common with the others, and a retransmission
+    std::vector<double> frequencies;
+    for (uint32_t i = 0; i < 12; ++i)
+    {
+        frequencies.push_back(28e9 + i * 1e6);
+    }
+    SpectrumValue sinr(Create<SpectrumModel>(frequencies));
+    for (uint32_t i = 0; i < 12; ++i)
+    {
+        sinr[i] = 0.5 + 0.75 * i;
+    }
+    std::vector<int> allRbs{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    std::vector<int> lowRbs{0, 1, 2, 3, 4, 5};
+    std::vector<int> highRbs{8, 9, 10, 11};
+    MmWaveErrorModel::MmWaveErrorModelHistory noHistory;
+    MmWaveErrorModel::MmWaveErrorModelHistory history;
+    history.Add(em->GetTbDecodificationStats(sinr, lowRbs, 800, 12, noHistory), sinr, lowRbs);
+
+    std::vector<MmWaveErrorModel::TbDecodificationRequest> tbs{
+        {&allRbs, 1500, 10, &noHistory},
+        {&lowRbs, 300, 10, &noHistory},
+        {&allRbs, 1500, 10, &noHistory},
+        {&highRbs, 200, 4, &noHistory},
+        {&lowRbs, 800, 12, &history},
+    };
+    std::vector<Ptr<MmWaveErrorModelOutput>> outputs = em->GetBatchDecodificationStats(sinr, tbs);
+    NS_TEST_ASSERT_MSG_EQ(outputs.size(), tbs.size(), "Wrong number of outputs");
+    for (std::size_t i = 0; i < tbs.size(); ++i)
+    {
+        Ptr<MmWaveEesmErrorModelOutput> expected = DynamicCast<MmWaveEesmErrorModelOutput>(
+            em->GetTbDecodificationStats(sinr,
+                                         *tbs[i].m_map,
+                                         tbs[i].m_size,
+                                         tbs[i].m_mcs,
+                                         *tbs[i].m_history));
+        Ptr<MmWaveEesmErrorModelOutput> output =
+            DynamicCast<MmWaveEesmErrorModelOutput>(outputs[i]);
+        NS_TEST_ASSERT_MSG_EQ(output->m_sinrEff,
+                              expected->m_sinrEff,
+                              "TestBatchDecodification: wrong effective SINR of TB " << i);
+        NS_TEST_ASSERT_MSG_EQ(output->m_tbler,
+                              expected->m_tbler,
+                              "TestBatchDecodification: wrong TBLER of TB " << i);
+        NS_TEST_ASSERT_MSG_EQ(output->m_codeBits,
+                              expected->m_codeBits,
+                              "TestBatchDecodification: wrong code bits of TB " << i);
+    }
+}
+
+void
+MmWaveL2smEesmTestCase::TestHarqCombining(const Ptr<MmWaveEesmErrorModel>& em,
+                                          bool chaseCombining)
+{
+    // three transmissions of a TB, with different SINRs and RB maps; the
+    // effective SINR of each retransmission is the one of a transmission
+    // without history over the SINR vector combined as per CC or IR
+    std::vector<double> frequencies;
+    for (uint32_t i = 0; i < 12; ++i)
+    {
+        frequencies.push_back(28e9 + i * 1e6);
+    }
+    Ptr<SpectrumModel> model = Create<SpectrumModel>(frequencies);
+    std::vector<SpectrumValue> sinrs;
+    for (uint32_t tx = 0; tx < 3; ++tx)
+    {
+        SpectrumValue sinr(model);
+        for (uint32_t i = 0; i < 12; ++i)
+        {
+            sinr[i] = 0.2 + 0.3 * ((i + 5 * tx) % 7);
+        }
+        sinrs.push_back(sinr);
+    }
+    std::vector<std::vector<int>> maps{{2, 3, 4}, {0, 1, 2, 3, 4, 6}, {0}};
+    const uint32_t size = 400;
+    const uint8_t mcs = 5;
+
+    MmWaveErrorModel::MmWaveErrorModelHistory noHistory;
+    MmWaveErrorModel::MmWaveErrorModelHistory history;
+    for (uint32_t tx = 0; tx < sinrs.size(); ++tx)
+    {
+        Ptr<MmWaveEesmErrorModelOutput> output = DynamicCast<MmWaveEesmErrorModelOutput>(
+            em->GetTbDecodificationStats(sinrs[tx], maps[tx], size, mcs, history));
+        if (tx > 0)
+        {
+            SpectrumValue sinrSum(model);
+            std::vector<int> mapSum;
+            if (chaseCombining)
+            {
+                std::size_t maxRbUsed = 0;
+                for (uint32_t i = 0; i <= tx; ++i)
+                {
+                    maxRbUsed = std::max(maxRbUsed, maps[i].size());
+                }
+                for (uint32_t j = 0; j < maxRbUsed; ++j)
+                {
+                    for (uint32_t i = 0; i <= tx; ++i)
+                    {
+                        sinrSum[j] += sinrs[i][maps[i][j % maps[i].size()]];
+                    }
+                    mapSum.push_back(j);
+                }
+            }
+            else
+            {
+                double previousSinrEff =
+                    DynamicCast<MmWaveEesmErrorModelOutput>(history.m_outputs.back())->m_sinrEff;
+                sinrSum = sinrs[tx];
+                for (int rb : maps[tx])
+                {
+                    sinrSum[rb] += previousSinrEff;
+                }
+                mapSum = maps[tx];
+            }
+            Ptr<MmWaveEesmErrorModelOutput> expected = DynamicCast<MmWaveEesmErrorModelOutput>(
+                em->GetTbDecodificationStats(sinrSum, mapSum, size, mcs, noHistory));
+            NS_TEST_ASSERT_MSG_EQ_TOL(output->m_sinrEff,
+                                      expected->m_sinrEff,
+                                      1e-12,
+                                      "TestHarqCombining: wrong effective SINR of TX " << tx);
+        }
+        history.Add(output, sinrs[tx], maps[tx]);
+    }
+}
+
 void
 MmWaveL2smEesmTestCase::TestEesmCcTable1()
 {
@@ -238,6 +375,8 @@ MmWaveL2smEesmTestCase::TestEesmCcTable1()
     // Test here the functions:
     TestBgType1(em);
     TestMappingSinrBler1(em);
+    TestBatchDecodification(em);
+    TestHarqCombining(em, true);
 }
 
 void
@@ -253,6 +392,8 @@ MmWaveL2smEesmTestCase::TestEesmCcTable2()
     // Test here the functions:
     TestBgType2(em);
     TestMappingSinrBler2(em);
+    TestBatchDecodification(em);
+    TestHarqCombining(em, true);
 }
 
 void
@@ -268,6 +409,8 @@ MmWaveL2smEesmTestCase::TestEesmIrTable1()
     // Test here the functions:
     TestBgType1(em);
     TestMappingSinrBler1(em);
+    TestBatchDecodification(em);
+    TestHarqCombining(em, false);
 }
 
 void
@@ -283,6 +426,8 @@ MmWaveL2smEesmTestCase::TestEesmIrTable2()
     // Test here the functions:
     TestBgType2(em);
     TestMappingSinrBler2(em);
+    TestBatchDecodification(em);
+    TestHarqCombining(em, false);
 }
 
 void
@@ -0,0 +1,174 @@
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/double.h"
+#include "ns3/enum.h"
+#include "ns3/mmwave-phy-mac-common.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <sstream>
+
+NS_LOG_COMPONENT_DEFINE("MmWaveNumerologyTest");
+
+using namespace ns3;
+using namespace mmwave;
+
+/**
+ * This test case takes a MmWaveNumerology snapshot of a MmWavePhyMacCommon
+ * configuration, and checks that its values are those of the configuration
+ */
+class MmWaveNumerologyTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * \param numerology the PHY layer numerology
+     * \param bandwidth the carrier bandwidth in Hz
+     * \param ctrlSymbols the number of OFDM symbols of the DL and of the UL control regions
+     * \param ulSchedDelay the UL scheduling delay, in slots
+     * \param tbDecodeLatency the TB decoding latency, in us
+     */
+    MmWaveNumerologyTestCase(MmWavePhyMacCommon::Numerology numerology,
+                             double bandwidth,
+                             uint32_t ctrlSymbols,
+                             uint32_t ulSchedDelay,
+                             uint32_t tbDecodeLatency);
+
+  private:
+    /**
+     * Run the test
+     */
+    void DoRun() override;
+
+    /**
+     * Build the name of the test
+     * \param numerology the PHY layer numerology
+     * \param bandwidth the carrier bandwidth in Hz
+     * \param ctrlSymbols the number of OFDM symbols of the control regions
+     * \return the name of the test
+     */
+    static std::string BuildNameString(MmWavePhyMacCommon::Numerology numerology,
+                                       double bandwidth,
+                                       uint32_t ctrlSymbols);
+
+    MmWavePhyMacCommon::Numerology m_numerology; //!< the PHY layer numerology
+    double m_bandwidth;                          //!< the carrier bandwidth in Hz
+    uint32_t m_ctrlSymbols;                      //!< the OFDM symbols of the control regions
+    uint32_t m_ulSchedDelay;                     //!< the UL scheduling delay, in slots
+    uint32_t m_tbDecodeLatency;                  //!< the TB decoding latency, in us
+};
+
+MmWaveNumerologyTestCase::MmWaveNumerologyTestCase(MmWavePhyMacCommon::Numerology numerology,
+                                                   double bandwidth,
+                                                   uint32_t ctrlSymbols,
+                                                   uint32_t ulSchedDelay,
+                                                   uint32_t tbDecodeLatency)
+    : TestCase(BuildNameString(numerology, bandwidth, ctrlSymbols)),
+      m_numerology(numerology),
+      m_bandwidth(bandwidth),
+      m_ctrlSymbols(ctrlSymbols),
+      m_ulSchedDelay(ulSchedDelay),
+      m_tbDecodeLatency(tbDecodeLatency)
+{
+}
+
+std::string
+MmWaveNumerologyTestCase::BuildNameString(MmWavePhyMacCommon::Numerology numerology,
+                                          double bandwidth,
+                                          uint32_t ctrlSymbols)
+{
+    std::ostringstream oss;
+    oss << "Checks the MmWaveNumerology of NR numerology " << numerology << ", " << bandwidth / 1e6
+        << " MHz and " << ctrlSymbols << " control symbols";
+    return oss.str();
+}
+
+void
+MmWaveNumerologyTestCase::DoRun()
+{
+    Ptr<MmWavePhyMacCommon> config = CreateObject<MmWavePhyMacCommon>();
+    // the bandwidth gives a number of RBs which depends on the numerology
+    config->SetAttribute("Numerology", EnumValue<MmWavePhyMacCommon::Numerology>(m_numerology));
+    config->SetAttribute("Bandwidth", DoubleValue(m_bandwidth));
+    config->SetAttribute("TbDecodeLatency", UintegerValue(m_tbDecodeLatency));
+    config->SetDlCtrlSymbols(m_ctrlSymbols);
+    config->SetUlCtrlSymbols(m_ctrlSymbols);
+    config->SetUlSchedDelay(m_ulSchedDelay);
+
+    MmWaveNumerology numerology(config);
+    NS_TEST_ASSERT_MSG_EQ(numerology.GetSymbPerSlot(),
+                          config->GetSymbPerSlot(),
+                          "Wrong number of symbols per slot");
+    NS_TEST_ASSERT_MSG_EQ(numerology.GetSlotsPerSubframe(),
+                          config->GetSlotsPerSubframe(),
+                          "Wrong number of slots per subframe");
+    NS_TEST_ASSERT_MSG_EQ(numerology.GetSubframesPerFrame(),
+                          config->GetSubframesPerFrame(),
+                          "Wrong number of subframes per frame");
+    NS_TEST_ASSERT_MSG_EQ(numerology.GetDlCtrlSymbols(),
+                          config->GetDlCtrlSymbols(),
+                          "Wrong number of DL control symbols");
+    NS_TEST_ASSERT_MSG_EQ(numerology.GetUlCtrlSymbols(),
+                          config->GetUlCtrlSymbols(),
+                          "Wrong number of UL control symbols");
+    NS_TEST_ASSERT_MSG_EQ(+numerology.GetUlSchedDelay(),
+                          +config->GetUlSchedDelay(),
+                          "Wrong UL scheduling delay");
+    NS_TEST_ASSERT_MSG_EQ(numerology.GetNumRb(), config->GetNumRb(), "Wrong number of RBs");
+    NS_TEST_ASSERT_MSG_EQ(numerology.GetSymbolPeriod(),
+                          config->GetSymbolPeriod(),
+                          "Wrong symbol period");
+    NS_TEST_ASSERT_MSG_EQ(numerology.GetSlotPeriod(),
+                          config->GetSlotPeriod(),
+                          "Wrong slot period");
+    NS_TEST_ASSERT_MSG_EQ(numerology.GetSubframePeriod(),
+                          config->GetSubframePeriod(),
+                          "Wrong subframe period");
+    NS_TEST_ASSERT_MSG_EQ(numerology.GetTbDecodeLatency(),
+                          MicroSeconds(config->GetTbDecodeLatency()),
+                          "Wrong TB decoding latency");
+
+    // the durations replace the products computed by the PHYs at each slot
+    for (uint32_t numSym = 0; numSym <= config->GetSymbPerSlot(); numSym++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(numerology.GetSymbolsDuration(numSym),
+                              config->GetSymbolPeriod() * numSym,
+                              "Wrong duration of " << numSym << " symbols");
+    }
+}
+
+/**
+ * Test suite for the MmWaveNumerology snapshot
+ */
+class MmWaveNumerologyTest : public TestSuite
+{
+  public:
+    MmWaveNumerologyTest();
+};
+
+MmWaveNumerologyTest::MmWaveNumerologyTest()
+    : TestSuite("mmwave-numerology-test", Type::UNIT)
+{
+    // the default configuration
+    AddTestCase(new MmWaveNumerologyTestCase(MmWavePhyMacCommon::NrNumerology2, 200e6, 1, 1, 100),
+                Duration::QUICK);
+    AddTestCase(new MmWaveNumerologyTestCase(MmWavePhyMacCommon::NrNumerology3, 400e6, 2, 0, 250),
+                Duration::QUICK);
+}
+
+// Do not forget to allocate an instance of this TestSuite
+static MmWaveNumerologyTest mmwaveNumerologyTestSuite;
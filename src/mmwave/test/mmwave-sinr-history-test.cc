@@ -0,0 +1,242 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/mmwave-enb-phy.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/test.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+using namespace ns3;
+using namespace mmwave;
+
+/**
+ * This test case checks the SINR filtered by the MmWaveSinrHistory against the
+ * one obtained by filtering the whole SINR trace at every update, i.e., by
+ * looking for the blockage in the variance of the noisy trace and by trying
+ * every weight of the exponential average over the blockage.
+ */
+class MmWaveSinrHistoryTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param growSamples the number of samples collected during the transient
+     */
+    MmWaveSinrHistoryTestCase(uint32_t growSamples);
+
+    /**
+     * Destructor
+     */
+    virtual ~MmWaveSinrHistoryTestCase();
+
+  private:
+    /**
+     * Run the test
+     */
+    virtual void DoRun(void);
+
+    /**
+     * Filter the last sample of a trace, going through the whole trace
+     *
+     * \param noisySinr the noisy SINR trace
+     * \param sinr the SINR trace
+     * \return the filtered SINR of the last sample
+     */
+    static double ExpectedFilteredSinr(const std::vector<double>& noisySinr,
+                                       const std::vector<double>& sinr);
+
+    uint32_t m_growSamples; //!< the number of samples collected during the transient
+};
+
+MmWaveSinrHistoryTestCase::MmWaveSinrHistoryTestCase(uint32_t growSamples)
+    : TestCase("Checks the SINR filtered by the MmWaveSinrHistory, with " +
+               std::to_string(growSamples) + " samples"),
+      m_growSamples(growSamples)
+{
+}
+
+MmWaveSinrHistoryTestCase::~MmWaveSinrHistoryTestCase()
+{
+}
+
+double
+MmWaveSinrHistoryTestCase::ExpectedFilteredSinr(const std::vector<double>& noisySinr,
+                                                const std::vector<double>& sinr)
+{
+    const uint64_t size = noisySinr.size();
+    if (size < 2)
+    {
+        return noisySinr.back();
+    }
+    std::vector<double> noisySinrDb;
+    for (double value : noisySinr)
+    {
+        noisySinrDb.push_back(10 * std::log10(value));
+    }
+    std::vector<double> vectorVar;
+    for (uint64_t i = 0; i + 1 < size; i++)
+    {
+        double mean = (noisySinrDb[i] + noisySinrDb[i + 1]) / 2;
+        vectorVar.push_back(
+            (std::pow(noisySinrDb[i] - mean, 2) + std::pow(noisySinrDb[i + 1] - mean, 2)) / 2);
+    }
+
+    // the end of the blockage
+    uint64_t end = 0;
+    for (uint64_t varIndex = vectorVar.size() - 1; varIndex > 0; varIndex--)
+    {
+        if (vectorVar[varIndex] > 5 || std::isnan(vectorVar[varIndex]) ||
+            noisySinr[varIndex + 1] < 10)
+        {
+            end = varIndex + 1;
+            break;
+        }
+    }
+
+    // the start of the blockage
+    const uint64_t window = 16;
+    uint64_t start = 0;
+    for (uint64_t i = end; i > window; i--)
+    {
+        bool lowVariance = std::all_of(vectorVar.begin() + i - window,
+                                       vectorVar.begin() + i - 1,
+                                       [](double v) { return v < 1; });
+        bool highSinr = std::all_of(noisySinrDb.begin() + i - window,
+                                    noisySinrDb.begin() + i,
+                                    [](double v) { return v > 10; });
+        if (lowVariance || highSinr)
+        {
+            start = i;
+            break;
+        }
+    }
+    if (start == end)
+    {
+        return noisySinr.back();
+    }
+
+    // the best weight of the exponential average during the blockage
+    std::array<double, 100> meanError;
+    int rep = 0;
+    for (double alpha = 0; alpha < 1; alpha = alpha + 0.01)
+    {
+        std::vector<double> x{0};
+        std::vector<double> error;
+        for (uint64_t i = start; i < end; i++)
+        {
+            x.push_back((1 - alpha) * x.back() + alpha * noisySinr[i]);
+            error.push_back(std::abs(x.back() - sinr[i]));
+        }
+        double sum = 0;
+        for (double e : error)
+        {
+            sum += e;
+        }
+        meanError.at(rep++) = sum / error.size();
+    }
+    int posMinAlpha =
+        std::distance(meanError.begin(), std::min_element(meanError.begin(), meanError.end()));
+    double minAlpha = (posMinAlpha + 1) * 0.01;
+    if (minAlpha > 0.5)
+    {
+        minAlpha = 0.2;
+    }
+
+    // the trace before the blockage, the filtered blockage without its last sample, and the
+    // trace after the blockage
+    std::vector<double> blockageTrace{0};
+    for (uint64_t i = start; i < end; i++)
+    {
+        blockageTrace.push_back((1 - minAlpha) * blockageTrace.back() + minAlpha * noisySinr[i]);
+    }
+    std::vector<double> finalTrace(noisySinr.begin(), noisySinr.begin() + start + 1);
+    finalTrace.insert(finalTrace.end(), blockageTrace.begin() + 1, blockageTrace.end() - 1);
+    finalTrace.insert(finalTrace.end(), noisySinr.begin() + end + 1, noisySinr.end());
+    return finalTrace.back();
+}
+
+void
+MmWaveSinrHistoryTestCase::DoRun(void)
+{
+    Ptr<NormalRandomVariable> noise = CreateObject<NormalRandomVariable>();
+    noise->SetStream(1);
+    Ptr<UniformRandomVariable> uniform = CreateObject<UniformRandomVariable>();
+    uniform->SetStream(2);
+    const double n0 = 3.98107170e-12;
+
+    // a trace which alternates LOS periods, around 25 dB, and blockages, around 0 dB
+    MmWaveSinrHistory history;
+    std::vector<double> sinrTrace;
+    std::vector<double> noisyTrace;
+    bool blockage = false;
+    for (uint32_t n = 0; n < m_growSamples + 400; n++)
+    {
+        if (uniform->GetValue() < 0.05)
+        {
+            blockage = !blockage;
+        }
+        double sinrDb = (blockage ? 0 : 25) + uniform->GetValue(-3, 3);
+        double sinr = std::pow(10, sinrDb / 10);
+        std::complex<double> gaussianNoise(std::sqrt(0.5 * n0) * noise->GetValue(),
+                                           std::sqrt(0.5 * n0) * noise->GetValue());
+        double noisySinr = (std::pow(std::abs(std::sqrt(sinr * n0) + gaussianNoise), 2) - n0) / n0;
+
+        bool grow = n < m_growSamples;
+        history.Add(sinr, noisySinr, grow);
+        sinrTrace.push_back(sinr);
+        noisyTrace.push_back(noisySinr);
+        if (!grow && sinrTrace.size() > std::max<uint32_t>(m_growSamples, 2))
+        {
+            sinrTrace.erase(sinrTrace.begin());
+            noisyTrace.erase(noisyTrace.begin());
+        }
+
+        NS_TEST_ASSERT_MSG_EQ(history.GetSize(), sinrTrace.size(), "Wrong size at sample " << n);
+        NS_TEST_ASSERT_MSG_EQ(history.GetLastNoisySinr(),
+                              noisySinr,
+                              "Wrong noisy SINR at sample " << n);
+        NS_TEST_ASSERT_MSG_EQ(history.GetFilteredSinr(),
+                              ExpectedFilteredSinr(noisyTrace, sinrTrace),
+                              "Wrong filtered SINR at sample " << n);
+    }
+}
+
+/**
+ * Test suite of the MmWaveSinrHistory
+ */
+class MmWaveSinrHistoryTestSuite : public TestSuite
+{
+  public:
+    MmWaveSinrHistoryTestSuite();
+};
+
+MmWaveSinrHistoryTestSuite::MmWaveSinrHistoryTestSuite()
+    : TestSuite("mmwave-sinr-history-test", Type::UNIT)
+{
+    for (uint32_t growSamples : {0, 10, 60, 200})
+    {
+        AddTestCase(new MmWaveSinrHistoryTestCase(growSamples), Duration::QUICK);
+    }
+}
+
+static MmWaveSinrHistoryTestSuite mmwaveSinrHistoryTestSuite; //!< the test suite
@@ -0,0 +1,138 @@
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "mmwave-test-scenario.h"
+
+#include "ns3/boolean.h"
+#include "ns3/config.h"
+#include "ns3/test.h"
+
+#include <sstream>
+
+NS_LOG_COMPONENT_DEFINE("MmWaveSkipIdleSlotsTest");
+
+using namespace ns3;
+using namespace mmwave;
+
+/**
+ * This test case runs a scenario with mostly idle UEs with and without
+ * MmWaveUePhy::SkipIdleSlots, and checks that the packets received by the
+ * applications and the TBs received by the PHYs are the same, while the UEs
+ * report fewer UL control TTIs, since the skipped slots send no empty UL
+ * control frame.
+ *
+ * The packets of the scenario are not sent on a slot boundary, so that the
+ * events at the boundaries of the skipped slots do not change order, and the
+ * channels are generated upfront, so that they are drawn in the same order;
+ * the other differences documented for the attribute thus do not show in this
+ * scenario.
+ */
+class MmWaveSkipIdleSlotsTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * \param numEnbs the number of eNBs
+     * \param uesPerEnb the number of UEs of each eNB
+     */
+    MmWaveSkipIdleSlotsTestCase(uint32_t numEnbs, uint32_t uesPerEnb);
+
+  private:
+    /**
+     * Run the test
+     */
+    void DoRun() override;
+
+    /**
+     * Restore the default values of the attributes
+     */
+    void DoTeardown() override;
+
+    /**
+     * Build the name of the test
+     * \param numEnbs the number of eNBs
+     * \param uesPerEnb the number of UEs of each eNB
+     * \return the name of the test
+     */
+    static std::string BuildNameString(uint32_t numEnbs, uint32_t uesPerEnb);
+
+    uint32_t m_numEnbs;   //!< the number of eNBs
+    uint32_t m_uesPerEnb; //!< the number of UEs of each eNB
+};
+
+MmWaveSkipIdleSlotsTestCase::MmWaveSkipIdleSlotsTestCase(uint32_t numEnbs, uint32_t uesPerEnb)
+    : TestCase(BuildNameString(numEnbs, uesPerEnb)),
+      m_numEnbs(numEnbs),
+      m_uesPerEnb(uesPerEnb)
+{
+}
+
+std::string
+MmWaveSkipIdleSlotsTestCase::BuildNameString(uint32_t numEnbs, uint32_t uesPerEnb)
+{
+    std::ostringstream oss;
+    oss << "Checks that SkipIdleSlots keeps the receptions of " << numEnbs << " eNBs with "
+        << uesPerEnb << " UEs each";
+    return oss.str();
+}
+
+void
+MmWaveSkipIdleSlotsTestCase::DoRun()
+{
+    MmWaveTestScenario scenario(m_numEnbs, m_uesPerEnb, MilliSeconds(20), MilliSeconds(400));
+    Config::SetDefault("ns3::MmWaveUePhy::SkipIdleSlots", BooleanValue(false));
+    MmWaveTestScenario::Results dense = scenario.Run();
+    Config::SetDefault("ns3::MmWaveUePhy::SkipIdleSlots", BooleanValue(true));
+    MmWaveTestScenario::Results skipping = scenario.Run();
+
+    NS_TEST_ASSERT_MSG_GT(dense.packets.size(), 0, "No packet received");
+    NS_TEST_ASSERT_MSG_EQ(skipping.packets.size(),
+                          dense.packets.size(),
+                          "Wrong number of packets received");
+    NS_TEST_ASSERT_MSG_EQ((skipping.packets == dense.packets),
+                          true,
+                          "The packets should be received at the same times");
+    NS_TEST_ASSERT_MSG_EQ(skipping.tbs.size(), dense.tbs.size(), "Wrong number of TBs received");
+    NS_TEST_ASSERT_MSG_EQ((skipping.tbs == dense.tbs), true, "The TBs should be the same");
+    NS_TEST_ASSERT_MSG_LT(skipping.ulCtrlTtis,
+                          dense.ulCtrlTtis,
+                          "The skipped slots should not send their UL control frames");
+}
+
+void
+MmWaveSkipIdleSlotsTestCase::DoTeardown()
+{
+    Config::Reset();
+}
+
+/**
+ * Test suite for MmWaveUePhy::SkipIdleSlots
+ */
+class MmWaveSkipIdleSlotsTest : public TestSuite
+{
+  public:
+    MmWaveSkipIdleSlotsTest();
+};
+
+MmWaveSkipIdleSlotsTest::MmWaveSkipIdleSlotsTest()
+    : TestSuite("mmwave-skip-idle-slots-test", Type::SYSTEM)
+{
+    AddTestCase(new MmWaveSkipIdleSlotsTestCase(1, 4), Duration::QUICK);
+    AddTestCase(new MmWaveSkipIdleSlotsTestCase(2, 2), Duration::QUICK);
+}
+
+// Do not forget to allocate an instance of this TestSuite
+static MmWaveSkipIdleSlotsTest mmwaveSkipIdleSlotsTestSuite;
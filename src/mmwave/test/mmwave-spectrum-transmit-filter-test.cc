@@ -0,0 +1,232 @@
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "mmwave-test-scenario.h"
+
+#include "ns3/boolean.h"
+#include "ns3/config.h"
+#include "ns3/mmwave-enb-net-device.h"
+#include "ns3/mmwave-helper.h"
+#include "ns3/mmwave-spectrum-signal-parameters.h"
+#include "ns3/mmwave-spectrum-transmit-filter.h"
+#include "ns3/mmwave-ue-net-device.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/node-container.h"
+#include "ns3/simulator.h"
+#include "ns3/spectrum-channel.h"
+#include "ns3/test.h"
+
+NS_LOG_COMPONENT_DEFINE("MmWaveSpectrumTransmitFilterTest");
+
+using namespace ns3;
+using namespace mmwave;
+
+/**
+ * This test case checks which signals the MmWaveSpectrumTransmitFilter
+ * installed by the MmWaveHelper discards: the signals between two eNBs or
+ * two UEs, and the DL control frames of the other cells. The data frames
+ * between an eNB and a UE, of the same cell or not, are delivered.
+ */
+class MmWaveSpectrumTransmitFilterTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    MmWaveSpectrumTransmitFilterTestCase();
+
+  private:
+    /**
+     * Run the test
+     */
+    void DoRun() override;
+};
+
+MmWaveSpectrumTransmitFilterTestCase::MmWaveSpectrumTransmitFilterTestCase()
+    : TestCase("Checks the signals discarded by the MmWaveSpectrumTransmitFilter")
+{
+}
+
+void
+MmWaveSpectrumTransmitFilterTestCase::DoRun()
+{
+    // two cells, with one UE each
+    //   UE1-----------------------------UE2
+    //    |                               |
+    //   BS1-----------------------------BS2
+    Ptr<MmWaveHelper> helper = CreateObject<MmWaveHelper>();
+    helper->SetAttribute("UseSpectrumTransmitFilter", BooleanValue(true));
+
+    NodeContainer enbNodes;
+    enbNodes.Create(2);
+    NodeContainer ueNodes;
+    ueNodes.Create(2);
+    Ptr<ListPositionAllocator> positions = CreateObject<ListPositionAllocator>();
+    positions->Add(Vector(0.0, 0.0, 25.0));
+    positions->Add(Vector(100.0, 0.0, 25.0));
+    positions->Add(Vector(0.0, 20.0, 1.6));
+    positions->Add(Vector(100.0, 20.0, 1.6));
+    MobilityHelper mobility;
+    mobility.SetPositionAllocator(positions);
+    mobility.Install(enbNodes);
+    mobility.Install(ueNodes);
+
+    NetDeviceContainer enbDevs = helper->InstallEnbDevice(enbNodes);
+    NetDeviceContainer ueDevs = helper->InstallUeDevice(ueNodes);
+    helper->AttachToClosestEnb(ueDevs, enbDevs);
+
+    Ptr<MmWaveEnbNetDevice> enbDev[2];
+    Ptr<MmWaveSpectrumPhy> enbPhy[2];
+    Ptr<MmWaveSpectrumPhy> uePhy[2];
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        enbDev[i] = DynamicCast<MmWaveEnbNetDevice>(enbDevs.Get(i));
+        enbPhy[i] = enbDev[i]->GetPhy()->GetDlSpectrumPhy();
+        uePhy[i] = DynamicCast<MmWaveUeNetDevice>(ueDevs.Get(i))->GetPhy()->GetDlSpectrumPhy();
+    }
+    Ptr<SpectrumTransmitFilter> filter =
+        enbPhy[0]->GetSpectrumChannel()->GetSpectrumTransmitFilter();
+    NS_TEST_ASSERT_MSG_NE(DynamicCast<MmWaveSpectrumTransmitFilter>(filter),
+                          nullptr,
+                          "The helper should install the filter on the channel");
+
+    Ptr<MmwaveSpectrumSignalParametersDataFrame> dlData =
+        Create<MmwaveSpectrumSignalParametersDataFrame>();
+    dlData->txPhy = enbPhy[0];
+    dlData->cellId = enbDev[0]->GetCellId();
+    Ptr<MmwaveSpectrumSignalParametersDataFrame> ulData =
+        Create<MmwaveSpectrumSignalParametersDataFrame>();
+    ulData->txPhy = uePhy[0];
+    ulData->cellId = enbDev[0]->GetCellId();
+    Ptr<MmWaveSpectrumSignalParametersDlCtrlFrame> dlCtrl =
+        Create<MmWaveSpectrumSignalParametersDlCtrlFrame>();
+    dlCtrl->txPhy = enbPhy[0];
+    dlCtrl->cellId = enbDev[0]->GetCellId();
+
+    // signals of the same type of device
+    NS_TEST_ASSERT_MSG_EQ(filter->Filter(dlData, enbPhy[1]),
+                          true,
+                          "The data of an eNB should not reach another eNB");
+    NS_TEST_ASSERT_MSG_EQ(filter->Filter(dlCtrl, enbPhy[1]),
+                          true,
+                          "The control of an eNB should not reach another eNB");
+    NS_TEST_ASSERT_MSG_EQ(filter->Filter(ulData, uePhy[1]),
+                          true,
+                          "The data of a UE should not reach another UE");
+
+    // DL control frames
+    NS_TEST_ASSERT_MSG_EQ(filter->Filter(dlCtrl, uePhy[0]),
+                          false,
+                          "The control of an eNB should reach the UEs of its cell");
+    NS_TEST_ASSERT_MSG_EQ(filter->Filter(dlCtrl, uePhy[1]),
+                          true,
+                          "The control of an eNB should not reach the UEs of another cell");
+
+    // data frames, which also interfere with the other cells
+    NS_TEST_ASSERT_MSG_EQ(filter->Filter(dlData, uePhy[0]),
+                          false,
+                          "The data of an eNB should reach the UEs of its cell");
+    NS_TEST_ASSERT_MSG_EQ(filter->Filter(dlData, uePhy[1]),
+                          false,
+                          "The data of an eNB should reach the UEs of another cell");
+    NS_TEST_ASSERT_MSG_EQ(filter->Filter(ulData, enbPhy[0]),
+                          false,
+                          "The data of a UE should reach the eNB of its cell");
+    NS_TEST_ASSERT_MSG_EQ(filter->Filter(ulData, enbPhy[1]),
+                          false,
+                          "The data of a UE should reach the eNB of another cell");
+
+    Simulator::Destroy();
+}
+
+/**
+ * This test case runs a scenario with two cells with and without the
+ * MmWaveSpectrumTransmitFilter, and checks that the packets received by the
+ * applications and the TBs received by the PHYs, with their SINR, are the
+ * same. The channels of the scenario are generated upfront, so that the
+ * pairs of devices which are filtered do not change the random numbers drawn.
+ */
+class MmWaveSpectrumTransmitFilterScenarioTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    MmWaveSpectrumTransmitFilterScenarioTestCase();
+
+  private:
+    /**
+     * Run the test
+     */
+    void DoRun() override;
+
+    /**
+     * Restore the default values of the attributes
+     */
+    void DoTeardown() override;
+};
+
+MmWaveSpectrumTransmitFilterScenarioTestCase::MmWaveSpectrumTransmitFilterScenarioTestCase()
+    : TestCase("Checks that the MmWaveSpectrumTransmitFilter keeps the receptions of two cells")
+{
+}
+
+void
+MmWaveSpectrumTransmitFilterScenarioTestCase::DoRun()
+{
+    MmWaveTestScenario scenario(2, 2, MilliSeconds(20), MilliSeconds(400));
+    Config::SetDefault("ns3::MmWaveHelper::UseSpectrumTransmitFilter", BooleanValue(false));
+    MmWaveTestScenario::Results unfiltered = scenario.Run();
+    Config::SetDefault("ns3::MmWaveHelper::UseSpectrumTransmitFilter", BooleanValue(true));
+    MmWaveTestScenario::Results filtered = scenario.Run();
+
+    NS_TEST_ASSERT_MSG_GT(unfiltered.packets.size(), 0, "No packet received");
+    NS_TEST_ASSERT_MSG_EQ(filtered.packets.size(),
+                          unfiltered.packets.size(),
+                          "Wrong number of packets received");
+    NS_TEST_ASSERT_MSG_EQ((filtered.packets == unfiltered.packets),
+                          true,
+                          "The packets should be received at the same times");
+    NS_TEST_ASSERT_MSG_EQ(filtered.tbs.size(),
+                          unfiltered.tbs.size(),
+                          "Wrong number of TBs received");
+    NS_TEST_ASSERT_MSG_EQ((filtered.tbs == unfiltered.tbs), true, "The TBs should be the same");
+}
+
+void
+MmWaveSpectrumTransmitFilterScenarioTestCase::DoTeardown()
+{
+    Config::Reset();
+}
+
+/**
+ * Test suite for the MmWaveSpectrumTransmitFilter
+ */
+class MmWaveSpectrumTransmitFilterTest : public TestSuite
+{
+  public:
+    MmWaveSpectrumTransmitFilterTest();
+};
+
+MmWaveSpectrumTransmitFilterTest::MmWaveSpectrumTransmitFilterTest()
+    : TestSuite("mmwave-spectrum-transmit-filter-test", Type::UNIT)
+{
+    AddTestCase(new MmWaveSpectrumTransmitFilterTestCase, Duration::QUICK);
+    AddTestCase(new MmWaveSpectrumTransmitFilterScenarioTestCase, Duration::QUICK);
+}
+
+// Do not forget to allocate an instance of this TestSuite
+static MmWaveSpectrumTransmitFilterTest mmwaveSpectrumTransmitFilterTestSuite;
@@ -0,0 +1,275 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "mmwave-test-scenario.h"
+
+#include <ns3/applications-module.h>
+#include <ns3/config.h>
+#include <ns3/internet-module.h>
+#include <ns3/mmwave-enb-net-device.h>
+#include <ns3/mmwave-helper.h>
+#include <ns3/mmwave-point-to-point-epc-helper.h>
+#include <ns3/mobility-module.h>
+#include <ns3/point-to-point-helper.h>
+#include <ns3/rng-seed-manager.h>
+#include <ns3/simulator.h>
+#include <ns3/three-gpp-channel-model.h>
+#include <ns3/three-gpp-propagation-loss-model.h>
+#include <ns3/three-gpp-spectrum-propagation-loss-model.h>
+
+namespace ns3
+{
+
+namespace mmwave
+{
+
+bool
+MmWaveTestScenario::PacketRx::operator==(const PacketRx& other) const
+{
+    return time == other.time && node == other.node && size == other.size;
+}
+
+bool
+MmWaveTestScenario::TbRx::operator==(const TbRx& other) const
+{
+    const RxPacketTraceParams& p = params;
+    const RxPacketTraceParams& q = other.params;
+    return time == other.time && downlink == other.downlink && p.m_cellId == q.m_cellId &&
+           p.m_ccId == q.m_ccId && p.m_rnti == q.m_rnti && p.m_frameNum == q.m_frameNum &&
+           p.m_sfNum == q.m_sfNum && p.m_slotNum == q.m_slotNum &&
+           p.m_symStart == q.m_symStart && p.m_numSym == q.m_numSym &&
+           p.m_tbSize == q.m_tbSize && p.m_mcs == q.m_mcs && p.m_rv == q.m_rv &&
+           p.m_sinr == q.m_sinr && p.m_sinrMin == q.m_sinrMin && p.m_tbler == q.m_tbler &&
+           p.m_corrupt == q.m_corrupt;
+}
+
+uint64_t
+MmWaveTestScenario::Results::GetDigest() const
+{
+    uint64_t digest = 14695981039346656037U;
+    auto add = [&digest](uint64_t value) { digest = (digest ^ value) * 1099511628211U; };
+    for (const PacketRx& packet : packets)
+    {
+        add(packet.time);
+        add(packet.node);
+        add(packet.size);
+    }
+    for (const TbRx& tb : tbs)
+    {
+        add(tb.time);
+        add(tb.downlink);
+        add(tb.params.m_cellId);
+        add(tb.params.m_rnti);
+        add(tb.params.m_symStart);
+        add(tb.params.m_numSym);
+        add(tb.params.m_tbSize);
+        add(tb.params.m_mcs);
+        add(tb.params.m_rv);
+        add(tb.params.m_corrupt);
+    }
+    return digest;
+}
+
+MmWaveTestScenario::MmWaveTestScenario(uint32_t numEnbs,
+                                       uint32_t uesPerEnb,
+                                       Time interval,
+                                       Time simTime)
+    : m_numEnbs(numEnbs),
+      m_uesPerEnb(uesPerEnb),
+      m_interval(interval),
+      m_simTime(simTime)
+{
+}
+
+void
+MmWaveTestScenario::PacketReceived(Results* results,
+                                   uint32_t node,
+                                   Ptr<const Packet> p,
+                                   const Address& from)
+{
+    results->packets.push_back({Simulator::Now().GetTimeStep(), node, p->GetSize()});
+}
+
+void
+MmWaveTestScenario::TbReceived(Results* results, bool downlink, RxPacketTraceParams params)
+{
+    results->tbs.push_back({Simulator::Now().GetTimeStep(), downlink, params});
+}
+
+void
+MmWaveTestScenario::UlTransmission(Results* results, PhyTransmissionTraceParams params)
+{
+    if (params.m_ttiType == PhyTransmissionTraceParams::CTRL)
+    {
+        results->ulCtrlTtis++;
+    }
+}
+
+MmWaveTestScenario::Results
+MmWaveTestScenario::Run()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    Config::SetDefault("ns3::ThreeGppPropagationLossModel::ShadowingEnabled", BooleanValue(false));
+    Config::SetDefault("ns3::LteRlcUmLowLat::ReportBufferStatusTimer",
+                       TimeValue(MicroSeconds(100.0)));
+
+    Ptr<MmWaveHelper> helper = CreateObject<MmWaveHelper>();
+    helper->SetSchedulerType("ns3::MmWaveFlexTtiMacScheduler");
+    helper->SetChannelConditionModelType("ns3::AlwaysLosChannelConditionModel");
+    Ptr<MmWavePointToPointEpcHelper> epcHelper = CreateObject<MmWavePointToPointEpcHelper>();
+    helper->SetEpcHelper(epcHelper);
+
+    NodeContainer remoteHosts;
+    remoteHosts.Create(1);
+    Ptr<Node> remoteHost = remoteHosts.Get(0);
+    InternetStackHelper internet;
+    internet.Install(remoteHosts);
+    PointToPointHelper p2ph;
+    p2ph.SetDeviceAttribute("DataRate", DataRateValue(DataRate("100Gb/s")));
+    p2ph.SetChannelAttribute("Delay", TimeValue(MilliSeconds(10)));
+    NetDeviceContainer internetDevices = p2ph.Install(epcHelper->GetPgwNode(), remoteHost);
+    Ipv4AddressHelper ipv4h;
+    ipv4h.SetBase("1.0.0.0", "255.0.0.0");
+    Ipv4Address remoteHostAddr = ipv4h.Assign(internetDevices).GetAddress(1);
+    Ipv4StaticRoutingHelper routingHelper;
+    routingHelper.GetStaticRouting(remoteHost->GetObject<Ipv4>())
+        ->AddNetworkRouteTo(Ipv4Address("7.0.0.0"), Ipv4Mask("255.0.0.0"), 1);
+
+    NodeContainer enbNodes;
+    enbNodes.Create(m_numEnbs);
+    NodeContainer ueNodes;
+    ueNodes.Create(m_numEnbs * m_uesPerEnb);
+    MobilityHelper mobility;
+    Ptr<ListPositionAllocator> positions = CreateObject<ListPositionAllocator>();
+    for (uint32_t i = 0; i < m_numEnbs; i++)
+    {
+        positions->Add(Vector(200 * i, 0, 15));
+    }
+    for (uint32_t i = 0; i < ueNodes.GetN(); i++)
+    {
+        positions->Add(Vector(200 * (i / m_uesPerEnb) + 20 + 3 * (i % m_uesPerEnb), 0, 1.5));
+    }
+    mobility.SetPositionAllocator(positions);
+    mobility.Install(enbNodes);
+    mobility.Install(ueNodes);
+
+    NetDeviceContainer enbDevs = helper->InstallEnbDevice(enbNodes);
+    NetDeviceContainer ueDevs = helper->InstallUeDevice(ueNodes);
+    internet.Install(ueNodes);
+    Ipv4InterfaceContainer ueIpIfaces = epcHelper->AssignUeIpv4Address(ueDevs);
+    for (uint32_t i = 0; i < ueNodes.GetN(); i++)
+    {
+        routingHelper.GetStaticRouting(ueNodes.Get(i)->GetObject<Ipv4>())
+            ->SetDefaultRoute(epcHelper->GetUeDefaultGatewayAddress(), 1);
+    }
+
+    // fixed streams, so that the runs of the scenario in the same program draw
+    // the same random numbers; the attachment already generates the channels
+    // between the eNBs and the UEs
+    NetDeviceContainer devices(enbDevs, ueDevs);
+    Ptr<SpectrumChannel> channel = DynamicCast<MmWaveEnbNetDevice>(enbDevs.Get(0))
+                                       ->GetPhy(0)
+                                       ->GetDlSpectrumPhy()
+                                       ->GetSpectrumChannel();
+    Ptr<PropagationLossModel> pathloss = channel->GetPropagationLossModel();
+    Ptr<ThreeGppChannelModel> channelModel = DynamicCast<ThreeGppChannelModel>(
+        DynamicCast<ThreeGppSpectrumPropagationLossModel>(
+            channel->GetPhasedArraySpectrumPropagationLossModel())
+            ->GetChannelModel());
+    int64_t stream = 1;
+    stream += helper->AssignStreams(devices, stream);
+    stream += internet.AssignStreams(NodeContainer(remoteHosts, enbNodes, ueNodes), stream);
+    stream += pathloss->AssignStreams(stream);
+    stream += DynamicCast<ThreeGppPropagationLossModel>(pathloss)
+                  ->GetChannelConditionModel()
+                  ->AssignStreams(stream);
+    stream += channelModel->AssignStreams(stream);
+
+    helper->AttachToClosestEnb(ueDevs, enbDevs);
+
+    // generate the channels of all the pairs of devices upfront, so that they
+    // do not depend on the order in which the signals are first sent
+    for (uint32_t i = 0; i < devices.GetN(); i++)
+    {
+        for (uint32_t j = i + 1; j < devices.GetN(); j++)
+        {
+            Ptr<MmWaveNetDevice> a = DynamicCast<MmWaveNetDevice>(devices.Get(i));
+            Ptr<MmWaveNetDevice> b = DynamicCast<MmWaveNetDevice>(devices.Get(j));
+            channelModel->GetChannel(a->GetNode()->GetObject<MobilityModel>(),
+                                     b->GetNode()->GetObject<MobilityModel>(),
+                                     a->GetAntenna(0),
+                                     b->GetAntenna(0));
+        }
+    }
+
+    Results results;
+    // the first packets are spread over an interval, and do not fall on a slot boundary
+    Ptr<UniformRandomVariable> offset = CreateObject<UniformRandomVariable>();
+    offset->SetAttribute("Max", DoubleValue(m_interval.GetMicroSeconds()));
+    offset->SetStream(stream);
+    for (uint32_t i = 0; i < ueNodes.GetN(); i++)
+    {
+        uint16_t dlPort = 1000;
+        uint16_t ulPort = 2000 + i;
+        PacketSinkHelper dlSink("ns3::UdpSocketFactory",
+                                InetSocketAddress(Ipv4Address::GetAny(), dlPort));
+        PacketSinkHelper ulSink("ns3::UdpSocketFactory",
+                                InetSocketAddress(Ipv4Address::GetAny(), ulPort));
+        ApplicationContainer sinks = dlSink.Install(ueNodes.Get(i));
+        sinks.Add(ulSink.Install(remoteHost));
+        sinks.Start(MilliSeconds(100));
+        for (uint32_t j = 0; j < sinks.GetN(); j++)
+        {
+            uint32_t node = sinks.Get(j)->GetNode()->GetId();
+            sinks.Get(j)->TraceConnectWithoutContext(
+                "Rx",
+                MakeBoundCallback(&MmWaveTestScenario::PacketReceived, &results, node));
+        }
+
+        UdpClientHelper dlClient(ueIpIfaces.GetAddress(i), dlPort);
+        dlClient.SetAttribute("Interval", TimeValue(m_interval));
+        dlClient.SetAttribute("MaxPackets", UintegerValue(0));
+        dlClient.SetAttribute("PacketSize", UintegerValue(200));
+        UdpClientHelper ulClient(remoteHostAddr, ulPort);
+        ulClient.SetAttribute("Interval", TimeValue(m_interval));
+        ulClient.SetAttribute("MaxPackets", UintegerValue(0));
+        ulClient.SetAttribute("PacketSize", UintegerValue(200));
+        dlClient.Install(remoteHost).Start(MilliSeconds(200) +
+                                           MicroSeconds(offset->GetInteger()) + NanoSeconds(1));
+        ulClient.Install(ueNodes.Get(i))
+            .Start(MilliSeconds(200) + MicroSeconds(offset->GetInteger()) + NanoSeconds(1));
+    }
+    Config::ConnectWithoutContextFailSafe(
+        "/NodeList/*/DeviceList/*/ComponentCarrierMap/*/MmWaveUePhy/DlSpectrumPhy/"
+        "RxPacketTraceUe",
+        MakeBoundCallback(&MmWaveTestScenario::TbReceived, &results, true));
+    Config::ConnectWithoutContextFailSafe(
+        "/NodeList/*/DeviceList/*/ComponentCarrierMap/*/MmWaveEnbPhy/DlSpectrumPhy/"
+        "RxPacketTraceEnb",
+        MakeBoundCallback(&MmWaveTestScenario::TbReceived, &results, false));
+    Config::ConnectWithoutContextFailSafe(
+        "/NodeList/*/DeviceList/*/ComponentCarrierMap/*/MmWaveUePhy/ReportUlPhyTransmission",
+        MakeBoundCallback(&MmWaveTestScenario::UlTransmission, &results));
+
+    Simulator::Stop(m_simTime);
+    Simulator::Run();
+    Simulator::Destroy();
+    return results;
+}
+
+} // namespace mmwave
+
+} // namespace ns3
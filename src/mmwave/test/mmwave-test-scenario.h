@@ -0,0 +1,157 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MMWAVE_TEST_SCENARIO_H
+#define MMWAVE_TEST_SCENARIO_H
+
+#include <ns3/address.h>
+#include <ns3/mmwave-phy-mac-common.h>
+#include <ns3/nstime.h>
+#include <ns3/packet.h>
+
+#include <vector>
+
+namespace ns3
+{
+
+namespace mmwave
+{
+
+/**
+ * \ingroup mmwave
+ * \brief A small EPC scenario for the tests which compare two configurations
+ *
+ * eNBs are placed every 200 m along a line, each with UEs which exchange a
+ * small UDP packet with a remote host at a regular interval, in DL and in
+ * UL. The scenario records the packets received by the applications, the
+ * TBs received by the PHYs of the eNBs and of the UEs, and the number of UL
+ * control TTIs reported by the PHYs of the UEs. The channels are
+ * always in LOS, without shadowing, and they are generated for all the pairs
+ * of devices before the simulation starts, so that the random numbers drawn do
+ * not depend on which signals reach which devices.
+ *
+ * The attributes of the mmWave module are configured with Config::SetDefault
+ * before the scenario runs. Each run assigns the same fixed streams to all the
+ * random variables, so that two runs of the same configuration in the same
+ * program give the same results.
+ */
+class MmWaveTestScenario
+{
+  public:
+    /**
+     * A packet received by an application.
+     */
+    struct PacketRx
+    {
+        int64_t time;  //!< the time of the reception, in time steps
+        uint32_t node; //!< the ID of the receiving node
+        uint32_t size; //!< the size of the packet
+
+        /**
+         * \param other the other reception
+         * \return whether the receptions are equal
+         */
+        bool operator==(const PacketRx& other) const;
+    };
+
+    /**
+     * A TB received by a PHY.
+     */
+    struct TbRx
+    {
+        int64_t time;               //!< the time of the reception, in time steps
+        bool downlink;              //!< whether the TB was received by a UE
+        RxPacketTraceParams params; //!< the parameters of the trace
+
+        /**
+         * \param other the other reception
+         * \return whether the receptions are equal, including the SINR values
+         */
+        bool operator==(const TbRx& other) const;
+    };
+
+    /**
+     * The receptions recorded during a run.
+     */
+    struct Results
+    {
+        std::vector<PacketRx> packets; //!< the packets received by the applications
+        std::vector<TbRx> tbs;         //!< the TBs received by the PHYs
+        uint64_t ulCtrlTtis = 0;       //!< the UL control TTIs reported by the UEs
+
+        /**
+         * Compute a digest of the receptions, which does not depend on the
+         * floating point values and can thus be compared with a reference
+         * value across platforms.
+         *
+         * \return the FNV-1a digest of the receptions
+         */
+        uint64_t GetDigest() const;
+    };
+
+    /**
+     * Constructor
+     * \param numEnbs the number of eNBs
+     * \param uesPerEnb the number of UEs placed close to each eNB
+     * \param interval the time between two packets of a UE in each direction
+     * \param simTime the duration of the simulation
+     */
+    MmWaveTestScenario(uint32_t numEnbs, uint32_t uesPerEnb, Time interval, Time simTime);
+
+    /**
+     * Build the scenario, run the simulation and destroy it.
+     * \return the receptions recorded during the run
+     */
+    Results Run();
+
+  private:
+    /**
+     * Record a packet received by an application.
+     * \param results the results of the run
+     * \param node the ID of the receiving node
+     * \param p the packet
+     * \param from the address of the sender
+     */
+    static void PacketReceived(Results* results,
+                               uint32_t node,
+                               Ptr<const Packet> p,
+                               const Address& from);
+
+    /**
+     * Record a TB received by a PHY.
+     * \param results the results of the run
+     * \param downlink whether the TB was received by a UE
+     * \param params the parameters of the trace
+     */
+    static void TbReceived(Results* results, bool downlink, RxPacketTraceParams params);
+
+    /**
+     * Count the UL control TTIs reported by a UE PHY.
+     * \param results the results of the run
+     * \param params the parameters of the trace
+     */
+    static void UlTransmission(Results* results, PhyTransmissionTraceParams params);
+
+    uint32_t m_numEnbs;   //!< the number of eNBs
+    uint32_t m_uesPerEnb; //!< the number of UEs of each eNB
+    Time m_interval;      //!< the time between two packets of a UE
+    Time m_simTime;       //!< the duration of the simulation
+};
+
+} // namespace mmwave
+
+} // namespace ns3
+
+#endif /* MMWAVE_TEST_SCENARIO_H */
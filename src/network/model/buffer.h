@@ -767,9 +767,9 @@ class Buffer
     /**
      * location in a newly-allocated buffer where you should start
      * writing data. i.e., m_start should be initialized to this
-     * value.
+     * value. Like the free list, it is kept by each thread.
      */
-    static uint32_t g_recommendedStart;
+    static thread_local uint32_t g_recommendedStart;
 
     /**
      * offset to the start of the virtual zero area from the start
@@ -802,9 +802,12 @@ class Buffer
         ~LocalStaticDestructor();
     };
 
-    static uint32_t g_maxSize;                            //!< Max observed data size
-    static FreeList* g_freeList;                          //!< Buffer data container
-    static LocalStaticDestructor g_localStaticDestructor; //!< Local static destructor
+    // The free list is kept by each thread, so that the threads of a
+    // MultithreadedSimulatorImpl create and destroy their packets independently.
+    static thread_local uint32_t g_maxSize;   //!< Max observed data size
+    static thread_local FreeList* g_freeList; //!< Buffer data container
+    /// Local static destructor, which releases the free list at the exit of the thread
+    static thread_local LocalStaticDestructor g_localStaticDestructor;
 #endif
 };
 
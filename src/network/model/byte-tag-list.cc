@@ -54,15 +54,15 @@ struct ByteTagListData
  *
  * \brief Container class for struct ByteTagListData
  *
- * Internal use only.
+ * Internal use only. Each thread has its own.
  */
-static class ByteTagListDataFreeList : public std::vector<ByteTagListData*>
+static thread_local class ByteTagListDataFreeList : public std::vector<ByteTagListData*>
 {
   public:
     ~ByteTagListDataFreeList();
 } g_freeList; //!< Container for struct ByteTagListData
 
-static uint32_t g_maxSize = 0; //!< maximum data size (used for allocation)
+static thread_local uint32_t g_maxSize = 0; //!< maximum data size (used for allocation)
 
 ByteTagListDataFreeList::~ByteTagListDataFreeList()
 {
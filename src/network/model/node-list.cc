@@ -138,6 +138,7 @@ NodeListPriv::DoGet()
     {
         ptr = CreateObject<NodeListPriv>();
         Config::RegisterRootNamespaceObject(ptr);
+        Config::IndexContainer(ptr, "NodeList");
         Simulator::ScheduleDestroy(&NodeListPriv::Delete);
     }
     return &ptr;
@@ -165,6 +166,7 @@ void
 NodeListPriv::DoDispose()
 {
     NS_LOG_FUNCTION(this);
+    Config::UnindexContainers(this);
     for (auto i = m_nodes.begin(); i != m_nodes.end(); i++)
     {
         Ptr<Node> node = *i;
@@ -181,6 +183,7 @@ NodeListPriv::Add(Ptr<Node> node)
     NS_LOG_FUNCTION(this << node);
     uint32_t index = m_nodes.size();
     m_nodes.push_back(node);
+    Config::NotifyIndexedObjectAdded(this, "NodeList", index, node);
     Simulator::ScheduleWithContext(index, TimeStep(0), &Node::Initialize, node);
     return index;
 }
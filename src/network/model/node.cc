@@ -27,6 +27,7 @@
 
 #include "ns3/assert.h"
 #include "ns3/boolean.h"
+#include "ns3/config.h"
 #include "ns3/global-value.h"
 #include "ns3/log.h"
 #include "ns3/object-vector.h"
@@ -106,6 +107,8 @@ Node::Construct()
 {
     NS_LOG_FUNCTION(this);
     m_id = NodeList::Add(this);
+    Config::IndexContainer(this, "DeviceList");
+    Config::IndexContainer(this, "ApplicationList");
 }
 
 Node::~Node()
@@ -141,6 +144,7 @@ Node::AddDevice(Ptr<NetDevice> device)
     device->SetIfIndex(index);
     device->SetReceiveCallback(MakeCallback(&Node::NonPromiscReceiveFromDevice, this));
     Simulator::ScheduleWithContext(GetId(), Seconds(0.0), &NetDevice::Initialize, device);
+    Config::NotifyIndexedObjectAdded(this, "DeviceList", index, device);
     NotifyDeviceAdded(device);
     return index;
 }
@@ -166,6 +170,7 @@ Node::AddApplication(Ptr<Application> application)
     NS_LOG_FUNCTION(this << application);
     uint32_t index = m_applications.size();
     m_applications.push_back(application);
+    Config::NotifyIndexedObjectAdded(this, "ApplicationList", index, application);
     application->SetNode(this);
     Simulator::ScheduleWithContext(GetId(), Seconds(0.0), &Application::Initialize, application);
     return index;
@@ -192,6 +197,7 @@ Node::DoDispose()
     NS_LOG_FUNCTION(this);
     m_deviceAdditionListeners.clear();
     m_handlers.clear();
+    Config::UnindexContainers(this);
     for (auto i = m_devices.begin(); i != m_devices.end(); i++)
     {
         Ptr<NetDevice> device = *i;
@@ -36,10 +36,11 @@ NS_LOG_COMPONENT_DEFINE("PacketMetadata");
 
 bool PacketMetadata::m_enable = false;
 bool PacketMetadata::m_enableChecking = false;
-bool PacketMetadata::m_metadataSkipped = false;
-uint32_t PacketMetadata::m_maxSize = 0;
-uint16_t PacketMetadata::m_chunkUid = 0;
-PacketMetadata::DataFreeList PacketMetadata::m_freeList;
+std::atomic<bool> PacketMetadata::m_metadataSkipped = false;
+thread_local uint32_t PacketMetadata::m_maxSize = 0;
+thread_local uint16_t PacketMetadata::m_chunkUid = 0;
+thread_local PacketMetadata::DataFreeList PacketMetadata::m_freeList;
+thread_local bool PacketMetadata::m_freeListDestroyed = false;
 
 PacketMetadata::DataFreeList::~DataFreeList()
 {
@@ -48,7 +49,7 @@ PacketMetadata::DataFreeList::~DataFreeList()
     {
         PacketMetadata::Deallocate(*i);
     }
-    PacketMetadata::m_enable = false;
+    PacketMetadata::m_freeListDestroyed = true;
 }
 
 void
@@ -593,7 +594,7 @@ void
 PacketMetadata::Recycle(PacketMetadata::Data* data)
 {
     NS_LOG_FUNCTION(data);
-    if (!m_enable)
+    if (!m_enable || m_freeListDestroyed)
     {
         PacketMetadata::Deallocate(data);
         return;
@@ -661,7 +662,7 @@ PacketMetadata::DoAddHeader(uint32_t uid, uint32_t size)
     NS_LOG_FUNCTION(this << uid << size);
     if (!m_enable)
     {
-        m_metadataSkipped = true;
+        m_metadataSkipped.store(true, std::memory_order_relaxed);
         return;
     }
 
@@ -683,7 +684,7 @@ PacketMetadata::RemoveHeader(const Header& header, uint32_t size)
     NS_LOG_FUNCTION(this << &header << size);
     if (!m_enable)
     {
-        m_metadataSkipped = true;
+        m_metadataSkipped.store(true, std::memory_order_relaxed);
         return;
     }
     PacketMetadata::SmallItem item;
@@ -728,7 +729,7 @@ PacketMetadata::AddTrailer(const Trailer& trailer, uint32_t size)
     NS_LOG_FUNCTION(this << &trailer << size);
     if (!m_enable)
     {
-        m_metadataSkipped = true;
+        m_metadataSkipped.store(true, std::memory_order_relaxed);
         return;
     }
     PacketMetadata::SmallItem item;
@@ -750,7 +751,7 @@ PacketMetadata::RemoveTrailer(const Trailer& trailer, uint32_t size)
     NS_LOG_FUNCTION(this << &trailer << size);
     if (!m_enable)
     {
-        m_metadataSkipped = true;
+        m_metadataSkipped.store(true, std::memory_order_relaxed);
         return;
     }
     PacketMetadata::SmallItem item;
@@ -794,7 +795,7 @@ PacketMetadata::AddAtEnd(const PacketMetadata& o)
     NS_LOG_FUNCTION(this << &o);
     if (!m_enable)
     {
-        m_metadataSkipped = true;
+        m_metadataSkipped.store(true, std::memory_order_relaxed);
         return;
     }
     if (m_tail == 0xffff)
@@ -870,7 +871,7 @@ PacketMetadata::AddPaddingAtEnd(uint32_t end)
     NS_LOG_FUNCTION(this << end);
     if (!m_enable)
     {
-        m_metadataSkipped = true;
+        m_metadataSkipped.store(true, std::memory_order_relaxed);
         return;
     }
 }
@@ -881,7 +882,7 @@ PacketMetadata::RemoveAtStart(uint32_t start)
     NS_LOG_FUNCTION(this << start);
     if (!m_enable)
     {
-        m_metadataSkipped = true;
+        m_metadataSkipped.store(true, std::memory_order_relaxed);
         return;
     }
     NS_ASSERT(m_data != nullptr);
@@ -942,7 +943,7 @@ PacketMetadata::RemoveAtEnd(uint32_t end)
     NS_LOG_FUNCTION(this << end);
     if (!m_enable)
     {
-        m_metadataSkipped = true;
+        m_metadataSkipped.store(true, std::memory_order_relaxed);
         return;
     }
     NS_ASSERT(m_data != nullptr);
@@ -33,6 +33,7 @@
 #include "ns3/mac48-address.h"
 #include "ns3/ptr.h"
 
+#include <atomic>
 #include <stdint.h>
 
 namespace ns3
@@ -787,6 +788,12 @@ class Packet : public SimpleRefCount<Packet>
      */
     uint32_t Deserialize(const uint8_t* buffer, uint32_t size);
 
+    /**
+     * \brief Take the next packet uid.
+     * \returns the uid, unique even among the threads of a MultithreadedSimulatorImpl
+     */
+    static uint32_t NextUid();
+
     Buffer m_buffer;               //!< the packet buffer (it's actual contents)
     ByteTagList m_byteTagList;     //!< the ByteTag list
     PacketTagList m_packetTagList; //!< the packet's Tag list
@@ -795,7 +802,7 @@ class Packet : public SimpleRefCount<Packet>
     /* Please see comments above about nix-vector */
     mutable Ptr<NixVector> m_nixVector; //!< the packet's Nix vector
 
-    static uint32_t m_globalUid; //!< Global counter of packets Uid
+    static std::atomic<uint32_t> m_globalUid; //!< Global counter of packets Uid
 };
 
 /**
@@ -20,10 +20,13 @@
 #include "point-to-point-net-device.h"
 
 #include "ns3/log.h"
+#include "ns3/multithreaded-simulator-impl.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -82,6 +85,15 @@ PointToPointChannel::Attach(Ptr<PointToPointNetDevice> device)
         m_link[1].m_dst = m_link[0].m_src;
         m_link[0].m_state = IDLE;
         m_link[1].m_state = IDLE;
+
+        Ptr<Node> nodeA = m_link[0].m_src->GetNode();
+        Ptr<Node> nodeB = m_link[1].m_src->GetNode();
+        if (nodeA && nodeB)
+        {
+            m_link[0].m_dstContext = nodeB->GetId();
+            m_link[1].m_dstContext = nodeA->GetId();
+            MultithreadedSimulatorImpl::DeclareLookAhead(nodeA->GetId(), nodeB->GetId(), m_delay);
+        }
     }
 }
 
@@ -95,8 +107,27 @@ PointToPointChannel::TransmitStart(Ptr<const Packet> p, Ptr<PointToPointNetDevic
     NS_ASSERT(m_link[1].m_state != INITIALIZING);
 
     uint32_t wire = src == m_link[0].m_src ? 0 : 1;
+    uint32_t context = m_link[wire].m_dstContext;
+    if (context == Simulator::NO_CONTEXT)
+    {
+        context = m_link[wire].m_dst->GetNode()->GetId();
+    }
 
-    Simulator::ScheduleWithContext(m_link[wire].m_dst->GetNode()->GetId(),
+    if (MultithreadedSimulatorImpl::IsRemoteContext(context))
+    {
+        // The destination is run by another thread, which must not share the
+        // reference counts of the packet and of its device with this one
+        std::vector<uint8_t> buffer(p->GetSerializedSize());
+        p->Serialize(buffer.data(), buffer.size());
+        Simulator::ScheduleWithContext(context,
+                                       txTime + m_delay,
+                                       &PointToPointNetDevice::Receive,
+                                       PeekPointer(m_link[wire].m_dst),
+                                       Create<Packet>(buffer.data(), buffer.size(), true));
+        return true;
+    }
+
+    Simulator::ScheduleWithContext(context,
                                    txTime + m_delay,
                                    &PointToPointNetDevice::Receive,
                                    m_link[wire].m_dst,
@@ -129,6 +160,15 @@ PointToPointChannel::GetDevice(std::size_t i) const
     return GetPointToPointDevice(i);
 }
 
+Address
+PointToPointChannel::GetRemoteAddress(const PointToPointNetDevice* device) const
+{
+    NS_LOG_FUNCTION(this << device);
+    NS_ASSERT(m_nDevices == N_DEVICES);
+    return PeekPointer(m_link[0].m_src) == device ? m_link[1].m_src->GetAddress()
+                                                   : m_link[0].m_src->GetAddress();
+}
+
 Time
 PointToPointChannel::GetDelay() const
 {
@@ -18,10 +18,12 @@
 #ifndef POINT_TO_POINT_CHANNEL_H
 #define POINT_TO_POINT_CHANNEL_H
 
+#include "ns3/address.h"
 #include "ns3/channel.h"
 #include "ns3/data-rate.h"
 #include "ns3/nstime.h"
 #include "ns3/ptr.h"
+#include "ns3/simulator.h"
 #include "ns3/traced-callback.h"
 
 #include <list>
@@ -45,6 +47,14 @@ class Packet;
  * [0] wire to transmit on.  The second device gets the [1] wire.  There is a
  * state (IDLE, TRANSMITTING) associated with each wire.
  *
+ * The channel can connect nodes run by different threads of a
+ * MultithreadedSimulatorImpl.  When the second device is attached, the
+ * delay is declared as the lookahead between the nodes of the devices, if
+ * they are known, as with the PointToPointHelper.  The packets for a node of
+ * another partition are serialized and deserialized, as with MPI, so that the
+ * two threads do not share them, and the TxRxPointToPoint trace is not fired
+ * for them, since its arguments reference both devices.
+ *
  * \see Attach
  * \see TransmitStart
  */
@@ -101,6 +111,17 @@ class PointToPointChannel : public Channel
      */
     Ptr<NetDevice> GetDevice(std::size_t i) const override;
 
+    /**
+     * \brief Get the address of the other device of this channel
+     *
+     * Unlike GetPointToPointDevice(), it does not take a reference to the other
+     * device, which may be run by another thread of a MultithreadedSimulatorImpl.
+     *
+     * \param device a device of this channel
+     * \returns the address of the other device
+     */
+    Address GetRemoteAddress(const PointToPointNetDevice* device) const;
+
   protected:
     /**
      * \brief Get the delay associated with this channel
@@ -202,6 +223,8 @@ class PointToPointChannel : public Channel
         WireState m_state{INITIALIZING};  //!< State of the link
         Ptr<PointToPointNetDevice> m_src; //!< First NetDevice
         Ptr<PointToPointNetDevice> m_dst; //!< Second NetDevice
+        /** Context of the node of the second NetDevice, if known at Attach */
+        uint32_t m_dstContext{Simulator::NO_CONTEXT};
     };
 
     Link m_link[N_DEVICES]; //!< Link model
@@ -17,14 +17,21 @@
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
 
+#include "ns3/config.h"
 #include "ns3/drop-tail-queue.h"
+#include "ns3/multithreaded-simulator-impl.h"
 #include "ns3/net-device-queue-interface.h"
 #include "ns3/point-to-point-channel.h"
+#include "ns3/point-to-point-helper.h"
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/simulator.h"
+#include "ns3/string.h"
 #include "ns3/test.h"
+#include "ns3/uinteger.h"
 
 #include <string>
+#include <tuple>
+#include <vector>
 
 using namespace ns3;
 
@@ -139,6 +146,179 @@ PointToPointTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \brief Test class for a PointToPointChannel between two partitions of a
+ * MultithreadedSimulatorImpl
+ *
+ * Two nodes, run by different threads, send packets to each other. The
+ * receptions must be those of the DefaultSimulatorImpl.
+ */
+class PointToPointMultithreadedTest : public TestCase
+{
+  public:
+    /**
+     * \brief Create the test
+     */
+    PointToPointMultithreadedTest();
+
+  private:
+    /**
+     * \brief Run the test
+     */
+    void DoRun() override;
+    /**
+     * \brief Restore the simulator implementation
+     */
+    void DoTeardown() override;
+
+    /// A reception: the time in ns, the size and the first byte of the packet
+    typedef std::tuple<int64_t, uint32_t, uint8_t> Reception;
+
+    /**
+     * \brief Run the exchange of packets
+     *
+     * \param simulatorType The simulator implementation.
+     * \return the receptions of the two nodes
+     */
+    std::vector<std::vector<Reception>> RunExchange(const std::string& simulatorType);
+    /**
+     * \brief Send a packet filled with its index, and schedule the next one
+     *
+     * \param device NetDevice to send from.
+     * \param index Index of the packet.
+     */
+    void Send(Ptr<PointToPointNetDevice> device, uint8_t index);
+    /**
+     * \brief Callback function which records the received packet
+     *
+     * \param dev The receiving device.
+     * \param pkt The received packet.
+     * \param mode The protocol mode used.
+     * \param sender The sender address.
+     *
+     * \return A boolean indicating packet handled properly.
+     */
+    bool RxPacket(Ptr<NetDevice> dev, Ptr<const Packet> pkt, uint16_t mode, const Address& sender);
+
+    uint32_t m_firstNode;                             //!< the id of the first node
+    std::vector<std::vector<Reception>> m_receptions; //!< the receptions of each node
+};
+
+PointToPointMultithreadedTest::PointToPointMultithreadedTest()
+    : TestCase("PointToPoint between two partitions of a MultithreadedSimulatorImpl"),
+      m_firstNode(0)
+{
+}
+
+void
+PointToPointMultithreadedTest::Send(Ptr<PointToPointNetDevice> device, uint8_t index)
+{
+    std::vector<uint8_t> buffer(200 + 7 * index, index);
+    device->Send(Create<Packet>(buffer.data(), buffer.size()), device->GetBroadcast(), 0x800);
+    if (index < 100)
+    {
+        Simulator::Schedule(MicroSeconds(700),
+                            &PointToPointMultithreadedTest::Send,
+                            this,
+                            device,
+                            index + 1);
+    }
+}
+
+bool
+PointToPointMultithreadedTest::RxPacket(Ptr<NetDevice> dev,
+                                        Ptr<const Packet> pkt,
+                                        uint16_t mode,
+                                        const Address& sender)
+{
+    // each node is run by a single thread, which only writes its receptions
+    uint8_t first = 0;
+    pkt->CopyData(&first, 1);
+    m_receptions[dev->GetNode()->GetId() == m_firstNode ? 0 : 1].emplace_back(
+        Simulator::Now().GetNanoSeconds(),
+        pkt->GetSize(),
+        first);
+    return true;
+}
+
+std::vector<std::vector<PointToPointMultithreadedTest::Reception>>
+PointToPointMultithreadedTest::RunExchange(const std::string& simulatorType)
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue(simulatorType));
+    Config::SetDefault("ns3::MultithreadedSimulatorImpl::PartitionCount", UintegerValue(2));
+
+    NodeContainer nodes;
+    nodes.Create(2);
+    m_firstNode = nodes.Get(0)->GetId();
+    Ptr<MultithreadedSimulatorImpl> impl =
+        DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+    if (impl)
+    {
+        impl->SetPartition(nodes.Get(0)->GetId(), 0);
+        impl->SetPartition(nodes.Get(1)->GetId(), 1);
+    }
+
+    PointToPointHelper p2p;
+    p2p.SetDeviceAttribute("DataRate", StringValue("5Mbps"));
+    p2p.SetChannelAttribute("Delay", StringValue("2ms"));
+    NetDeviceContainer devices = p2p.Install(nodes);
+    if (impl)
+    {
+        // the channel declares its delay
+        NS_TEST_EXPECT_MSG_EQ(impl->GetLookAhead(), MilliSeconds(2), "wrong lookahead");
+    }
+
+    m_receptions.assign(2, {});
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        Ptr<PointToPointNetDevice> device = DynamicCast<PointToPointNetDevice>(devices.Get(i));
+        device->SetReceiveCallback(MakeCallback(&PointToPointMultithreadedTest::RxPacket, this));
+        Simulator::ScheduleWithContext(nodes.Get(i)->GetId(),
+                                       MicroSeconds(100 + 300 * i),
+                                       &PointToPointMultithreadedTest::Send,
+                                       this,
+                                       device,
+                                       0);
+    }
+
+    Simulator::Stop(Seconds(1));
+    Simulator::Run();
+    Simulator::Destroy();
+    return m_receptions;
+}
+
+void
+PointToPointMultithreadedTest::DoRun()
+{
+    auto expected = RunExchange("ns3::DefaultSimulatorImpl");
+    auto receptions = RunExchange("ns3::MultithreadedSimulatorImpl");
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        NS_TEST_ASSERT_MSG_EQ(expected[i].size(), 101, "wrong number of packets of node " << i);
+        NS_TEST_ASSERT_MSG_EQ(receptions[i].size(),
+                              expected[i].size(),
+                              "wrong number of packets of node " << i);
+        for (std::size_t k = 0; k < expected[i].size(); ++k)
+        {
+            NS_TEST_EXPECT_MSG_EQ(std::get<0>(receptions[i][k]),
+                                  std::get<0>(expected[i][k]),
+                                  "wrong reception time of node " << i);
+            NS_TEST_EXPECT_MSG_EQ(std::get<1>(receptions[i][k]),
+                                  std::get<1>(expected[i][k]),
+                                  "wrong packet size of node " << i);
+            NS_TEST_EXPECT_MSG_EQ(+std::get<2>(receptions[i][k]),
+                                  +std::get<2>(expected[i][k]),
+                                  "wrong packet content of node " << i);
+        }
+    }
+}
+
+void
+PointToPointMultithreadedTest::DoTeardown()
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue("ns3::DefaultSimulatorImpl"));
+}
+
 /**
  * \brief TestSuite for PointToPoint module
  */
@@ -155,6 +335,7 @@ PointToPointTestSuite::PointToPointTestSuite()
     : TestSuite("devices-point-to-point", Type::UNIT)
 {
     AddTestCase(new PointToPointTest, TestCase::Duration::QUICK);
+    AddTestCase(new PointToPointMultithreadedTest, TestCase::Duration::QUICK);
 }
 
 static PointToPointTestSuite g_pointToPointTestSuite; //!< The testsuite
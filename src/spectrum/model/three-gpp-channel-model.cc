@@ -2609,10 +2609,8 @@ ThreeGppChannelModel::GenerateChannelParameters(const Ptr<const ChannelCondition
     }
 
     // Generate paramNum independent LSPs.
-    for (uint8_t iter = 0; iter < paramNum; iter++)
-    {
-        LSPsIndep.push_back(m_normalRv->GetValue());
-    }
+    LSPsIndep.resize(paramNum);
+    m_normalRv->GetValues(LSPsIndep);
     for (uint8_t row = 0; row < paramNum; row++)
     {
         double temp = 0;
@@ -3073,21 +3071,25 @@ ThreeGppChannelModel::GenerateChannelParameters(const Ptr<const ChannelCondition
     // store the PHI values for all the possible combination of polarization
     clusterPhase.resize(channelParams->m_reducedClusterNumber);
     crossPolarizationPowerRatios.resize(channelParams->m_reducedClusterNumber);
+    // m_normalRv and m_uniformRv are independent streams, so the values of
+    // each cluster are drawn in bulk from each stream.
+    DoubleVector phases(4 * table3gpp->m_raysPerCluster);
     for (uint8_t nInd = 0; nInd < channelParams->m_reducedClusterNumber; nInd++)
     {
         clusterPhase[nInd].resize(table3gpp->m_raysPerCluster);
         crossPolarizationPowerRatios[nInd].resize(table3gpp->m_raysPerCluster);
+        m_normalRv->GetValues(crossPolarizationPowerRatios[nInd]);
+        m_uniformRv->GetValues(phases, -1 * M_PI, M_PI);
         for (uint8_t mInd = 0; mInd < table3gpp->m_raysPerCluster; mInd++)
         {
-            clusterPhase[nInd][mInd].resize(4);
             // used to store the XPR values
             crossPolarizationPowerRatios[nInd][mInd] =
-                std::pow(10, (m_normalRv->GetValue() * sigXprLinear + uXprLinear) / 10.0);
-            for (uint8_t pInd = 0; pInd < 4; pInd++)
-            {
-                // used to store the PHI values
-                clusterPhase[nInd][mInd][pInd] = m_uniformRv->GetValue(-1 * M_PI, M_PI);
-            }
+                std::pow(10,
+                         (crossPolarizationPowerRatios[nInd][mInd] * sigXprLinear + uXprLinear) /
+                             10.0);
+            // used to store the PHI values
+            clusterPhase[nInd][mInd].assign(phases.begin() + 4 * mInd,
+                                            phases.begin() + 4 * (mInd + 1));
         }
     }
 
@@ -18,7 +18,9 @@
  */
 
 #include "ns3/core-module.h"
+#include "ns3/event-trace.h"
 
+#include <algorithm>
 #include <cmath> // sqrt
 #include <fstream>
 #include <iomanip>
@@ -103,10 +105,12 @@ class Bench
     /** The output. */
     struct Result
     {
-        double init;     /**< Time (s) for initialization. */
-        double simu;     /**< Time (s) for simulation. */
-        uint64_t pop;    /**< Event population. */
-        uint64_t events; /**< Number of events executed. */
+        double init;              /**< Time (s) for initialization. */
+        double simu;              /**< Time (s) for simulation. */
+        uint64_t pop;             /**< Event population. */
+        uint64_t events;          /**< Number of events executed. */
+        uint64_t allocations;     /**< Number of events allocated during the simulation. */
+        uint64_t heapAllocations; /**< Number of those allocated from the heap. */
     };
 
     /**
@@ -150,14 +154,16 @@ Bench::Run()
     DEB("initialization took " << init << "s");
 
     DEB("running");
+    EventImpl::ResetAllocationCounts();
     timer.Start();
     Simulator::Run();
     simu = timer.End() / 1000.0;
     DEB("run took " << simu << "s");
+    auto allocs = EventImpl::GetAllocationCounts();
 
     Simulator::Destroy();
 
-    return Result{init, simu, m_population, m_count};
+    return Result{init, simu, m_population, m_count, allocs.allocations, allocs.heapAllocations};
 }
 
 void
@@ -241,6 +247,9 @@ class BenchSuite
 
     std::string m_scheduler;       /**< Descriptive string for the scheduler. */
     std::vector<Result> m_results; /**< Store for the run results. */
+    uint64_t m_events;             /**< Number of events executed in the runs. */
+    uint64_t m_allocations;        /**< Number of events allocated in the runs. */
+    uint64_t m_heapAllocations;    /**< Number of those allocated from the heap. */
 
 }; // BenchSuite
 
@@ -270,6 +279,9 @@ BenchSuite::BenchSuite(ObjectFactory& factory,
                        uint64_t runs,
                        Ptr<RandomVariableStream> eventStream,
                        bool calRev)
+    : m_events(0),
+      m_allocations(0),
+      m_heapAllocations(0)
 {
     Simulator::SetScheduler(factory);
 
@@ -302,6 +314,9 @@ BenchSuite::BenchSuite(ObjectFactory& factory,
         auto run = bench.Run();
         m_results.push_back(Result::Bench(run));
         m_results.back().Log(i);
+        m_events += run.events;
+        m_allocations += run.allocations;
+        m_heapAllocations += run.heapAllocations;
     }
 
     Simulator::Destroy();
@@ -331,6 +346,12 @@ BenchSuite::Header() const
 void
 BenchSuite::Log() const
 {
+    if (m_events > 0)
+    {
+        double heapShare = 100.0 * m_heapAllocations / std::max<uint64_t>(m_allocations, 1);
+        LOG("Event allocations: " << (double)m_allocations / m_events << " per event, "
+                                  << heapShare << " % from the heap");
+    }
     if (m_results.size() < 2)
     {
         LOG("");
@@ -387,6 +408,190 @@ BenchSuite::Log() const
 
 } // BenchSuite::Log()
 
+/**
+ *  Replay of an event trace against a scheduler, for an ensemble of runs.
+ *
+ *  The operations of the trace are applied directly to the scheduler,
+ *  without running any event, so that only the cost of the scheduler
+ *  is measured.
+ */
+class ReplaySuite
+{
+  public:
+    /**
+     * Perform the runs for a single scheduler type.
+     *
+     * \param [in] factory Factory pre-configured to create the desired Scheduler.
+     * \param [in] trace The operations to replay.
+     * \param [in] runs The number of replications.
+     */
+    ReplaySuite(ObjectFactory& factory,
+                const std::vector<EventTrace::Record>& trace,
+                uint64_t runs);
+
+    /** Write the results to \c LOG() */
+    void Log() const;
+
+  private:
+    std::string m_scheduler;    /**< Descriptive string for the scheduler. */
+    std::vector<double> m_time; /**< Time (s) of each run. */
+    uint64_t m_operations;      /**< Number of operations per run. */
+
+}; // class ReplaySuite
+
+ReplaySuite::ReplaySuite(ObjectFactory& factory,
+                         const std::vector<EventTrace::Record>& trace,
+                         uint64_t runs)
+    : m_scheduler(factory.GetTypeId().GetName()),
+      m_operations(trace.size())
+{
+    LOG("");
+    LOG(m_scheduler);
+    LOG(std::left << std::setw(g_fwidth) << "Run #" << std::setw(g_fwidth) << "Time (s)"
+                  << std::setw(g_fwidth) << "Rate (op/s)"
+                  << "Per (s/op)");
+
+    // the first run primes the caches and the allocators
+    for (uint64_t i = 0; i <= runs; ++i)
+    {
+        Ptr<Scheduler> scheduler = factory.Create<Scheduler>();
+        SystemWallClockMs timer;
+        timer.Start();
+        for (const auto& record : trace)
+        {
+            switch (record.operation)
+            {
+            case EventTrace::INSERT:
+                scheduler->Insert(Scheduler::Event{nullptr, record.key});
+                break;
+            case EventTrace::REMOVE_NEXT: {
+                Scheduler::Event ev = scheduler->RemoveNext();
+                NS_ABORT_MSG_IF(ev.key.m_ts != record.key.m_ts,
+                                m_scheduler << " does not follow the trace");
+                break;
+            }
+            case EventTrace::REMOVE:
+                scheduler->Remove(Scheduler::Event{nullptr, record.key});
+                break;
+            default:
+                break;
+            }
+        }
+        double time = timer.End() / 1000.0;
+        if (i == 0)
+        {
+            DEB("priming took " << time << "s");
+            continue;
+        }
+        m_time.push_back(time);
+        LOG(std::left << std::setw(g_fwidth) << i - 1 << std::setw(g_fwidth) << time
+                      << std::setw(g_fwidth) << m_operations / time << time / m_operations);
+    }
+}
+
+void
+ReplaySuite::Log() const
+{
+    if (m_time.size() < 2)
+    {
+        LOG("");
+        return;
+    }
+    double sum = 0;
+    double sum2 = 0;
+    for (auto time : m_time)
+    {
+        sum += time;
+        sum2 += time * time;
+    }
+    double average = sum / m_time.size();
+    double stdev = std::sqrt(std::max(sum2 / m_time.size() - average * average, 0.0));
+    LOG(std::left << std::setw(g_fwidth) << "average" << std::setw(g_fwidth) << average
+                  << std::setw(g_fwidth) << m_operations / average << average / m_operations);
+    LOG(std::left << std::setw(g_fwidth) << "stdev" << std::setw(g_fwidth) << stdev);
+    LOG("");
+}
+
+/**
+ *  Load the operations on the event list of an event trace, such as
+ *  recorded by the DefaultSimulatorImpl with its \c EventTraceFile attribute.
+ *  The cancellations, which do not involve the scheduler, are dropped.
+ *
+ *  \param [in] filename The event trace file name.
+ *  \returns The operations.
+ */
+std::vector<EventTrace::Record>
+LoadEventTrace(const std::string& filename)
+{
+    LOG("  Event trace:                  " << filename);
+    EventTraceReader reader(filename);
+    std::vector<EventTrace::Record> trace;
+    uint64_t inserts = 0;
+    uint64_t cancels = 0;
+    EventTrace::Record record;
+    while (reader.Read(record))
+    {
+        if (record.operation == EventTrace::CANCEL)
+        {
+            ++cancels;
+            continue;
+        }
+        inserts += (record.operation == EventTrace::INSERT);
+        trace.push_back(record);
+    }
+    LOG("    Found " << inserts << " insertions, " << trace.size() - inserts << " removals, "
+                     << cancels << " cancellations");
+    return trace;
+}
+
+/**
+ *  Create a RandomVariableStream with the event delays of a slotted radio
+ *  access network, such as the mmWave module.
+ *
+ *  The delays are multiples of the OFDM symbol period of numerology 3
+ *  (14 symbols per 125 us slot), so that all the events fall on the symbol
+ *  boundaries, in bursts of events with the same timestamp.  Most events
+ *  are scheduled for the next symbol or slot, some a few slots ahead (HARQ
+ *  feedback, scheduling delays) and a few far in the future (RRC and
+ *  statistics timers).
+ *
+ *  \returns The RandomVariableStream.
+ */
+Ptr<RandomVariableStream>
+GetSlottedStream()
+{
+    LOG("  Event time distribution:      slotted (symbol boundaries of numerology 3)");
+    const uint64_t symbol = 8928;
+    const uint64_t slot = 14 * symbol;
+
+    auto urv = CreateObject<UniformRandomVariable>();
+    urv->SetStream(1);
+    std::vector<double> nsValues(100000);
+    for (auto& value : nsValues)
+    {
+        double choice = urv->GetValue();
+        if (choice < 0.6)
+        {
+            value = symbol;
+        }
+        else if (choice < 0.9)
+        {
+            value = slot;
+        }
+        else if (choice < 0.98)
+        {
+            value = urv->GetInteger(2, 8) * slot;
+        }
+        else
+        {
+            value = urv->GetInteger(80, 1600) * slot;
+        }
+    }
+    auto drv = CreateObject<DeterministicRandomVariable>();
+    drv->SetValueArray(&nsValues[0], nsValues.size());
+    return drv;
+}
+
 /**
  *  Create a RandomVariableStream to generate next event delays.
  *
@@ -457,6 +662,7 @@ main(int argc, char* argv[])
     bool allSched = false;
     bool schedCal = false;
     bool schedHeap = false;
+    bool schedLadder = false;
     bool schedList = false;
     bool schedMap = false; // default scheduler
     bool schedPQ = false;
@@ -465,6 +671,8 @@ main(int argc, char* argv[])
     uint64_t total = 1000000;
     uint64_t runs = 1;
     std::string filename = "";
+    bool slotted = false;
+    std::string replay = "";
     bool calRev = false;
 
     CommandLine cmd(__FILE__);
@@ -474,14 +682,20 @@ main(int argc, char* argv[])
               "  an exponential distribution, with mean 100 ns,\n"
               "  an ascii file, given by the --file=\"<filename>\" argument,\n"
               "  or standard input, by the argument --file=\"-\"\n"
+              "  or a slotted distribution like the mmWave module, by --slotted\n"
               "In the case of either --file form, the input is expected\n"
               "to be ascii, giving the relative event times in ns.\n"
               "\n"
+              "Alternatively, --replay=\"<filename>\" replays against the\n"
+              "schedulers an event trace recorded by the DefaultSimulatorImpl\n"
+              "(see its EventTraceFile attribute).\n"
+              "\n"
               "If no scheduler is specified the MapScheduler will be run.");
     cmd.AddValue("all", "use all schedulers", allSched);
     cmd.AddValue("cal", "use CalendarScheduler", schedCal);
     cmd.AddValue("calrev", "reverse ordering in the CalendarScheduler", calRev);
     cmd.AddValue("heap", "use HeapScheduler", schedHeap);
+    cmd.AddValue("ladder", "use LadderScheduler", schedLadder);
     cmd.AddValue("list", "use ListScheduler", schedList);
     cmd.AddValue("map", "use MapScheduler (default)", schedMap);
     cmd.AddValue("pri", "use PriorityQueue", schedPQ);
@@ -490,6 +704,8 @@ main(int argc, char* argv[])
     cmd.AddValue("total", "total number of events to run", total);
     cmd.AddValue("runs", "number of runs", runs);
     cmd.AddValue("file", "file of relative event times", filename);
+    cmd.AddValue("slotted", "use a slotted event time distribution", slotted);
+    cmd.AddValue("replay", "event trace to replay", replay);
     cmd.AddValue("prec", "printed output precision", g_fwidth);
     cmd.Parse(argc, argv);
 
@@ -498,39 +714,68 @@ main(int argc, char* argv[])
 
     LOG(std::setprecision(g_fwidth - 6)); // prints blank line
     LOGME(" Benchmark the simulator scheduler");
-    LOG("  Event population size:        " << pop);
-    LOG("  Total events per run:         " << total);
+    if (replay.empty())
+    {
+        LOG("  Event population size:        " << pop);
+        LOG("  Total events per run:         " << total);
+    }
     LOG("  Number of runs per scheduler: " << runs);
     DEB("debugging is ON");
 
     if (allSched)
     {
-        schedCal = schedHeap = schedList = schedMap = schedPQ = true;
+        schedCal = schedHeap = schedLadder = schedList = schedMap = schedPQ = true;
     }
     // Set the default case if nothing else is set
-    if (!(schedCal || schedHeap || schedList || schedMap || schedPQ))
+    if (!(schedCal || schedHeap || schedLadder || schedList || schedMap || schedPQ))
     {
         schedMap = true;
     }
 
-    auto eventStream = GetRandomStream(filename);
+    std::vector<EventTrace::Record> trace;
+    Ptr<RandomVariableStream> eventStream;
+    if (!replay.empty())
+    {
+        trace = LoadEventTrace(replay);
+    }
+    else
+    {
+        eventStream = slotted ? GetSlottedStream() : GetRandomStream(filename);
+    }
+
+    // Run the benchmark, or the replay, with a scheduler
+    auto run = [&](ObjectFactory& schedulerFactory, uint64_t events, bool reverse) {
+        if (!replay.empty())
+        {
+            ReplaySuite(schedulerFactory, trace, runs).Log();
+        }
+        else
+        {
+            BenchSuite(schedulerFactory, pop, events, runs, eventStream, reverse).Log();
+        }
+    };
 
     ObjectFactory factory("ns3::MapScheduler");
     if (schedCal)
     {
         factory.SetTypeId("ns3::CalendarScheduler");
         factory.Set("Reverse", BooleanValue(calRev));
-        BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
+        run(factory, total, calRev);
         if (allSched)
         {
             factory.Set("Reverse", BooleanValue(!calRev));
-            BenchSuite(factory, pop, total, runs, eventStream, !calRev).Log();
+            run(factory, total, !calRev);
         }
     }
     if (schedHeap)
     {
         factory.SetTypeId("ns3::HeapScheduler");
-        BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
+        run(factory, total, calRev);
+    }
+    if (schedLadder)
+    {
+        factory.SetTypeId("ns3::LadderScheduler");
+        run(factory, total, calRev);
     }
     if (schedList)
     {
@@ -541,17 +786,17 @@ main(int argc, char* argv[])
             LOG("Running List scheduler with 1/10 total events");
             listTotal /= 10;
         }
-        BenchSuite(factory, pop, listTotal, runs, eventStream, calRev).Log();
+        run(factory, listTotal, calRev);
     }
     if (schedMap)
     {
         factory.SetTypeId("ns3::MapScheduler");
-        BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
+        run(factory, total, calRev);
     }
     if (schedPQ)
     {
         factory.SetTypeId("ns3::PriorityQueueScheduler");
-        BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
+        run(factory, total, calRev);
     }
 
     return 0;
@@ -0,0 +1,137 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the cost of the Config path resolution on a large
+// NodeList.  Each node holds a few SimpleNetDevices; the program connects a
+// trace sink and sets an attribute on one device of every node through an
+// explicit path, as the helpers do for each new UE, then resolves a few
+// wildcard paths over the whole NodeList.
+// Sample usage:  ./ns3 run 'perf-config-path --nodes=10000 --index=0'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+using namespace ns3;
+
+/**
+ * \ingroup system-tests-perf
+ *
+ * Trace sink of the benchmark.
+ *
+ * \param context the trace context
+ * \param packet the dropped packet
+ */
+void
+PhyRxDrop(std::string context, Ptr<const Packet> packet)
+{
+}
+
+/**
+ * \ingroup system-tests-perf
+ *
+ * Wall clock time since a given instant.
+ *
+ * \param start the instant
+ * \returns the time in seconds
+ */
+double
+SecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nNodes = 10000;
+    uint32_t nDevices = 2;
+    uint32_t nWildcards = 10;
+    bool index = true;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nodes", "Number of nodes", nNodes);
+    cmd.AddValue("devices", "Number of devices per node", nDevices);
+    cmd.AddValue("wildcards", "Number of resolutions of each wildcard path", nWildcards);
+    cmd.AddValue("index", "Index the NodeList and DeviceList containers", index);
+    cmd.Parse(argc, argv);
+
+    auto start = std::chrono::steady_clock::now();
+    NodeContainer nodes;
+    nodes.Create(nNodes);
+    for (uint32_t i = 0; i < nNodes; ++i)
+    {
+        for (uint32_t j = 0; j < nDevices; ++j)
+        {
+            nodes.Get(i)->AddDevice(CreateObject<SimpleNetDevice>());
+        }
+        if (!index)
+        {
+            Config::UnindexContainers(PeekPointer(nodes.Get(i)));
+        }
+    }
+    if (!index)
+    {
+        for (std::size_t i = 0; i < Config::GetRootNamespaceObjectN(); ++i)
+        {
+            Config::UnindexContainers(PeekPointer(Config::GetRootNamespaceObject(i)));
+        }
+    }
+    double createSeconds = SecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < nNodes; ++i)
+    {
+        std::ostringstream oss;
+        oss << "/NodeList/" << i << "/DeviceList/" << nDevices - 1
+            << "/$ns3::SimpleNetDevice/PhyRxDrop";
+        Config::Connect(oss.str(), MakeCallback(&PhyRxDrop));
+    }
+    double connectSeconds = SecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < nNodes; ++i)
+    {
+        std::ostringstream oss;
+        oss << "/NodeList/" << i << "/DeviceList/0/$ns3::SimpleNetDevice/PointToPointMode";
+        Config::Set(oss.str(), BooleanValue(true));
+    }
+    double setSeconds = SecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    std::size_t matches = 0;
+    for (uint32_t i = 0; i < nWildcards; ++i)
+    {
+        matches += Config::LookupMatches("/NodeList/*/DeviceList/*").GetN();
+        matches += Config::LookupMatches("/NodeList/[0-99]/DeviceList/0").GetN();
+    }
+    double wildcardSeconds = SecondsSince(start);
+
+    std::cout << argv[0] << ": " << nNodes << " nodes, " << nDevices << " devices per node, "
+              << (index ? "indexed" : "not indexed") << std::endl;
+    std::cout << "  create: " << createSeconds << " s" << std::endl;
+    std::cout << "  connect: " << connectSeconds << " s, " << connectSeconds / nNodes * 1e6
+              << " us per path" << std::endl;
+    std::cout << "  set: " << setSeconds << " s, " << setSeconds / nNodes * 1e6 << " us per path"
+              << std::endl;
+    std::cout << "  wildcards: " << wildcardSeconds << " s, " << matches << " matches"
+              << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
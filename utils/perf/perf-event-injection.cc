@@ -0,0 +1,203 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the rate at which other threads can inject events
+// into a running simulation with Simulator::ScheduleWithContext, as the
+// reader threads of FdNetDevice and TapBridge do for every received frame.
+// The producer threads inject their events as fast as they can, while the
+// simulation runs a periodic event; the program reports the rate at which
+// the injected events are run, and the time spent by the producers in
+// ScheduleWithContext.
+// Sample usage:  ./ns3 run 'perf-event-injection --producers=4 --realtime=1'
+
+#include "ns3/core-module.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup system-tests-perf
+ *
+ * The producer threads and the receiver of their events.
+ */
+class InjectionWorkload
+{
+  public:
+    /**
+     * Constructor.
+     *
+     * \param producers The number of producer threads.
+     * \param events The number of events injected by each producer.
+     * \param tick The period of the event of the simulation.
+     */
+    InjectionWorkload(uint32_t producers, uint64_t events, Time tick)
+        : m_producers(producers),
+          m_events(events),
+          m_tick(tick),
+          m_received(0),
+          m_checksum(0),
+          m_producerSeconds(0)
+    {
+    }
+
+    /** Start the producers from the simulation, and the periodic event. */
+    void Start()
+    {
+        m_start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < m_producers; ++i)
+        {
+            m_threads.emplace_back(&InjectionWorkload::Produce, this, i);
+        }
+        Tick();
+    }
+
+    /** Wait for the producers. */
+    void Join()
+    {
+        for (auto& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    /** \returns the wall-clock time from the start to the last injected event, in seconds */
+    double GetSeconds() const
+    {
+        return std::chrono::duration<double>(m_end - m_start).count();
+    }
+
+    /** \returns the time spent by the producers in ScheduleWithContext, in seconds */
+    double GetProducerSeconds() const
+    {
+        return m_producerSeconds;
+    }
+
+    /** \returns the number of injected events run */
+    uint64_t GetReceived() const
+    {
+        return m_received;
+    }
+
+    /** \returns the sum of the values of the injected events */
+    uint64_t GetChecksum() const
+    {
+        return m_checksum;
+    }
+
+  private:
+    /**
+     * Inject the events of a producer.
+     * \param producer The producer.
+     */
+    void Produce(uint32_t producer)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < m_events; ++i)
+        {
+            Simulator::ScheduleWithContext(producer,
+                                           Time(0),
+                                           &InjectionWorkload::Receive,
+                                           this,
+                                           producer + i);
+        }
+        double seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        double expected = m_producerSeconds.load();
+        while (!m_producerSeconds.compare_exchange_weak(expected, expected + seconds))
+        {
+        }
+    }
+
+    /**
+     * An injected event.
+     * \param value The value of the event.
+     */
+    void Receive(uint64_t value)
+    {
+        m_checksum += value;
+        if (++m_received == m_events * m_producers)
+        {
+            m_end = std::chrono::steady_clock::now();
+            Simulator::Stop();
+        }
+    }
+
+    /** The periodic event of the simulation. */
+    void Tick()
+    {
+        Simulator::Schedule(m_tick, &InjectionWorkload::Tick, this);
+    }
+
+    uint32_t m_producers;                          //!< The number of producers.
+    uint64_t m_events;                             //!< The events per producer.
+    Time m_tick;                                   //!< The period of the periodic event.
+    uint64_t m_received;                           //!< The number of injected events run.
+    uint64_t m_checksum;                           //!< The sum of the injected values.
+    std::atomic<double> m_producerSeconds;         //!< The time spent by the producers.
+    std::vector<std::thread> m_threads;            //!< The producer threads.
+    std::chrono::steady_clock::time_point m_start; //!< The start of the producers.
+    std::chrono::steady_clock::time_point m_end;   //!< The last injected event.
+};
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t producers = 2;
+    uint64_t events = 1000000;
+    bool realtime = false;
+    Time tick = MicroSeconds(10);
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("producers", "Number of producer threads", producers);
+    cmd.AddValue("events", "Number of events injected by each producer", events);
+    cmd.AddValue("realtime", "Use the RealtimeSimulatorImpl", realtime);
+    cmd.AddValue("tick", "Period of the event of the simulation", tick);
+    cmd.Parse(argc, argv);
+
+    if (realtime)
+    {
+        Config::SetGlobal("SimulatorImplementationType",
+                          StringValue("ns3::RealtimeSimulatorImpl"));
+    }
+
+    InjectionWorkload workload(producers, events, tick);
+    Simulator::ScheduleWithContext(0, Seconds(0), &InjectionWorkload::Start, &workload);
+    Simulator::Run();
+    workload.Join();
+    uint64_t simulatorEvents = Simulator::GetEventCount();
+    Simulator::Destroy();
+
+    uint64_t total = events * producers;
+    // each producer injects the values producer + i
+    uint64_t expected = producers * (events * (events - 1) / 2) +
+                        events * (uint64_t(producers) * (producers - 1) / 2);
+    NS_ABORT_MSG_IF(workload.GetReceived() != total || workload.GetChecksum() != expected,
+                    "Injected events lost");
+
+    std::cout << argv[0] << ": " << producers << " producers, " << events << " events each, "
+              << (realtime ? "realtime" : "default") << " simulator" << std::endl;
+    std::cout << "  run: " << workload.GetSeconds() << " s, "
+              << total / workload.GetSeconds() / 1e6 << " M injected events/s, "
+              << simulatorEvents << " events in total" << std::endl;
+    std::cout << "  producers: " << workload.GetProducerSeconds() / producers
+              << " s per producer, " << workload.GetProducerSeconds() / total * 1e9
+              << " ns per ScheduleWithContext" << std::endl;
+    return 0;
+}
@@ -0,0 +1,170 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the cost of the ASN.1 encoding and decoding of the
+// RRC messages exchanged by the real RRC protocol, in the same way as
+// LteEnbRrcProtocolReal and LteUeRrcProtocolReal do: the sender adds the
+// message header to a new packet, the receiver peeks the message type and
+// then removes the message header.
+// Sample usage:  ./ns3 run 'perf-lte-rrc-asn1 --iterations=100000'
+
+#include "ns3/core-module.h"
+#include "ns3/lte-rrc-header.h"
+#include "ns3/packet.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * \ingroup system-tests-perf
+ *
+ * \returns a RRC connection setup message with a SRB and a DRB
+ */
+LteRrcSap::RrcConnectionSetup
+CreateRrcConnectionSetup()
+{
+    LteRrcSap::RrcConnectionSetup msg;
+    msg.rrcTransactionIdentifier = 3;
+
+    LteRrcSap::RadioResourceConfigDedicated& rrd = msg.radioResourceConfigDedicated;
+    LteRrcSap::SrbToAddMod srbToAddMod;
+    srbToAddMod.srbIdentity = 1;
+    srbToAddMod.logicalChannelConfig.priority = 1;
+    srbToAddMod.logicalChannelConfig.prioritizedBitRateKbps = 100;
+    srbToAddMod.logicalChannelConfig.bucketSizeDurationMs = 100;
+    srbToAddMod.logicalChannelConfig.logicalChannelGroup = 0;
+    rrd.srbToAddModList.push_back(srbToAddMod);
+
+    LteRrcSap::DrbToAddMod drbToAddMod;
+    drbToAddMod.epsBearerIdentity = 1;
+    drbToAddMod.drbIdentity = 1;
+    drbToAddMod.logicalChannelIdentity = 3;
+    drbToAddMod.rlcConfig.choice = LteRrcSap::RlcConfig::UM_BI_DIRECTIONAL;
+    drbToAddMod.logicalChannelConfig.priority = 9;
+    drbToAddMod.logicalChannelConfig.prioritizedBitRateKbps = 0;
+    drbToAddMod.logicalChannelConfig.bucketSizeDurationMs = 100;
+    drbToAddMod.logicalChannelConfig.logicalChannelGroup = 2;
+    rrd.drbToAddModList.push_back(drbToAddMod);
+
+    rrd.havePhysicalConfigDedicated = true;
+    rrd.physicalConfigDedicated.haveSoundingRsUlConfigDedicated = true;
+    rrd.physicalConfigDedicated.soundingRsUlConfigDedicated.type =
+        LteRrcSap::SoundingRsUlConfigDedicated::SETUP;
+    rrd.physicalConfigDedicated.soundingRsUlConfigDedicated.srsBandwidth = 0;
+    rrd.physicalConfigDedicated.soundingRsUlConfigDedicated.srsConfigIndex = 12;
+    rrd.physicalConfigDedicated.haveAntennaInfoDedicated = true;
+    rrd.physicalConfigDedicated.antennaInfo.transmissionMode = 2;
+    rrd.physicalConfigDedicated.havePdschConfigDedicated = true;
+    rrd.physicalConfigDedicated.pdschConfigDedicated.pa = LteRrcSap::PdschConfigDedicated::dB0;
+    return msg;
+}
+
+/**
+ * \ingroup system-tests-perf
+ *
+ * \returns a measurement report with a neighbour cell
+ */
+LteRrcSap::MeasurementReport
+CreateMeasurementReport()
+{
+    LteRrcSap::MeasurementReport msg;
+    LteRrcSap::MeasResults& mResults = msg.measResults;
+    mResults.measId = 1;
+    mResults.rsrpResult = 40;
+    mResults.rsrqResult = 20;
+    mResults.haveMeasResultNeighCells = true;
+    mResults.haveScellsMeas = false;
+
+    LteRrcSap::MeasResultEutra mResEutra;
+    mResEutra.physCellId = 2;
+    mResEutra.haveCgiInfo = false;
+    mResEutra.haveRsrpResult = true;
+    mResEutra.rsrpResult = 35;
+    mResEutra.haveRsrqResult = true;
+    mResEutra.rsrqResult = 18;
+    mResults.measResultListEutra.push_back(mResEutra);
+    return msg;
+}
+
+/**
+ * \ingroup system-tests-perf
+ *
+ * Encode and decode a message a number of times and print the time per message
+ *
+ * \tparam HEADER the header of the message
+ * \tparam TYPE_HEADER the header of the message type, peeked by the receiver
+ * \tparam MSG the message
+ * \param name the name of the message
+ * \param msg the message
+ * \param iterations the number of messages
+ */
+template <class HEADER, class TYPE_HEADER, class MSG>
+void
+Run(std::string name, MSG msg, uint32_t iterations)
+{
+    uint64_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        HEADER header;
+        header.SetMessage(msg);
+        Ptr<Packet> packet = Create<Packet>();
+        packet->AddHeader(header);
+        bytes += packet->GetSize();
+    }
+    auto encoded = std::chrono::steady_clock::now();
+
+    HEADER source;
+    source.SetMessage(msg);
+    Ptr<Packet> encodedPacket = Create<Packet>();
+    encodedPacket->AddHeader(source);
+    auto decodeStart = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        Ptr<Packet> packet = encodedPacket->Copy();
+        TYPE_HEADER typeHeader;
+        packet->PeekHeader(typeHeader);
+        HEADER header;
+        packet->RemoveHeader(header);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double encodeUs = std::chrono::duration<double, std::micro>(encoded - start).count();
+    double decodeUs = std::chrono::duration<double, std::micro>(end - decodeStart).count();
+    std::cout << "  " << name << " (" << bytes / iterations << " bytes): encode "
+              << encodeUs / iterations << " us, decode " << decodeUs / iterations << " us"
+              << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t iterations = 100000;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("iterations", "Number of messages encoded and decoded", iterations);
+    cmd.Parse(argc, argv);
+
+    std::cout << argv[0] << ": " << iterations << " messages" << std::endl;
+    Run<RrcConnectionSetupHeader, RrcDlCcchMessage>("RrcConnectionSetup",
+                                                    CreateRrcConnectionSetup(),
+                                                    iterations);
+    Run<MeasurementReportHeader, RrcUlDcchMessage>("MeasurementReport",
+                                                   CreateMeasurementReport(),
+                                                   iterations);
+    return 0;
+}
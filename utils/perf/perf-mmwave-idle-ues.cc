@@ -0,0 +1,167 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the cost of mostly idle mmWave UEs: one eNB serves
+// UEs which exchange a small UDP packet with a remote host every few tens of
+// milliseconds, in DL and in UL.  It prints the number of packets received,
+// a digest of their reception times, the number of events and the wall-clock
+// time of the simulation, so that the runs with and without
+// ns3::MmWaveUePhy::SkipIdleSlots can be compared.
+// Sample usage:  ./ns3 run 'perf-mmwave-idle-ues --numUes=50 --skipIdleSlots=1'
+
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/mmwave-helper.h"
+#include "ns3/mmwave-point-to-point-epc-helper.h"
+#include "ns3/mobility-module.h"
+#include "ns3/point-to-point-helper.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace ns3;
+using namespace mmwave;
+
+static uint64_t g_packets = 0;                   //!< Number of packets received.
+static uint64_t g_digest = 14695981039346656037U; //!< FNV-1a digest of the receptions.
+
+/**
+ * Count a received packet, and add its reception time and size to the digest.
+ * \param p The packet.
+ * \param from The address of the sender.
+ */
+static void
+PacketReceived(Ptr<const Packet> p, const Address& from)
+{
+    g_packets++;
+    for (uint64_t value : {static_cast<uint64_t>(Simulator::Now().GetTimeStep()),
+                           static_cast<uint64_t>(p->GetSize())})
+    {
+        g_digest = (g_digest ^ value) * 1099511628211U;
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t numUes = 20;
+    double interval = 20;
+    double simTime = 1;
+    bool skipIdleSlots = false;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("numUes", "Number of UEs", numUes);
+    cmd.AddValue("interval", "Time between two packets of a UE in each direction, in ms", interval);
+    cmd.AddValue("simTime", "Simulation time, in seconds", simTime);
+    cmd.AddValue("skipIdleSlots", "Value of ns3::MmWaveUePhy::SkipIdleSlots", skipIdleSlots);
+    cmd.Parse(argc, argv);
+
+    Config::SetDefault("ns3::MmWaveUePhy::SkipIdleSlots", BooleanValue(skipIdleSlots));
+    Config::SetDefault("ns3::LteRlcUmLowLat::ReportBufferStatusTimer",
+                       TimeValue(MicroSeconds(100.0)));
+
+    Ptr<MmWaveHelper> helper = CreateObject<MmWaveHelper>();
+    helper->SetSchedulerType("ns3::MmWaveFlexTtiMacScheduler");
+    Ptr<MmWavePointToPointEpcHelper> epcHelper = CreateObject<MmWavePointToPointEpcHelper>();
+    helper->SetEpcHelper(epcHelper);
+
+    NodeContainer remoteHosts;
+    remoteHosts.Create(1);
+    Ptr<Node> remoteHost = remoteHosts.Get(0);
+    InternetStackHelper internet;
+    internet.Install(remoteHosts);
+    PointToPointHelper p2ph;
+    p2ph.SetDeviceAttribute("DataRate", DataRateValue(DataRate("100Gb/s")));
+    p2ph.SetChannelAttribute("Delay", TimeValue(MilliSeconds(10)));
+    NetDeviceContainer internetDevices = p2ph.Install(epcHelper->GetPgwNode(), remoteHost);
+    Ipv4AddressHelper ipv4h;
+    ipv4h.SetBase("1.0.0.0", "255.0.0.0");
+    Ipv4Address remoteHostAddr = ipv4h.Assign(internetDevices).GetAddress(1);
+    Ipv4StaticRoutingHelper routingHelper;
+    routingHelper.GetStaticRouting(remoteHost->GetObject<Ipv4>())
+        ->AddNetworkRouteTo(Ipv4Address("7.0.0.0"), Ipv4Mask("255.0.0.0"), 1);
+
+    NodeContainer enbNodes;
+    enbNodes.Create(1);
+    NodeContainer ueNodes;
+    ueNodes.Create(numUes);
+    MobilityHelper mobility;
+    Ptr<ListPositionAllocator> positions = CreateObject<ListPositionAllocator>();
+    positions->Add(Vector(0, 0, 15));
+    for (uint32_t i = 0; i < numUes; i++)
+    {
+        positions->Add(Vector(20 + 3 * (i % 30), 4 * (i / 30), 1.5));
+    }
+    mobility.SetPositionAllocator(positions);
+    mobility.Install(enbNodes);
+    mobility.Install(ueNodes);
+
+    NetDeviceContainer enbDevs = helper->InstallEnbDevice(enbNodes);
+    NetDeviceContainer ueDevs = helper->InstallUeDevice(ueNodes);
+    internet.Install(ueNodes);
+    Ipv4InterfaceContainer ueIpIfaces = epcHelper->AssignUeIpv4Address(ueDevs);
+    for (uint32_t i = 0; i < numUes; i++)
+    {
+        routingHelper.GetStaticRouting(ueNodes.Get(i)->GetObject<Ipv4>())
+            ->SetDefaultRoute(epcHelper->GetUeDefaultGatewayAddress(), 1);
+    }
+    helper->AttachToClosestEnb(ueDevs, enbDevs);
+
+    // the first packets are spread over an interval, and do not fall on a slot boundary
+    Ptr<UniformRandomVariable> offset = CreateObject<UniformRandomVariable>();
+    offset->SetAttribute("Max", DoubleValue(interval * 1000));
+    for (uint32_t i = 0; i < numUes; i++)
+    {
+        uint16_t dlPort = 1000;
+        uint16_t ulPort = 2000 + i;
+        PacketSinkHelper dlSink("ns3::UdpSocketFactory",
+                                InetSocketAddress(Ipv4Address::GetAny(), dlPort));
+        PacketSinkHelper ulSink("ns3::UdpSocketFactory",
+                                InetSocketAddress(Ipv4Address::GetAny(), ulPort));
+        ApplicationContainer sinks = dlSink.Install(ueNodes.Get(i));
+        sinks.Add(ulSink.Install(remoteHost));
+        sinks.Start(MilliSeconds(100));
+
+        UdpClientHelper dlClient(ueIpIfaces.GetAddress(i), dlPort);
+        dlClient.SetAttribute("Interval", TimeValue(MilliSeconds(interval)));
+        dlClient.SetAttribute("MaxPackets", UintegerValue(0));
+        dlClient.SetAttribute("PacketSize", UintegerValue(200));
+        UdpClientHelper ulClient(remoteHostAddr, ulPort);
+        ulClient.SetAttribute("Interval", TimeValue(MilliSeconds(interval)));
+        ulClient.SetAttribute("MaxPackets", UintegerValue(0));
+        ulClient.SetAttribute("PacketSize", UintegerValue(200));
+        dlClient.Install(remoteHost).Start(MilliSeconds(200) +
+                                           MicroSeconds(offset->GetInteger()) + NanoSeconds(1));
+        ulClient.Install(ueNodes.Get(i))
+            .Start(MilliSeconds(200) + MicroSeconds(offset->GetInteger()) + NanoSeconds(1));
+    }
+    Config::ConnectWithoutContext("/NodeList/*/ApplicationList/*/$ns3::PacketSink/Rx",
+                                  MakeCallback(&PacketReceived));
+
+    Simulator::Stop(Seconds(simTime));
+    auto start = std::chrono::steady_clock::now();
+    Simulator::Run();
+    double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << argv[0] << ": " << numUes << " UEs, a packet every " << interval
+              << " ms, SkipIdleSlots " << skipIdleSlots << std::endl;
+    std::cout << "  " << g_packets << " packets received, digest " << std::hex << g_digest
+              << std::dec << std::endl;
+    std::cout << "  " << Simulator::GetEventCount() << " events, " << seconds << " s" << std::endl;
+    Simulator::Destroy();
+    return 0;
+}
@@ -0,0 +1,206 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the cost of the signals exchanged by the devices of
+// several mmWave cells: eNBs on a line, each serving UEs which exchange UDP
+// packets with a remote host, in DL and in UL.  It prints the number of
+// packets received, a digest of their reception times, the number of events
+// and the wall-clock time of the simulation, so that the runs with and without
+// ns3::MmWaveHelper::UseSpectrumTransmitFilter can be compared.  Since the
+// filter skips the channels of the pairs of devices which do not exchange
+// signals, the channel conditions are fixed (LOS, without shadowing) and the
+// channels of all the pairs are generated before the simulation, so that both
+// runs draw the same random numbers.
+// Sample usage:  ./ns3 run 'perf-mmwave-multi-cell --numEnbs=4 --transmitFilter=0'
+
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/mmwave-helper.h"
+#include "ns3/mmwave-point-to-point-epc-helper.h"
+#include "ns3/mobility-module.h"
+#include "ns3/point-to-point-helper.h"
+#include "ns3/three-gpp-spectrum-propagation-loss-model.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace ns3;
+using namespace mmwave;
+
+static uint64_t g_packets = 0;                   //!< Number of packets received.
+static uint64_t g_digest = 14695981039346656037U; //!< FNV-1a digest of the receptions.
+
+/**
+ * Count a received packet, and add its reception time and size to the digest.
+ * \param p The packet.
+ * \param from The address of the sender.
+ */
+static void
+PacketReceived(Ptr<const Packet> p, const Address& from)
+{
+    g_packets++;
+    for (uint64_t value : {static_cast<uint64_t>(Simulator::Now().GetTimeStep()),
+                           static_cast<uint64_t>(p->GetSize())})
+    {
+        g_digest = (g_digest ^ value) * 1099511628211U;
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t numEnbs = 4;
+    uint32_t uesPerEnb = 5;
+    double interval = 2;
+    double simTime = 0.5;
+    bool transmitFilter = true;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("numEnbs", "Number of eNBs", numEnbs);
+    cmd.AddValue("uesPerEnb", "Number of UEs of each eNB", uesPerEnb);
+    cmd.AddValue("interval", "Time between two packets of a UE in each direction, in ms", interval);
+    cmd.AddValue("simTime", "Simulation time, in seconds", simTime);
+    cmd.AddValue("transmitFilter",
+                 "Value of ns3::MmWaveHelper::UseSpectrumTransmitFilter",
+                 transmitFilter);
+    cmd.Parse(argc, argv);
+
+    Config::SetDefault("ns3::MmWaveHelper::UseSpectrumTransmitFilter",
+                       BooleanValue(transmitFilter));
+    Config::SetDefault("ns3::ThreeGppPropagationLossModel::ShadowingEnabled", BooleanValue(false));
+    Config::SetDefault("ns3::LteRlcUmLowLat::ReportBufferStatusTimer",
+                       TimeValue(MicroSeconds(100.0)));
+
+    Ptr<MmWaveHelper> helper = CreateObject<MmWaveHelper>();
+    helper->SetSchedulerType("ns3::MmWaveFlexTtiMacScheduler");
+    helper->SetChannelConditionModelType("ns3::AlwaysLosChannelConditionModel");
+    Ptr<MmWavePointToPointEpcHelper> epcHelper = CreateObject<MmWavePointToPointEpcHelper>();
+    helper->SetEpcHelper(epcHelper);
+
+    NodeContainer remoteHosts;
+    remoteHosts.Create(1);
+    Ptr<Node> remoteHost = remoteHosts.Get(0);
+    InternetStackHelper internet;
+    internet.Install(remoteHosts);
+    PointToPointHelper p2ph;
+    p2ph.SetDeviceAttribute("DataRate", DataRateValue(DataRate("100Gb/s")));
+    p2ph.SetChannelAttribute("Delay", TimeValue(MilliSeconds(10)));
+    NetDeviceContainer internetDevices = p2ph.Install(epcHelper->GetPgwNode(), remoteHost);
+    Ipv4AddressHelper ipv4h;
+    ipv4h.SetBase("1.0.0.0", "255.0.0.0");
+    Ipv4Address remoteHostAddr = ipv4h.Assign(internetDevices).GetAddress(1);
+    Ipv4StaticRoutingHelper routingHelper;
+    routingHelper.GetStaticRouting(remoteHost->GetObject<Ipv4>())
+        ->AddNetworkRouteTo(Ipv4Address("7.0.0.0"), Ipv4Mask("255.0.0.0"), 1);
+
+    uint32_t numUes = numEnbs * uesPerEnb;
+    NodeContainer enbNodes;
+    enbNodes.Create(numEnbs);
+    NodeContainer ueNodes;
+    ueNodes.Create(numUes);
+    MobilityHelper mobility;
+    Ptr<ListPositionAllocator> enbPositions = CreateObject<ListPositionAllocator>();
+    Ptr<ListPositionAllocator> uePositions = CreateObject<ListPositionAllocator>();
+    for (uint32_t i = 0; i < numEnbs; i++)
+    {
+        enbPositions->Add(Vector(200 * i, 0, 15));
+        for (uint32_t j = 0; j < uesPerEnb; j++)
+        {
+            uePositions->Add(Vector(200 * i + 20 + 10 * j, 5 + 10 * j, 1.5));
+        }
+    }
+    mobility.SetPositionAllocator(enbPositions);
+    mobility.Install(enbNodes);
+    mobility.SetPositionAllocator(uePositions);
+    mobility.Install(ueNodes);
+
+    NetDeviceContainer enbDevs = helper->InstallEnbDevice(enbNodes);
+    NetDeviceContainer ueDevs = helper->InstallUeDevice(ueNodes);
+    internet.Install(ueNodes);
+    Ipv4InterfaceContainer ueIpIfaces = epcHelper->AssignUeIpv4Address(ueDevs);
+    for (uint32_t i = 0; i < numUes; i++)
+    {
+        routingHelper.GetStaticRouting(ueNodes.Get(i)->GetObject<Ipv4>())
+            ->SetDefaultRoute(epcHelper->GetUeDefaultGatewayAddress(), 1);
+    }
+    helper->AttachToClosestEnb(ueDevs, enbDevs);
+
+    NetDeviceContainer devices(enbDevs, ueDevs);
+    Ptr<MatrixBasedChannelModel> channelModel =
+        DynamicCast<ThreeGppSpectrumPropagationLossModel>(
+            DynamicCast<MmWaveEnbNetDevice>(enbDevs.Get(0))
+                ->GetPhy(0)
+                ->GetDlSpectrumPhy()
+                ->GetSpectrumChannel()
+                ->GetPhasedArraySpectrumPropagationLossModel())
+            ->GetChannelModel();
+    for (uint32_t i = 0; i < devices.GetN(); i++)
+    {
+        for (uint32_t j = i + 1; j < devices.GetN(); j++)
+        {
+            Ptr<MmWaveNetDevice> a = DynamicCast<MmWaveNetDevice>(devices.Get(i));
+            Ptr<MmWaveNetDevice> b = DynamicCast<MmWaveNetDevice>(devices.Get(j));
+            channelModel->GetChannel(a->GetNode()->GetObject<MobilityModel>(),
+                                     b->GetNode()->GetObject<MobilityModel>(),
+                                     a->GetAntenna(0),
+                                     b->GetAntenna(0));
+        }
+    }
+
+    Ptr<UniformRandomVariable> offset = CreateObject<UniformRandomVariable>();
+    offset->SetAttribute("Max", DoubleValue(interval * 1000));
+    for (uint32_t i = 0; i < numUes; i++)
+    {
+        uint16_t dlPort = 1000;
+        uint16_t ulPort = 2000 + i;
+        PacketSinkHelper dlSink("ns3::UdpSocketFactory",
+                                InetSocketAddress(Ipv4Address::GetAny(), dlPort));
+        PacketSinkHelper ulSink("ns3::UdpSocketFactory",
+                                InetSocketAddress(Ipv4Address::GetAny(), ulPort));
+        ApplicationContainer sinks = dlSink.Install(ueNodes.Get(i));
+        sinks.Add(ulSink.Install(remoteHost));
+        sinks.Start(MilliSeconds(100));
+
+        UdpClientHelper dlClient(ueIpIfaces.GetAddress(i), dlPort);
+        dlClient.SetAttribute("Interval", TimeValue(MilliSeconds(interval)));
+        dlClient.SetAttribute("MaxPackets", UintegerValue(0));
+        dlClient.SetAttribute("PacketSize", UintegerValue(1000));
+        UdpClientHelper ulClient(remoteHostAddr, ulPort);
+        ulClient.SetAttribute("Interval", TimeValue(MilliSeconds(interval)));
+        ulClient.SetAttribute("MaxPackets", UintegerValue(0));
+        ulClient.SetAttribute("PacketSize", UintegerValue(1000));
+        dlClient.Install(remoteHost).Start(MilliSeconds(200) + MicroSeconds(offset->GetInteger()));
+        ulClient.Install(ueNodes.Get(i)).Start(MilliSeconds(200) +
+                                               MicroSeconds(offset->GetInteger()));
+    }
+    Config::ConnectWithoutContext("/NodeList/*/ApplicationList/*/$ns3::PacketSink/Rx",
+                                  MakeCallback(&PacketReceived));
+
+    Simulator::Stop(Seconds(simTime));
+    auto start = std::chrono::steady_clock::now();
+    Simulator::Run();
+    double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << argv[0] << ": " << numEnbs << " eNBs, " << uesPerEnb
+              << " UEs per eNB, a packet every " << interval << " ms, UseSpectrumTransmitFilter "
+              << transmitFilter << std::endl;
+    std::cout << "  " << g_packets << " packets received, digest " << std::hex << g_digest
+              << std::dec << std::endl;
+    std::cout << "  " << Simulator::GetEventCount() << " events, " << seconds << " s" << std::endl;
+    Simulator::Destroy();
+    return 0;
+}
@@ -0,0 +1,192 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the cost of the numerology arithmetic that the mmWave
+// PHYs do at every slot: the durations of the control and data TTIs, the start
+// of the next TTI and the slot, subframe and frame counters.  The slots are
+// run twice: with the getters of MmWavePhyMacCommon, and with the
+// MmWaveNumerology snapshot read by MmWaveEnbPhy and MmWaveUePhy.
+// Sample usage:  ./ns3 run 'perf-mmwave-numerology --numerology=NrNumerology3 --slots=2000000'
+
+#include "ns3/core-module.h"
+#include "ns3/mmwave-phy-mac-common.h"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+using namespace mmwave;
+
+/**
+ * Run the per-slot arithmetic of the PHYs over a number of slots.
+ * \tparam Config The type which provides the numerology getters.
+ * \param config The numerology.
+ * \param dataTtis The number of OFDM symbols of the data TTIs of a slot.
+ * \param slots The number of slots.
+ * \returns a checksum of the computed times and counters
+ */
+template <class Config>
+static int64_t
+RunSlots(const Config& config, const std::vector<uint32_t>& dataTtis, uint32_t slots)
+{
+    int64_t checksum = 0;
+    uint32_t frameNum = 0;
+    uint32_t sfNum = 0;
+    uint32_t slotNum = 0;
+    for (uint32_t i = 0; i < slots; ++i)
+    {
+        uint32_t symStart = config.GetDlCtrlSymbols();
+        Time ttiPeriod = config.GetSymbolsDuration(config.GetDlCtrlSymbols());
+        checksum += ttiPeriod.GetTimeStep();
+        for (uint32_t numSym : dataTtis)
+        {
+            Time nextTtiStart = config.GetSymbolsDuration(symStart);
+            ttiPeriod = config.GetSymbolsDuration(numSym);
+            checksum += nextTtiStart.GetTimeStep() + ttiPeriod.GetTimeStep();
+            symStart += numSym;
+        }
+        ttiPeriod = config.GetSymbolsDuration(config.GetUlCtrlSymbols());
+        checksum += ttiPeriod.GetTimeStep();
+
+        uint32_t ulSlotNum = (slotNum + config.GetUlSchedDelay()) % config.GetSlotsPerSubframe();
+        checksum += ulSlotNum;
+        if (slotNum == config.GetSlotsPerSubframe() - 1)
+        {
+            slotNum = 0;
+            if (sfNum == config.GetSubframesPerFrame() - 1)
+            {
+                sfNum = 0;
+                frameNum++;
+            }
+            else
+            {
+                sfNum++;
+            }
+        }
+        else
+        {
+            slotNum++;
+        }
+    }
+    return checksum + frameNum + sfNum + slotNum;
+}
+
+/**
+ * The numerology getters of MmWavePhyMacCommon, with the durations computed
+ * as the PHYs did before the MmWaveNumerology snapshot.
+ */
+class CommonConfig
+{
+  public:
+    /**
+     * Constructor
+     * \param config The configuration.
+     */
+    CommonConfig(Ptr<MmWavePhyMacCommon> config)
+        : m_config(config)
+    {
+    }
+
+    /**
+     * \returns the number of OFDM symbols of the DL control region
+     */
+    uint32_t GetDlCtrlSymbols() const
+    {
+        return m_config->GetDlCtrlSymbols();
+    }
+
+    /**
+     * \returns the number of OFDM symbols of the UL control region
+     */
+    uint32_t GetUlCtrlSymbols() const
+    {
+        return m_config->GetUlCtrlSymbols();
+    }
+
+    /**
+     * \returns the UL scheduling delay, in slots
+     */
+    uint32_t GetUlSchedDelay() const
+    {
+        return m_config->GetUlSchedDelay();
+    }
+
+    /**
+     * \returns the number of slots in a subframe
+     */
+    uint32_t GetSlotsPerSubframe() const
+    {
+        return m_config->GetSlotsPerSubframe();
+    }
+
+    /**
+     * \returns the number of subframes in a frame
+     */
+    uint32_t GetSubframesPerFrame() const
+    {
+        return m_config->GetSubframesPerFrame();
+    }
+
+    /**
+     * \param numSym A number of OFDM symbols.
+     * \returns the duration of numSym OFDM symbols
+     */
+    Time GetSymbolsDuration(uint32_t numSym) const
+    {
+        return numSym * m_config->GetSymbolPeriod();
+    }
+
+  private:
+    Ptr<MmWavePhyMacCommon> m_config; //!< The configuration.
+};
+
+int
+main(int argc, char* argv[])
+{
+    std::string numerology = "NrNumerology2";
+    uint32_t slots = 1000000;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("numerology", "Value of ns3::MmWavePhyMacCommon::Numerology", numerology);
+    cmd.AddValue("slots", "Number of slots", slots);
+    cmd.Parse(argc, argv);
+
+    Ptr<MmWavePhyMacCommon> config = CreateObject<MmWavePhyMacCommon>();
+    config->SetAttribute("Numerology", StringValue(numerology));
+    // a slot with a DL and a UL data TTI, as scheduled by MmWaveFlexTtiMacScheduler
+    uint32_t dataSymbols = config->GetSymbPerSlot() - config->GetDlCtrlSymbols() -
+                           config->GetUlCtrlSymbols();
+    std::vector<uint32_t> dataTtis{dataSymbols / 2, dataSymbols - dataSymbols / 2};
+
+    auto start = std::chrono::steady_clock::now();
+    int64_t commonChecksum = RunSlots(CommonConfig(config), dataTtis, slots);
+    double commonSeconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    int64_t snapshotChecksum = RunSlots(MmWaveNumerology(config), dataTtis, slots);
+    double snapshotSeconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    NS_ABORT_MSG_IF(commonChecksum != snapshotChecksum, "The numerologies disagree");
+
+    std::cout << argv[0] << ": " << numerology << ", " << slots << " slots, checksum "
+              << commonChecksum << std::endl;
+    std::cout << "  MmWavePhyMacCommon: " << commonSeconds / slots * 1e9 << " ns per slot"
+              << std::endl;
+    std::cout << "  MmWaveNumerology: " << snapshotSeconds / slots * 1e9 << " ns per slot"
+              << std::endl;
+    return 0;
+}
@@ -0,0 +1,95 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the setup time of a large mmWave deployment: the
+// installation of the eNB and UE devices and the attachment of the UEs to
+// the closest eNB, before any simulated time elapses.  The breakdown of the
+// time spent in each stage is printed by the MmWaveHelper.
+// Sample usage:  ./ns3 run 'perf-mmwave-setup --numEnbs=100 --numUes=5000'
+
+#include "ns3/core-module.h"
+#include "ns3/mmwave-helper.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+using namespace ns3;
+using namespace mmwave;
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t numEnbs = 25;
+    uint32_t numUes = 1000;
+    double isd = 200;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("numEnbs", "Number of eNBs, deployed on a square grid", numEnbs);
+    cmd.AddValue("numUes", "Number of UEs, dropped uniformly in the area", numUes);
+    cmd.AddValue("isd", "Inter-site distance in meters", isd);
+    cmd.Parse(argc, argv);
+
+    auto start = std::chrono::steady_clock::now();
+
+    Ptr<MmWaveHelper> helper = CreateObject<MmWaveHelper>();
+    helper->SetPathlossModelType("ns3::ThreeGppUmiStreetCanyonPropagationLossModel");
+    helper->SetChannelConditionModelType("ns3::ThreeGppUmiStreetCanyonChannelConditionModel");
+
+    uint32_t side = std::ceil(std::sqrt(numEnbs));
+    NodeContainer enbNodes;
+    enbNodes.Create(numEnbs);
+    MobilityHelper enbMobility;
+    enbMobility.SetPositionAllocator("ns3::GridPositionAllocator",
+                                     "DeltaX",
+                                     DoubleValue(isd),
+                                     "DeltaY",
+                                     DoubleValue(isd),
+                                     "GridWidth",
+                                     UintegerValue(side),
+                                     "Z",
+                                     DoubleValue(10));
+    enbMobility.Install(enbNodes);
+
+    NodeContainer ueNodes;
+    ueNodes.Create(numUes);
+    Ptr<UniformRandomVariable> x = CreateObject<UniformRandomVariable>();
+    x->SetAttribute("Max", DoubleValue(side * isd));
+    Ptr<UniformRandomVariable> y = CreateObject<UniformRandomVariable>();
+    y->SetAttribute("Max", DoubleValue(side * isd));
+    Ptr<RandomBoxPositionAllocator> uePositions = CreateObject<RandomBoxPositionAllocator>();
+    uePositions->SetX(x);
+    uePositions->SetY(y);
+    uePositions->SetZ(CreateObjectWithAttributes<ConstantRandomVariable>("Constant",
+                                                                         DoubleValue(1.5)));
+    MobilityHelper ueMobility;
+    ueMobility.SetPositionAllocator(uePositions);
+    ueMobility.Install(ueNodes);
+
+    NetDeviceContainer enbDevices = helper->InstallEnbDevice(enbNodes);
+    NetDeviceContainer ueDevices = helper->InstallUeDevice(ueNodes);
+    helper->AttachToClosestEnb(ueDevices, enbDevices);
+
+    auto end = std::chrono::steady_clock::now();
+    std::cout << argv[0] << ": " << numEnbs << " eNBs, " << numUes << " UEs" << std::endl;
+    helper->PrintSetupTimes(std::cout);
+    std::cout << "  wall time: " << std::chrono::duration<double>(end - start).count() << " s"
+              << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
@@ -0,0 +1,128 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the rate at which an mmWave PHY decodes transport
+// blocks, i.e., the cost of the error model call made by
+// MmWaveSpectrumPhy::EndRxData for every received TB.  The decodes are run
+// twice: with an error model created for every TB, and with a single error
+// model instance, as the PHY does.  With --retx, each TB is decoded with a
+// HARQ history of that many previous transmissions.
+// Sample usage:  ./ns3 run 'perf-mmwave-tb-decode --errorModel=ns3::MmWaveEesmIrT1 --retx=2'
+
+#include "ns3/core-module.h"
+#include "ns3/mmwave-error-model.h"
+#include "ns3/spectrum-model.h"
+#include "ns3/spectrum-value.h"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+using namespace mmwave;
+
+/**
+ * Create an error model.
+ * \param type The TypeId of the error model.
+ * \returns the error model
+ */
+static Ptr<MmWaveErrorModel>
+CreateErrorModel(TypeId type)
+{
+    ObjectFactory factory;
+    factory.SetTypeId(type);
+    return DynamicCast<MmWaveErrorModel>(factory.Create());
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string errorModel = "ns3::MmWaveLteMiErrorModel";
+    uint32_t numRbs = 72;
+    uint32_t tbSize = 4000;
+    uint32_t mcs = 10;
+    uint32_t retx = 0;
+    uint32_t decodes = 200000;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("errorModel", "TypeId of the error model", errorModel);
+    cmd.AddValue("numRbs", "Number of RBs of the TB", numRbs);
+    cmd.AddValue("tbSize", "Size of the TB, in bytes", tbSize);
+    cmd.AddValue("mcs", "MCS of the TB", mcs);
+    cmd.AddValue("retx", "Number of previous transmissions in the HARQ history", retx);
+    cmd.AddValue("decodes", "Number of TB decodes", decodes);
+    cmd.Parse(argc, argv);
+
+    TypeId type = TypeId::LookupByName(errorModel);
+    NS_ABORT_MSG_IF(!type.IsChildOf(MmWaveErrorModel::GetTypeId()),
+                    errorModel << " is not a subclass of MmWaveErrorModel");
+
+    std::vector<double> frequencies;
+    for (uint32_t i = 0; i < numRbs; ++i)
+    {
+        frequencies.push_back(28e9 + i * 1.44e6);
+    }
+    Ptr<SpectrumModel> model = Create<SpectrumModel>(frequencies);
+    SpectrumValue sinr(model);
+    std::vector<int> map;
+    Ptr<UniformRandomVariable> sinrDb = CreateObject<UniformRandomVariable>();
+    sinrDb->SetAttribute("Min", DoubleValue(0));
+    sinrDb->SetAttribute("Max", DoubleValue(20));
+    for (uint32_t i = 0; i < numRbs; ++i)
+    {
+        sinr[i] = std::pow(10, sinrDb->GetValue() / 10);
+        map.push_back(i);
+    }
+
+    Ptr<MmWaveErrorModel> em = CreateErrorModel(type);
+    MmWaveErrorModel::MmWaveErrorModelHistory history;
+    for (uint32_t i = 0; i < retx; ++i)
+    {
+        history.push_back(em->GetTbDecodificationStats(sinr, map, tbSize, mcs, history));
+    }
+
+    // one error model per TB, as MmWaveSpectrumPhy::EndRxData used to do
+    double tblerSum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < decodes; ++i)
+    {
+        Ptr<MmWaveErrorModel> perTb = CreateErrorModel(type);
+        tblerSum += perTb->GetTbDecodificationStats(sinr, map, tbSize, mcs, history)->m_tbler;
+    }
+    double perTbSeconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // a single error model
+    double persistentTblerSum = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < decodes; ++i)
+    {
+        persistentTblerSum +=
+            em->GetTbDecodificationStats(sinr, map, tbSize, mcs, history)->m_tbler;
+    }
+    double persistentSeconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    NS_ABORT_MSG_IF(tblerSum != persistentTblerSum, "The error models disagree");
+
+    std::cout << argv[0] << ": " << errorModel << ", " << numRbs << " RBs, " << tbSize
+              << " bytes, MCS " << mcs << ", " << retx << " previous transmissions, TBLER "
+              << tblerSum / decodes << std::endl;
+    std::cout << "  error model per TB: " << decodes / perTbSeconds / 1e6 << " M decodes/s, "
+              << perTbSeconds / decodes * 1e9 << " ns per decode" << std::endl;
+    std::cout << "  single error model: " << decodes / persistentSeconds / 1e6
+              << " M decodes/s, " << persistentSeconds / decodes * 1e9 << " ns per decode"
+              << std::endl;
+    return 0;
+}
@@ -0,0 +1,238 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the scaling of the MultithreadedSimulatorImpl with
+// the number of partitions.  A number of cells, i.e., contexts, run periodic
+// slot events with a configurable amount of computation, and exchange
+// messages with a delay longer than one slot, which is declared as the
+// lookahead.  The wall-clock time of the DefaultSimulatorImpl is the
+// reference of the speedup.
+// Sample usage:  ./ns3 run 'perf-pdes --cells=64 --partitions=1,2,4,8,16'
+
+#include "ns3/core-module.h"
+#include "ns3/multithreaded-simulator-impl.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup system-tests-perf
+ *
+ * Cells with periodic slot events, exchanging messages with the other cells.
+ */
+class CellWorkload
+{
+  public:
+    /**
+     * Constructor.
+     *
+     * \param cells The number of cells.
+     * \param slot The slot period, which is also the lookahead between the cells.
+     * \param work The number of iterations of computation per slot.
+     */
+    CellWorkload(uint32_t cells, Time slot, uint32_t work)
+        : m_slot(slot),
+          m_work(work),
+          m_state(cells)
+    {
+        for (uint32_t i = 0; i < cells; ++i)
+        {
+            m_state[i].value = i + 1;
+        }
+    }
+
+    /** Schedule the first slot of every cell and declare the lookahead. */
+    void Start()
+    {
+        for (uint32_t i = 0; i < m_state.size(); ++i)
+        {
+            for (uint32_t j = i + 1; j < m_state.size(); ++j)
+            {
+                MultithreadedSimulatorImpl::DeclareLookAhead(i, j, m_slot);
+            }
+            Simulator::ScheduleWithContext(i, Seconds(0), &CellWorkload::Slot, this, i);
+        }
+    }
+
+    /** \returns a checksum of the state of the cells */
+    uint64_t GetChecksum() const
+    {
+        uint64_t checksum = 0;
+        for (const auto& state : m_state)
+        {
+            checksum = checksum * 31 + state.value;
+        }
+        return checksum;
+    }
+
+  private:
+    /**
+     * A slot of a cell.
+     * \param cell The cell.
+     */
+    void Slot(uint32_t cell)
+    {
+        State& state = m_state[cell];
+        uint64_t value = state.value + state.received;
+        for (uint32_t k = 0; k < m_work; ++k)
+        {
+            value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+        }
+        state.value = value;
+        state.received = 0;
+
+        uint32_t neighbor = (cell + 1 + (value >> 40) % (m_state.size() - 1)) % m_state.size();
+        // the messages arrive in the middle of a slot, after at least the lookahead
+        Simulator::ScheduleWithContext(neighbor,
+                                       m_slot + m_slot / 2,
+                                       &CellWorkload::Receive,
+                                       this,
+                                       neighbor,
+                                       value >> 32);
+        Simulator::Schedule(m_slot, &CellWorkload::Slot, this, cell);
+    }
+
+    /**
+     * Reception of a message.
+     * \param cell The receiving cell.
+     * \param value The content of the message.
+     */
+    void Receive(uint32_t cell, uint64_t value)
+    {
+        m_state[cell].received += value;
+    }
+
+    /** The state of a cell, on its own cache line. */
+    struct alignas(64) State
+    {
+        uint64_t value{0};    //!< The state.
+        uint64_t received{0}; //!< The sum of the messages received in the slot.
+    };
+
+    Time m_slot;                //!< The slot period.
+    uint32_t m_work;            //!< The iterations of computation per slot.
+    std::vector<State> m_state; //!< The state of the cells.
+};
+
+/**
+ * \ingroup system-tests-perf
+ *
+ * Run the workload with a simulator implementation.
+ *
+ * \param simulatorType The simulator implementation.
+ * \param partitions The number of partitions of the MultithreadedSimulatorImpl.
+ * \param cells The number of cells.
+ * \param slot The slot period.
+ * \param work The computation per slot.
+ * \param duration The simulated time.
+ * \param [out] checksum The checksum of the final state.
+ * \param [out] events The number of events.
+ * \returns the wall-clock time of Simulator::Run, in seconds
+ */
+double
+RunWorkload(const std::string& simulatorType,
+            uint32_t partitions,
+            uint32_t cells,
+            Time slot,
+            uint32_t work,
+            Time duration,
+            uint64_t& checksum,
+            uint64_t& events)
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue(simulatorType));
+    Config::SetDefault("ns3::MultithreadedSimulatorImpl::PartitionCount",
+                       UintegerValue(partitions));
+
+    CellWorkload workload(cells, slot, work);
+    workload.Start();
+    // away from the slots and the messages, where the two simulators may differ
+    Simulator::Stop(duration + slot / 4);
+
+    auto start = std::chrono::steady_clock::now();
+    Simulator::Run();
+    auto end = std::chrono::steady_clock::now();
+
+    checksum = workload.GetChecksum();
+    events = Simulator::GetEventCount();
+    Simulator::Destroy();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t cells = 64;
+    uint32_t work = 2000;
+    Time slot = MicroSeconds(125);
+    Time duration = MilliSeconds(200);
+    std::string partitionList = "1,2,4,8,16";
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("cells", "Number of cells (contexts)", cells);
+    cmd.AddValue("work", "Iterations of computation per slot", work);
+    cmd.AddValue("slot", "Slot period, the lookahead between the cells", slot);
+    cmd.AddValue("duration", "Simulated time", duration);
+    cmd.AddValue("partitions", "Comma-separated numbers of partitions", partitionList);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(cells < 2, "At least two cells are needed");
+
+    uint64_t reference = 0;
+    uint64_t events = 0;
+    double sequential = RunWorkload("ns3::DefaultSimulatorImpl",
+                                    1,
+                                    cells,
+                                    slot,
+                                    work,
+                                    duration,
+                                    reference,
+                                    events);
+
+    std::cout << argv[0] << ": " << cells << " cells, " << events << " events, "
+              << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::setw(12) << "partitions" << std::setw(12) << "time (s)" << std::setw(14)
+              << "Mevents/s" << std::setw(10) << "speedup" << std::endl;
+    std::cout << std::setw(12) << "default" << std::setw(12) << sequential << std::setw(14)
+              << events / sequential / 1e6 << std::setw(10) << 1.0 << std::endl;
+
+    std::istringstream iss(partitionList);
+    std::string token;
+    while (std::getline(iss, token, ','))
+    {
+        uint32_t partitions = std::stoul(token);
+        uint64_t checksum = 0;
+        double elapsed = RunWorkload("ns3::MultithreadedSimulatorImpl",
+                                     partitions,
+                                     cells,
+                                     slot,
+                                     work,
+                                     duration,
+                                     checksum,
+                                     events);
+        NS_ABORT_MSG_IF(checksum != reference,
+                        "The multithreaded run differs from the sequential run");
+        std::cout << std::setw(12) << partitions << std::setw(12) << elapsed << std::setw(14)
+                  << events / elapsed / 1e6 << std::setw(10) << sequential / elapsed
+                  << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,230 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the processing rate of a single high-rate RLC UM
+// bearer.  A transmitting and a receiving RLC entity are connected back to
+// back through a loopback MAC that delivers the PDUs out of order, as HARQ
+// with several parallel processes would, so that the receive path exercises
+// the reordering window and the SDU reassembly.
+// Sample usage:  ./ns3 run 'perf-rlc-um --simTime=1 --reorderDepth=8'
+
+#include "ns3/core-module.h"
+#include "ns3/lte-mac-sap.h"
+#include "ns3/lte-rlc-sap.h"
+#include "ns3/lte-rlc-um-lowlat.h"
+#include "ns3/lte-rlc-um.h"
+#include "ns3/packet.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup system-tests-perf
+ *
+ * MAC that loops the PDUs of the transmitting RLC entity back to the
+ * receiving one, reversing their order in blocks of a given depth.
+ */
+class LoopbackMac : public LteMacSapProvider
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param reorderDepth the number of PDUs whose order is reversed
+     */
+    LoopbackMac(uint32_t reorderDepth)
+        : m_reorderDepth(reorderDepth),
+          m_rxSapUser(nullptr),
+          m_pdus(0)
+    {
+    }
+
+    /**
+     * \param user the MAC SAP user of the receiving RLC entity
+     */
+    void SetReceiver(LteMacSapUser* user)
+    {
+        m_rxSapUser = user;
+    }
+
+    void TransmitPdu(TransmitPduParameters params) override
+    {
+        ++m_pdus;
+        m_pending.push_back(params.pdu);
+        if (m_pending.size() == m_reorderDepth)
+        {
+            for (auto it = m_pending.rbegin(); it != m_pending.rend(); ++it)
+            {
+                LteMacSapUser::ReceivePduParameters rxParams;
+                rxParams.p = *it;
+                rxParams.rnti = params.rnti;
+                rxParams.lcid = params.lcid;
+                m_rxSapUser->ReceivePdu(rxParams);
+            }
+            m_pending.clear();
+        }
+    }
+
+    void ReportBufferStatus(ReportBufferStatusParameters /* params */) override
+    {
+    }
+
+    /**
+     * \returns the number of PDUs transmitted
+     */
+    uint64_t GetPdus() const
+    {
+        return m_pdus;
+    }
+
+  private:
+    uint32_t m_reorderDepth;            ///< number of PDUs reversed at once
+    LteMacSapUser* m_rxSapUser;         ///< receiving RLC entity
+    std::vector<Ptr<Packet>> m_pending; ///< PDUs waiting to be delivered
+    uint64_t m_pdus;                    ///< number of PDUs transmitted
+};
+
+/**
+ * \ingroup system-tests-perf
+ *
+ * PDCP sink counting the SDUs delivered by the receiving RLC entity.
+ */
+class SinkPdcp : public LteRlcSapUser
+{
+  public:
+    SinkPdcp()
+        : m_sdus(0),
+          m_bytes(0)
+    {
+    }
+
+    void ReceivePdcpPdu(Ptr<Packet> p) override
+    {
+        ++m_sdus;
+        m_bytes += p->GetSize();
+    }
+
+    uint64_t m_sdus;  ///< number of SDUs received
+    uint64_t m_bytes; ///< number of bytes received
+};
+
+/**
+ * \ingroup system-tests-perf
+ *
+ * Offer a burst of SDUs to the transmitting RLC entity and grant it a
+ * transmission opportunity, then reschedule for the next TTI.
+ *
+ * \param txRlc the transmitting RLC entity
+ * \param tti the TTI duration
+ * \param sdusPerTti the number of SDUs offered per TTI
+ * \param sduSize the SDU size
+ * \param grantBytes the size of the transmission opportunities
+ * \param grantsPerTti the number of transmission opportunities per TTI
+ */
+void
+Tti(Ptr<LteRlc> txRlc,
+    Time tti,
+    uint32_t sdusPerTti,
+    uint32_t sduSize,
+    uint32_t grantBytes,
+    uint32_t grantsPerTti)
+{
+    LteRlcSapProvider::TransmitPdcpPduParameters txParams;
+    txParams.rnti = 1;
+    txParams.lcid = 3;
+    for (uint32_t i = 0; i < sdusPerTti; ++i)
+    {
+        txParams.pdcpPdu = Create<Packet>(sduSize);
+        txRlc->GetLteRlcSapProvider()->TransmitPdcpPdu(txParams);
+    }
+
+    LteMacSapUser::TxOpportunityParameters txOpParams;
+    txOpParams.bytes = grantBytes;
+    txOpParams.layer = 0;
+    txOpParams.componentCarrierId = 0;
+    txOpParams.rnti = 1;
+    txOpParams.lcid = 3;
+    for (uint32_t i = 0; i < grantsPerTti; ++i)
+    {
+        txOpParams.harqId = i;
+        txRlc->GetLteMacSapUser()->NotifyTxOpportunity(txOpParams);
+    }
+
+    Simulator::Schedule(tti, &Tti, txRlc, tti, sdusPerTti, sduSize, grantBytes, grantsPerTti);
+}
+
+int
+main(int argc, char* argv[])
+{
+    double simTime = 1.0;
+    uint32_t ttiUs = 125;
+    uint32_t sdusPerTti = 16;
+    uint32_t sduSize = 1400;
+    uint32_t grantBytes = 3000;
+    uint32_t grantsPerTti = 8;
+    uint32_t reorderDepth = 8;
+    bool lowLat = false;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("simTime", "Simulated time in seconds", simTime);
+    cmd.AddValue("ttiUs", "TTI duration in microseconds", ttiUs);
+    cmd.AddValue("sdusPerTti", "Number of SDUs offered to the RLC per TTI", sdusPerTti);
+    cmd.AddValue("sduSize", "SDU size in bytes", sduSize);
+    cmd.AddValue("grantBytes", "Size of each transmission opportunity in bytes", grantBytes);
+    cmd.AddValue("grantsPerTti", "Number of transmission opportunities per TTI", grantsPerTti);
+    cmd.AddValue("reorderDepth", "Number of PDUs delivered in reverse order", reorderDepth);
+    cmd.AddValue("lowLat", "Benchmark LteRlcUmLowLat instead of LteRlcUm", lowLat);
+    cmd.Parse(argc, argv);
+
+    ObjectFactory factory;
+    factory.SetTypeId(lowLat ? LteRlcUmLowLat::GetTypeId() : LteRlcUm::GetTypeId());
+    factory.Set("MaxTxBufferSize", UintegerValue(100 * 1024 * 1024));
+    Ptr<LteRlc> txRlc = factory.Create<LteRlc>();
+    Ptr<LteRlc> rxRlc = factory.Create<LteRlc>();
+
+    LoopbackMac mac(std::max<uint32_t>(reorderDepth, 1));
+    SinkPdcp sink;
+    for (Ptr<LteRlc> rlc : {txRlc, rxRlc})
+    {
+        rlc->SetRnti(1);
+        rlc->SetLcId(3);
+        rlc->SetLteMacSapProvider(&mac);
+        rlc->SetLteRlcSapUser(&sink);
+    }
+    mac.SetReceiver(rxRlc->GetLteMacSapUser());
+
+    Time tti = MicroSeconds(ttiUs);
+    Simulator::Schedule(tti, &Tti, txRlc, tti, sdusPerTti, sduSize, grantBytes, grantsPerTti);
+    Simulator::Stop(Seconds(simTime));
+
+    auto start = std::chrono::steady_clock::now();
+    Simulator::Run();
+    auto end = std::chrono::steady_clock::now();
+    double wallSeconds = std::chrono::duration<double>(end - start).count();
+
+    std::cout << argv[0] << ": " << (lowLat ? "LteRlcUmLowLat" : "LteRlcUm") << std::endl;
+    std::cout << "  PDUs: " << mac.GetPdus() << ", SDUs delivered: " << sink.m_sdus << std::endl;
+    std::cout << "  simulated goodput: " << sink.m_bytes * 8 / simTime / 1e6 << " Mbps"
+              << std::endl;
+    std::cout << "  wall time: " << wallSeconds << " s, " << mac.GetPdus() / wallSeconds
+              << " PDUs/s" << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}